@@ -142,6 +142,38 @@ QByteArray CRawStream::readBytes(int count)
     return result;
 }
 
+QByteArray CRawStream::readBytesInPlace(int count)
+{
+    const char *data = peekBytes(count);
+    if (!data) {
+        return readBytes(count);
+    }
+    m_device->seek(m_device->pos() + count);
+    return QByteArray::fromRawData(data, count);
+}
+
+void CRawStream::skipBytes(int count)
+{
+    if (count > bytesAvailable()) {
+        m_error = true;
+        return;
+    }
+    if (m_device->isSequential()) {
+        m_device->read(count);
+    } else {
+        m_device->seek(m_device->pos() + count);
+    }
+}
+
+const char *CRawStream::peekBytes(int count) const
+{
+    const QBuffer *buffer = qobject_cast<const QBuffer*>(m_device);
+    if (!buffer || (count > bytesAvailable())) {
+        return nullptr;
+    }
+    return buffer->data().constData() + buffer->pos();
+}
+
 CRawStream &CRawStream::operator>>(qint8 &i)
 {
     return protectedRead(i);
@@ -55,6 +55,12 @@ public:
 
     bool writeBytes(const QByteArray &bytes);
     QByteArray readBytes(int count);
+    // Same as readBytes(), but refers to the data of an in-memory buffer instead of a copy.
+    // The result is valid only as long as the stream data is alive.
+    QByteArray readBytesInPlace(int count);
+    void skipBytes(int count);
+    // The next count bytes of an in-memory buffer (without reading them) or nullptr
+    const char *peekBytes(int count) const;
 
     QByteArray readAll();
 
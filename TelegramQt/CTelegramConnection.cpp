@@ -54,6 +54,7 @@ using namespace TelegramUtils;
 using namespace Telegram;
 
 static const quint32 s_defaultAuthInterval = 15000; // 15 sec
+static const int s_maxReceiveBufferCapacity = 1024 * 1024; // Do not keep the buffer of a huge package (e.g. a file part)
 
 CTelegramConnection::CTelegramConnection(const CAppInformation *appInfo, QObject *parent) :
     QObject(parent),
@@ -226,21 +227,22 @@ quint64 CTelegramConnection::signUp(const QString &phoneNumber, const QString &a
 
 void CTelegramConnection::downloadFile(const TLInputFileLocation &inputLocation, quint32 offset, quint32 limit, quint32 requestId)
 {
-    if (m_requestedFilesIds.contains(requestId)) {
-        // Prevent from (really possible) repeated request.
-        return;
-    }
-
+    // There can be several chunk requests of the same file in flight
     const quint64 messageId = uploadGetFile(inputLocation, offset, limit);
     qDebug() << Q_FUNC_INFO << messageId << "offset:" << offset << "limit:" << limit << "request:" << requestId;
 
     m_requestedFilesIds.insert(messageId, requestId);
 }
 
-void CTelegramConnection::uploadFile(quint64 fileId, quint32 filePart, const QByteArray &bytes, quint32 requestId)
+void CTelegramConnection::uploadFile(quint64 fileId, quint32 filePart, quint32 fileTotalParts, const QByteArray &bytes, quint32 requestId)
 {
     qDebug() << Q_FUNC_INFO << "id" << fileId << "part" << filePart << "size" << bytes.count() << "request" << requestId;
-    const quint64 messageId = uploadSaveFilePart(fileId, filePart, bytes);
+    quint64 messageId = 0;
+    if (fileTotalParts) {
+        messageId = uploadSaveBigFilePart(fileId, filePart, fileTotalParts, bytes);
+    } else {
+        messageId = uploadSaveFilePart(fileId, filePart, bytes);
+    }
 
     m_requestedFilesIds.insert(messageId, requestId);
 }
@@ -267,7 +269,12 @@ quint64 CTelegramConnection::sendMedia(const TLInputPeer &peer, const TLInputMed
 // Generated Telegram API methods implementation
 quint64 CTelegramConnection::accountChangePhone(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode)
 {
+    quint32 size = 4; // TLValue::AccountChangePhone
+    size += tlEncodedSize(phoneNumber);
+    size += tlEncodedSize(phoneCodeHash);
+    size += tlEncodedSize(phoneCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountChangePhone;
     outputStream << phoneNumber;
@@ -278,7 +285,10 @@ quint64 CTelegramConnection::accountChangePhone(const QString &phoneNumber, cons
 
 quint64 CTelegramConnection::accountCheckUsername(const QString &username)
 {
+    quint32 size = 4; // TLValue::AccountCheckUsername
+    size += tlEncodedSize(username);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountCheckUsername;
     outputStream << username;
@@ -287,7 +297,10 @@ quint64 CTelegramConnection::accountCheckUsername(const QString &username)
 
 quint64 CTelegramConnection::accountDeleteAccount(const QString &reason)
 {
+    quint32 size = 4; // TLValue::AccountDeleteAccount
+    size += tlEncodedSize(reason);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountDeleteAccount;
     outputStream << reason;
@@ -296,7 +309,9 @@ quint64 CTelegramConnection::accountDeleteAccount(const QString &reason)
 
 quint64 CTelegramConnection::accountGetAccountTTL()
 {
+    quint32 size = 4; // TLValue::AccountGetAccountTTL
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountGetAccountTTL;
     return sendEncryptedPackage(output);
@@ -304,7 +319,9 @@ quint64 CTelegramConnection::accountGetAccountTTL()
 
 quint64 CTelegramConnection::accountGetAuthorizations()
 {
+    quint32 size = 4; // TLValue::AccountGetAuthorizations
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountGetAuthorizations;
     return sendEncryptedPackage(output);
@@ -312,7 +329,10 @@ quint64 CTelegramConnection::accountGetAuthorizations()
 
 quint64 CTelegramConnection::accountGetNotifySettings(const TLInputNotifyPeer &peer)
 {
+    quint32 size = 4; // TLValue::AccountGetNotifySettings
+    size += tlEncodedSize(peer);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountGetNotifySettings;
     outputStream << peer;
@@ -321,7 +341,9 @@ quint64 CTelegramConnection::accountGetNotifySettings(const TLInputNotifyPeer &p
 
 quint64 CTelegramConnection::accountGetPassword()
 {
+    quint32 size = 4; // TLValue::AccountGetPassword
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountGetPassword;
     return sendEncryptedPackage(output);
@@ -329,7 +351,10 @@ quint64 CTelegramConnection::accountGetPassword()
 
 quint64 CTelegramConnection::accountGetPasswordSettings(const QByteArray &currentPasswordHash)
 {
+    quint32 size = 4; // TLValue::AccountGetPasswordSettings
+    size += tlEncodedSize(currentPasswordHash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountGetPasswordSettings;
     outputStream << currentPasswordHash;
@@ -338,7 +363,10 @@ quint64 CTelegramConnection::accountGetPasswordSettings(const QByteArray &curren
 
 quint64 CTelegramConnection::accountGetPrivacy(const TLInputPrivacyKey &key)
 {
+    quint32 size = 4; // TLValue::AccountGetPrivacy
+    size += tlEncodedSize(key);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountGetPrivacy;
     outputStream << key;
@@ -347,7 +375,9 @@ quint64 CTelegramConnection::accountGetPrivacy(const TLInputPrivacyKey &key)
 
 quint64 CTelegramConnection::accountGetWallPapers()
 {
+    quint32 size = 4; // TLValue::AccountGetWallPapers
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountGetWallPapers;
     return sendEncryptedPackage(output);
@@ -355,7 +385,16 @@ quint64 CTelegramConnection::accountGetWallPapers()
 
 quint64 CTelegramConnection::accountRegisterDevice(quint32 tokenType, const QString &token, const QString &deviceModel, const QString &systemVersion, const QString &appVersion, bool appSandbox, const QString &langCode)
 {
+    quint32 size = 4; // TLValue::AccountRegisterDevice
+    size += tlEncodedSize(tokenType);
+    size += tlEncodedSize(token);
+    size += tlEncodedSize(deviceModel);
+    size += tlEncodedSize(systemVersion);
+    size += tlEncodedSize(appVersion);
+    size += tlEncodedSize(appSandbox);
+    size += tlEncodedSize(langCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountRegisterDevice;
     outputStream << tokenType;
@@ -370,7 +409,11 @@ quint64 CTelegramConnection::accountRegisterDevice(quint32 tokenType, const QStr
 
 quint64 CTelegramConnection::accountReportPeer(const TLInputPeer &peer, const TLReportReason &reason)
 {
+    quint32 size = 4; // TLValue::AccountReportPeer
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(reason);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountReportPeer;
     outputStream << peer;
@@ -380,7 +423,10 @@ quint64 CTelegramConnection::accountReportPeer(const TLInputPeer &peer, const TL
 
 quint64 CTelegramConnection::accountResetAuthorization(quint64 hash)
 {
+    quint32 size = 4; // TLValue::AccountResetAuthorization
+    size += tlEncodedSize(hash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountResetAuthorization;
     outputStream << hash;
@@ -389,7 +435,9 @@ quint64 CTelegramConnection::accountResetAuthorization(quint64 hash)
 
 quint64 CTelegramConnection::accountResetNotifySettings()
 {
+    quint32 size = 4; // TLValue::AccountResetNotifySettings
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountResetNotifySettings;
     return sendEncryptedPackage(output);
@@ -397,7 +445,10 @@ quint64 CTelegramConnection::accountResetNotifySettings()
 
 quint64 CTelegramConnection::accountSendChangePhoneCode(const QString &phoneNumber)
 {
+    quint32 size = 4; // TLValue::AccountSendChangePhoneCode
+    size += tlEncodedSize(phoneNumber);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountSendChangePhoneCode;
     outputStream << phoneNumber;
@@ -406,7 +457,10 @@ quint64 CTelegramConnection::accountSendChangePhoneCode(const QString &phoneNumb
 
 quint64 CTelegramConnection::accountSetAccountTTL(const TLAccountDaysTTL &ttl)
 {
+    quint32 size = 4; // TLValue::AccountSetAccountTTL
+    size += tlEncodedSize(ttl);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountSetAccountTTL;
     outputStream << ttl;
@@ -415,7 +469,11 @@ quint64 CTelegramConnection::accountSetAccountTTL(const TLAccountDaysTTL &ttl)
 
 quint64 CTelegramConnection::accountSetPrivacy(const TLInputPrivacyKey &key, const TLVector<TLInputPrivacyRule> &rules)
 {
+    quint32 size = 4; // TLValue::AccountSetPrivacy
+    size += tlEncodedSize(key);
+    size += tlEncodedSize(rules);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountSetPrivacy;
     outputStream << key;
@@ -425,7 +483,11 @@ quint64 CTelegramConnection::accountSetPrivacy(const TLInputPrivacyKey &key, con
 
 quint64 CTelegramConnection::accountUnregisterDevice(quint32 tokenType, const QString &token)
 {
+    quint32 size = 4; // TLValue::AccountUnregisterDevice
+    size += tlEncodedSize(tokenType);
+    size += tlEncodedSize(token);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountUnregisterDevice;
     outputStream << tokenType;
@@ -435,7 +497,10 @@ quint64 CTelegramConnection::accountUnregisterDevice(quint32 tokenType, const QS
 
 quint64 CTelegramConnection::accountUpdateDeviceLocked(quint32 period)
 {
+    quint32 size = 4; // TLValue::AccountUpdateDeviceLocked
+    size += tlEncodedSize(period);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountUpdateDeviceLocked;
     outputStream << period;
@@ -444,7 +509,11 @@ quint64 CTelegramConnection::accountUpdateDeviceLocked(quint32 period)
 
 quint64 CTelegramConnection::accountUpdateNotifySettings(const TLInputNotifyPeer &peer, const TLInputPeerNotifySettings &settings)
 {
+    quint32 size = 4; // TLValue::AccountUpdateNotifySettings
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(settings);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountUpdateNotifySettings;
     outputStream << peer;
@@ -454,7 +523,11 @@ quint64 CTelegramConnection::accountUpdateNotifySettings(const TLInputNotifyPeer
 
 quint64 CTelegramConnection::accountUpdatePasswordSettings(const QByteArray &currentPasswordHash, const TLAccountPasswordInputSettings &newSettings)
 {
+    quint32 size = 4; // TLValue::AccountUpdatePasswordSettings
+    size += tlEncodedSize(currentPasswordHash);
+    size += tlEncodedSize(newSettings);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountUpdatePasswordSettings;
     outputStream << currentPasswordHash;
@@ -464,7 +537,11 @@ quint64 CTelegramConnection::accountUpdatePasswordSettings(const QByteArray &cur
 
 quint64 CTelegramConnection::accountUpdateProfile(const QString &firstName, const QString &lastName)
 {
+    quint32 size = 4; // TLValue::AccountUpdateProfile
+    size += tlEncodedSize(firstName);
+    size += tlEncodedSize(lastName);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountUpdateProfile;
     outputStream << firstName;
@@ -474,7 +551,10 @@ quint64 CTelegramConnection::accountUpdateProfile(const QString &firstName, cons
 
 quint64 CTelegramConnection::accountUpdateStatus(bool offline)
 {
+    quint32 size = 4; // TLValue::AccountUpdateStatus
+    size += tlEncodedSize(offline);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountUpdateStatus;
     outputStream << offline;
@@ -483,7 +563,10 @@ quint64 CTelegramConnection::accountUpdateStatus(bool offline)
 
 quint64 CTelegramConnection::accountUpdateUsername(const QString &username)
 {
+    quint32 size = 4; // TLValue::AccountUpdateUsername
+    size += tlEncodedSize(username);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AccountUpdateUsername;
     outputStream << username;
@@ -492,7 +575,13 @@ quint64 CTelegramConnection::accountUpdateUsername(const QString &username)
 
 quint64 CTelegramConnection::authBindTempAuthKey(quint64 permAuthKeyId, quint64 nonce, quint32 expiresAt, const QByteArray &encryptedMessage)
 {
+    quint32 size = 4; // TLValue::AuthBindTempAuthKey
+    size += tlEncodedSize(permAuthKeyId);
+    size += tlEncodedSize(nonce);
+    size += tlEncodedSize(expiresAt);
+    size += tlEncodedSize(encryptedMessage);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthBindTempAuthKey;
     outputStream << permAuthKeyId;
@@ -504,7 +593,10 @@ quint64 CTelegramConnection::authBindTempAuthKey(quint64 permAuthKeyId, quint64
 
 quint64 CTelegramConnection::authCheckPassword(const QByteArray &passwordHash)
 {
+    quint32 size = 4; // TLValue::AuthCheckPassword
+    size += tlEncodedSize(passwordHash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthCheckPassword;
     outputStream << passwordHash;
@@ -513,7 +605,10 @@ quint64 CTelegramConnection::authCheckPassword(const QByteArray &passwordHash)
 
 quint64 CTelegramConnection::authCheckPhone(const QString &phoneNumber)
 {
+    quint32 size = 4; // TLValue::AuthCheckPhone
+    size += tlEncodedSize(phoneNumber);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthCheckPhone;
     outputStream << phoneNumber;
@@ -522,7 +617,10 @@ quint64 CTelegramConnection::authCheckPhone(const QString &phoneNumber)
 
 quint64 CTelegramConnection::authExportAuthorization(quint32 dcId)
 {
+    quint32 size = 4; // TLValue::AuthExportAuthorization
+    size += tlEncodedSize(dcId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthExportAuthorization;
     outputStream << dcId;
@@ -531,7 +629,11 @@ quint64 CTelegramConnection::authExportAuthorization(quint32 dcId)
 
 quint64 CTelegramConnection::authImportAuthorization(quint32 id, const QByteArray &bytes)
 {
+    quint32 size = 4; // TLValue::AuthImportAuthorization
+    size += tlEncodedSize(id);
+    size += tlEncodedSize(bytes);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthImportAuthorization;
     outputStream << id;
@@ -541,7 +643,13 @@ quint64 CTelegramConnection::authImportAuthorization(quint32 id, const QByteArra
 
 quint64 CTelegramConnection::authImportBotAuthorization(quint32 flags, quint32 apiId, const QString &apiHash, const QString &botAuthToken)
 {
+    quint32 size = 4; // TLValue::AuthImportBotAuthorization
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(apiId);
+    size += tlEncodedSize(apiHash);
+    size += tlEncodedSize(botAuthToken);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthImportBotAuthorization;
     outputStream << flags;
@@ -553,7 +661,9 @@ quint64 CTelegramConnection::authImportBotAuthorization(quint32 flags, quint32 a
 
 quint64 CTelegramConnection::authLogOut()
 {
+    quint32 size = 4; // TLValue::AuthLogOut
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthLogOut;
     return sendEncryptedPackage(output);
@@ -561,7 +671,10 @@ quint64 CTelegramConnection::authLogOut()
 
 quint64 CTelegramConnection::authRecoverPassword(const QString &code)
 {
+    quint32 size = 4; // TLValue::AuthRecoverPassword
+    size += tlEncodedSize(code);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthRecoverPassword;
     outputStream << code;
@@ -570,7 +683,9 @@ quint64 CTelegramConnection::authRecoverPassword(const QString &code)
 
 quint64 CTelegramConnection::authRequestPasswordRecovery()
 {
+    quint32 size = 4; // TLValue::AuthRequestPasswordRecovery
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthRequestPasswordRecovery;
     return sendEncryptedPackage(output);
@@ -578,7 +693,9 @@ quint64 CTelegramConnection::authRequestPasswordRecovery()
 
 quint64 CTelegramConnection::authResetAuthorizations()
 {
+    quint32 size = 4; // TLValue::AuthResetAuthorizations
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthResetAuthorizations;
     return sendEncryptedPackage(output);
@@ -586,7 +703,11 @@ quint64 CTelegramConnection::authResetAuthorizations()
 
 quint64 CTelegramConnection::authSendCall(const QString &phoneNumber, const QString &phoneCodeHash)
 {
+    quint32 size = 4; // TLValue::AuthSendCall
+    size += tlEncodedSize(phoneNumber);
+    size += tlEncodedSize(phoneCodeHash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthSendCall;
     outputStream << phoneNumber;
@@ -596,7 +717,14 @@ quint64 CTelegramConnection::authSendCall(const QString &phoneNumber, const QStr
 
 quint64 CTelegramConnection::authSendCode(const QString &phoneNumber, quint32 smsType, quint32 apiId, const QString &apiHash, const QString &langCode)
 {
+    quint32 size = 4; // TLValue::AuthSendCode
+    size += tlEncodedSize(phoneNumber);
+    size += tlEncodedSize(smsType);
+    size += tlEncodedSize(apiId);
+    size += tlEncodedSize(apiHash);
+    size += tlEncodedSize(langCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthSendCode;
     outputStream << phoneNumber;
@@ -609,7 +737,11 @@ quint64 CTelegramConnection::authSendCode(const QString &phoneNumber, quint32 sm
 
 quint64 CTelegramConnection::authSendInvites(const TLVector<QString> &phoneNumbers, const QString &message)
 {
+    quint32 size = 4; // TLValue::AuthSendInvites
+    size += tlEncodedSize(phoneNumbers);
+    size += tlEncodedSize(message);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthSendInvites;
     outputStream << phoneNumbers;
@@ -619,7 +751,11 @@ quint64 CTelegramConnection::authSendInvites(const TLVector<QString> &phoneNumbe
 
 quint64 CTelegramConnection::authSendSms(const QString &phoneNumber, const QString &phoneCodeHash)
 {
+    quint32 size = 4; // TLValue::AuthSendSms
+    size += tlEncodedSize(phoneNumber);
+    size += tlEncodedSize(phoneCodeHash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthSendSms;
     outputStream << phoneNumber;
@@ -629,7 +765,12 @@ quint64 CTelegramConnection::authSendSms(const QString &phoneNumber, const QStri
 
 quint64 CTelegramConnection::authSignIn(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode)
 {
+    quint32 size = 4; // TLValue::AuthSignIn
+    size += tlEncodedSize(phoneNumber);
+    size += tlEncodedSize(phoneCodeHash);
+    size += tlEncodedSize(phoneCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthSignIn;
     outputStream << phoneNumber;
@@ -640,7 +781,14 @@ quint64 CTelegramConnection::authSignIn(const QString &phoneNumber, const QStrin
 
 quint64 CTelegramConnection::authSignUp(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode, const QString &firstName, const QString &lastName)
 {
+    quint32 size = 4; // TLValue::AuthSignUp
+    size += tlEncodedSize(phoneNumber);
+    size += tlEncodedSize(phoneCodeHash);
+    size += tlEncodedSize(phoneCode);
+    size += tlEncodedSize(firstName);
+    size += tlEncodedSize(lastName);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::AuthSignUp;
     outputStream << phoneNumber;
@@ -653,7 +801,11 @@ quint64 CTelegramConnection::authSignUp(const QString &phoneNumber, const QStrin
 
 quint64 CTelegramConnection::channelsCheckUsername(const TLInputChannel &channel, const QString &username)
 {
+    quint32 size = 4; // TLValue::ChannelsCheckUsername
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(username);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsCheckUsername;
     outputStream << channel;
@@ -663,7 +815,12 @@ quint64 CTelegramConnection::channelsCheckUsername(const TLInputChannel &channel
 
 quint64 CTelegramConnection::channelsCreateChannel(quint32 flags, const QString &title, const QString &about)
 {
+    quint32 size = 4; // TLValue::ChannelsCreateChannel
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(title);
+    size += tlEncodedSize(about);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsCreateChannel;
     outputStream << flags;
@@ -676,7 +833,10 @@ quint64 CTelegramConnection::channelsCreateChannel(quint32 flags, const QString
 
 quint64 CTelegramConnection::channelsDeleteChannel(const TLInputChannel &channel)
 {
+    quint32 size = 4; // TLValue::ChannelsDeleteChannel
+    size += tlEncodedSize(channel);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsDeleteChannel;
     outputStream << channel;
@@ -685,7 +845,11 @@ quint64 CTelegramConnection::channelsDeleteChannel(const TLInputChannel &channel
 
 quint64 CTelegramConnection::channelsDeleteMessages(const TLInputChannel &channel, const TLVector<quint32> &id)
 {
+    quint32 size = 4; // TLValue::ChannelsDeleteMessages
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsDeleteMessages;
     outputStream << channel;
@@ -695,7 +859,11 @@ quint64 CTelegramConnection::channelsDeleteMessages(const TLInputChannel &channe
 
 quint64 CTelegramConnection::channelsDeleteUserHistory(const TLInputChannel &channel, const TLInputUser &userId)
 {
+    quint32 size = 4; // TLValue::ChannelsDeleteUserHistory
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(userId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsDeleteUserHistory;
     outputStream << channel;
@@ -705,7 +873,11 @@ quint64 CTelegramConnection::channelsDeleteUserHistory(const TLInputChannel &cha
 
 quint64 CTelegramConnection::channelsEditAbout(const TLInputChannel &channel, const QString &about)
 {
+    quint32 size = 4; // TLValue::ChannelsEditAbout
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(about);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsEditAbout;
     outputStream << channel;
@@ -715,7 +887,12 @@ quint64 CTelegramConnection::channelsEditAbout(const TLInputChannel &channel, co
 
 quint64 CTelegramConnection::channelsEditAdmin(const TLInputChannel &channel, const TLInputUser &userId, const TLChannelParticipantRole &role)
 {
+    quint32 size = 4; // TLValue::ChannelsEditAdmin
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(userId);
+    size += tlEncodedSize(role);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsEditAdmin;
     outputStream << channel;
@@ -726,7 +903,11 @@ quint64 CTelegramConnection::channelsEditAdmin(const TLInputChannel &channel, co
 
 quint64 CTelegramConnection::channelsEditPhoto(const TLInputChannel &channel, const TLInputChatPhoto &photo)
 {
+    quint32 size = 4; // TLValue::ChannelsEditPhoto
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(photo);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsEditPhoto;
     outputStream << channel;
@@ -736,7 +917,11 @@ quint64 CTelegramConnection::channelsEditPhoto(const TLInputChannel &channel, co
 
 quint64 CTelegramConnection::channelsEditTitle(const TLInputChannel &channel, const QString &title)
 {
+    quint32 size = 4; // TLValue::ChannelsEditTitle
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(title);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsEditTitle;
     outputStream << channel;
@@ -746,7 +931,10 @@ quint64 CTelegramConnection::channelsEditTitle(const TLInputChannel &channel, co
 
 quint64 CTelegramConnection::channelsExportInvite(const TLInputChannel &channel)
 {
+    quint32 size = 4; // TLValue::ChannelsExportInvite
+    size += tlEncodedSize(channel);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsExportInvite;
     outputStream << channel;
@@ -755,7 +943,10 @@ quint64 CTelegramConnection::channelsExportInvite(const TLInputChannel &channel)
 
 quint64 CTelegramConnection::channelsGetChannels(const TLVector<TLInputChannel> &id)
 {
+    quint32 size = 4; // TLValue::ChannelsGetChannels
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsGetChannels;
     outputStream << id;
@@ -764,7 +955,11 @@ quint64 CTelegramConnection::channelsGetChannels(const TLVector<TLInputChannel>
 
 quint64 CTelegramConnection::channelsGetDialogs(quint32 offset, quint32 limit)
 {
+    quint32 size = 4; // TLValue::ChannelsGetDialogs
+    size += tlEncodedSize(offset);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsGetDialogs;
     outputStream << offset;
@@ -774,7 +969,10 @@ quint64 CTelegramConnection::channelsGetDialogs(quint32 offset, quint32 limit)
 
 quint64 CTelegramConnection::channelsGetFullChannel(const TLInputChannel &channel)
 {
+    quint32 size = 4; // TLValue::ChannelsGetFullChannel
+    size += tlEncodedSize(channel);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsGetFullChannel;
     outputStream << channel;
@@ -783,7 +981,15 @@ quint64 CTelegramConnection::channelsGetFullChannel(const TLInputChannel &channe
 
 quint64 CTelegramConnection::channelsGetImportantHistory(const TLInputChannel &channel, quint32 offsetId, quint32 addOffset, quint32 limit, quint32 maxId, quint32 minId)
 {
+    quint32 size = 4; // TLValue::ChannelsGetImportantHistory
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(offsetId);
+    size += tlEncodedSize(addOffset);
+    size += tlEncodedSize(limit);
+    size += tlEncodedSize(maxId);
+    size += tlEncodedSize(minId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsGetImportantHistory;
     outputStream << channel;
@@ -797,7 +1003,11 @@ quint64 CTelegramConnection::channelsGetImportantHistory(const TLInputChannel &c
 
 quint64 CTelegramConnection::channelsGetMessages(const TLInputChannel &channel, const TLVector<quint32> &id)
 {
+    quint32 size = 4; // TLValue::ChannelsGetMessages
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsGetMessages;
     outputStream << channel;
@@ -807,7 +1017,11 @@ quint64 CTelegramConnection::channelsGetMessages(const TLInputChannel &channel,
 
 quint64 CTelegramConnection::channelsGetParticipant(const TLInputChannel &channel, const TLInputUser &userId)
 {
+    quint32 size = 4; // TLValue::ChannelsGetParticipant
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(userId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsGetParticipant;
     outputStream << channel;
@@ -817,7 +1031,13 @@ quint64 CTelegramConnection::channelsGetParticipant(const TLInputChannel &channe
 
 quint64 CTelegramConnection::channelsGetParticipants(const TLInputChannel &channel, const TLChannelParticipantsFilter &filter, quint32 offset, quint32 limit)
 {
+    quint32 size = 4; // TLValue::ChannelsGetParticipants
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(filter);
+    size += tlEncodedSize(offset);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsGetParticipants;
     outputStream << channel;
@@ -829,7 +1049,11 @@ quint64 CTelegramConnection::channelsGetParticipants(const TLInputChannel &chann
 
 quint64 CTelegramConnection::channelsInviteToChannel(const TLInputChannel &channel, const TLVector<TLInputUser> &users)
 {
+    quint32 size = 4; // TLValue::ChannelsInviteToChannel
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(users);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsInviteToChannel;
     outputStream << channel;
@@ -839,7 +1063,10 @@ quint64 CTelegramConnection::channelsInviteToChannel(const TLInputChannel &chann
 
 quint64 CTelegramConnection::channelsJoinChannel(const TLInputChannel &channel)
 {
+    quint32 size = 4; // TLValue::ChannelsJoinChannel
+    size += tlEncodedSize(channel);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsJoinChannel;
     outputStream << channel;
@@ -848,7 +1075,12 @@ quint64 CTelegramConnection::channelsJoinChannel(const TLInputChannel &channel)
 
 quint64 CTelegramConnection::channelsKickFromChannel(const TLInputChannel &channel, const TLInputUser &userId, bool kicked)
 {
+    quint32 size = 4; // TLValue::ChannelsKickFromChannel
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(userId);
+    size += tlEncodedSize(kicked);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsKickFromChannel;
     outputStream << channel;
@@ -859,7 +1091,10 @@ quint64 CTelegramConnection::channelsKickFromChannel(const TLInputChannel &chann
 
 quint64 CTelegramConnection::channelsLeaveChannel(const TLInputChannel &channel)
 {
+    quint32 size = 4; // TLValue::ChannelsLeaveChannel
+    size += tlEncodedSize(channel);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsLeaveChannel;
     outputStream << channel;
@@ -868,7 +1103,11 @@ quint64 CTelegramConnection::channelsLeaveChannel(const TLInputChannel &channel)
 
 quint64 CTelegramConnection::channelsReadHistory(const TLInputChannel &channel, quint32 maxId)
 {
+    quint32 size = 4; // TLValue::ChannelsReadHistory
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(maxId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsReadHistory;
     outputStream << channel;
@@ -878,7 +1117,12 @@ quint64 CTelegramConnection::channelsReadHistory(const TLInputChannel &channel,
 
 quint64 CTelegramConnection::channelsReportSpam(const TLInputChannel &channel, const TLInputUser &userId, const TLVector<quint32> &id)
 {
+    quint32 size = 4; // TLValue::ChannelsReportSpam
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(userId);
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsReportSpam;
     outputStream << channel;
@@ -889,7 +1133,11 @@ quint64 CTelegramConnection::channelsReportSpam(const TLInputChannel &channel, c
 
 quint64 CTelegramConnection::channelsToggleComments(const TLInputChannel &channel, bool enabled)
 {
+    quint32 size = 4; // TLValue::ChannelsToggleComments
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(enabled);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsToggleComments;
     outputStream << channel;
@@ -899,7 +1147,11 @@ quint64 CTelegramConnection::channelsToggleComments(const TLInputChannel &channe
 
 quint64 CTelegramConnection::channelsUpdateUsername(const TLInputChannel &channel, const QString &username)
 {
+    quint32 size = 4; // TLValue::ChannelsUpdateUsername
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(username);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ChannelsUpdateUsername;
     outputStream << channel;
@@ -909,7 +1161,10 @@ quint64 CTelegramConnection::channelsUpdateUsername(const TLInputChannel &channe
 
 quint64 CTelegramConnection::contactsBlock(const TLInputUser &id)
 {
+    quint32 size = 4; // TLValue::ContactsBlock
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsBlock;
     outputStream << id;
@@ -918,7 +1173,10 @@ quint64 CTelegramConnection::contactsBlock(const TLInputUser &id)
 
 quint64 CTelegramConnection::contactsDeleteContact(const TLInputUser &id)
 {
+    quint32 size = 4; // TLValue::ContactsDeleteContact
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsDeleteContact;
     outputStream << id;
@@ -927,7 +1185,10 @@ quint64 CTelegramConnection::contactsDeleteContact(const TLInputUser &id)
 
 quint64 CTelegramConnection::contactsDeleteContacts(const TLVector<TLInputUser> &id)
 {
+    quint32 size = 4; // TLValue::ContactsDeleteContacts
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsDeleteContacts;
     outputStream << id;
@@ -936,7 +1197,9 @@ quint64 CTelegramConnection::contactsDeleteContacts(const TLVector<TLInputUser>
 
 quint64 CTelegramConnection::contactsExportCard()
 {
+    quint32 size = 4; // TLValue::ContactsExportCard
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsExportCard;
     return sendEncryptedPackage(output);
@@ -944,7 +1207,11 @@ quint64 CTelegramConnection::contactsExportCard()
 
 quint64 CTelegramConnection::contactsGetBlocked(quint32 offset, quint32 limit)
 {
+    quint32 size = 4; // TLValue::ContactsGetBlocked
+    size += tlEncodedSize(offset);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsGetBlocked;
     outputStream << offset;
@@ -954,7 +1221,10 @@ quint64 CTelegramConnection::contactsGetBlocked(quint32 offset, quint32 limit)
 
 quint64 CTelegramConnection::contactsGetContacts(const QString &hash)
 {
+    quint32 size = 4; // TLValue::ContactsGetContacts
+    size += tlEncodedSize(hash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsGetContacts;
     outputStream << hash;
@@ -963,7 +1233,9 @@ quint64 CTelegramConnection::contactsGetContacts(const QString &hash)
 
 quint64 CTelegramConnection::contactsGetStatuses()
 {
+    quint32 size = 4; // TLValue::ContactsGetStatuses
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsGetStatuses;
     return sendEncryptedPackage(output);
@@ -971,7 +1243,10 @@ quint64 CTelegramConnection::contactsGetStatuses()
 
 quint64 CTelegramConnection::contactsGetSuggested(quint32 limit)
 {
+    quint32 size = 4; // TLValue::ContactsGetSuggested
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsGetSuggested;
     outputStream << limit;
@@ -980,7 +1255,10 @@ quint64 CTelegramConnection::contactsGetSuggested(quint32 limit)
 
 quint64 CTelegramConnection::contactsImportCard(const TLVector<quint32> &exportCard)
 {
+    quint32 size = 4; // TLValue::ContactsImportCard
+    size += tlEncodedSize(exportCard);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsImportCard;
     outputStream << exportCard;
@@ -989,7 +1267,11 @@ quint64 CTelegramConnection::contactsImportCard(const TLVector<quint32> &exportC
 
 quint64 CTelegramConnection::contactsImportContacts(const TLVector<TLInputContact> &contacts, bool replace)
 {
+    quint32 size = 4; // TLValue::ContactsImportContacts
+    size += tlEncodedSize(contacts);
+    size += tlEncodedSize(replace);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsImportContacts;
     outputStream << contacts;
@@ -999,7 +1281,10 @@ quint64 CTelegramConnection::contactsImportContacts(const TLVector<TLInputContac
 
 quint64 CTelegramConnection::contactsResolveUsername(const QString &username)
 {
+    quint32 size = 4; // TLValue::ContactsResolveUsername
+    size += tlEncodedSize(username);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsResolveUsername;
     outputStream << username;
@@ -1008,7 +1293,11 @@ quint64 CTelegramConnection::contactsResolveUsername(const QString &username)
 
 quint64 CTelegramConnection::contactsSearch(const QString &q, quint32 limit)
 {
+    quint32 size = 4; // TLValue::ContactsSearch
+    size += tlEncodedSize(q);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsSearch;
     outputStream << q;
@@ -1018,7 +1307,10 @@ quint64 CTelegramConnection::contactsSearch(const QString &q, quint32 limit)
 
 quint64 CTelegramConnection::contactsUnblock(const TLInputUser &id)
 {
+    quint32 size = 4; // TLValue::ContactsUnblock
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::ContactsUnblock;
     outputStream << id;
@@ -1027,7 +1319,13 @@ quint64 CTelegramConnection::contactsUnblock(const TLInputUser &id)
 
 quint64 CTelegramConnection::helpGetAppChangelog(const QString &deviceModel, const QString &systemVersion, const QString &appVersion, const QString &langCode)
 {
+    quint32 size = 4; // TLValue::HelpGetAppChangelog
+    size += tlEncodedSize(deviceModel);
+    size += tlEncodedSize(systemVersion);
+    size += tlEncodedSize(appVersion);
+    size += tlEncodedSize(langCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpGetAppChangelog;
     outputStream << deviceModel;
@@ -1039,7 +1337,13 @@ quint64 CTelegramConnection::helpGetAppChangelog(const QString &deviceModel, con
 
 quint64 CTelegramConnection::helpGetAppUpdate(const QString &deviceModel, const QString &systemVersion, const QString &appVersion, const QString &langCode)
 {
+    quint32 size = 4; // TLValue::HelpGetAppUpdate
+    size += tlEncodedSize(deviceModel);
+    size += tlEncodedSize(systemVersion);
+    size += tlEncodedSize(appVersion);
+    size += tlEncodedSize(langCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpGetAppUpdate;
     outputStream << deviceModel;
@@ -1051,7 +1355,9 @@ quint64 CTelegramConnection::helpGetAppUpdate(const QString &deviceModel, const
 
 quint64 CTelegramConnection::helpGetConfig()
 {
+    quint32 size = 4; // TLValue::HelpGetConfig
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpGetConfig;
     return sendEncryptedPackage(output);
@@ -1059,7 +1365,10 @@ quint64 CTelegramConnection::helpGetConfig()
 
 quint64 CTelegramConnection::helpGetInviteText(const QString &langCode)
 {
+    quint32 size = 4; // TLValue::HelpGetInviteText
+    size += tlEncodedSize(langCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpGetInviteText;
     outputStream << langCode;
@@ -1068,7 +1377,9 @@ quint64 CTelegramConnection::helpGetInviteText(const QString &langCode)
 
 quint64 CTelegramConnection::helpGetNearestDc()
 {
+    quint32 size = 4; // TLValue::HelpGetNearestDc
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpGetNearestDc;
     return sendEncryptedPackage(output);
@@ -1076,7 +1387,9 @@ quint64 CTelegramConnection::helpGetNearestDc()
 
 quint64 CTelegramConnection::helpGetSupport()
 {
+    quint32 size = 4; // TLValue::HelpGetSupport
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpGetSupport;
     return sendEncryptedPackage(output);
@@ -1084,7 +1397,10 @@ quint64 CTelegramConnection::helpGetSupport()
 
 quint64 CTelegramConnection::helpGetTermsOfService(const QString &langCode)
 {
+    quint32 size = 4; // TLValue::HelpGetTermsOfService
+    size += tlEncodedSize(langCode);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpGetTermsOfService;
     outputStream << langCode;
@@ -1093,7 +1409,10 @@ quint64 CTelegramConnection::helpGetTermsOfService(const QString &langCode)
 
 quint64 CTelegramConnection::helpSaveAppLog(const TLVector<TLInputAppEvent> &events)
 {
+    quint32 size = 4; // TLValue::HelpSaveAppLog
+    size += tlEncodedSize(events);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::HelpSaveAppLog;
     outputStream << events;
@@ -1102,7 +1421,12 @@ quint64 CTelegramConnection::helpSaveAppLog(const TLVector<TLInputAppEvent> &eve
 
 quint64 CTelegramConnection::messagesAcceptEncryption(const TLInputEncryptedChat &peer, const QByteArray &gB, quint64 keyFingerprint)
 {
+    quint32 size = 4; // TLValue::MessagesAcceptEncryption
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(gB);
+    size += tlEncodedSize(keyFingerprint);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesAcceptEncryption;
     outputStream << peer;
@@ -1113,7 +1437,12 @@ quint64 CTelegramConnection::messagesAcceptEncryption(const TLInputEncryptedChat
 
 quint64 CTelegramConnection::messagesAddChatUser(quint32 chatId, const TLInputUser &userId, quint32 fwdLimit)
 {
+    quint32 size = 4; // TLValue::MessagesAddChatUser
+    size += tlEncodedSize(chatId);
+    size += tlEncodedSize(userId);
+    size += tlEncodedSize(fwdLimit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesAddChatUser;
     outputStream << chatId;
@@ -1124,7 +1453,10 @@ quint64 CTelegramConnection::messagesAddChatUser(quint32 chatId, const TLInputUs
 
 quint64 CTelegramConnection::messagesCheckChatInvite(const QString &hash)
 {
+    quint32 size = 4; // TLValue::MessagesCheckChatInvite
+    size += tlEncodedSize(hash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesCheckChatInvite;
     outputStream << hash;
@@ -1133,7 +1465,11 @@ quint64 CTelegramConnection::messagesCheckChatInvite(const QString &hash)
 
 quint64 CTelegramConnection::messagesCreateChat(const TLVector<TLInputUser> &users, const QString &title)
 {
+    quint32 size = 4; // TLValue::MessagesCreateChat
+    size += tlEncodedSize(users);
+    size += tlEncodedSize(title);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesCreateChat;
     outputStream << users;
@@ -1143,7 +1479,11 @@ quint64 CTelegramConnection::messagesCreateChat(const TLVector<TLInputUser> &use
 
 quint64 CTelegramConnection::messagesDeleteChatUser(quint32 chatId, const TLInputUser &userId)
 {
+    quint32 size = 4; // TLValue::MessagesDeleteChatUser
+    size += tlEncodedSize(chatId);
+    size += tlEncodedSize(userId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesDeleteChatUser;
     outputStream << chatId;
@@ -1153,7 +1493,11 @@ quint64 CTelegramConnection::messagesDeleteChatUser(quint32 chatId, const TLInpu
 
 quint64 CTelegramConnection::messagesDeleteHistory(const TLInputPeer &peer, quint32 maxId)
 {
+    quint32 size = 4; // TLValue::MessagesDeleteHistory
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(maxId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesDeleteHistory;
     outputStream << peer;
@@ -1163,7 +1507,10 @@ quint64 CTelegramConnection::messagesDeleteHistory(const TLInputPeer &peer, quin
 
 quint64 CTelegramConnection::messagesDeleteMessages(const TLVector<quint32> &id)
 {
+    quint32 size = 4; // TLValue::MessagesDeleteMessages
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesDeleteMessages;
     outputStream << id;
@@ -1172,7 +1519,10 @@ quint64 CTelegramConnection::messagesDeleteMessages(const TLVector<quint32> &id)
 
 quint64 CTelegramConnection::messagesDiscardEncryption(quint32 chatId)
 {
+    quint32 size = 4; // TLValue::MessagesDiscardEncryption
+    size += tlEncodedSize(chatId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesDiscardEncryption;
     outputStream << chatId;
@@ -1181,7 +1531,12 @@ quint64 CTelegramConnection::messagesDiscardEncryption(quint32 chatId)
 
 quint64 CTelegramConnection::messagesEditChatAdmin(quint32 chatId, const TLInputUser &userId, bool isAdmin)
 {
+    quint32 size = 4; // TLValue::MessagesEditChatAdmin
+    size += tlEncodedSize(chatId);
+    size += tlEncodedSize(userId);
+    size += tlEncodedSize(isAdmin);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesEditChatAdmin;
     outputStream << chatId;
@@ -1192,7 +1547,11 @@ quint64 CTelegramConnection::messagesEditChatAdmin(quint32 chatId, const TLInput
 
 quint64 CTelegramConnection::messagesEditChatPhoto(quint32 chatId, const TLInputChatPhoto &photo)
 {
+    quint32 size = 4; // TLValue::MessagesEditChatPhoto
+    size += tlEncodedSize(chatId);
+    size += tlEncodedSize(photo);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesEditChatPhoto;
     outputStream << chatId;
@@ -1202,7 +1561,11 @@ quint64 CTelegramConnection::messagesEditChatPhoto(quint32 chatId, const TLInput
 
 quint64 CTelegramConnection::messagesEditChatTitle(quint32 chatId, const QString &title)
 {
+    quint32 size = 4; // TLValue::MessagesEditChatTitle
+    size += tlEncodedSize(chatId);
+    size += tlEncodedSize(title);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesEditChatTitle;
     outputStream << chatId;
@@ -1212,7 +1575,10 @@ quint64 CTelegramConnection::messagesEditChatTitle(quint32 chatId, const QString
 
 quint64 CTelegramConnection::messagesExportChatInvite(quint32 chatId)
 {
+    quint32 size = 4; // TLValue::MessagesExportChatInvite
+    size += tlEncodedSize(chatId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesExportChatInvite;
     outputStream << chatId;
@@ -1221,7 +1587,12 @@ quint64 CTelegramConnection::messagesExportChatInvite(quint32 chatId)
 
 quint64 CTelegramConnection::messagesForwardMessage(const TLInputPeer &peer, quint32 id, quint64 randomId)
 {
+    quint32 size = 4; // TLValue::MessagesForwardMessage
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(id);
+    size += tlEncodedSize(randomId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesForwardMessage;
     outputStream << peer;
@@ -1232,7 +1603,14 @@ quint64 CTelegramConnection::messagesForwardMessage(const TLInputPeer &peer, qui
 
 quint64 CTelegramConnection::messagesForwardMessages(quint32 flags, const TLInputPeer &fromPeer, const TLVector<quint32> &id, const TLVector<quint64> &randomId, const TLInputPeer &toPeer)
 {
+    quint32 size = 4; // TLValue::MessagesForwardMessages
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(fromPeer);
+    size += tlEncodedSize(id);
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(toPeer);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesForwardMessages;
     outputStream << flags;
@@ -1246,7 +1624,10 @@ quint64 CTelegramConnection::messagesForwardMessages(quint32 flags, const TLInpu
 
 quint64 CTelegramConnection::messagesGetAllStickers(quint32 hash)
 {
+    quint32 size = 4; // TLValue::MessagesGetAllStickers
+    size += tlEncodedSize(hash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetAllStickers;
     outputStream << hash;
@@ -1255,7 +1636,10 @@ quint64 CTelegramConnection::messagesGetAllStickers(quint32 hash)
 
 quint64 CTelegramConnection::messagesGetChats(const TLVector<quint32> &id)
 {
+    quint32 size = 4; // TLValue::MessagesGetChats
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetChats;
     outputStream << id;
@@ -1264,7 +1648,11 @@ quint64 CTelegramConnection::messagesGetChats(const TLVector<quint32> &id)
 
 quint64 CTelegramConnection::messagesGetDhConfig(quint32 version, quint32 randomLength)
 {
+    quint32 size = 4; // TLValue::MessagesGetDhConfig
+    size += tlEncodedSize(version);
+    size += tlEncodedSize(randomLength);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetDhConfig;
     outputStream << version;
@@ -1274,7 +1662,13 @@ quint64 CTelegramConnection::messagesGetDhConfig(quint32 version, quint32 random
 
 quint64 CTelegramConnection::messagesGetDialogs(quint32 offsetDate, quint32 offsetId, const TLInputPeer &offsetPeer, quint32 limit)
 {
+    quint32 size = 4; // TLValue::MessagesGetDialogs
+    size += tlEncodedSize(offsetDate);
+    size += tlEncodedSize(offsetId);
+    size += tlEncodedSize(offsetPeer);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetDialogs;
     outputStream << offsetDate;
@@ -1286,7 +1680,12 @@ quint64 CTelegramConnection::messagesGetDialogs(quint32 offsetDate, quint32 offs
 
 quint64 CTelegramConnection::messagesGetDocumentByHash(const QByteArray &sha256, quint32 size, const QString &mimeType)
 {
+    quint32 size = 4; // TLValue::MessagesGetDocumentByHash
+    size += tlEncodedSize(sha256);
+    size += tlEncodedSize(size);
+    size += tlEncodedSize(mimeType);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetDocumentByHash;
     outputStream << sha256;
@@ -1297,7 +1696,10 @@ quint64 CTelegramConnection::messagesGetDocumentByHash(const QByteArray &sha256,
 
 quint64 CTelegramConnection::messagesGetFullChat(quint32 chatId)
 {
+    quint32 size = 4; // TLValue::MessagesGetFullChat
+    size += tlEncodedSize(chatId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetFullChat;
     outputStream << chatId;
@@ -1306,7 +1708,15 @@ quint64 CTelegramConnection::messagesGetFullChat(quint32 chatId)
 
 quint64 CTelegramConnection::messagesGetHistory(const TLInputPeer &peer, quint32 offsetId, quint32 addOffset, quint32 limit, quint32 maxId, quint32 minId)
 {
+    quint32 size = 4; // TLValue::MessagesGetHistory
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(offsetId);
+    size += tlEncodedSize(addOffset);
+    size += tlEncodedSize(limit);
+    size += tlEncodedSize(maxId);
+    size += tlEncodedSize(minId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetHistory;
     outputStream << peer;
@@ -1320,7 +1730,12 @@ quint64 CTelegramConnection::messagesGetHistory(const TLInputPeer &peer, quint32
 
 quint64 CTelegramConnection::messagesGetInlineBotResults(const TLInputUser &bot, const QString &query, const QString &offset)
 {
+    quint32 size = 4; // TLValue::MessagesGetInlineBotResults
+    size += tlEncodedSize(bot);
+    size += tlEncodedSize(query);
+    size += tlEncodedSize(offset);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetInlineBotResults;
     outputStream << bot;
@@ -1331,7 +1746,10 @@ quint64 CTelegramConnection::messagesGetInlineBotResults(const TLInputUser &bot,
 
 quint64 CTelegramConnection::messagesGetMessages(const TLVector<quint32> &id)
 {
+    quint32 size = 4; // TLValue::MessagesGetMessages
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetMessages;
     outputStream << id;
@@ -1340,7 +1758,12 @@ quint64 CTelegramConnection::messagesGetMessages(const TLVector<quint32> &id)
 
 quint64 CTelegramConnection::messagesGetMessagesViews(const TLInputPeer &peer, const TLVector<quint32> &id, bool increment)
 {
+    quint32 size = 4; // TLValue::MessagesGetMessagesViews
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(id);
+    size += tlEncodedSize(increment);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetMessagesViews;
     outputStream << peer;
@@ -1351,7 +1774,10 @@ quint64 CTelegramConnection::messagesGetMessagesViews(const TLInputPeer &peer, c
 
 quint64 CTelegramConnection::messagesGetSavedGifs(quint32 hash)
 {
+    quint32 size = 4; // TLValue::MessagesGetSavedGifs
+    size += tlEncodedSize(hash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetSavedGifs;
     outputStream << hash;
@@ -1360,7 +1786,10 @@ quint64 CTelegramConnection::messagesGetSavedGifs(quint32 hash)
 
 quint64 CTelegramConnection::messagesGetStickerSet(const TLInputStickerSet &stickerset)
 {
+    quint32 size = 4; // TLValue::MessagesGetStickerSet
+    size += tlEncodedSize(stickerset);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetStickerSet;
     outputStream << stickerset;
@@ -1369,7 +1798,11 @@ quint64 CTelegramConnection::messagesGetStickerSet(const TLInputStickerSet &stic
 
 quint64 CTelegramConnection::messagesGetStickers(const QString &emoticon, const QString &hash)
 {
+    quint32 size = 4; // TLValue::MessagesGetStickers
+    size += tlEncodedSize(emoticon);
+    size += tlEncodedSize(hash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetStickers;
     outputStream << emoticon;
@@ -1379,7 +1812,10 @@ quint64 CTelegramConnection::messagesGetStickers(const QString &emoticon, const
 
 quint64 CTelegramConnection::messagesGetWebPagePreview(const QString &message)
 {
+    quint32 size = 4; // TLValue::MessagesGetWebPagePreview
+    size += tlEncodedSize(message);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesGetWebPagePreview;
     outputStream << message;
@@ -1388,7 +1824,10 @@ quint64 CTelegramConnection::messagesGetWebPagePreview(const QString &message)
 
 quint64 CTelegramConnection::messagesImportChatInvite(const QString &hash)
 {
+    quint32 size = 4; // TLValue::MessagesImportChatInvite
+    size += tlEncodedSize(hash);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesImportChatInvite;
     outputStream << hash;
@@ -1397,7 +1836,11 @@ quint64 CTelegramConnection::messagesImportChatInvite(const QString &hash)
 
 quint64 CTelegramConnection::messagesInstallStickerSet(const TLInputStickerSet &stickerset, bool disabled)
 {
+    quint32 size = 4; // TLValue::MessagesInstallStickerSet
+    size += tlEncodedSize(stickerset);
+    size += tlEncodedSize(disabled);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesInstallStickerSet;
     outputStream << stickerset;
@@ -1407,7 +1850,10 @@ quint64 CTelegramConnection::messagesInstallStickerSet(const TLInputStickerSet &
 
 quint64 CTelegramConnection::messagesMigrateChat(quint32 chatId)
 {
+    quint32 size = 4; // TLValue::MessagesMigrateChat
+    size += tlEncodedSize(chatId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesMigrateChat;
     outputStream << chatId;
@@ -1416,7 +1862,11 @@ quint64 CTelegramConnection::messagesMigrateChat(quint32 chatId)
 
 quint64 CTelegramConnection::messagesReadEncryptedHistory(const TLInputEncryptedChat &peer, quint32 maxDate)
 {
+    quint32 size = 4; // TLValue::MessagesReadEncryptedHistory
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(maxDate);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesReadEncryptedHistory;
     outputStream << peer;
@@ -1426,7 +1876,11 @@ quint64 CTelegramConnection::messagesReadEncryptedHistory(const TLInputEncrypted
 
 quint64 CTelegramConnection::messagesReadHistory(const TLInputPeer &peer, quint32 maxId)
 {
+    quint32 size = 4; // TLValue::MessagesReadHistory
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(maxId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesReadHistory;
     outputStream << peer;
@@ -1436,7 +1890,10 @@ quint64 CTelegramConnection::messagesReadHistory(const TLInputPeer &peer, quint3
 
 quint64 CTelegramConnection::messagesReadMessageContents(const TLVector<quint32> &id)
 {
+    quint32 size = 4; // TLValue::MessagesReadMessageContents
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesReadMessageContents;
     outputStream << id;
@@ -1445,7 +1902,10 @@ quint64 CTelegramConnection::messagesReadMessageContents(const TLVector<quint32>
 
 quint64 CTelegramConnection::messagesReceivedMessages(quint32 maxId)
 {
+    quint32 size = 4; // TLValue::MessagesReceivedMessages
+    size += tlEncodedSize(maxId);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesReceivedMessages;
     outputStream << maxId;
@@ -1454,7 +1914,10 @@ quint64 CTelegramConnection::messagesReceivedMessages(quint32 maxId)
 
 quint64 CTelegramConnection::messagesReceivedQueue(quint32 maxQts)
 {
+    quint32 size = 4; // TLValue::MessagesReceivedQueue
+    size += tlEncodedSize(maxQts);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesReceivedQueue;
     outputStream << maxQts;
@@ -1463,7 +1926,10 @@ quint64 CTelegramConnection::messagesReceivedQueue(quint32 maxQts)
 
 quint64 CTelegramConnection::messagesReorderStickerSets(const TLVector<quint64> &order)
 {
+    quint32 size = 4; // TLValue::MessagesReorderStickerSets
+    size += tlEncodedSize(order);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesReorderStickerSets;
     outputStream << order;
@@ -1472,7 +1938,10 @@ quint64 CTelegramConnection::messagesReorderStickerSets(const TLVector<quint64>
 
 quint64 CTelegramConnection::messagesReportSpam(const TLInputPeer &peer)
 {
+    quint32 size = 4; // TLValue::MessagesReportSpam
+    size += tlEncodedSize(peer);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesReportSpam;
     outputStream << peer;
@@ -1481,7 +1950,12 @@ quint64 CTelegramConnection::messagesReportSpam(const TLInputPeer &peer)
 
 quint64 CTelegramConnection::messagesRequestEncryption(const TLInputUser &userId, quint32 randomId, const QByteArray &gA)
 {
+    quint32 size = 4; // TLValue::MessagesRequestEncryption
+    size += tlEncodedSize(userId);
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(gA);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesRequestEncryption;
     outputStream << userId;
@@ -1492,7 +1966,11 @@ quint64 CTelegramConnection::messagesRequestEncryption(const TLInputUser &userId
 
 quint64 CTelegramConnection::messagesSaveGif(const TLInputDocument &id, bool unsave)
 {
+    quint32 size = 4; // TLValue::MessagesSaveGif
+    size += tlEncodedSize(id);
+    size += tlEncodedSize(unsave);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSaveGif;
     outputStream << id;
@@ -1502,7 +1980,18 @@ quint64 CTelegramConnection::messagesSaveGif(const TLInputDocument &id, bool uns
 
 quint64 CTelegramConnection::messagesSearch(quint32 flags, const TLInputPeer &peer, const QString &q, const TLMessagesFilter &filter, quint32 minDate, quint32 maxDate, quint32 offset, quint32 maxId, quint32 limit)
 {
+    quint32 size = 4; // TLValue::MessagesSearch
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(q);
+    size += tlEncodedSize(filter);
+    size += tlEncodedSize(minDate);
+    size += tlEncodedSize(maxDate);
+    size += tlEncodedSize(offset);
+    size += tlEncodedSize(maxId);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSearch;
     outputStream << flags;
@@ -1520,7 +2009,11 @@ quint64 CTelegramConnection::messagesSearch(quint32 flags, const TLInputPeer &pe
 
 quint64 CTelegramConnection::messagesSearchGifs(const QString &q, quint32 offset)
 {
+    quint32 size = 4; // TLValue::MessagesSearchGifs
+    size += tlEncodedSize(q);
+    size += tlEncodedSize(offset);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSearchGifs;
     outputStream << q;
@@ -1530,7 +2023,14 @@ quint64 CTelegramConnection::messagesSearchGifs(const QString &q, quint32 offset
 
 quint64 CTelegramConnection::messagesSearchGlobal(const QString &q, quint32 offsetDate, const TLInputPeer &offsetPeer, quint32 offsetId, quint32 limit)
 {
+    quint32 size = 4; // TLValue::MessagesSearchGlobal
+    size += tlEncodedSize(q);
+    size += tlEncodedSize(offsetDate);
+    size += tlEncodedSize(offsetPeer);
+    size += tlEncodedSize(offsetId);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSearchGlobal;
     outputStream << q;
@@ -1543,7 +2043,13 @@ quint64 CTelegramConnection::messagesSearchGlobal(const QString &q, quint32 offs
 
 quint64 CTelegramConnection::messagesSendBroadcast(const TLVector<TLInputUser> &contacts, const TLVector<quint64> &randomId, const QString &message, const TLInputMedia &media)
 {
+    quint32 size = 4; // TLValue::MessagesSendBroadcast
+    size += tlEncodedSize(contacts);
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(message);
+    size += tlEncodedSize(media);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSendBroadcast;
     outputStream << contacts;
@@ -1555,7 +2061,12 @@ quint64 CTelegramConnection::messagesSendBroadcast(const TLVector<TLInputUser> &
 
 quint64 CTelegramConnection::messagesSendEncrypted(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data)
 {
+    quint32 size = 4; // TLValue::MessagesSendEncrypted
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(data);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSendEncrypted;
     outputStream << peer;
@@ -1566,7 +2077,13 @@ quint64 CTelegramConnection::messagesSendEncrypted(const TLInputEncryptedChat &p
 
 quint64 CTelegramConnection::messagesSendEncryptedFile(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data, const TLInputEncryptedFile &file)
 {
+    quint32 size = 4; // TLValue::MessagesSendEncryptedFile
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(data);
+    size += tlEncodedSize(file);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSendEncryptedFile;
     outputStream << peer;
@@ -1578,7 +2095,12 @@ quint64 CTelegramConnection::messagesSendEncryptedFile(const TLInputEncryptedCha
 
 quint64 CTelegramConnection::messagesSendEncryptedService(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data)
 {
+    quint32 size = 4; // TLValue::MessagesSendEncryptedService
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(data);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSendEncryptedService;
     outputStream << peer;
@@ -1589,7 +2111,17 @@ quint64 CTelegramConnection::messagesSendEncryptedService(const TLInputEncrypted
 
 quint64 CTelegramConnection::messagesSendInlineBotResult(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, quint64 randomId, quint64 queryId, const QString &id)
 {
+    quint32 size = 4; // TLValue::MessagesSendInlineBotResult
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(peer);
+    if (flags & 1 << 0) {
+        size += tlEncodedSize(replyToMsgId);
+    }
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(queryId);
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSendInlineBotResult;
     outputStream << flags;
@@ -1606,7 +2138,19 @@ quint64 CTelegramConnection::messagesSendInlineBotResult(quint32 flags, const TL
 
 quint64 CTelegramConnection::messagesSendMedia(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, const TLInputMedia &media, quint64 randomId, const TLReplyMarkup &replyMarkup)
 {
+    quint32 size = 4; // TLValue::MessagesSendMedia
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(peer);
+    if (flags & 1 << 0) {
+        size += tlEncodedSize(replyToMsgId);
+    }
+    size += tlEncodedSize(media);
+    size += tlEncodedSize(randomId);
+    if (flags & 1 << 2) {
+        size += tlEncodedSize(replyMarkup);
+    }
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSendMedia;
     outputStream << flags;
@@ -1625,7 +2169,22 @@ quint64 CTelegramConnection::messagesSendMedia(quint32 flags, const TLInputPeer
 
 quint64 CTelegramConnection::messagesSendMessage(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, const QString &message, quint64 randomId, const TLReplyMarkup &replyMarkup, const TLVector<TLMessageEntity> &entities)
 {
+    quint32 size = 4; // TLValue::MessagesSendMessage
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(peer);
+    if (flags & 1 << 0) {
+        size += tlEncodedSize(replyToMsgId);
+    }
+    size += tlEncodedSize(message);
+    size += tlEncodedSize(randomId);
+    if (flags & 1 << 2) {
+        size += tlEncodedSize(replyMarkup);
+    }
+    if (flags & 1 << 3) {
+        size += tlEncodedSize(entities);
+    }
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSendMessage;
     outputStream << flags;
@@ -1648,7 +2207,11 @@ quint64 CTelegramConnection::messagesSendMessage(quint32 flags, const TLInputPee
 
 quint64 CTelegramConnection::messagesSetEncryptedTyping(const TLInputEncryptedChat &peer, bool typing)
 {
+    quint32 size = 4; // TLValue::MessagesSetEncryptedTyping
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(typing);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSetEncryptedTyping;
     outputStream << peer;
@@ -1658,7 +2221,16 @@ quint64 CTelegramConnection::messagesSetEncryptedTyping(const TLInputEncryptedCh
 
 quint64 CTelegramConnection::messagesSetInlineBotResults(quint32 flags, quint64 queryId, const TLVector<TLInputBotInlineResult> &results, quint32 cacheTime, const QString &nextOffset)
 {
+    quint32 size = 4; // TLValue::MessagesSetInlineBotResults
+    size += tlEncodedSize(flags);
+    size += tlEncodedSize(queryId);
+    size += tlEncodedSize(results);
+    size += tlEncodedSize(cacheTime);
+    if (flags & 1 << 2) {
+        size += tlEncodedSize(nextOffset);
+    }
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSetInlineBotResults;
     outputStream << flags;
@@ -1675,7 +2247,11 @@ quint64 CTelegramConnection::messagesSetInlineBotResults(quint32 flags, quint64
 
 quint64 CTelegramConnection::messagesSetTyping(const TLInputPeer &peer, const TLSendMessageAction &action)
 {
+    quint32 size = 4; // TLValue::MessagesSetTyping
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(action);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesSetTyping;
     outputStream << peer;
@@ -1685,7 +2261,13 @@ quint64 CTelegramConnection::messagesSetTyping(const TLInputPeer &peer, const TL
 
 quint64 CTelegramConnection::messagesStartBot(const TLInputUser &bot, const TLInputPeer &peer, quint64 randomId, const QString &startParam)
 {
+    quint32 size = 4; // TLValue::MessagesStartBot
+    size += tlEncodedSize(bot);
+    size += tlEncodedSize(peer);
+    size += tlEncodedSize(randomId);
+    size += tlEncodedSize(startParam);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesStartBot;
     outputStream << bot;
@@ -1697,7 +2279,11 @@ quint64 CTelegramConnection::messagesStartBot(const TLInputUser &bot, const TLIn
 
 quint64 CTelegramConnection::messagesToggleChatAdmins(quint32 chatId, bool enabled)
 {
+    quint32 size = 4; // TLValue::MessagesToggleChatAdmins
+    size += tlEncodedSize(chatId);
+    size += tlEncodedSize(enabled);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesToggleChatAdmins;
     outputStream << chatId;
@@ -1707,7 +2293,10 @@ quint64 CTelegramConnection::messagesToggleChatAdmins(quint32 chatId, bool enabl
 
 quint64 CTelegramConnection::messagesUninstallStickerSet(const TLInputStickerSet &stickerset)
 {
+    quint32 size = 4; // TLValue::MessagesUninstallStickerSet
+    size += tlEncodedSize(stickerset);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::MessagesUninstallStickerSet;
     outputStream << stickerset;
@@ -1716,7 +2305,13 @@ quint64 CTelegramConnection::messagesUninstallStickerSet(const TLInputStickerSet
 
 quint64 CTelegramConnection::updatesGetChannelDifference(const TLInputChannel &channel, const TLChannelMessagesFilter &filter, quint32 pts, quint32 limit)
 {
+    quint32 size = 4; // TLValue::UpdatesGetChannelDifference
+    size += tlEncodedSize(channel);
+    size += tlEncodedSize(filter);
+    size += tlEncodedSize(pts);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UpdatesGetChannelDifference;
     outputStream << channel;
@@ -1728,7 +2323,12 @@ quint64 CTelegramConnection::updatesGetChannelDifference(const TLInputChannel &c
 
 quint64 CTelegramConnection::updatesGetDifference(quint32 pts, quint32 date, quint32 qts)
 {
+    quint32 size = 4; // TLValue::UpdatesGetDifference
+    size += tlEncodedSize(pts);
+    size += tlEncodedSize(date);
+    size += tlEncodedSize(qts);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UpdatesGetDifference;
     outputStream << pts;
@@ -1739,7 +2339,9 @@ quint64 CTelegramConnection::updatesGetDifference(quint32 pts, quint32 date, qui
 
 quint64 CTelegramConnection::updatesGetState()
 {
+    quint32 size = 4; // TLValue::UpdatesGetState
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UpdatesGetState;
     return sendEncryptedPackage(output);
@@ -1747,7 +2349,12 @@ quint64 CTelegramConnection::updatesGetState()
 
 quint64 CTelegramConnection::uploadGetFile(const TLInputFileLocation &location, quint32 offset, quint32 limit)
 {
+    quint32 size = 4; // TLValue::UploadGetFile
+    size += tlEncodedSize(location);
+    size += tlEncodedSize(offset);
+    size += tlEncodedSize(limit);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UploadGetFile;
     outputStream << location;
@@ -1758,7 +2365,13 @@ quint64 CTelegramConnection::uploadGetFile(const TLInputFileLocation &location,
 
 quint64 CTelegramConnection::uploadSaveBigFilePart(quint64 fileId, quint32 filePart, quint32 fileTotalParts, const QByteArray &bytes)
 {
+    quint32 size = 4; // TLValue::UploadSaveBigFilePart
+    size += tlEncodedSize(fileId);
+    size += tlEncodedSize(filePart);
+    size += tlEncodedSize(fileTotalParts);
+    size += tlEncodedSize(bytes);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UploadSaveBigFilePart;
     outputStream << fileId;
@@ -1770,7 +2383,12 @@ quint64 CTelegramConnection::uploadSaveBigFilePart(quint64 fileId, quint32 fileP
 
 quint64 CTelegramConnection::uploadSaveFilePart(quint64 fileId, quint32 filePart, const QByteArray &bytes)
 {
+    quint32 size = 4; // TLValue::UploadSaveFilePart
+    size += tlEncodedSize(fileId);
+    size += tlEncodedSize(filePart);
+    size += tlEncodedSize(bytes);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UploadSaveFilePart;
     outputStream << fileId;
@@ -1781,7 +2399,10 @@ quint64 CTelegramConnection::uploadSaveFilePart(quint64 fileId, quint32 filePart
 
 quint64 CTelegramConnection::usersGetFullUser(const TLInputUser &id)
 {
+    quint32 size = 4; // TLValue::UsersGetFullUser
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UsersGetFullUser;
     outputStream << id;
@@ -1790,7 +2411,10 @@ quint64 CTelegramConnection::usersGetFullUser(const TLInputUser &id)
 
 quint64 CTelegramConnection::usersGetUsers(const TLVector<TLInputUser> &id)
 {
+    quint32 size = 4; // TLValue::UsersGetUsers
+    size += tlEncodedSize(id);
     QByteArray output;
+    output.reserve(size);
     CTelegramStream outputStream(&output, /* write */ true);
     outputStream << TLValue::UsersGetUsers;
     outputStream << id;
@@ -2257,7 +2881,8 @@ void CTelegramConnection::processContainer(CTelegramStream &stream)
 
         stream >> size;
 
-        processRpcQuery(stream.readBytes(size));
+        // The message data refers to the container package, which outlives the processing
+        processRpcQuery(stream.readBytesInPlace(size));
     }
 }
 
@@ -2814,6 +3439,17 @@ bool CTelegramConnection::processRpcError(CTelegramStream &stream, quint64 id, T
         }
             processed = true;
             break;
+        case TLValue::ContactsResolveUsername: {
+            const QString userName = userNameFromPackage(id);
+            if (errorMessage == QLatin1String("USERNAME_INVALID")) {
+                emit userNameStatusUpdated(userName, TelegramNamespace::UserNameStatusIsInvalid);
+            } else {
+                // USERNAME_NOT_OCCUPIED
+                emit userNameStatusUpdated(userName, TelegramNamespace::UserNameStatusUnknown);
+            }
+        }
+            processed = true;
+            break;
         case TLValue::MessagesGetChats:
         {
             const QByteArray data = m_submittedPackages.value(id);
@@ -2864,6 +3500,25 @@ bool CTelegramConnection::processRpcError(CTelegramStream &stream, quint64 id, T
         break;
     }
 
+    if (!processed && ((request == TLValue::UploadSaveFilePart) || (request == TLValue::UploadSaveBigFilePart))
+            && m_requestedFilesIds.contains(id)) {
+        // Let the owner of the request retry the part
+        emit fileDataSendFailed(m_requestedFilesIds.take(id), filePartFromPackage(m_submittedPackages.value(id)));
+        processed = true;
+    }
+
+    if (!processed && (request == TLValue::UploadGetFile) && m_requestedFilesIds.contains(id)) {
+        // Let the owner of the request retry the chunk
+        emit fileDataReceiveFailed(m_requestedFilesIds.take(id), fileOffsetFromPackage(m_submittedPackages.value(id)));
+        processed = true;
+    }
+
+    if (!processed && (request == TLValue::MessagesGetHistory)) {
+        // Let the dispatcher release the history cursor of the request
+        emit messagesHistoryRequestFailed(id);
+        processed = true;
+    }
+
     emit errorReceived(errorCode, errorMessage, processed);
     return processed;
 }
@@ -3418,9 +4073,13 @@ void CTelegramConnection::processChannelsGetImportantHistory(RpcProcessingContex
 
 void CTelegramConnection::processChannelsGetMessages(RpcProcessingContext *context)
 {
-    qWarning() << Q_FUNC_INFO << "Is not implemented yet";
     TLMessagesMessages result;
     context->readRpcResult(&result);
+    if (!result.isValid()) {
+        return;
+    }
+
+    emit messagesMessagesReceived(result);
 }
 
 void CTelegramConnection::processChannelsGetParticipant(RpcProcessingContext *context)
@@ -3542,6 +4201,8 @@ void CTelegramConnection::processContactsGetContacts(RpcProcessingContext *conte
         }
 
         emit contactListReceived(contactList);
+    } else if (result.tlType == TLValue::ContactsContactsNotModified) {
+        emit contactListNotModified();
     }
 }
 
@@ -3758,8 +4419,11 @@ void CTelegramConnection::processMessagesGetDhConfig(RpcProcessingContext *conte
 
 void CTelegramConnection::processMessagesGetDialogs(RpcProcessingContext *context)
 {
+    // Only the dialog list is built from the answer, so the bodies of the top messages are skipped
     TLMessagesDialogs result;
-    context->readRpcResult(&result);
+    context->inputStream().readDialogsPage(&result);
+    context->setReadCode(result.tlType);
+    context->setSucceed(result.isValid() && !context->inputStream().error());
     if (!result.isValid()) {
         return;
     }
@@ -3801,9 +4465,10 @@ void CTelegramConnection::processMessagesGetFullChat(RpcProcessingContext *conte
 
 void CTelegramConnection::processMessagesGetHistory(RpcProcessingContext *context)
 {
-    TLMessagesMessages result;
-    context->readRpcResult(&result);
-    if (!result.isValid()) {
+    // The history page is passed to the receivers without copying it
+    TLMessagesMessagesShared result;
+    context->readRpcResult(&result.data());
+    if (!result->isValid()) {
         return;
     }
 
@@ -3813,7 +4478,7 @@ void CTelegramConnection::processMessagesGetHistory(RpcProcessingContext *contex
     stream >> value;
     stream >> peer;
 
-    emit messagesHistoryReceived(result, peer);
+    emit messagesHistoryReceived(result, peer, context->requestId());
 }
 
 void CTelegramConnection::processMessagesGetInlineBotResults(RpcProcessingContext *context)
@@ -3825,9 +4490,13 @@ void CTelegramConnection::processMessagesGetInlineBotResults(RpcProcessingContex
 
 void CTelegramConnection::processMessagesGetMessages(RpcProcessingContext *context)
 {
-    qWarning() << Q_FUNC_INFO << "Is not implemented yet";
     TLMessagesMessages result;
     context->readRpcResult(&result);
+    if (!result.isValid()) {
+        return;
+    }
+
+    emit messagesMessagesReceived(result);
 }
 
 void CTelegramConnection::processMessagesGetMessagesViews(RpcProcessingContext *context)
@@ -4048,26 +4717,19 @@ void CTelegramConnection::processUploadGetFile(RpcProcessingContext *context)
 {
     TLUploadFile result;
     context->readRpcResult(&result);
+    const quint32 requestId = m_requestedFilesIds.take(context->requestId());
+    const quint32 offset = fileOffsetFromPackage(context->requestData());
     if (!result.isValid()) {
+        emit fileDataReceiveFailed(requestId, offset);
         return;
     }
-    CTelegramStream stream(context->requestData());
-    TLValue value;
-    TLInputFileLocation location;
-    quint32 offset;
-
-    stream >> value;
-    stream >> location;
-    stream >> offset;
 
-    emit fileDataReceived(result, m_requestedFilesIds.value(context->requestId()), offset);
+    emit fileDataReceived(result, requestId, offset);
 }
 
 void CTelegramConnection::processUploadSaveBigFilePart(RpcProcessingContext *context)
 {
-    TLValue result; // bool
-    context->inputStream() >> result;
-    context->setReadCode(result);
+    processUploadSaveFilePart(context);
 }
 
 void CTelegramConnection::processUploadSaveFilePart(RpcProcessingContext *context)
@@ -4075,10 +4737,14 @@ void CTelegramConnection::processUploadSaveFilePart(RpcProcessingContext *contex
     TLValue result; // bool
     context->inputStream() >> result;
     context->setReadCode(result);
+
+    const quint32 requestId = m_requestedFilesIds.take(context->requestId());
+    const quint32 filePart = filePartFromPackage(context->requestData());
     if (result == TLValue::BoolTrue) {
-        emit fileDataSent(m_requestedFilesIds.take(context->requestId()));
+        emit fileDataSent(requestId, filePart);
     } else {
-        qWarning() << "Unhandled UploadSaveFilePart result"; // retry putFile() call?
+        qWarning() << Q_FUNC_INFO << "The part" << filePart << "is not saved";
+        emit fileDataSendFailed(requestId, filePart);
     }
 }
 
@@ -4225,6 +4891,7 @@ void CTelegramConnection::onTransportPackageReceived(const QByteArray &input)
 
     quint64 authId = 0;
     QByteArray payload;
+    QByteArray decryptedData;
     inputStream >> authId;
 
     if (!authId) {
@@ -4289,12 +4956,16 @@ void CTelegramConnection::onTransportPackageReceived(const QByteArray &input)
             return;
         }
         // Encrypted Message
-        const QByteArray messageKey = inputStream.readBytes(16);
-        const QByteArray data = inputStream.readBytes(inputStream.bytesAvailable());
+        const QByteArray messageKey = inputStream.readBytesInPlace(16);
+        const QByteArray data = inputStream.readBytesInPlace(inputStream.bytesAvailable());
 
         const SAesKey key = generateServerToClientAesKey(messageKey);
 
-        QByteArray decryptedData = Utils::aesDecrypt(data, key).left(data.length());
+        // Take the buffer of the previous package; a reentrant call (if any) would get an empty one.
+        decryptedData.swap(m_receiveBuffer);
+        if (!Utils::aesDecrypt(data, key, &decryptedData)) {
+            return;
+        }
         CRawStream decryptedStream(decryptedData);
 
         quint64 sessionId = 0;
@@ -4331,7 +5002,7 @@ void CTelegramConnection::onTransportPackageReceived(const QByteArray &input)
             return;
         }
 
-        payload = decryptedStream.readAll();
+        payload = decryptedStream.readBytesInPlace(decryptedStream.bytesAvailable());
 
         processRpcQuery(payload);
     }
@@ -4340,6 +5011,12 @@ void CTelegramConnection::onTransportPackageReceived(const QByteArray &input)
     static int packagesCount = 0;
     qDebug() << Q_FUNC_INFO << "Got package" << ++packagesCount << TLValue::firstFromArray(payload);
 #endif
+
+    // The payload may refer to the decrypted data, release it first
+    payload.clear();
+    if (!decryptedData.isEmpty() && (decryptedData.capacity() <= s_maxReceiveBufferCapacity)) {
+        m_receiveBuffer.swap(decryptedData);
+    }
 }
 
 void CTelegramConnection::onTransportTimeout()
@@ -4641,6 +5318,45 @@ QString CTelegramConnection::userNameFromPackage(quint64 id) const
     return name;
 }
 
+quint32 CTelegramConnection::filePartFromPackage(const QByteArray &data) const
+{
+    CTelegramStream stream(data);
+
+    TLValue method;
+    quint64 fileId;
+    quint32 filePart = 0;
+
+    stream >> method;
+    switch (method) {
+    case TLValue::UploadSaveFilePart:
+    case TLValue::UploadSaveBigFilePart:
+        stream >> fileId;
+        stream >> filePart;
+        break;
+    default:
+        break;
+    }
+
+    return filePart;
+}
+
+quint32 CTelegramConnection::fileOffsetFromPackage(const QByteArray &data) const
+{
+    CTelegramStream stream(data);
+
+    TLValue method;
+    TLInputFileLocation location;
+    quint32 offset = 0;
+
+    stream >> method;
+    if (method == TLValue::UploadGetFile) {
+        stream >> location;
+        stream >> offset;
+    }
+
+    return offset;
+}
+
 void CTelegramConnection::startAuthTimer()
 {
     qDebug() << Q_FUNC_INFO;
@@ -267,7 +267,7 @@ public:
     quint64 signUp(const QString &phoneNumber, const QString &authCode, const QString &firstName, const QString &lastName);
 
     void downloadFile(const TLInputFileLocation &inputLocation, quint32 offset, quint32 limit, quint32 requestId);
-    void uploadFile(quint64 fileId, quint32 filePart, const QByteArray &bytes, quint32 requestId);
+    void uploadFile(quint64 fileId, quint32 filePart, quint32 fileTotalParts, const QByteArray &bytes, quint32 requestId);
 
     quint64 sendMessage(const TLInputPeer &peer, const QString &message, quint64 randomMessageId);
     quint64 sendMedia(const TLInputPeer &peer, const TLInputMedia &media, quint64 randomMessageId);
@@ -324,16 +324,21 @@ signals:
     void userNameStatusUpdated(const QString &userName, TelegramNamespace::UserNameStatus status);
     void usersReceived(const QVector<TLUser> &users);
     void contactListReceived(const QVector<quint32> &contactList);
+    void contactListNotModified();
     void contactListChanged(const QVector<quint32> &added, const QVector<quint32> &removed);
     void fileDataReceived(const TLUploadFile &file, quint32 requestId, quint32 offset);
-    void fileDataSent(quint32 requestId);
+    void fileDataSent(quint32 requestId, quint32 filePart);
+    void fileDataSendFailed(quint32 requestId, quint32 filePart);
+    void fileDataReceiveFailed(quint32 requestId, quint32 offset);
 
     void messagesChatsReceived(const QVector<TLChat> &chats);
     void messagesFullChatReceived(const TLChatFull &chat, const QVector<TLChat> &chats, const QVector<TLUser> &users);
     void channelsParticipantsReceived(quint32 channelId, const TLVector<TLChannelParticipant> &participants);
 
     void fullUserReceived(const TLUserFull &userFull);
-    void messagesHistoryReceived(const TLMessagesMessages &history, const TLInputPeer &peer);
+    void messagesHistoryReceived(const TLMessagesMessagesShared &history, const TLInputPeer &peer, quint64 requestId);
+    void messagesHistoryRequestFailed(quint64 requestId);
+    void messagesMessagesReceived(const TLMessagesMessages &messages);
     void messagesDialogsReceived(const TLMessagesDialogs &dialogs, quint32 offsetDate, quint32 offsetId, const TLInputPeer &offsetPeer, quint32 limit);
     void channelsDialogsReceived(const TLMessagesDialogs &dialogs, quint32 offsetId, quint32 limit);
     void messagesAffectedMessagesReceived(const TLMessagesAffectedMessages &affectedMessages);
@@ -510,6 +515,8 @@ protected:
     quint64 newMessageId();
 
     QString userNameFromPackage(quint64 id) const;
+    quint32 filePartFromPackage(const QByteArray &data) const;
+    quint32 fileOffsetFromPackage(const QByteArray &data) const;
 
     void startAuthTimer();
     void stopAuthTimer();
@@ -587,6 +594,8 @@ protected:
 
     QString m_authCodeHash;
 
+    QByteArray m_receiveBuffer; // Decrypted data of the last package, kept to reuse the allocation
+
 #ifdef NETWORK_LOGGING
     QFile *m_logFile;
 #endif
@@ -91,10 +91,20 @@ CTelegramCore::CTelegramCore(QObject *parent) :
             this, &CTelegramCore::contactProfileChanged);
     connect(m_private->m_mediaModule, &CTelegramMediaModule::avatarReceived,
             this, &CTelegramCore::avatarReceived);
+    connect(m_private->m_mediaModule, &CTelegramMediaModule::peerPictureReceived,
+            this, &CTelegramCore::peerPictureReceived);
     connect(m_private->m_mediaModule, &CTelegramMediaModule::messageMediaDataReceived,
             this, &CTelegramCore::messageMediaDataReceived);
     connect(m_private->m_dispatcher, &CTelegramDispatcher::messageReceived,
             this, &CTelegramCore::messageReceived);
+    connect(m_private->m_dispatcher, &CTelegramDispatcher::messagesReceived,
+            this, &CTelegramCore::messagesReceived);
+    connect(m_private->m_dispatcher, &CTelegramDispatcher::historyReceived,
+            this, &CTelegramCore::historyReceived);
+    connect(m_private->m_dispatcher, &CTelegramDispatcher::historyRequestFailed,
+            this, &CTelegramCore::historyRequestFailed);
+    connect(m_private->m_dispatcher, &CTelegramDispatcher::messageMediaInfoAvailable,
+            this, &CTelegramCore::messageMediaInfoAvailable);
     connect(m_private->m_dispatcher, &CTelegramDispatcher::contactStatusChanged,
             this, &CTelegramCore::contactStatusChanged);
     connect(m_private->m_dispatcher, &CTelegramDispatcher::contactMessageActionChanged,
@@ -124,6 +134,10 @@ CTelegramCore::CTelegramCore(QObject *parent) :
             this, &CTelegramCore::filePartUploaded);
     connect(m_private->m_mediaModule, &CTelegramMediaModule::fileRequestFinished,
             this, &CTelegramCore::fileRequestFinished);
+    connect(m_private->m_mediaModule, &CTelegramMediaModule::fileDownloaded,
+            this, &CTelegramCore::fileDownloaded);
+    connect(m_private->m_mediaModule, &CTelegramMediaModule::fileRequestFailed,
+            this, &CTelegramCore::fileRequestFailed);
 }
 
 CTelegramCore::~CTelegramCore()
@@ -206,6 +220,11 @@ QByteArray CTelegramCore::connectionSecretInfo() const
     return m_private->m_dispatcher->connectionSecretInfo();
 }
 
+bool CTelegramCore::saveCacheSnapshot(QIODevice *device) const
+{
+    return m_private->m_dispatcher->saveCacheSnapshot(device);
+}
+
 quint64 CTelegramCore::authKeyId() const
 {
     return m_private->m_authModule->authKeyId();
@@ -242,6 +261,11 @@ bool CTelegramCore::setSecretInfo(const QByteArray &secret)
     return m_private->m_dispatcher->setSecretInfo(secret);
 }
 
+bool CTelegramCore::restoreCacheSnapshot(QIODevice *device)
+{
+    return m_private->m_dispatcher->restoreCacheSnapshot(device);
+}
+
 bool CTelegramCore::setServerConfiguration(const QVector<Telegram::DcOption> &dcs)
 {
     return m_private->m_dispatcher->setDcConfiguration(dcs);
@@ -342,11 +366,31 @@ quint32 CTelegramCore::requestFile(const Telegram::RemoteFile *file)
     return m_private->m_mediaModule->requestFile(file);
 }
 
+void CTelegramCore::prefetchPeerPictures(const QVector<Telegram::Peer> &peers, Telegram::PeerPictureSize size)
+{
+    m_private->m_mediaModule->prefetchPeerPictures(peers, size);
+}
+
+void CTelegramCore::setVisiblePeers(const QVector<Telegram::Peer> &peers)
+{
+    m_private->m_mediaModule->setVisiblePeers(peers);
+}
+
 bool CTelegramCore::requestHistory(const Telegram::Peer &peer, int offset, int limit)
 {
     return m_private->m_dispatcher->requestHistory(peer, offset, limit);
 }
 
+quint32 CTelegramCore::requestHistoryBefore(const Telegram::Peer &peer, quint32 messageId, quint32 limit)
+{
+    return m_private->m_dispatcher->requestHistoryBefore(peer, messageId, limit);
+}
+
+quint32 CTelegramCore::requestHistoryAfter(const Telegram::Peer &peer, quint32 messageId, quint32 limit)
+{
+    return m_private->m_dispatcher->requestHistoryAfter(peer, messageId, limit);
+}
+
 quint32 CTelegramCore::resolveUsername(const QString &userName)
 {
     return m_private->m_dispatcher->resolveUsername(userName);
@@ -450,6 +494,11 @@ void CTelegramCore::setAcceptableMessageTypes(TelegramNamespace::MessageTypeFlag
     return m_private->m_dispatcher->setAcceptableMessageTypes(types);
 }
 
+void CTelegramCore::setMessagesBatchingEnabled(bool enable)
+{
+    return m_private->m_dispatcher->setMessagesBatchingEnabled(enable);
+}
+
 void CTelegramCore::setAutoReconnection(bool enable)
 {
     return m_private->m_dispatcher->setAutoReconnection(enable);
@@ -470,6 +519,31 @@ void CTelegramCore::setMediaDataBufferSize(quint32 size)
     m_private->m_mediaModule->setMediaDataBufferSize(size);
 }
 
+void CTelegramCore::setDownloadDirectory(const QString &path)
+{
+    m_private->m_mediaModule->setDownloadDirectory(path);
+}
+
+void CTelegramCore::setMediaCacheDirectory(const QString &path)
+{
+    m_private->m_mediaModule->setMediaCacheDirectory(path);
+}
+
+void CTelegramCore::setMediaCacheSize(quint64 size)
+{
+    m_private->m_mediaModule->setMediaCacheSize(size);
+}
+
+void CTelegramCore::setMessageCacheSize(quint32 size)
+{
+    m_private->m_dispatcher->setMessageCacheSize(size);
+}
+
+void CTelegramCore::setDialogsPageSize(quint32 size)
+{
+    m_private->m_dispatcher->setDialogsPageSize(size);
+}
+
 QString CTelegramCore::selfPhone() const
 {
     return m_private->m_dispatcher->selfPhone();
@@ -480,6 +554,11 @@ quint32 CTelegramCore::selfId() const
     return m_private->m_dispatcher->selfId();
 }
 
+quint32 CTelegramCore::userIdByPhone(const QString &phone) const
+{
+    return m_private->m_dispatcher->userIdByPhone(phone);
+}
+
 quint32 CTelegramCore::maxMessageId() const
 {
     return m_private->m_dispatcher->maxMessageId();
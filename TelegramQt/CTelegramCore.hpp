@@ -57,14 +57,17 @@ public:
     Q_INVOKABLE Telegram::RsaKey serverPublicRsaKey() const;
     Q_INVOKABLE QVector<Telegram::DcOption> serverConfiguration();
     QByteArray connectionSecretInfo() const;
+    // Optional snapshot of users, chats, dialogs and contacts. Restore it after setSecretInfo() to skip the initial sync.
+    bool saveCacheSnapshot(QIODevice *device) const;
     quint64 authKeyId() const;
 
     Q_INVOKABLE TelegramNamespace::ConnectionState connectionState() const;
     Q_INVOKABLE QString selfPhone() const;
     Q_INVOKABLE quint32 selfId() const;
-    // maxMessageId is an id of the last sent or received message. Updated *after* messageReceived and sentMessageIdReceived signal emission.
+    // maxMessageId is an id of the last sent or received message. Updated *after* messageReceived (messagesReceived) and sentMessageIdReceived signal emission.
     Q_INVOKABLE quint32 maxMessageId() const;
     Q_INVOKABLE QVector<quint32> contactList() const;
+    Q_INVOKABLE quint32 userIdByPhone(const QString &phone) const; // Lookup among the known users. Returns 0 if the user is not known.
     Q_INVOKABLE QVector<Telegram::Peer> dialogs() const;
 
     Q_INVOKABLE QString peerPictureToken(const Telegram::Peer &peer, const Telegram::PeerPictureSize size = Telegram::PeerPictureSize::Small) const;
@@ -83,12 +86,26 @@ public:
 public Q_SLOTS:
     void setMessageReceivingFilter(TelegramNamespace::MessageFlags flags); // Messages with at least one of the passed flags will be filtered out.
     void setAcceptableMessageTypes(TelegramNamespace::MessageTypeFlags types);
+    // Deliver the history and the updates difference messages via messagesReceived() instead of messageReceived(). Disabled by default.
+    void setMessagesBatchingEnabled(bool enable);
     void setAutoReconnection(bool enable);
     void setUpdatesEnabled(bool enable);
 
     // By default, the app would ping server every 15 000 ms and instruct the server to close connection after 10 000 more ms. Pass interval = 0 to disable ping.
     void setPingInterval(quint32 interval, quint32 serverDisconnectionAdditionalTime = 10000);
     void setMediaDataBufferSize(quint32 size);
+    // Downloads of a known size are stored into the directory and resumed after a reconnection or restart.
+    // The file is available on fileDownloaded(); filePartReceived() carries only the parts received in this session.
+    // A file which is already in the directory is read from there without the network.
+    void setDownloadDirectory(const QString &path);
+    // Small downloaded files (avatars, stickers, thumbnails) are kept in the directory and served without the network.
+    void setMediaCacheDirectory(const QString &path);
+    // Disk budget (in bytes) of the media cache. Pass 0 to reset to the default value.
+    void setMediaCacheSize(quint64 size);
+    // Memory budget (in bytes) of the media messages cache. Pass 0 to reset to the default value.
+    void setMessageCacheSize(quint32 size);
+    // Number of dialogs requested per page on the initial sync (up to 100). Pass 0 to reset to the default value.
+    void setDialogsPageSize(quint32 size);
 
     bool connectToServer();
     void disconnectFromServer();
@@ -99,6 +116,7 @@ public Q_SLOTS:
 
     void resetConnectionData();
     bool setSecretInfo(const QByteArray &secret);
+    bool restoreCacheSnapshot(QIODevice *device);
 
     bool logOut();
 
@@ -119,8 +137,16 @@ public Q_SLOTS:
     void deleteContacts(const QVector<quint32> &userIds);
 
     quint32 requestFile(const Telegram::RemoteFile *file);
+    // Download the pictures in background (deduplicated, paused while the requested files are transferred) and get them via peerPictureReceived().
+    // Pictures of the visible peers are fetched first.
+    void prefetchPeerPictures(const QVector<Telegram::Peer> &peers, Telegram::PeerPictureSize size = Telegram::PeerPictureSize::Small);
+    void setVisiblePeers(const QVector<Telegram::Peer> &peers);
 
     bool requestHistory(const Telegram::Peer &peer, int offset, int limit);
+    // History cursors: request up to limit messages older (or newer) than the messageId and get them via historyReceived().
+    // Pass messageId = 0 to requestHistoryBefore() to start from the most recent message. Returns the cursor id or 0 on error.
+    quint32 requestHistoryBefore(const Telegram::Peer &peer, quint32 messageId, quint32 limit);
+    quint32 requestHistoryAfter(const Telegram::Peer &peer, quint32 messageId, quint32 limit);
 
     quint32 resolveUsername(const QString &userName);
 
@@ -166,10 +192,20 @@ Q_SIGNALS:
     void passwordInfoReceived(quint64 requestId);
 
     void avatarReceived(quint32 userId, const QByteArray &data, const QString &mimeType, const QString &avatarToken);
+    void peerPictureReceived(Telegram::Peer peer, const QByteArray &data, const QString &mimeType, const QString &pictureToken);
     void messageMediaDataReceived(Telegram::Peer peer, quint32 messageId, const QByteArray &data,
                                   const QString &mimeType, TelegramNamespace::MessageType type, quint32 offset, quint32 size);
 
     void messageReceived(const Telegram::Message &message);
+    // Messages of the history (requested via requestHistory()) and of the updates difference are delivered in chunks,
+    // if enabled via setMessagesBatchingEnabled().
+    void messagesReceived(const QVector<Telegram::Message> &messages);
+    // Messages, which are already delivered via this signal, are not requested again (and not included).
+    void historyReceived(quint32 cursorId, const Telegram::Peer &peer, const QVector<Telegram::Message> &messages, bool reachedEnd);
+    // The history request of the cursor is failed; the cursor is released and the page can be requested again.
+    void historyRequestFailed(quint32 cursorId, const Telegram::Peer &peer);
+    // getMessageMediaInfo() fails for a message evicted from the cache and requests it again. Retry on this signal.
+    void messageMediaInfoAvailable(Telegram::Peer peer, quint32 messageId);
 
     void contactStatusChanged(quint32 userId, TelegramNamespace::ContactStatus status);
     void contactMessageActionChanged(quint32 userId, TelegramNamespace::MessageAction action);
@@ -191,6 +227,9 @@ Q_SIGNALS:
     void filePartReceived(quint32 requestId, const QByteArray &data, const QString &mimeType, quint32 offset, quint32 totalSize);
     void filePartUploaded(quint32 requestId, quint32 offset, quint32 totalSize);
     void fileRequestFinished(quint32 requestId, Telegram::RemoteFile requestResult);
+    void fileDownloaded(quint32 requestId, const QString &filePath);
+    // The request is given up after a few failed attempts; no more signals are emitted for it.
+    void fileRequestFailed(quint32 requestId);
 
 public:
     // Deprecated:
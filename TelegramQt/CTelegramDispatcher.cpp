@@ -17,6 +17,7 @@
 
 #include "CTelegramDispatcher.hpp"
 
+#include "CacheSnapshot.hpp"
 #include "TelegramNamespace.hpp"
 #include "TelegramNamespace_p.hpp"
 #include "CTelegramConnection.hpp"
@@ -29,11 +30,13 @@
 using namespace TelegramUtils;
 using namespace Telegram;
 
+#include <QDateTime>
 #include <QTimer>
 
 #include <QCryptographicHash>
 #include <QDebug>
 #include <algorithm>
+#include <iterator>
 
 #ifdef DEVELOPER_BUILD
 #include "TLTypesDebug.hpp"
@@ -85,7 +88,13 @@ const quint32 secretFormatVersion = 4;
 const int s_userTypingActionPeriod = 6000; // 6 sec
 const int s_localTypingDuration = 5000; // 5 sec
 const int s_localTypingRecommendedRepeatInterval = 400; // (s_userTypingActionPeriod - s_localTypingDuration) / 2. Minus 100 ms for insurance.
-static const quint32 s_dialogsLimit = 30;
+static const int s_typingExpiryCoalescingInterval = 50; // Expire the statuses which are due within 50 ms in the same timeout
+static const qint64 s_unresolvedUserNameTimeout = 5 * 60 * 1000; // 5 min
+static const int s_unresolvedUserNamesLimit = 4096;
+static const qint64 s_resolveUserNameTimeout = 30 * 1000; // 30 sec
+static const quint32 s_defaultDialogsPageSize = 30;
+static const quint32 s_maxHistoryPageSize = 100; // Server-side limit
+static const quint32 s_maxDialogsPageSize = 100; // Server-side limit
 
 static const int s_autoConnectionIndexInvalid = -1; // App logic rely on (s_autoConnectionIndexInvalid + 1 == 0)
 
@@ -105,9 +114,11 @@ CTelegramDispatcher::CTelegramDispatcher(QObject *parent) :
     m_deltaTime(0),
     m_messageReceivingFilterFlags(TelegramNamespace::MessageFlagRead),
     m_acceptableMessageTypes(TelegramNamespace::MessageTypeAll),
+    m_messagesBatchingEnabled(false),
     m_autoReconnectionEnabled(false),
     m_initializationState(0),
     m_requestedSteps(0),
+    m_restoredSteps(0),
     m_wantedActiveDc(0),
     m_autoConnectionDcIndex(s_autoConnectionIndexInvalid),
     m_mainConnection(0),
@@ -116,10 +127,14 @@ CTelegramDispatcher::CTelegramDispatcher(QObject *parent) :
     m_updatesStateIsLocked(false),
     m_selfUserId(0),
     m_maxMessageId(0),
+    m_dialogsPageSize(s_defaultDialogsPageSize),
+    m_dialogsPagingReceived(0),
+    m_lastHistoryCursorId(0),
     m_typingUpdateTimer(new QTimer(this))
 {
     m_typingUpdateTimer->setSingleShot(true);
     connect(m_typingUpdateTimer, &QTimer::timeout, this, &CTelegramDispatcher::messageActionTimerTimeout);
+    m_typingClock.start();
 
     resetConnectionData();
     resetDcConfiguration();
@@ -200,7 +215,7 @@ QVector<quint32> CTelegramDispatcher::chatIdList() const
 
 QVector<Telegram::Peer> CTelegramDispatcher::dialogs() const
 {
-    return m_dialogs.keys().toVector();
+    return m_dialogs.peers();
 }
 
 void CTelegramDispatcher::addContacts(const QStringList &phoneNumbers, bool replace)
@@ -278,7 +293,8 @@ QByteArray CTelegramDispatcher::connectionSecretInfo() const
     if (m_updatesEnabled) {
         const quint32 dialogsCount = m_dialogs.count();
         outputStream << dialogsCount;
-        for (const TLDialog &dialog : m_dialogs) {
+        for (int i = 0; i < m_dialogs.count(); ++i) {
+            const TLDialog &dialog = m_dialogs.dialogAt(i);
             switch (dialog.tlType) {
             case TLValue::Dialog:
                 outputStream << quint8(DialogTypeDialog);
@@ -307,6 +323,106 @@ QByteArray CTelegramDispatcher::connectionSecretInfo() const
     return output;
 }
 
+bool CTelegramDispatcher::saveCacheSnapshot(QIODevice *device) const
+{
+    if (m_authKey.isEmpty()) {
+        qDebug() << Q_FUNC_INFO << "Cache snapshot is not available (there is no auth key).";
+        return false;
+    }
+
+    CacheSnapshot snapshot;
+    snapshot.authId = Utils::getFingerprints(m_authKey, Utils::Lower64Bits);
+    snapshot.maxMessageId = m_maxMessageId;
+
+    snapshot.users.reserve(m_users.count());
+    for (const TLUser *user : m_users) {
+        snapshot.users.append(*user);
+    }
+
+    // Keep the order of the public chat ids
+    snapshot.chats.reserve(m_chatIds.count());
+    for (quint32 chatId : m_chatIds) {
+        const TLChat *chat = m_chatInfo.value(chatId);
+        if (chat) {
+            snapshot.chats.append(*chat);
+        }
+    }
+
+    snapshot.dialogs.resize(m_dialogs.count());
+    for (int i = 0; i < m_dialogs.count(); ++i) {
+        snapshot.dialogs[i].dialog = m_dialogs.dialogAt(i);
+        snapshot.dialogs[i].date = m_dialogs.date(m_dialogs.peerAt(i));
+    }
+
+    snapshot.contactList = m_contactIdList;
+
+    // The cached (media) messages are kept as is, so they are not refetched on the first access after a restore.
+    const QVector<MessageCache::Key> messageKeys = m_messageCache.keys();
+    const QVector<TLMessage> messages = m_messageCache.messages();
+    snapshot.recentMessages.resize(messageKeys.count());
+    for (int i = 0; i < messageKeys.count(); ++i) {
+        snapshot.recentMessages[i].peer = messageKeys.at(i).peer;
+        snapshot.recentMessages[i].message = messages.at(i);
+    }
+
+    return snapshot.write(device);
+}
+
+bool CTelegramDispatcher::restoreCacheSnapshot(QIODevice *device)
+{
+    if (connectionState() != TelegramNamespace::ConnectionStateDisconnected) {
+        qWarning() << Q_FUNC_INFO << "Connection is already in progress.";
+        return false;
+    }
+    if (m_authKey.isEmpty()) {
+        qWarning() << Q_FUNC_INFO << "The snapshot should be restored after the secret info.";
+        return false;
+    }
+
+    CacheSnapshot snapshot;
+    if (!snapshot.read(device)) {
+        return false;
+    }
+    if (snapshot.authId != Utils::getFingerprints(m_authKey, Utils::Lower64Bits)) {
+        qWarning() << Q_FUNC_INFO << "The snapshot belongs to another session.";
+        return false;
+    }
+
+    onUsersReceived(snapshot.users);
+    onChatsReceived(snapshot.chats);
+
+    QVector<Telegram::Peer> newDialogs;
+    newDialogs.reserve(snapshot.dialogs.count());
+    m_dialogs.reserve(m_dialogs.count() + snapshot.dialogs.count());
+    for (const CacheSnapshot::Dialog &entry : snapshot.dialogs) {
+        const Telegram::Peer peer = toPublicPeer(entry.dialog.peer);
+        if (!peer.isValid()) {
+            continue;
+        }
+        if (m_dialogs.insert(peer, entry.dialog, entry.date)) {
+            newDialogs.append(peer);
+        }
+    }
+    if (!newDialogs.isEmpty()) {
+        emit dialogsChanged(newDialogs, {});
+    }
+
+    setContactList(snapshot.contactList);
+
+    // The least recently used first to keep the order
+    for (int i = snapshot.recentMessages.count() - 1; i >= 0; --i) {
+        const CacheSnapshot::Message &entry = snapshot.recentMessages.at(i);
+        m_messageCache.insert(entry.peer, entry.message);
+    }
+
+    m_maxMessageId = qMax(m_maxMessageId, snapshot.maxMessageId);
+
+    // The rest is caught up via getDifference(). The contact list is requested with the hash of the restored one,
+    // so the server answers with contactsContactsNotModified unless the contacts were changed meanwhile.
+    m_restoredSteps = InitializationStepFlags(StepDialogs);
+    return true;
+}
+
 void CTelegramDispatcher::setMessageReceivingFilter(TelegramNamespace::MessageFlags flags)
 {
     m_messageReceivingFilterFlags = flags;
@@ -317,11 +433,29 @@ void CTelegramDispatcher::setAcceptableMessageTypes(TelegramNamespace::MessageTy
     m_acceptableMessageTypes = types;
 }
 
+void CTelegramDispatcher::setMessagesBatchingEnabled(bool enable)
+{
+    m_messagesBatchingEnabled = enable;
+}
+
 void CTelegramDispatcher::setAutoReconnection(bool enable)
 {
     m_autoReconnectionEnabled = enable;
 }
 
+void CTelegramDispatcher::setMessageCacheSize(quint32 bytes)
+{
+    m_messageCache.setMaxCost(bytes);
+}
+
+void CTelegramDispatcher::setDialogsPageSize(quint32 size)
+{
+    if (!size) {
+        size = s_defaultDialogsPageSize;
+    }
+    m_dialogsPageSize = qMin(size, s_maxDialogsPageSize);
+}
+
 bool CTelegramDispatcher::setDcConfiguration(const QVector<Telegram::DcOption> &dcs)
 {
     if (connectionState() != TelegramNamespace::ConnectionStateDisconnected) {
@@ -546,16 +680,19 @@ void CTelegramDispatcher::resetConnectionData()
     m_delayedPackages.clear();
     qDeleteAll(m_users);
     m_users.clear();
-    qDeleteAll(m_knownMediaMessages);
-    m_knownMediaMessages.clear();
-    for (auto peerMessages : m_channelMediaMessages) {
-        qDeleteAll(*peerMessages);
-    }
-    qDeleteAll(m_channelMediaMessages);
-    m_channelMediaMessages.clear();
+    m_userNameToPeer.clear();
+    m_phoneToUserId.clear();
+    m_unresolvedUserNames.clear();
+    m_resolvingUserNames.clear();
+    m_messageCache.clear();
     m_contactIdList.clear();
+    m_contactsHash.clear();
+    m_restoredSteps = 0;
+    m_historyRequests.clear();
+    m_loadedHistory.clear();
     m_contactsMessageActions.clear();
     m_localMessageActions.clear();
+    m_typingUpdateTimer->stop();
 
     qDeleteAll(m_chatInfo);
     m_chatInfo.clear();
@@ -607,8 +744,9 @@ bool CTelegramDispatcher::requestHistory(const Telegram::Peer &peer, quint32 off
     }
 
     quint32 offsetId = m_maxMessageId + 1;
-    if (m_dialogs.contains(peer)) {
-        offsetId = m_dialogs.value(peer).topMessage + 1;
+    const TLDialog *dialog = m_dialogs.find(peer);
+    if (dialog) {
+        offsetId = dialog->topMessage + 1;
     }
 
     mainConnection()->messagesGetHistory(inputPeer, /* offsetId */ offsetId, /* addOffset */ offset, limit, /* maxId */ 0, /* minId */ 0);
@@ -616,23 +754,181 @@ bool CTelegramDispatcher::requestHistory(const Telegram::Peer &peer, quint32 off
     return true;
 }
 
+quint32 CTelegramDispatcher::requestHistoryBefore(const Telegram::Peer &peer, quint32 messageId, quint32 limit)
+{
+    return requestHistoryPage(peer, messageId, limit, /* older */ true);
+}
+
+quint32 CTelegramDispatcher::requestHistoryAfter(const Telegram::Peer &peer, quint32 messageId, quint32 limit)
+{
+    return requestHistoryPage(peer, messageId, limit, /* older */ false);
+}
+
+quint32 CTelegramDispatcher::requestHistoryPage(const Telegram::Peer &peer, quint32 messageId, quint32 limit, bool older)
+{
+    if (!mainConnection()) {
+        return 0;
+    }
+
+    const TLInputPeer inputPeer = toInputPeer(peer);
+    if (inputPeer.tlType == TLValue::InputPeerEmpty) {
+        qDebug() << Q_FUNC_INFO << "Can not resolve peer" << peer;
+        return 0;
+    }
+
+    HistoryCursor cursor;
+    cursor.id = ++m_lastHistoryCursorId;
+    cursor.peer = peer;
+    cursor.messageId = messageId;
+    cursor.limit = qBound(1u, limit, s_maxHistoryPageSize);
+    cursor.older = older;
+
+    // Skip the range, which is already delivered, instead of requesting it again
+    const MessageRangeSet loaded = m_loadedHistory.value(peer);
+    if (older && messageId) {
+        const MessageRangeSet::Range range = loaded.rangeOf(messageId - 1);
+        if (range.last) {
+            if (range.first <= 1) {
+                // Nothing left to load. Emit after the caller got the cursor id.
+                QTimer::singleShot(0, this, [this, cursor]() {
+                    emit historyReceived(cursor.id, cursor.peer, QVector<Telegram::Message>(), /* reachedEnd */ true);
+                });
+                return cursor.id;
+            }
+            cursor.messageId = range.first;
+        }
+    } else if (!older) {
+        const MessageRangeSet::Range range = loaded.rangeOf(messageId + 1);
+        if (range.last) {
+            cursor.messageId = range.last;
+        }
+    }
+
+    quint64 requestId = 0;
+    if (older) {
+        requestId = mainConnection()->messagesGetHistory(inputPeer, /* offsetId */ cursor.messageId, /* addOffset */ 0, cursor.limit, /* maxId */ 0, /* minId */ 0);
+    } else {
+        // A negative addOffset turns the page to the newer messages; minId excludes the anchor itself.
+        const quint32 addOffset = static_cast<quint32>(-static_cast<qint32>(cursor.limit));
+        requestId = mainConnection()->messagesGetHistory(inputPeer, /* offsetId */ cursor.messageId, addOffset, cursor.limit, /* maxId */ 0, /* minId */ cursor.messageId);
+    }
+    m_historyRequests.insert(requestId, cursor);
+    return cursor.id;
+}
+
 quint32 CTelegramDispatcher::resolveUsername(const QString &userName)
 {
     if (!mainConnection()) {
         return 0;
     }
 
-    foreach (const TLUser *user, m_users) {
-        if (user->username == userName) {
-            return user->id;
+    const QString key = userName.toCaseFolded();
+    const Telegram::Peer peer = m_userNameToPeer.value(key);
+    if (peer.type == Telegram::Peer::User) {
+        return peer.id;
+    }
+    if (peer.isValid()) {
+        // A known chat or channel, there is nothing to request.
+        emit userNameStatusUpdated(userName, TelegramNamespace::UserNameStatusResolved);
+        return 0;
+    }
+
+    const qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
+    const auto unresolved = m_unresolvedUserNames.find(key);
+    if (unresolved != m_unresolvedUserNames.end()) {
+        if (*unresolved > currentTime) {
+            qDebug() << Q_FUNC_INFO << "The user name is known to be unresolvable:" << userName;
+            emit userNameStatusUpdated(userName, TelegramNamespace::UserNameStatusUnknown);
+            return 0;
         }
+        m_unresolvedUserNames.erase(unresolved);
     }
 
-    mainConnection()->contactsResolveUsername(userName);
+    // Do not repeat the request while the previous one is in flight (unless it got lost)
+    const qint64 requestTime = m_resolvingUserNames.value(key);
+    if (!requestTime || (requestTime + s_resolveUserNameTimeout < currentTime)) {
+        m_resolvingUserNames.insert(key, currentTime);
+        mainConnection()->contactsResolveUsername(userName);
+    }
 
     return 0;
 }
 
+quint32 CTelegramDispatcher::userIdByPhone(const QString &phone) const
+{
+    return m_phoneToUserId.value(Telegram::Utils::normalizedPhoneNumber(phone));
+}
+
+void CTelegramDispatcher::onUserNameStatusUpdated(const QString &userName, TelegramNamespace::UserNameStatus status)
+{
+    const QString key = userName.toCaseFolded();
+    if (m_resolvingUserNames.remove(key)) {
+        switch (status) {
+        case TelegramNamespace::UserNameStatusResolved:
+            break;
+        case TelegramNamespace::UserNameStatusIsInvalid:
+        case TelegramNamespace::UserNameStatusUnknown:
+            if (m_unresolvedUserNames.count() >= s_unresolvedUserNamesLimit) {
+                purgeUnresolvedUserNames();
+            }
+            m_unresolvedUserNames.insert(key, QDateTime::currentMSecsSinceEpoch() + s_unresolvedUserNameTimeout);
+            break;
+        default:
+            break;
+        }
+    }
+    emit userNameStatusUpdated(userName, status);
+}
+
+void CTelegramDispatcher::purgeUnresolvedUserNames()
+{
+    const qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
+    for (auto it = m_unresolvedUserNames.begin(); it != m_unresolvedUserNames.end(); ) {
+        if (it.value() <= currentTime) {
+            it = m_unresolvedUserNames.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // Still too many distinct misses; it is just a cache, so drop it.
+    if (m_unresolvedUserNames.count() >= s_unresolvedUserNamesLimit) {
+        m_unresolvedUserNames.clear();
+    }
+}
+
+void CTelegramDispatcher::updateUserNameIndex(const QString &previousName, const QString &newName, const Telegram::Peer &peer)
+{
+    if (previousName == newName) {
+        return;
+    }
+    if (!previousName.isEmpty()) {
+        const QString previousKey = previousName.toCaseFolded();
+        if (m_userNameToPeer.value(previousKey) == peer) {
+            m_userNameToPeer.remove(previousKey);
+        }
+    }
+    if (!newName.isEmpty()) {
+        const QString key = newName.toCaseFolded();
+        m_userNameToPeer.insert(key, peer);
+        m_unresolvedUserNames.remove(key);
+    }
+}
+
+void CTelegramDispatcher::updatePhoneIndex(const QString &previousPhone, const QString &newPhone, quint32 userId)
+{
+    const QString previousKey = Telegram::Utils::normalizedPhoneNumber(previousPhone);
+    const QString key = Telegram::Utils::normalizedPhoneNumber(newPhone);
+    if (previousKey == key) {
+        return;
+    }
+    if (!previousKey.isEmpty() && (m_phoneToUserId.value(previousKey) == userId)) {
+        m_phoneToUserId.remove(previousKey);
+    }
+    if (!key.isEmpty()) {
+        m_phoneToUserId.insert(key, userId);
+    }
+}
+
 quint64 CTelegramDispatcher::sendMessage(const Telegram::Peer &peer, const QString &message)
 {
     if (!mainConnection()) {
@@ -641,20 +937,18 @@ quint64 CTelegramDispatcher::sendMessage(const Telegram::Peer &peer, const QStri
     }
     const TLInputPeer inputPeer = toInputPeer(peer);
 
-    int actionIndex = -1;
-
     switch (inputPeer.tlType) {
     case TLValue::InputPeerSelf:
         qDebug() << Q_FUNC_INFO << "Message to self";
         break;
     case TLValue::InputPeerUser:
-        actionIndex = TypingStatus::indexForUser(m_localMessageActions, inputPeer.userId);
+        m_localMessageActions.remove(0, inputPeer.userId);
         break;
     case TLValue::InputPeerChat:
-        actionIndex = TypingStatus::indexForChatAndUser(m_localMessageActions, inputPeer.chatId);
+        m_localMessageActions.remove(inputPeer.chatId, 0);
         break;
     case TLValue::InputPeerChannel:
-        actionIndex = TypingStatus::indexForChatAndUser(m_localMessageActions, inputPeer.channelId);
+        m_localMessageActions.remove(inputPeer.channelId, 0);
         break;
     case TLValue::InputPeerEmpty:
     default:
@@ -663,10 +957,6 @@ quint64 CTelegramDispatcher::sendMessage(const Telegram::Peer &peer, const QStri
         return 0;
     }
 
-    if (actionIndex >= 0) {
-        m_localMessageActions.remove(actionIndex);
-    }
-
     quint64 randomId;
     Utils::randomBytes(&randomId);
 #ifdef DEVELOPER_BUILD
@@ -768,7 +1058,8 @@ void CTelegramDispatcher::setTyping(const Telegram::Peer &peer, TelegramNamespac
 
     TLInputPeer inputPeer = toInputPeer(peer);
 
-    int actionIndex = -1;
+    quint32 chatId = 0;
+    quint32 userId = 0;
 
     switch (inputPeer.tlType) {
     case TLValue::InputPeerEmpty:
@@ -778,25 +1069,21 @@ void CTelegramDispatcher::setTyping(const Telegram::Peer &peer, TelegramNamespac
         // Makes no sense
         return;
     case TLValue::InputPeerUser:
-        actionIndex = TypingStatus::indexForUser(m_localMessageActions, inputPeer.userId);
+        userId = inputPeer.userId;
         break;
     case TLValue::InputPeerChat:
-        actionIndex = TypingStatus::indexForChatAndUser(m_localMessageActions, inputPeer.chatId);
+        chatId = inputPeer.chatId;
         break;
     case TLValue::InputPeerChannel:
-        actionIndex = TypingStatus::indexForChatAndUser(m_localMessageActions, inputPeer.channelId);
+        chatId = inputPeer.channelId;
         break;
     default:
         // Invalid InputPeer type
         return;
     }
 
-    if (actionIndex >= 0) {
-        if (m_localMessageActions.at(actionIndex).action == publicAction) {
-            return; // Avoid flood
-        }
-    } else if (publicAction == TelegramNamespace::MessageActionNone) {
-        return; // Avoid flood
+    if (m_localMessageActions.action(chatId, userId) == publicAction) {
+        return; // Avoid flood (MessageActionNone is returned for an unknown status as well)
     }
 
     const TLValue::Value tlAction = publicMessageActionToTelegramAction(publicAction);
@@ -807,27 +1094,11 @@ void CTelegramDispatcher::setTyping(const Telegram::Peer &peer, TelegramNamespac
     mainConnection()->messagesSetTyping(inputPeer, action);
 
     if (publicAction == TelegramNamespace::MessageActionNone) {
-        m_localMessageActions.remove(actionIndex);
+        m_localMessageActions.remove(chatId, userId);
     } else {
-        if (actionIndex >= 0) {
-            m_localMessageActions[actionIndex].action = publicAction;
-        } else {
-            TypingStatus status;
-            status.action = publicAction;
-            if (inputPeer.tlType == TLValue::InputPeerChat) {
-                status.chatId = inputPeer.chatId;
-            } else if (inputPeer.tlType == TLValue::InputPeerChannel) {
-                status.chatId = inputPeer.channelId;
-            } else {
-                status.userId = inputPeer.userId;
-            }
-            status.typingTime = s_localTypingDuration;
-
-            m_localMessageActions.append(status);
-        }
-
-        ensureTypingUpdateTimer(s_localTypingDuration);
+        m_localMessageActions.insert(chatId, userId, publicAction, m_typingClock.elapsed() + s_localTypingDuration);
     }
+    scheduleTypingUpdateTimer();
 }
 
 void CTelegramDispatcher::setMessageRead(const Telegram::Peer &peer, quint32 messageId)
@@ -908,14 +1179,13 @@ bool CTelegramDispatcher::setWantedDc(quint32 dc)
 
 bool CTelegramDispatcher::getDialogInfo(Telegram::DialogInfo *info, const Telegram::Peer peer) const
 {
-    if (!info || !m_dialogs.contains(peer)) {
+    const TLDialog *dialog = m_dialogs.find(peer);
+    if (!info || !dialog) {
         return false;
     }
-    
-    const TLDialog &dialog = m_dialogs.value(peer);
-    
+
     info->d->peer = peer;
-    info->d->muteUntil = dialog.notifySettings.muteUntil;
+    info->d->muteUntil = dialog->notifySettings.muteUntil;
     return true;
 }
 
@@ -1019,8 +1289,12 @@ void CTelegramDispatcher::onUsersReceived(const QVector<TLUser> &users)
     foreach (const TLUser &user, users) {
         TLUser *existsUser = m_users.value(user.id);
         if (existsUser) {
+            updateUserNameIndex(existsUser->username, user.username, toPublicPeer(user));
+            updatePhoneIndex(existsUser->phone, user.phone, user.id);
             *existsUser = user;
         } else {
+            updateUserNameIndex(QString(), user.username, toPublicPeer(user));
+            updatePhoneIndex(QString(), user.phone, user.id);
             m_users.insert(user.id, new TLUser(user));
         }
         if (user.self()) {
@@ -1074,98 +1348,159 @@ void CTelegramDispatcher::onContactListReceived(const QVector<quint32> &contactL
 
     QVector<quint32> newContactList = contactList;
     std::sort(newContactList.begin(), newContactList.end());
+    setContactList(newContactList);
 
-    if (m_contactIdList != newContactList) {
-        m_contactIdList = newContactList;
-        emit contactListChanged();
-    }
+    continueInitialization(StepContactList);
+}
 
+void CTelegramDispatcher::onContactListNotModified()
+{
+    qDebug() << Q_FUNC_INFO << "Keep the cached contact list" << m_contactIdList.count();
     continueInitialization(StepContactList);
 }
 
 void CTelegramDispatcher::onContactListChanged(const QVector<quint32> &added, const QVector<quint32> &removed)
 {
     qDebug() << Q_FUNC_INFO << added << removed;
-    QVector<quint32> newContactList = m_contactIdList;
 
-    // There is some redundant checks, but let's be paranoid
-    foreach (const quint32 contact, added) {
-        if (!newContactList.contains(contact)) {
-            newContactList.append(contact);
-        }
-    }
+    QVector<quint32> sortedAdded = added;
+    std::sort(sortedAdded.begin(), sortedAdded.end());
+    sortedAdded.erase(std::unique(sortedAdded.begin(), sortedAdded.end()), sortedAdded.end());
 
-    foreach (const quint32 contact, removed) {
-        for (int i = 0; i < newContactList.count(); ++i) {
-            // We can use remove one, because we warranty that there is no duplication
-#if QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)
-            newContactList.removeOne(contact);
-#else
-            int index = newContactList.indexOf(contact);
-            if (index < 0) {
-                continue;
-            }
-            newContactList.remove(index);
-#endif
-        }
-    }
+    QVector<quint32> sortedRemoved = removed;
+    std::sort(sortedRemoved.begin(), sortedRemoved.end());
 
-    std::sort(newContactList.begin(), newContactList.end());
+    // Both lists are sorted, so the union and the difference are linear
+    QVector<quint32> mergedContactList;
+    mergedContactList.reserve(m_contactIdList.count() + sortedAdded.count());
+    std::set_union(m_contactIdList.constBegin(), m_contactIdList.constEnd(),
+                   sortedAdded.constBegin(), sortedAdded.constEnd(),
+                   std::back_inserter(mergedContactList));
 
+    QVector<quint32> newContactList;
+    newContactList.reserve(mergedContactList.count());
+    std::set_difference(mergedContactList.constBegin(), mergedContactList.constEnd(),
+                        sortedRemoved.constBegin(), sortedRemoved.constEnd(),
+                        std::back_inserter(newContactList));
+
+    setContactList(newContactList);
+}
+
+void CTelegramDispatcher::setContactList(const QVector<quint32> &sortedContactList)
+{
     // There is no valid cases when lists are equal, but the check is (usually) cheap.
-    if (m_contactIdList != newContactList) {
-        m_contactIdList = newContactList;
-        emit contactListChanged();
+    if (m_contactIdList == sortedContactList) {
+        return;
+    }
+    m_contactIdList = sortedContactList;
+    m_contactsHash = contactListHash(m_contactIdList);
+    emit contactListChanged();
+}
+
+QString CTelegramDispatcher::contactListHash(const QVector<quint32> &sortedContactList)
+{
+    if (sortedContactList.isEmpty()) {
+        return QString();
+    }
+    // MD5 of the comma-separated sorted contact ids, as specified for contacts.getContacts
+    QByteArray ids;
+    ids.reserve(sortedContactList.count() * 11);
+    for (quint32 userId : sortedContactList) {
+        if (!ids.isEmpty()) {
+            ids.append(',');
+        }
+        ids.append(QByteArray::number(userId));
     }
+    return QString::fromLatin1(QCryptographicHash::hash(ids, QCryptographicHash::Md5).toHex());
 }
 
 void CTelegramDispatcher::messageActionTimerTimeout()
 {
-    int minTime = s_userTypingActionPeriod;
+    const qint64 time = m_typingClock.elapsed() + s_typingExpiryCoalescingInterval;
 
-    for (int i = m_contactsMessageActions.count() - 1; i >= 0; --i) {
-        int remainingTime = m_contactsMessageActions.at(i).typingTime - m_typingUpdateTimer->interval();
-        if (remainingTime < 15) { // Let 15 ms be allowed correction
-            if (m_contactsMessageActions.at(i).chatId) {
-                emit contactChatMessageActionChanged(m_contactsMessageActions.at(i).chatId,
-                                                    m_contactsMessageActions.at(i).userId,
-                                                    TelegramNamespace::MessageActionNone);
-            } else {
-                emit contactMessageActionChanged(m_contactsMessageActions.at(i).userId,
-                                                TelegramNamespace::MessageActionNone);
-            }
-            m_contactsMessageActions.remove(i);
+    for (const TypingStatusMap::Status &status : m_contactsMessageActions.takeExpired(time)) {
+        if (status.chatId) {
+            emit contactChatMessageActionChanged(status.chatId, status.userId, TelegramNamespace::MessageActionNone);
         } else {
-            m_contactsMessageActions[i].typingTime = remainingTime;
-            if (minTime > remainingTime) {
-                minTime = remainingTime;
-            }
+            emit contactMessageActionChanged(status.userId, TelegramNamespace::MessageActionNone);
         }
     }
 
-    for (int i = m_localMessageActions.count() - 1; i >= 0; --i) {
-        int timeRemaining = m_localMessageActions.at(i).typingTime - m_typingUpdateTimer->interval();
-        if (timeRemaining < 15) { // Let 15 ms be allowed correction
-            m_localMessageActions.remove(i);
-        } else {
-            m_localMessageActions[i].typingTime = timeRemaining;
-            if (minTime > timeRemaining) {
-                minTime = timeRemaining;
-            }
+    m_localMessageActions.takeExpired(time);
+
+    scheduleTypingUpdateTimer();
+}
+
+void CTelegramDispatcher::onMessagesHistoryReceived(const TLMessagesMessagesShared &history, const TLInputPeer &peer, quint64 requestId)
+{
+    Q_UNUSED(peer)
+    const TLMessagesMessages &messages = history.value();
+    onUsersReceived(messages.users);
+    onChatsReceived(messages.chats);
+
+    if (!m_historyRequests.contains(requestId)) {
+        // A legacy requestHistory() call
+        processMessagesReceived(messages.messages, /* applyFilter */ false, /* updateMaxMessageId */ true);
+        return;
+    }
+
+    const HistoryCursor cursor = m_historyRequests.take(requestId);
+    QVector<Telegram::Message> apiMessages;
+    apiMessages.reserve(messages.messages.count());
+    quint32 minId = 0;
+    quint32 maxId = 0;
+    for (const TLMessage &message : messages.messages) {
+        if (!minId || (message.id < minId)) {
+            minId = message.id;
+        }
+        maxId = qMax(maxId, message.id);
+        Telegram::Message apiMessage;
+        if (processMessage(message, &apiMessage)) {
+            apiMessages.append(apiMessage);
         }
     }
 
-    if (!m_contactsMessageActions.isEmpty() || !m_localMessageActions.isEmpty()) {
-        m_typingUpdateTimer->start(minTime);
+    const bool reachedEnd = quint32(messages.messages.count()) < cursor.limit;
+    MessageRangeSet &loaded = m_loadedHistory[cursor.peer];
+    if (cursor.older) {
+        // Everything between the oldest received message and the anchor is known now (the gaps are deleted messages)
+        const quint32 last = cursor.messageId ? cursor.messageId - 1 : maxId;
+        const quint32 first = reachedEnd ? 1 : minId;
+        if (first && last && (first <= last)) {
+            loaded.insert(first, last);
+        }
+    } else if (maxId) {
+        loaded.insert(cursor.messageId + 1, maxId);
+    }
+
+    emit historyReceived(cursor.id, cursor.peer, apiMessages, reachedEnd);
+}
+
+void CTelegramDispatcher::onMessagesHistoryRequestFailed(quint64 requestId)
+{
+    if (!m_historyRequests.contains(requestId)) {
+        return;
     }
+
+    const HistoryCursor cursor = m_historyRequests.take(requestId);
+    qDebug() << Q_FUNC_INFO << "History request failed for cursor" << cursor.id;
+    emit historyRequestFailed(cursor.id, cursor.peer);
 }
 
-void CTelegramDispatcher::onMessagesHistoryReceived(const TLMessagesMessages &messages)
+void CTelegramDispatcher::onMessagesMessagesReceived(const TLMessagesMessages &messages)
 {
+    // The messages are requested by getMessage() to restore evicted cache entries. Do not emit them as new messages.
     onUsersReceived(messages.users);
     onChatsReceived(messages.chats);
-    foreach (const TLMessage &message, messages.messages) {
-        processMessageReceived(message);
+    for (const TLMessage &message : messages.messages) {
+        if ((message.tlType != TLValue::Message) || (message.media.tlType == TLValue::MessageMediaEmpty)) {
+            continue;
+        }
+        const Telegram::Peer peer = messageDialogPeer(message);
+        if (peer.isValid()) {
+            m_messageCache.insert(peer, message);
+            emit messageMediaInfoAvailable(peer, message.id);
+        }
     }
 }
 
@@ -1182,13 +1517,54 @@ void CTelegramDispatcher::onMessagesDialogsReceived(const TLMessagesDialogs &dia
     onChatsReceived(dialogs.chats);
     qDebug() << Q_FUNC_INFO << "received dialogs:" << dialogs.dialogs.count();
 
+    // Index the page messages once instead of searching for the top message of each dialog.
+    // Only the message headers are decoded (see CTelegramStream::readDialogsPage()).
+    QHash<MessageCache::Key, quint32> messageDates; // (dialog peer, message id) to date
+    messageDates.reserve(dialogs.messages.count());
+    for (const TLMessage &message : dialogs.messages) {
+        messageDates.insert(MessageCache::Key(messageDialogPeer(message), message.id), message.date);
+    }
+
+    m_dialogs.reserve(m_dialogs.count() + dialogs.dialogs.count());
+
+    if (!offsetId && !offsetDate) {
+        m_dialogsPagingReceived = 0; // The first page
+    }
+    m_dialogsPagingReceived += dialogs.dialogs.count();
+
     QVector<Telegram::Peer> newDialogs;
+    newDialogs.reserve(dialogs.dialogs.count());
+
+    // The last valid dialog of the page is the offset of the next page
+    Telegram::Peer lastPeer;
+    quint32 lastMessageId = 0;
+    quint32 lastDate = 0;
+
     // Apply dialogs
     for (const TLDialog &dialog : dialogs.dialogs) {
+        if (!dialog.isValid()) {
+#ifdef DEVELOPER_BUILD
+            qWarning() << "Received invalid dialog!" << dialog;
+#else
+            qWarning() << "Received invalid dialog!";
+#endif
+            continue;
+        }
         const Telegram::Peer p = toPublicPeer(dialog.peer);
-        if (m_dialogs.contains(p)) {
+        if (!p.isValid()) {
+            continue;
+        }
+        const quint32 date = messageDates.value(MessageCache::Key(p, dialog.topMessage));
+        if (dialog.topMessage) {
+            lastPeer = p;
+            lastMessageId = dialog.topMessage;
+            lastDate = date;
+        }
+
+        TLDialog *existDialogPtr = m_dialogs.find(p);
+        if (existDialogPtr) {
             qDebug() << Q_FUNC_INFO << "Update dialog" << p;
-            TLDialog &existDialog = m_dialogs[p];
+            TLDialog &existDialog = *existDialogPtr;
             if (dialog.tlType == TLValue::DialogChannel) {
                 // update channel from
                 if (existDialog.pts < dialog.pts) {
@@ -1204,59 +1580,27 @@ void CTelegramDispatcher::onMessagesDialogsReceived(const TLMessagesDialogs &dia
                 qDebug() << "Dialog readInboxMaxId updated from" << existDialog.readInboxMaxId << "to" << dialog.readInboxMaxId;
             }
             existDialog = dialog;
+            if (date) {
+                m_dialogs.setDate(p, date);
+            }
         } else {
             qDebug() << Q_FUNC_INFO << "Add dialog" << p;
-            m_dialogs.insert(p, dialog);
+            m_dialogs.insert(p, dialog, date);
             newDialogs.append(p);
         }
     }
+
+    // Let the client render this page while the next one is loading
     if (!newDialogs.isEmpty()) {
         emit dialogsChanged(newDialogs, {});
     }
 
     if (dialogs.tlType == TLValue::MessagesDialogsSlice) {
-        quint32 lastDate = 0;
-        quint32 lastMessageId = 0;
-        Telegram::Peer lastPeer;
-
-        auto it = dialogs.dialogs.constEnd();
-        while (it != dialogs.dialogs.constBegin()) {
-            --it;
-            const TLDialog &dialog = *it;
-            if (!dialog.isValid()) {
-#ifdef DEVELOPER_BUILD
-                qWarning() << "Received invalid dialog!" << dialog;
-#else
-                qWarning() << "Received invalid dialog!";
-#endif
-                continue;
-            }
-
-            const Telegram::Peer p = toPublicPeer(dialog.peer);
-            if (!lastPeer.isValid() && p.isValid()) {
-                lastPeer = p;
-            }
-
-            if (!lastMessageId) {
-                quint32 messageId = dialog.topMessage;
-                if (messageId) {
-                    lastMessageId = messageId;
-                }
-                for (const TLMessage &message : dialogs.messages) {
-                    if (message.id == lastMessageId) {
-                        lastDate = message.date;
-                        break;
-                    }
-                }
-            }
-
-            if (lastPeer.isValid() && lastMessageId && lastDate) {
-                break; // Break the 'while dialog'
-            }
-        }
-
-        if (lastPeer.isValid() && lastMessageId) {
-            mainConnection()->messagesGetDialogs(lastDate, lastMessageId, toInputPeer(lastPeer), s_dialogsLimit);
+        // The known dialogs (e.g. restored or added by updates) do not count, only the received pages do
+        const bool hasMore = (m_dialogsPagingReceived < dialogs.count) && !dialogs.dialogs.isEmpty();
+        const bool hasProgress = lastMessageId && ((lastMessageId != offsetId) || (lastDate != offsetDate));
+        if (hasMore && hasProgress) {
+            mainConnection()->messagesGetDialogs(lastDate, lastMessageId, toInputPeer(lastPeer), m_dialogsPageSize);
             return;
         }
     }
@@ -1296,6 +1640,16 @@ void CTelegramDispatcher::getDcConfiguration()
 void CTelegramDispatcher::getInitialUsers()
 {
     m_askedInitialUsers.clear();
+    if (!m_selfUserId) {
+        // The self user can be already known from a restored cache snapshot
+        for (const TLUser *user : m_users) {
+            if (user->self()) {
+                m_selfUserId = user->id;
+                emit selfUserAvailable(m_selfUserId);
+                break;
+            }
+        }
+    }
     if (!m_selfUserId || !m_users.contains(m_selfUserId)) {
         TLInputUser selfUser;
         selfUser.tlType = TLValue::InputUserSelf;
@@ -1315,13 +1669,13 @@ void CTelegramDispatcher::getInitialUsers()
 void CTelegramDispatcher::getInitialDialogs()
 {
     qDebug() << Q_FUNC_INFO;
-    mainConnection()->messagesGetDialogs(/* offsetDate */ 0, /* offsetId */ 0, TLInputPeer(), /* limit */ s_dialogsLimit);
+    mainConnection()->messagesGetDialogs(/* offsetDate */ 0, /* offsetId */ 0, TLInputPeer(), /* limit */ m_dialogsPageSize);
 }
 
 void CTelegramDispatcher::getContacts()
 {
     qDebug() << Q_FUNC_INFO;
-    mainConnection()->contactsGetContacts(QString()); // Empty hash argument for now.
+    mainConnection()->contactsGetContacts(m_contactsHash);
 }
 
 void CTelegramDispatcher::getUpdatesState()
@@ -1358,13 +1712,7 @@ void CTelegramDispatcher::onUpdatesDifferenceReceived(const TLUpdatesDifference
             updateChat(chat);
         }
 
-        foreach (const TLMessage &message, updatesDifference.newMessages) {
-            if ((message.tlType != TLValue::MessageService) && (filterReceivedMessage(getPublicMessageFlags(message.flags)))) {
-                continue;
-            }
-
-            processMessageReceived(message);
-        }
+        processMessagesReceived(updatesDifference.newMessages, /* applyFilter */ true, /* updateMaxMessageId */ true);
         if (updatesDifference.tlType == TLValue::UpdatesDifference) {
             setUpdateState(updatesDifference.state.pts, updatesDifference.state.seq, updatesDifference.state.date);
         } else { // UpdatesDifferenceSlice
@@ -1405,13 +1753,7 @@ void CTelegramDispatcher::onUpdatesChannelDifferenceReceived(const TLUpdatesChan
             updateChat(chat);
         }
 
-        foreach (const TLMessage &message, updatesDifference.newMessages) {
-            if ((message.tlType != TLValue::MessageService) && (filterReceivedMessage(getPublicMessageFlags(message.flags)))) {
-                continue;
-            }
-
-            internalProcessMessageReceived(message);
-        }
+        processMessagesReceived(updatesDifference.newMessages, /* applyFilter */ true, /* updateMaxMessageId */ false);
 //        if (updatesDifference.tlType == TLValue::UpdatesChannelDifference) {
 //            setUpdateState(updatesDifference.state.pts, updatesDifference.state.seq, updatesDifference.state.date);
 //        } else { // UpdatesDifferenceSlice
@@ -1513,12 +1855,9 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
     case TLValue::UpdateNewChannelMessage:
     {
         qDebug() << Q_FUNC_INFO << "UpdateNewMessage";
-        const Telegram::Peer peer = toPublicPeer(update.message.toId);
-        if (m_dialogs.contains(peer)) {
-            const TLDialog &dialog = m_dialogs.value(peer);
-            if (update.message.id <= dialog.topMessage) {
-                break;
-            }
+        const TLDialog *dialog = m_dialogs.find(messageDialogPeer(update.message));
+        if (dialog && (update.message.id <= dialog->topMessage)) {
+            break;
         }
         processMessageReceived(update.message);
     }
@@ -1545,34 +1884,20 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
     case TLValue::UpdateChatUserTyping:
         if (m_users.contains(update.userId)) {
             TelegramNamespace::MessageAction action = telegramMessageActionToPublicAction(update.action.tlType);
+            const quint32 chatId = (update.tlType == TLValue::UpdateChatUserTyping) ? update.chatId : 0;
 
-            int remainingTime = s_userTypingActionPeriod;
-            remainingTime += m_typingUpdateTimer->remainingTime();
-
-            int index = -1;
-            if (update.tlType == TLValue::UpdateUserTyping) {
-                index = TypingStatus::indexForUser(m_contactsMessageActions, update.userId);
-                emit contactMessageActionChanged(update.userId, action);
+            if (chatId) {
+                emit contactChatMessageActionChanged(chatId, update.userId, action);
             } else {
-                index = TypingStatus::indexForChatAndUser(m_contactsMessageActions, update.chatId, update.userId);
-                emit contactChatMessageActionChanged(update.chatId,
-                                                    update.userId, action);
+                emit contactMessageActionChanged(update.userId, action);
             }
 
-            if (index < 0) {
-                index = m_contactsMessageActions.count();
-                TypingStatus status;
-                status.userId = update.userId;
-                if (update.tlType == TLValue::UpdateChatUserTyping) {
-                    status.chatId = update.chatId;
-                }
-                m_contactsMessageActions.append(status);
+            if (action == TelegramNamespace::MessageActionNone) {
+                m_contactsMessageActions.remove(chatId, update.userId);
+            } else {
+                m_contactsMessageActions.insert(chatId, update.userId, action, m_typingClock.elapsed() + s_userTypingActionPeriod);
             }
-
-            m_contactsMessageActions[index].action = action;
-            m_contactsMessageActions[index].typingTime = remainingTime;
-
-            ensureTypingUpdateTimer(remainingTime);
+            scheduleTypingUpdateTimer();
         }
         break;
     case TLValue::UpdateChatParticipants: {
@@ -1599,8 +1924,9 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
     case TLValue::UpdateUserName: {
         TLUser *user = m_users.value(update.userId);
         if (user) {
-            bool changed = (user->firstName == update.firstName) && (user->lastName == update.lastName);
+            const bool changed = (user->firstName != update.firstName) || (user->lastName != update.lastName) || (user->username != update.username);
             if (changed) {
+                updateUserNameIndex(user->username, update.username, toPublicPeer(*user));
                 user->firstName = update.firstName;
                 user->lastName = update.lastName;
                 user->username = update.username;
@@ -1696,8 +2022,9 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
             qDebug() << Q_FUNC_INFO << update.tlType << "Unable to resolve peer" << update.peer.tlType << update.peer.userId << update.peer.chatId;
 #endif
         }
-        if (m_dialogs.contains(peer)) {
-            m_dialogs[peer].readInboxMaxId = update.maxId;
+        TLDialog *dialog = m_dialogs.find(peer);
+        if (dialog) {
+            dialog->readInboxMaxId = update.maxId;
         }
         if (update.tlType == TLValue::UpdateReadHistoryInbox) {
             emit messageReadInbox(peer, update.maxId);
@@ -1709,8 +2036,9 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
     case TLValue::UpdateReadChannelInbox:
     {
         const Telegram::Peer peer = Telegram::Peer(update.channelId, Telegram::Peer::Channel);
-        if (m_dialogs.contains(peer)) {
-            m_dialogs[peer].readInboxMaxId = update.maxId;
+        TLDialog *dialog = m_dialogs.find(peer);
+        if (dialog) {
+            dialog->readInboxMaxId = update.maxId;
         }
         emit messageReadInbox(peer, update.maxId);
     }
@@ -1731,9 +2059,9 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
         break;
     case TLValue::UpdateNewChannelMessage:
     {
-        const Telegram::Peer peer = toPublicPeer(update.message.toId);
-        if (m_dialogs.contains(peer)) {
-            m_dialogs[peer].pts = update.pts;
+        TLDialog *dialog = m_dialogs.find(toPublicPeer(update.message.toId));
+        if (dialog) {
+            dialog->pts = update.pts;
         }
     }
         break;
@@ -1741,8 +2069,9 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
     {
         const Telegram::Peer peer = Telegram::Peer(update.channelId, Telegram::Peer::Channel);
         qDebug() << Q_FUNC_INFO << "DeleteChannelMessages is not implemented yet" << update.channelId << update.messages << update.pts << update.ptsCount;
-        if (m_dialogs.contains(peer)) {
-            m_dialogs[peer].pts = update.pts;
+        TLDialog *dialog = m_dialogs.find(peer);
+        if (dialog) {
+            dialog->pts = update.pts;
         }
     }
         break;
@@ -1760,10 +2089,57 @@ void CTelegramDispatcher::processMessageReceived(const TLMessage &message)
     ensureMaxMessageId(message.id);
 }
 
+// Applies a chunk of messages (history or difference) and delivers them at once via messagesReceived()
+// if the batching is enabled, or one by one via messageReceived() otherwise.
+void CTelegramDispatcher::processMessagesReceived(const QVector<TLMessage> &messages, bool applyFilter, bool updateMaxMessageId)
+{
+    if (!m_messagesBatchingEnabled) {
+        for (const TLMessage &message : messages) {
+            if (applyFilter && (message.tlType != TLValue::MessageService) && filterReceivedMessage(getPublicMessageFlags(message.flags))) {
+                continue;
+            }
+            internalProcessMessageReceived(message);
+            if (updateMaxMessageId) {
+                ensureMaxMessageId(message.id);
+            }
+        }
+        return;
+    }
+
+    QVector<Telegram::Message> apiMessages;
+    apiMessages.reserve(messages.count());
+    quint32 maxId = 0;
+    for (const TLMessage &message : messages) {
+        if (applyFilter && (message.tlType != TLValue::MessageService) && filterReceivedMessage(getPublicMessageFlags(message.flags))) {
+            continue;
+        }
+        Telegram::Message apiMessage;
+        if (processMessage(message, &apiMessage)) {
+            apiMessages.append(apiMessage);
+        }
+        maxId = qMax(maxId, message.id);
+    }
+    if (!apiMessages.isEmpty()) {
+        emit messagesReceived(apiMessages);
+    }
+    if (updateMaxMessageId) {
+        ensureMaxMessageId(maxId);
+    }
+}
+
 void CTelegramDispatcher::internalProcessMessageReceived(const TLMessage &message)
+{
+    Telegram::Message apiMessage;
+    if (processMessage(message, &apiMessage)) {
+        emit messageReceived(apiMessage);
+    }
+}
+
+// Applies the message to the local state and returns true if there is a public message to deliver
+bool CTelegramDispatcher::processMessage(const TLMessage &message, Telegram::Message *apiMessage)
 {
     if (message.tlType == TLValue::MessageEmpty) {
-        return;
+        return false;
     }
 
     if (message.tlType == TLValue::MessageService) {
@@ -1787,7 +2163,7 @@ void CTelegramDispatcher::internalProcessMessageReceived(const TLMessage &messag
             TLVector<TLChatParticipant> participants = fullChat.participants.participants;
             for (int i = 0; i < participants.count(); ++i) {
                 if (participants.at(i).userId == action.userId) {
-                    return;
+                    return false;
                 }
             }
 
@@ -1829,73 +2205,84 @@ void CTelegramDispatcher::internalProcessMessageReceived(const TLMessage &messag
             qWarning() << Q_FUNC_INFO << "Unimplemented service message type" << action.tlType.toString();
             break;
         }
-        return;
+        return false;
     }
 
     const TelegramNamespace::MessageType messageType = telegramMessageTypeToPublicMessageType(message.media.tlType);
 
     if (!(messageType & m_acceptableMessageTypes)) {
-        return;
+        return false;
     }
 
-    Telegram::Message apiMessage;
-
     TelegramNamespace::MessageFlags messageFlags = getPublicMessageFlags(message.flags);
     if (messageFlags & TelegramNamespace::MessageFlagForwarded) {
-        apiMessage.forwardContactId = message.fwdFromId.userId;
-        apiMessage.setForwardFromPeer(toPublicPeer(message.fwdFromId));
-        apiMessage.fwdTimestamp = message.fwdDate;
+        apiMessage->forwardContactId = message.fwdFromId.userId;
+        apiMessage->setForwardFromPeer(toPublicPeer(message.fwdFromId));
+        apiMessage->fwdTimestamp = message.fwdDate;
     }
 
     if (messageFlags & TelegramNamespace::MessageFlagIsReply) {
-        apiMessage.replyToMessageId = message.replyToMsgId;
-    }
-
-    Telegram::Peer peer;
-    if ((message.toId.tlType != TLValue::PeerUser) || (messageFlags & TelegramNamespace::MessageFlagOut)) {
-        // To a group chat or an outgoing message
-        peer = toPublicPeer(message.toId);
-    } else {
-        // Personal chat from someone
-        peer = Telegram::Peer(message.fromId, Telegram::Peer::User);
+        apiMessage->replyToMessageId = message.replyToMsgId;
     }
 
+    const Telegram::Peer peer = messageDialogPeer(message);
     if (!peer.isValid()) {
         qWarning() << Q_FUNC_INFO << "Unknown peer type!";
-        return;
+        return false;
     }
-    apiMessage.setPeer(peer);
-    apiMessage.fromId = message.fromId;
-    apiMessage.type = messageType;
-    apiMessage.text = message.message;
-    apiMessage.id = message.id;
-    apiMessage.timestamp = message.date;
-    apiMessage.flags = messageFlags;
-
-    if (!m_users.contains(apiMessage.fromId) && !m_askedUserIds.contains(apiMessage.fromId)) {
-        m_askedUserIds.append(apiMessage.fromId);
-        qWarning() << Q_FUNC_INFO << "Unknown user" << apiMessage.fromId; // Should not happen as we have proper dialogs getter
+    apiMessage->setPeer(peer);
+    apiMessage->fromId = message.fromId;
+    apiMessage->type = messageType;
+    apiMessage->text = message.message;
+    apiMessage->id = message.id;
+    apiMessage->timestamp = message.date;
+    apiMessage->flags = messageFlags;
+
+    if (!m_users.contains(apiMessage->fromId) && !m_askedUserIds.contains(apiMessage->fromId)) {
+        m_askedUserIds.append(apiMessage->fromId);
+        qWarning() << Q_FUNC_INFO << "Unknown user" << apiMessage->fromId; // Should not happen as we have proper dialogs getter
 //        activeConnection()->messagesGetDialogs(/* offsetDate */ 0, /* offsetId */ 0, TLInputPeer(), /* limit */ 1);
     }
 
     if (message.media.tlType != TLValue::MessageMediaEmpty) {
-        QHash<quint32, TLMessage*> *peerHash = nullptr;
-        if (peer.type == Telegram::Peer::Channel) {
-            if (!m_channelMediaMessages.contains(peer.id)) {
-                m_channelMediaMessages.insert(peer.id, new QHash<quint32, TLMessage*>());
-            }
-            peerHash = m_channelMediaMessages.value(peer.id);
-        } else {
-            peerHash = &m_knownMediaMessages;
-        }
-        if (!peerHash) { // Should never happen, right?
-            qWarning() << Q_FUNC_INFO << "Something went wrong. Unable to process media message, memory leak is very possible";
-            return;
-        }
-        peerHash->insert(message.id, new TLMessage(message));
+        m_messageCache.insert(peer, message);
+    }
+
+    TLDialog *dialog = m_dialogs.find(peer);
+    if (dialog && (message.id > dialog->topMessage)) {
+        dialog->topMessage = message.id;
+        m_dialogs.setDate(peer, message.date);
     }
 
-    emit messageReceived(apiMessage);
+    return true;
+}
+
+Telegram::Peer CTelegramDispatcher::messageDialogPeer(const TLMessage &message) const
+{
+    if ((message.toId.tlType != TLValue::PeerUser) || (message.flags & TelegramMessageFlagOut)) {
+        // To a group chat or an outgoing message
+        return toPublicPeer(message.toId);
+    }
+    // Personal chat from someone
+    return Telegram::Peer(message.fromId, Telegram::Peer::User);
+}
+
+bool CTelegramDispatcher::requestMessage(quint32 messageId, const Telegram::Peer &peer)
+{
+    if (!mainConnection()) {
+        return false;
+    }
+
+    if (peer.type == Telegram::Peer::Channel) {
+        const TLInputChannel inputChannel = toInputChannel(peer);
+        if (inputChannel.tlType == TLValue::InputChannelEmpty) {
+            return false;
+        }
+        mainConnection()->channelsGetMessages(inputChannel, TLVector<quint32>() << messageId);
+    } else {
+        mainConnection()->messagesGetMessages(TLVector<quint32>() << messageId);
+    }
+    return true;
 }
 
 void CTelegramDispatcher::emitChatChanged(quint32 id)
@@ -1920,11 +2307,14 @@ void CTelegramDispatcher::emitChatChanged(quint32 id)
 
 void CTelegramDispatcher::updateChat(const TLChat &newChat)
 {
-    if (!m_chatInfo.contains(newChat.id)) {
+    TLChat *existChat = m_chatInfo.value(newChat.id);
+    if (!existChat) {
+        updateUserNameIndex(QString(), newChat.username, toPublicPeer(&newChat));
         TLChat *newChatInstance = new TLChat(newChat);
         m_chatInfo.insert(newChat.id, newChatInstance);
     } else {
-        *m_chatInfo[newChat.id] = newChat;
+        updateUserNameIndex(existChat->username, newChat.username, toPublicPeer(&newChat));
+        *existChat = newChat;
     }
     emitChatChanged(newChat.id);
 }
@@ -2167,12 +2557,18 @@ void CTelegramDispatcher::onConnectionAuthChanged(int newStateInt, quint32 dc)
         if (newState == CTelegramConnection::AuthStateSignedIn) {
             connect(connection, &CTelegramConnection::contactListReceived,
                     this, &CTelegramDispatcher::onContactListReceived);
+            connect(connection, &CTelegramConnection::contactListNotModified,
+                    this, &CTelegramDispatcher::onContactListNotModified);
             connect(connection, &CTelegramConnection::contactListChanged,
                     this, &CTelegramDispatcher::onContactListChanged);
             connect(connection, &CTelegramConnection::updatesReceived,
                     this, &CTelegramDispatcher::onUpdatesReceived);
             connect(connection, &CTelegramConnection::messagesHistoryReceived,
                     this, &CTelegramDispatcher::onMessagesHistoryReceived);
+            connect(connection, &CTelegramConnection::messagesHistoryRequestFailed,
+                    this, &CTelegramDispatcher::onMessagesHistoryRequestFailed);
+            connect(connection, &CTelegramConnection::messagesMessagesReceived,
+                    this, &CTelegramDispatcher::onMessagesMessagesReceived);
             connect(connection, &CTelegramConnection::messagesDialogsReceived,
                     this, &CTelegramDispatcher::onMessagesDialogsReceived);
             connect(connection, &CTelegramConnection::messagesAffectedMessagesReceived,
@@ -2190,7 +2586,7 @@ void CTelegramDispatcher::onConnectionAuthChanged(int newStateInt, quint32 dc)
             connect(connection, &CTelegramConnection::messagesFullChatReceived,
                     this, &CTelegramDispatcher::onMessagesFullChatReceived);
             connect(connection, &CTelegramConnection::userNameStatusUpdated,
-                    this, &CTelegramDispatcher::userNameStatusUpdated);
+                    this, &CTelegramDispatcher::onUserNameStatusUpdated);
         }
 
          // Start initialization, if it is not started yet.
@@ -2408,7 +2804,6 @@ void CTelegramDispatcher::onUpdatesReceived(const TLUpdates &updates, quint64 id
         shortMessage.fwdDate = updates.fwdDate;
         shortMessage.replyToMsgId = updates.replyToMsgId;
 
-        int messageActionIndex = 0;
         if (updates.tlType == TLValue::UpdateShortMessage) {
             shortMessage.toId.tlType = TLValue::PeerUser;
 
@@ -2420,9 +2815,8 @@ void CTelegramDispatcher::onUpdatesReceived(const TLUpdates &updates, quint64 id
                 shortMessage.fromId = updates.userId;
             }
 
-            messageActionIndex = TypingStatus::indexForUser(m_contactsMessageActions, updates.fromId);
-            if (messageActionIndex >= 0) {
-                emit contactMessageActionChanged(updates.fromId, TelegramNamespace::MessageActionNone);
+            if (m_contactsMessageActions.remove(0, shortMessage.fromId)) {
+                emit contactMessageActionChanged(shortMessage.fromId, TelegramNamespace::MessageActionNone);
             }
 
         } else {
@@ -2431,8 +2825,7 @@ void CTelegramDispatcher::onUpdatesReceived(const TLUpdates &updates, quint64 id
 
             shortMessage.fromId = updates.fromId;
 
-            messageActionIndex = TypingStatus::indexForUser(m_contactsMessageActions, updates.fromId);
-            if (messageActionIndex >= 0) {
+            if (m_contactsMessageActions.remove(updates.chatId, updates.fromId)) {
                 emit contactChatMessageActionChanged(updates.chatId,
                                                     updates.fromId,
                                                     TelegramNamespace::MessageActionNone);
@@ -2440,10 +2833,6 @@ void CTelegramDispatcher::onUpdatesReceived(const TLUpdates &updates, quint64 id
         }
 
         processUpdate(update);
-
-        if (messageActionIndex > 0) {
-            m_contactsMessageActions.remove(messageActionIndex);
-        }
     }
         break;
     case TLValue::UpdateShort:
@@ -2508,11 +2897,25 @@ void CTelegramDispatcher::onAuthExportedAuthorizationReceived(quint32 dc, quint3
     }
 }
 
-void CTelegramDispatcher::ensureTypingUpdateTimer(int interval)
+void CTelegramDispatcher::scheduleTypingUpdateTimer()
 {
-    if (!m_typingUpdateTimer->isActive()) {
-        m_typingUpdateTimer->start(interval);
+    // The single timer is armed for the earliest deadline of both maps
+    qint64 deadline = m_contactsMessageActions.nextDeadline();
+    const qint64 localDeadline = m_localMessageActions.nextDeadline();
+    if ((deadline < 0) || ((localDeadline >= 0) && (localDeadline < deadline))) {
+        deadline = localDeadline;
     }
+
+    if (deadline < 0) {
+        m_typingUpdateTimer->stop();
+        return;
+    }
+
+    const int interval = int(qMax<qint64>(0, deadline - m_typingClock.elapsed()));
+    if (m_typingUpdateTimer->isActive() && (qAbs(m_typingUpdateTimer->remainingTime() - interval) < s_typingExpiryCoalescingInterval)) {
+        return; // Close enough, keep the timer as is
+    }
+    m_typingUpdateTimer->start(interval);
 }
 
 void CTelegramDispatcher::continueInitialization(CTelegramDispatcher::InitializationStep justDone)
@@ -2534,6 +2937,7 @@ void CTelegramDispatcher::continueInitialization(CTelegramDispatcher::Initializa
     if (!m_updatesEnabled) {
         skippedSteps |= StepUpdates;
     }
+    skippedSteps |= m_restoredSteps;
     const InitializationStepFlags neededSteps = ~(m_initializationState|m_requestedSteps|skippedSteps);
     if (neededSteps & StepDcConfiguration) {
         qDebug() << "CTelegramDispatcher::continueInitialization(): Request DC Configuration";
@@ -2694,12 +3098,10 @@ void CTelegramDispatcher::updateSentMessageId(quint64 randomId, quint32 resolved
 {
     if (m_randomMessageToPeerMap.contains(randomId)) {
         const Telegram::Peer peer = m_randomMessageToPeerMap.take(randomId);
-        if (m_dialogs.contains(peer)) {
-            TLDialog &dialog = m_dialogs[peer];
-            if (resolvedId > dialog.topMessage) {
-                qDebug() << "Up top dialog message from" << dialog.topMessage << "to" << resolvedId;
-                dialog.topMessage = resolvedId;
-            }
+        TLDialog *dialog = m_dialogs.find(peer);
+        if (dialog && (resolvedId > dialog->topMessage)) {
+            qDebug() << "Up top dialog message from" << dialog->topMessage << "to" << resolvedId;
+            dialog->topMessage = resolvedId;
         }
     }
     qDebug() << Q_FUNC_INFO << "Sent message id received:" << resolvedId << "is the id of message" << randomId;
@@ -2855,15 +3257,13 @@ const TLChat *CTelegramDispatcher::getChat(const Telegram::Peer &peer) const
     }
 }
 
-const TLMessage *CTelegramDispatcher::getMessage(quint32 messageId, const Telegram::Peer &peer) const
+const TLMessage *CTelegramDispatcher::getMessage(quint32 messageId, const Telegram::Peer &peer)
 {
-    if (peer.type == Telegram::Peer::Channel) {
-        QHash<quint32, TLMessage*> *peerMessages = m_channelMediaMessages.value(peer.id); // message id, message
-        if (!peerMessages) {
-            return nullptr;
-        }
-
-        return peerMessages->value(messageId);
+    const TLMessage *message = m_messageCache.object(peer, messageId);
+    if (!message && m_messageCache.isEvicted(peer, messageId) && requestMessage(messageId, peer)) {
+        // Keep the mark until the request is sent, so the message can be requested on the next call otherwise
+        qDebug() << Q_FUNC_INFO << "Refetch evicted message" << messageId << "of peer" << peer.type << peer.id;
+        m_messageCache.takeEvicted(peer, messageId);
     }
-    return m_knownMediaMessages.value(messageId);
+    return message;
 }
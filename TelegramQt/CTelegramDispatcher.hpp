@@ -20,14 +20,19 @@
 
 #include <QObject>
 
+#include <QElapsedTimer>
 #include <QHash>
 #include <QPair>
 #include <QStringList>
 #include <QVector>
 
+#include "DialogMap.hpp"
 #include "FileRequestDescriptor.hpp"
+#include "MessageCache.hpp"
+#include "MessageRangeSet.hpp"
 #include "TLTypes.hpp"
 #include "TelegramNamespace.hpp"
+#include "TypingStatusMap.hpp"
 
 QT_FORWARD_DECLARE_CLASS(QCryptographicHash)
 QT_FORWARD_DECLARE_CLASS(QIODevice)
@@ -37,17 +42,6 @@ class CAppInformation;
 class CTelegramConnection;
 class CTelegramModule;
 
-namespace Telegram
-{
-
-inline uint qHash(const Peer &key, uint seed)
-{
-    quint32 s = seed;
-    return key.id ^ s;
-}
-
-}
-
 class CTelegramDispatcher : public QObject
 {
     Q_OBJECT
@@ -92,25 +86,38 @@ public:
     quint32 maxMessageId() const;
     QVector<quint32> contactIdList() const;
     QVector<quint32> chatIdList() const;
-    QVector<Telegram::Peer> dialogs() const;
+    QVector<Telegram::Peer> dialogs() const; // Sorted by the top message date (the most recent first)
 
     void addContacts(const QStringList &phoneNumbers, bool replace = false);
     void deleteContacts(const QVector<quint32> &userIds);
 
     QByteArray connectionSecretInfo() const;
 
+    bool saveCacheSnapshot(QIODevice *device) const;
+    bool restoreCacheSnapshot(QIODevice *device);
+
     quint32 messageReceivingFilterFlags() const { return m_messageReceivingFilterFlags; }
     void setMessageReceivingFilter(TelegramNamespace::MessageFlags flags);
     void setAcceptableMessageTypes(TelegramNamespace::MessageTypeFlags types);
+    void setMessagesBatchingEnabled(bool enable);
     void setAutoReconnection(bool enable);
 
+    quint32 messageCacheSize() const { return m_messageCache.maxCost(); }
+    void setMessageCacheSize(quint32 bytes);
+
+    quint32 dialogsPageSize() const { return m_dialogsPageSize; }
+    void setDialogsPageSize(quint32 size);
+
     bool setDcConfiguration(const QVector<Telegram::DcOption> &dcs);
     bool connectToServer();
     bool setSecretInfo(const QByteArray &secret);
     void disconnectFromServer();
 
     bool requestHistory(const Telegram::Peer &peer, quint32 offset, quint32 limit);
+    quint32 requestHistoryBefore(const Telegram::Peer &peer, quint32 messageId, quint32 limit);
+    quint32 requestHistoryAfter(const Telegram::Peer &peer, quint32 messageId, quint32 limit);
     quint32 resolveUsername(const QString &userName);
+    quint32 userIdByPhone(const QString &phone) const;
 
     quint64 sendMessage(const Telegram::Peer &peer, const QString &message);
     quint64 sendMedia(const Telegram::Peer &peer, const TLInputMedia &inputMedia);
@@ -147,7 +154,7 @@ public:
     // Getters
     const TLUser *getUser(quint32 userId) const;
     const TLChat *getChat(const Telegram::Peer &peer) const;
-    const TLMessage *getMessage(quint32 messageId, const Telegram::Peer &peer) const;
+    const TLMessage *getMessage(quint32 messageId, const Telegram::Peer &peer);
 
     bool getDialogInfo(Telegram::DialogInfo *info, const Telegram::Peer peer) const;
     bool getUserInfo(Telegram::UserInfo *userInfo, quint32 userId) const;
@@ -177,6 +184,10 @@ signals:
     void contactProfileChanged(quint32 userId);
 
     void messageReceived(const Telegram::Message &message);
+    void messagesReceived(const QVector<Telegram::Message> &messages);
+    void historyReceived(quint32 cursorId, const Telegram::Peer &peer, const QVector<Telegram::Message> &messages, bool reachedEnd);
+    void historyRequestFailed(quint32 cursorId, const Telegram::Peer &peer);
+    void messageMediaInfoAvailable(Telegram::Peer peer, quint32 messageId);
 
     void contactStatusChanged(quint32 userId, TelegramNamespace::ContactStatus status);
     void contactMessageActionChanged(quint32 userId, TelegramNamespace::MessageAction action);
@@ -207,10 +218,14 @@ protected slots:
     void onChannelsParticipantsReceived(quint32 channelId, TLVector<TLChannelParticipant> participants);
 
     void onContactListReceived(const QVector<quint32> &contactIdList);
+    void onUserNameStatusUpdated(const QString &userName, TelegramNamespace::UserNameStatus status);
+    void onContactListNotModified();
     void onContactListChanged(const QVector<quint32> &added, const QVector<quint32> &removed);
     void messageActionTimerTimeout();
 
-    void onMessagesHistoryReceived(const TLMessagesMessages &messages);
+    void onMessagesHistoryReceived(const TLMessagesMessagesShared &history, const TLInputPeer &peer, quint64 requestId);
+    void onMessagesHistoryRequestFailed(quint64 requestId);
+    void onMessagesMessagesReceived(const TLMessagesMessages &messages);
     void onMessagesDialogsReceived(const TLMessagesDialogs &dialogs, quint32 offsetDate, quint32 offsetId, const TLInputPeer &offsetPeer, quint32 limit);
     void onMessagesAffectedMessagesReceived(const TLMessagesAffectedMessages &affectedMessages);
 
@@ -232,7 +247,30 @@ protected:
     void processUpdate(const TLUpdate &update);
 
     void processMessageReceived(const TLMessage &message);
+    void processMessagesReceived(const QVector<TLMessage> &messages, bool applyFilter, bool updateMaxMessageId);
     void internalProcessMessageReceived(const TLMessage &message);
+    bool processMessage(const TLMessage &message, Telegram::Message *apiMessage);
+
+    Telegram::Peer messageDialogPeer(const TLMessage &message) const;
+    bool requestMessage(quint32 messageId, const Telegram::Peer &peer);
+
+    void updateUserNameIndex(const QString &previousName, const QString &newName, const Telegram::Peer &peer);
+    void updatePhoneIndex(const QString &previousPhone, const QString &newPhone, quint32 userId);
+    void purgeUnresolvedUserNames();
+
+    struct HistoryCursor {
+        HistoryCursor() : id(0), messageId(0), limit(0), older(true) { }
+        quint32 id;
+        Telegram::Peer peer;
+        quint32 messageId; // The anchor (exclusive)
+        quint32 limit;
+        bool older;
+    };
+
+    quint32 requestHistoryPage(const Telegram::Peer &peer, quint32 messageId, quint32 limit, bool older);
+
+    void setContactList(const QVector<quint32> &sortedContactList);
+    static QString contactListHash(const QVector<quint32> &sortedContactList);
 
     void emitChatChanged(quint32 id);
     void updateChat(const TLChat &newChat);
@@ -245,7 +283,7 @@ protected:
 
     bool filterReceivedMessage(quint32 messageFlags) const;
 
-    void ensureTypingUpdateTimer(int interval);
+    void scheduleTypingUpdateTimer();
     void ensureUpdateState(quint32 pts = 0, quint32 seq = 0, quint32 date = 0);
     void setUpdateState(quint32 pts, quint32 seq, quint32 date);
 
@@ -264,40 +302,6 @@ protected:
 
     TelegramNamespace::MessageFlags getPublicMessageFlags(quint32 flags);
 
-    struct TypingStatus {
-        TypingStatus() : chatId(0), userId(0),
-            typingTime(0), action(TelegramNamespace::MessageActionNone) { }
-
-        quint32 chatId;
-        quint32 userId;
-        int typingTime; // (ms)
-        TelegramNamespace::MessageAction action;
-
-        static int indexForUser(const QVector<TypingStatus> &statusVector, quint32 userId) {
-            for (int i = 0; i < statusVector.count(); ++i) {
-                if (statusVector.at(i).chatId) {
-                    continue;
-                }
-
-                if (statusVector.at(i).userId == userId) {
-                    return i;
-                }
-            }
-
-            return -1;
-        }
-
-        static int indexForChatAndUser(const QVector<TypingStatus> &statusVector, quint32 chatId, quint32 userId = 0) {
-            for (int i = 0; i < statusVector.count(); ++i) {
-                if ((statusVector.at(i).chatId == chatId) && (statusVector.at(i).userId == userId)) {
-                    return i;
-                }
-            }
-
-            return -1;
-        }
-    };
-
     TelegramNamespace::ConnectionState m_connectionState;
 
     const CAppInformation *m_appInformation;
@@ -310,10 +314,12 @@ protected:
 
     TelegramNamespace::MessageFlags m_messageReceivingFilterFlags;
     TelegramNamespace::MessageTypeFlags m_acceptableMessageTypes;
+    bool m_messagesBatchingEnabled;
     bool m_autoReconnectionEnabled;
 
     InitializationStepFlags m_initializationState;
     InitializationStepFlags m_requestedSteps;
+    InitializationStepFlags m_restoredSteps; // Steps with data restored from a cache snapshot
 
     quint32 m_wantedActiveDc;
     int m_autoConnectionDcIndex;
@@ -336,26 +342,37 @@ protected:
     QHash<quint32, TLUser*> m_users;
     QVector<quint32> m_askedUserIds;
     QVector<TLInputUser> m_askedInitialUsers;
+    QHash<QString, Telegram::Peer> m_userNameToPeer; // Case folded user name to the user or channel
+    QHash<QString, quint32> m_phoneToUserId; // Normalized (digits only) phone to user id
+    QHash<QString, qint64> m_unresolvedUserNames; // Case folded user name to the negative cache expiration time (ms)
+    QHash<QString, qint64> m_resolvingUserNames; // Case folded user name to the request time (ms)
 
-    QHash<quint32, TLMessage*> m_knownMediaMessages; // message id, message
-    QHash<quint32, QHash<quint32, TLMessage*> *> m_channelMediaMessages; // ChannelId to <message id, message>
+    MessageCache m_messageCache; // Media messages
 
     quint32 m_selfUserId;
     quint32 m_maxMessageId;
 
     QVector<quint32> m_contactIdList;
+    QString m_contactsHash;
 
     // fileId is program-specific handler, not related to Telegram.
     QHash<quint64,quint64> m_rpcIdToMessageRandomIdMap; // RPC Id, Random Id
     QHash<quint64,Telegram::Peer> m_randomMessageToPeerMap; // Random Id, Peer
 
+    QHash<quint64, HistoryCursor> m_historyRequests; // RPC Id, Cursor
+    QHash<Telegram::Peer, MessageRangeSet> m_loadedHistory; // Message ranges, which are already delivered via historyReceived()
+    quint32 m_lastHistoryCursorId;
+
     QTimer *m_typingUpdateTimer;
-    QVector<TypingStatus> m_contactsMessageActions;
-    QVector<TypingStatus> m_localMessageActions;
+    QElapsedTimer m_typingClock;
+    TypingStatusMap m_contactsMessageActions; // (chatId, userId)
+    TypingStatusMap m_localMessageActions; // (chatId, 0) or (0, userId)
 
     TLVector<quint32> m_chatIds; // Telegram chat ids vector. Index is "public chat id".
 
-    QHash<Telegram::Peer,TLDialog> m_dialogs;
+    DialogMap m_dialogs;
+    quint32 m_dialogsPageSize;
+    quint32 m_dialogsPagingReceived; // Dialogs received since the first page was requested
     QHash<quint32, TLChat*> m_chatInfo; // Telegram chat id to Chat map
     QHash<quint32, TLChatFull> m_chatFullInfo; // Telegram chat id to ChatFull map
     QHash<quint32, TLVector<TLChannelParticipant> > m_channelParticipants; // Telegram chat id to ChatFull map
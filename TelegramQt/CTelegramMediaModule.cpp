@@ -22,8 +22,13 @@
 #include "TelegramUtils.hpp"
 #include "Utils.hpp"
 #include "Debug.hpp"
+#include "PartialFile.hpp"
 
 #include <QDebug>
+#include <QDir>
+#include <QMimeDatabase>
+#include <QSharedPointer>
+#include <QTimer>
 
 #ifdef DEVELOPER_BUILD
 #include "TLTypesDebug.hpp"
@@ -31,11 +36,16 @@
 
 using namespace TelegramUtils;
 
+static const int s_maxPrefetchRequests = 8;
+static const quint32 s_peerPictureChunkSize = 512 * 256; // Set chunkSize to some big number to get the whole picture at once
+
 CTelegramMediaModule::CTelegramMediaModule(QObject *parent) :
     CTelegramModule(parent),
     m_mediaDataBufferSize(FileRequestDescriptor::defaultDownloadPartSize()),
-    m_fileRequestCounter(0)
+    m_fileRequestCounter(0),
+    m_localRequestsContext(new QObject(this))
 {
+    m_clock.start();
 }
 
 CTelegramMediaModule::~CTelegramMediaModule()
@@ -44,18 +54,38 @@ CTelegramMediaModule::~CTelegramMediaModule()
 
 void CTelegramMediaModule::setMediaDataBufferSize(quint32 size)
 {
-    if (size % 256) {
-        qDebug() << Q_FUNC_INFO << "Unable to set incorrect size" << size << ". The value must be divisible by 1 KB";
-        return;
-    }
-
     if (!size) {
         size = FileRequestDescriptor::defaultDownloadPartSize();
     }
 
+    // A requested part must not cross a 1 MB boundary, so the size must be a power of two between 1 KB and 512 KB.
+    if ((size % 1024) || ((1024 * 1024) % size) || (size > FileRequestDescriptor::maxDownloadPartSize())) {
+        qDebug() << Q_FUNC_INFO << "Unable to set incorrect size" << size << ". The value must be a power of two between 1 KB and 512 KB";
+        return;
+    }
+
     m_mediaDataBufferSize = size;
 }
 
+void CTelegramMediaModule::setDownloadDirectory(const QString &path)
+{
+    if (!path.isEmpty() && !QDir().mkpath(path)) {
+        qWarning() << Q_FUNC_INFO << "Unable to create the directory" << path;
+        return;
+    }
+    m_downloadDirectory = path;
+}
+
+void CTelegramMediaModule::setMediaCacheDirectory(const QString &path)
+{
+    m_mediaCache.setDirectory(path);
+}
+
+void CTelegramMediaModule::setMediaCacheSize(quint64 bytes)
+{
+    m_mediaCache.setMaxSize(bytes);
+}
+
 QString CTelegramMediaModule::peerPictureToken(const Telegram::Peer &peer, const Telegram::PeerPictureSize size) const
 {
     switch (peer.type) {
@@ -78,19 +108,72 @@ quint32 CTelegramMediaModule::requestFile(const Telegram::RemoteFile *file, quin
         return 0;
     }
 
+    const QString uniqueId = file->getUniqueId();
+
+    // The application request for a picture which is being prefetched joins the prefetch request
+    const auto prefetchEntry = m_prefetchEntries.find(uniqueId);
+    if ((prefetchEntry != m_prefetchEntries.end()) && prefetchEntry.value().requestId) {
+        prefetchEntry.value().isRequestedByApplication = true;
+        return prefetchEntry.value().requestId;
+    }
+
+    if (m_mediaCache.contains(uniqueId)) {
+        const QByteArray data = m_mediaCache.data(uniqueId);
+        if (!data.isEmpty()) {
+            // Complete the request without the network, but after the caller gets the request id
+            const quint32 requestId = ++m_fileRequestCounter;
+            const Telegram::RemoteFile result = *file;
+            QTimer::singleShot(0, m_localRequestsContext, [this, requestId, data, result]() {
+                const QString mimeType = QMimeDatabase().mimeTypeForData(data).name();
+                deliverFilePart(requestId, data, mimeType, 0, data.size());
+                finishFileRequest(requestId, result);
+            });
+            return requestId;
+        }
+    }
+
     FileRequestDescriptor request;
     request.setType(FileRequestDescriptor::Download);
     request.setDcId(file->d->m_dcId);
     request.setInputLocation(file->d->getInputFileLocation());
     request.setSize(file->d->m_size);
-    request.uniqueId = file->getUniqueId();
+    request.uniqueId = uniqueId;
 
-    if (chunkSize) {
-        request.setChunkSize(chunkSize);
-    } else {
-        request.setChunkSize(m_mediaDataBufferSize);
+    if (!chunkSize) {
+        chunkSize = m_mediaDataBufferSize;
+        // Use bigger parts for big files, but keep at least four parts to download in parallel
+        while ((chunkSize < FileRequestDescriptor::maxDownloadPartSize()) && (chunkSize * 8 <= request.size())) {
+            chunkSize *= 2;
+        }
+    }
+    request.setChunkSize(chunkSize);
+
+    PartialFile *partialFile = openPartialFile(&request);
+    if (partialFile && partialFile->isFinished()) {
+        // The file is already downloaded; complete the request from it after the caller gets the request id
+        const quint32 requestId = ++m_fileRequestCounter;
+        const QSharedPointer<PartialFile> downloadedFile(partialFile);
+        const Telegram::RemoteFile result = *file;
+        QTimer::singleShot(0, m_localRequestsContext, [this, requestId, downloadedFile, chunkSize, result]() {
+            deliverDownloadedFile(requestId, downloadedFile.data(), chunkSize, result);
+        });
+        return requestId;
     }
-    return addFileRequest(request);
+
+    const quint32 requestId = addFileRequest(request);
+    if (!requestId) {
+        delete partialFile;
+        return 0;
+    }
+    if (partialFile) {
+        m_partialFiles.insert(requestId, partialFile);
+    }
+    if (m_mediaCache.isEnabled() && (request.size() <= MediaCache::maxFileSize())) {
+        // Small files (avatars, stickers, thumbnails) are collected to put them into the cache,
+        // even if they are written to the download directory as well
+        m_cacheBuffers.insert(requestId, QByteArray());
+    }
+    return requestId;
 }
 
 bool CTelegramMediaModule::getMessageMediaInfo(Telegram::MessageMediaInfo *messageInfo, quint32 messageId, const Telegram::Peer &peer) const
@@ -121,7 +204,14 @@ quint32 CTelegramMediaModule::uploadFile(const QByteArray &fileContent, const QS
 
 quint32 CTelegramMediaModule::uploadFile(QIODevice *source, const QString &fileName)
 {
-    return uploadFile(source->readAll(), fileName);
+    if (!mainConnection()) {
+        qWarning() << Q_FUNC_INFO << "Called without connection";
+        return 0;
+    }
+#ifdef DEVELOPER_BUILD
+    qDebug() << Q_FUNC_INFO << fileName;
+#endif
+    return addFileRequest(FileRequestDescriptor::uploadRequest(source, fileName, mainConnection()->dcInfo().id));
 }
 
 quint64 CTelegramMediaModule::sendMedia(const Telegram::Peer &peer, const Telegram::MessageMediaInfo &info)
@@ -209,8 +299,20 @@ quint64 CTelegramMediaModule::sendMedia(const Telegram::Peer &peer, const Telegr
 
 void CTelegramMediaModule::clear()
 {
+    // The partial files are kept on the disk to resume the downloads later
+    qDeleteAll(m_partialFiles);
+    m_partialFiles.clear();
+    m_cacheBuffers.clear();
+    m_prefetchEntries.clear();
+    m_visiblePrefetchQueue.clear();
+    m_prefetchQueue.clear();
+    m_prefetchRequests.clear();
     m_requestedFileDescriptors.clear();
     m_fileRequestCounter = 0;
+
+    // Drop the scheduled completions of the requests served without the network (the ids are reused)
+    delete m_localRequestsContext;
+    m_localRequestsContext = new QObject(this);
 }
 
 void CTelegramMediaModule::onFileDataReceived(const TLUploadFile &file, quint32 requestId, quint32 offset)
@@ -234,26 +336,50 @@ void CTelegramMediaModule::onFileDataReceived(const TLUploadFile &file, quint32
         return;
     }
 
-    const quint32 chunkSize = file.bytes.size();
+    if (!descriptor.addChunk(offset, file.bytes, m_clock.elapsed())) {
+        qDebug() << Q_FUNC_INFO << "Unexpected chunk" << offset << "of request" << requestId;
+        return;
+    }
+
+    PartialFile *partialFile = m_partialFiles.value(requestId);
+    if (partialFile && !partialFile->write(offset, file.bytes)) {
+        // Keep the download going; the data is still delivered via filePartReceived()
+        qWarning() << Q_FUNC_INFO << "Unable to store the chunk" << offset << "of request" << requestId << "Continue in memory.";
+        delete m_partialFiles.take(requestId);
+        partialFile = nullptr;
+    }
 
     QString mimeType = mimeTypeByStorageFileType(file.type.tlType);
 
     // Depends on InputFileLocation tlType, we can either have descriptor.size() (for MediaMessage data (Audio, Video, Document)),
-    // or have file type StorageFilePartial otherwise.
+    // or have file type StorageFilePartial otherwise. In the later case the chunks are requested one by one.
 
     bool isFinished = false;
+    QByteArray data;
+    quint32 chunkOffset = 0;
 
-    if (descriptor.size()) {
-        isFinished = descriptor.offset() + chunkSize == descriptor.size();
-    } else {
-        isFinished = file.type.tlType != TLValue::StorageFilePartial;
-    }
+    // The chunks can be received out of order; deliver all of them which are contiguous with the already delivered data.
+    while (!isFinished && descriptor.takeReadyChunk(&data, &chunkOffset)) {
+        if (descriptor.size()) {
+            isFinished = (descriptor.offset() >= descriptor.size()) || (quint32(data.size()) < descriptor.chunkSize());
+        } else {
+            isFinished = (file.type.tlType != TLValue::StorageFilePartial) || data.isEmpty();
+        }
 
-    if (isFinished) {
-        descriptor.setSize(descriptor.offset() + chunkSize);
-    }
+        if (isFinished) {
+            descriptor.setSize(descriptor.offset());
+        }
 
-    emit filePartReceived(requestId, file.bytes, mimeType, descriptor.offset(), descriptor.size()); // Size can be unknown (== 0)
+        const auto cacheBuffer = m_cacheBuffers.find(requestId);
+        if (cacheBuffer != m_cacheBuffers.end()) {
+            cacheBuffer.value().append(data);
+            if (quint32(cacheBuffer.value().size()) > MediaCache::maxFileSize()) {
+                m_cacheBuffers.erase(cacheBuffer);
+            }
+        }
+
+        deliverFilePart(requestId, data, mimeType, chunkOffset, descriptor.size()); // Size can be unknown (== 0)
+    }
 
     if (isFinished) {
 #ifdef DEVELOPER_BUILD
@@ -264,12 +390,26 @@ void CTelegramMediaModule::onFileDataReceived(const TLUploadFile &file, quint32
         const TLInputFileLocation location = descriptor.inputLocation();
         result.d->setInputFileLocation(&location);
         result.d->m_dcId = descriptor.dcId();
-        emit fileRequestFinished(requestId, result);
+
+        if (m_cacheBuffers.contains(requestId)) {
+            m_mediaCache.insert(descriptor.uniqueId, m_cacheBuffers.take(requestId));
+        }
+
+        if (partialFile) {
+            m_partialFiles.remove(requestId);
+            if (partialFile->finish()) {
+                if (!isInternalRequest(requestId)) {
+                    emit fileDownloaded(requestId, partialFile->filePath());
+                }
+            } else {
+                qWarning() << Q_FUNC_INFO << "Unable to finish the file" << partialFile->filePath();
+            }
+            delete partialFile;
+        }
 
         m_requestedFileDescriptors.remove(requestId);
+        finishFileRequest(requestId, result);
     } else {
-        descriptor.setOffset(offset + chunkSize);
-
         CTelegramConnection *connection = qobject_cast<CTelegramConnection*>(sender());
         if (connection) {
             processFileRequestForConnection(connection, requestId);
@@ -279,7 +419,7 @@ void CTelegramMediaModule::onFileDataReceived(const TLUploadFile &file, quint32
     }
 }
 
-void CTelegramMediaModule::onFileDataUploaded(quint32 requestId)
+void CTelegramMediaModule::onFileDataUploaded(quint32 requestId, quint32 part)
 {
     if (!m_requestedFileDescriptors.contains(requestId)) {
         qDebug() << Q_FUNC_INFO << "Unexpected fileId" << requestId;
@@ -292,7 +432,7 @@ void CTelegramMediaModule::onFileDataUploaded(quint32 requestId)
         return;
     }
 
-    descriptor.bumpPart();
+    descriptor.setPartUploaded(part);
 
     emit filePartUploaded(requestId, descriptor.offset(), descriptor.size());
 
@@ -305,7 +445,67 @@ void CTelegramMediaModule::onFileDataUploaded(quint32 requestId)
         result.d->m_size = descriptor.size();
         result.d->setInputFile(&fileInfo);
 
-        emit fileRequestFinished(requestId, result);
+        m_requestedFileDescriptors.remove(requestId);
+        finishFileRequest(requestId, result);
+        return;
+    }
+
+    CTelegramConnection *connection = qobject_cast<CTelegramConnection*>(sender());
+    if (connection) {
+        processFileRequestForConnection(connection, requestId);
+    } else {
+        qDebug() << Q_FUNC_INFO << "Invalid call. The method must be called only on CTelegramConnection signal.";
+    }
+}
+
+void CTelegramMediaModule::onFileDataUploadFailed(quint32 requestId, quint32 part)
+{
+    if (!m_requestedFileDescriptors.contains(requestId)) {
+        qDebug() << Q_FUNC_INFO << "Unexpected fileId" << requestId;
+        return;
+    }
+
+    FileRequestDescriptor &descriptor = m_requestedFileDescriptors[requestId];
+
+    if (descriptor.type() != FileRequestDescriptor::Upload) {
+        return;
+    }
+
+    if (!descriptor.setPartFailed(part)) {
+        qWarning() << Q_FUNC_INFO << "Unable to upload the part" << part << "of request" << requestId;
+        m_requestedFileDescriptors.remove(requestId);
+        failFileRequest(requestId);
+        return;
+    }
+
+    CTelegramConnection *connection = qobject_cast<CTelegramConnection*>(sender());
+    if (connection) {
+        processFileRequestForConnection(connection, requestId);
+    } else {
+        qDebug() << Q_FUNC_INFO << "Invalid call. The method must be called only on CTelegramConnection signal.";
+    }
+}
+
+void CTelegramMediaModule::onFileDataReceiveFailed(quint32 requestId, quint32 offset)
+{
+    if (!m_requestedFileDescriptors.contains(requestId)) {
+        qDebug() << Q_FUNC_INFO << "Unexpected request" << requestId;
+        return;
+    }
+
+    FileRequestDescriptor &descriptor = m_requestedFileDescriptors[requestId];
+
+    if (descriptor.type() != FileRequestDescriptor::Download) {
+        return;
+    }
+
+    if (!descriptor.setChunkFailed(offset)) {
+        qWarning() << Q_FUNC_INFO << "Unable to download the chunk" << offset << "of request" << requestId;
+        m_requestedFileDescriptors.remove(requestId);
+        // The partial file is kept on the disk to resume the download later
+        delete m_partialFiles.take(requestId);
+        m_cacheBuffers.remove(requestId);
+        failFileRequest(requestId);
         return;
     }
 
@@ -341,6 +541,8 @@ void CTelegramMediaModule::onConnectionAuthChanged(CTelegramConnection *connecti
             }
 
             if (state == CTelegramConnection::AuthStateSignedIn) {
+                // The requests sent via a previous session are not going to be answered
+                m_requestedFileDescriptors[fileId].resetChunkRequests();
                 processFileRequestForConnection(connection, fileId);
             }
         }
@@ -351,6 +553,8 @@ void CTelegramMediaModule::onNewConnection(CTelegramConnection *connection)
 {
     connect(connection, &CTelegramConnection::fileDataReceived, this, &CTelegramMediaModule::onFileDataReceived);
     connect(connection, &CTelegramConnection::fileDataSent, this, &CTelegramMediaModule::onFileDataUploaded);
+    connect(connection, &CTelegramConnection::fileDataSendFailed, this, &CTelegramMediaModule::onFileDataUploadFailed);
+    connect(connection, &CTelegramConnection::fileDataReceiveFailed, this, &CTelegramMediaModule::onFileDataReceiveFailed);
 }
 
 template<typename T>
@@ -371,18 +575,181 @@ QString CTelegramMediaModule::getPictureToken(const T *peerData, const Telegram:
 }
 
 template<typename T>
-quint32 CTelegramMediaModule::getPeerPicture(const T *peerData, const Telegram::PeerPictureSize size)
+bool CTelegramMediaModule::getPeerPictureFile(const T *peerData, const Telegram::PeerPictureSize size, Telegram::RemoteFile *file) const
 {
     if (!peerData) {
-        qDebug() << "CTelegramMediaModule::getPeerPicture(): invalid peer data";
-        return 0;
+        return false;
     }
     const TLFileLocation &picture = size == Telegram::PeerPictureSize::Small ? peerData->photo.photoSmall : peerData->photo.photoBig;
-    Telegram::RemoteFile location;
-    if (!location.d->setFileLocation(&picture)) {
-        return 0;
+    if (picture.tlType == TLValue::FileLocationUnavailable) {
+        return false;
+    }
+    return file->d->setFileLocation(&picture);
+}
+
+bool CTelegramMediaModule::getPeerPictureFile(const Telegram::Peer &peer, const Telegram::PeerPictureSize size, Telegram::RemoteFile *file) const
+{
+    switch (peer.type) {
+    case Telegram::Peer::User:
+        return getPeerPictureFile(getUser(peer.id), size, file);
+    case Telegram::Peer::Chat:
+    case Telegram::Peer::Channel:
+        return getPeerPictureFile(getChat(peer), size, file);
+    default:
+        break;
+    }
+    return false;
+}
+
+void CTelegramMediaModule::prefetchPeerPictures(const QVector<Telegram::Peer> &peers, Telegram::PeerPictureSize size)
+{
+    for (const Telegram::Peer &peer : peers) {
+        Telegram::RemoteFile file;
+        if (!getPeerPictureFile(peer, size, &file)) {
+            continue;
+        }
+        // Deduplicate by the picture location
+        const QString token = file.getUniqueId();
+        auto it = m_prefetchEntries.find(token);
+        if (it == m_prefetchEntries.end()) {
+            it = m_prefetchEntries.insert(token, PrefetchEntry());
+            it.value().file = file;
+            if (m_visiblePeers.contains(peer)) {
+                m_visiblePrefetchQueue.enqueue(token);
+            } else {
+                m_prefetchQueue.enqueue(token);
+            }
+        }
+        if (!it.value().peers.contains(peer)) {
+            it.value().peers.append(peer);
+        }
+    }
+    schedulePrefetch();
+}
+
+void CTelegramMediaModule::setVisiblePeers(const QVector<Telegram::Peer> &peers)
+{
+    m_visiblePeers.clear();
+    m_visiblePrefetchQueue.clear();
+    for (const Telegram::Peer &peer : peers) {
+        m_visiblePeers.insert(peer);
+        for (const Telegram::PeerPictureSize size : { Telegram::PeerPictureSize::Small, Telegram::PeerPictureSize::Big }) {
+            Telegram::RemoteFile file;
+            if (!getPeerPictureFile(peer, size, &file)) {
+                continue;
+            }
+            const QString token = file.getUniqueId();
+            const auto it = m_prefetchEntries.constFind(token);
+            if ((it != m_prefetchEntries.constEnd()) && !it.value().requestId) {
+                // The token stays in the normal queue as well; the duplicate is skipped there once requested
+                m_visiblePrefetchQueue.enqueue(token);
+            }
+        }
+    }
+    schedulePrefetch();
+}
+
+bool CTelegramMediaModule::isInternalRequest(quint32 requestId) const
+{
+    const QString token = m_prefetchRequests.value(requestId);
+    return !token.isEmpty() && !m_prefetchEntries.value(token).isRequestedByApplication;
+}
+
+bool CTelegramMediaModule::hasInteractiveRequests() const
+{
+    for (auto it = m_requestedFileDescriptors.constBegin(); it != m_requestedFileDescriptors.constEnd(); ++it) {
+        if (!m_prefetchRequests.contains(it.key())) {
+            return true;
+        }
+    }
+    for (const PrefetchEntry &entry : m_prefetchEntries) {
+        if (entry.requestId && entry.isRequestedByApplication) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CTelegramMediaModule::schedulePrefetch()
+{
+    // Leave the bandwidth to the requests of the application
+    if (hasInteractiveRequests()) {
+        return;
+    }
+
+    while (m_prefetchRequests.count() < s_maxPrefetchRequests) {
+        QQueue<QString> &queue = m_visiblePrefetchQueue.isEmpty() ? m_prefetchQueue : m_visiblePrefetchQueue;
+        if (queue.isEmpty()) {
+            break;
+        }
+        const QString token = queue.dequeue();
+        const auto it = m_prefetchEntries.find(token);
+        if ((it == m_prefetchEntries.end()) || it.value().requestId) {
+            continue; // Already requested (via the other queue)
+        }
+
+        // Served from the media cache if possible; the network requests are spread over the DC connections.
+        const quint32 requestId = requestFile(&it.value().file, s_peerPictureChunkSize);
+        if (!requestId) {
+            m_prefetchEntries.erase(it);
+            continue;
+        }
+        it.value().requestId = requestId;
+        m_prefetchRequests.insert(requestId, token);
+    }
+}
+
+// The prefetch requests are internal, so they are reported via the file request signals only if the application joins them
+void CTelegramMediaModule::deliverFilePart(quint32 requestId, const QByteArray &data, const QString &mimeType, quint32 offset, quint32 totalSize)
+{
+    const QString token = m_prefetchRequests.value(requestId);
+    if (token.isEmpty()) {
+        emit filePartReceived(requestId, data, mimeType, offset, totalSize);
+        return;
     }
-    return requestFile(&location, /* chunkSize */ 512 * 256); // Set chunkSize to some big number to get the whole avatar at once
+    PrefetchEntry &entry = m_prefetchEntries[token];
+    entry.data.append(data);
+    entry.mimeType = mimeType;
+}
+
+void CTelegramMediaModule::finishFileRequest(quint32 requestId, const Telegram::RemoteFile &result)
+{
+    const QString token = m_prefetchRequests.take(requestId);
+    if (token.isEmpty()) {
+        emit fileRequestFinished(requestId, result);
+    } else {
+        const PrefetchEntry entry = m_prefetchEntries.take(token);
+        if (entry.isRequestedByApplication) {
+            // The application could join after the first parts, so the picture is delivered at once
+            emit filePartReceived(requestId, entry.data, entry.mimeType, 0, entry.data.size());
+            emit fileRequestFinished(requestId, result);
+        }
+        for (const Telegram::Peer &peer : entry.peers) {
+            emit peerPictureReceived(peer, entry.data, entry.mimeType, token);
+            if (peer.type == Telegram::Peer::User) {
+                emit avatarReceived(peer.id, entry.data, entry.mimeType, token);
+            }
+        }
+    }
+
+    // Either a prefetch slot is free, or an interactive request is finished
+    schedulePrefetch();
+}
+
+void CTelegramMediaModule::failFileRequest(quint32 requestId)
+{
+    const QString token = m_prefetchRequests.take(requestId);
+    if (token.isEmpty()) {
+        emit fileRequestFailed(requestId);
+    } else {
+        // Drop the entry; the picture is prefetched again on the next prefetchPeerPictures() call
+        if (m_prefetchEntries.take(token).isRequestedByApplication) {
+            emit fileRequestFailed(requestId);
+        }
+    }
+
+    // Either a prefetch slot is free, or an interactive request is finished
+    schedulePrefetch();
 }
 
 quint32 CTelegramMediaModule::addFileRequest(const FileRequestDescriptor &descriptor)
@@ -408,9 +775,66 @@ quint32 CTelegramMediaModule::addFileRequest(const FileRequestDescriptor &descri
     return m_fileRequestCounter;
 }
 
+PartialFile *CTelegramMediaModule::openPartialFile(FileRequestDescriptor *descriptor)
+{
+    // The file end is needed to allocate the file and to know when it is complete
+    if (m_downloadDirectory.isEmpty() || !descriptor->size() || descriptor->uniqueId.isEmpty()) {
+        return nullptr;
+    }
+
+    const QString filePath = QDir(m_downloadDirectory).filePath(descriptor->uniqueId);
+    for (const PartialFile *file : m_partialFiles) {
+        if (file->filePath() == filePath) {
+            qDebug() << Q_FUNC_INFO << "The file is already being downloaded by another request" << filePath;
+            return nullptr;
+        }
+    }
+
+    PartialFile *file = new PartialFile(filePath);
+    if (!file->open(descriptor->size())) {
+        delete file;
+        return nullptr;
+    }
+
+    // Resume from the stored data. Keep at least the last chunk to request, so the request is finished as usual.
+    quint32 offset = qMin(file->completedPrefix(), descriptor->size() - 1);
+    offset -= offset % descriptor->chunkSize();
+    if (offset) {
+        qDebug() << Q_FUNC_INFO << "Resume the download of" << filePath << "from" << offset;
+        descriptor->setOffset(offset);
+        descriptor->resetChunkRequests();
+    }
+    return file;
+}
+
+void CTelegramMediaModule::deliverDownloadedFile(quint32 requestId, PartialFile *file, quint32 chunkSize, const Telegram::RemoteFile &result)
+{
+    QString mimeType;
+    for (quint32 offset = 0; offset < file->size(); offset += chunkSize) {
+        const QByteArray data = file->read(offset, chunkSize);
+        if (data.isEmpty()) {
+            qWarning() << Q_FUNC_INFO << "Unable to read" << file->filePath();
+            failFileRequest(requestId);
+            return;
+        }
+        if (mimeType.isEmpty()) {
+            mimeType = QMimeDatabase().mimeTypeForData(data).name();
+        }
+        deliverFilePart(requestId, data, mimeType, offset, file->size());
+    }
+    file->finish();
+    if (!isInternalRequest(requestId)) {
+        emit fileDownloaded(requestId, file->filePath());
+    }
+    finishFileRequest(requestId, result);
+}
+
 void CTelegramMediaModule::processFileRequestForConnection(CTelegramConnection *connection, quint32 requestId)
 {
-    const FileRequestDescriptor descriptor = m_requestedFileDescriptors.value(requestId);
+    if (!m_requestedFileDescriptors.contains(requestId)) {
+        return;
+    }
+    FileRequestDescriptor &descriptor = m_requestedFileDescriptors[requestId];
     qDebug() << Q_FUNC_INFO << requestId << descriptor.type();
 
     if (connection->authState() != CTelegramConnection::AuthStateSignedIn) {
@@ -420,10 +844,25 @@ void CTelegramMediaModule::processFileRequestForConnection(CTelegramConnection *
 
     switch (descriptor.type()) {
     case FileRequestDescriptor::Download:
-        connection->downloadFile(descriptor.inputLocation(), descriptor.offset(), descriptor.chunkSize(), requestId);
+        // Keep the window of the chunk requests full
+        while (descriptor.canRequestChunk()) {
+            const quint32 offset = descriptor.takeNextChunkOffset(m_clock.elapsed());
+            connection->downloadFile(descriptor.inputLocation(), offset, descriptor.chunkSize(), requestId);
+        }
         break;
     case FileRequestDescriptor::Upload:
-        connection->uploadFile(descriptor.fileId(), descriptor.part(), descriptor.data(), requestId);
+        while (descriptor.canUploadPart()) {
+            quint32 part = 0;
+            QByteArray data;
+            if (!descriptor.takeNextPart(&part, &data)) {
+                qWarning() << Q_FUNC_INFO << "Unable to upload the file of request" << requestId;
+                m_requestedFileDescriptors.remove(requestId);
+                failFileRequest(requestId);
+                return;
+            }
+            const quint32 totalParts = descriptor.isBigFile() ? descriptor.parts() : 0;
+            connection->uploadFile(descriptor.fileId(), part, totalParts, data, requestId);
+        }
         break;
     default:
         break;
@@ -20,14 +20,21 @@
 
 #include "CTelegramModule.hpp"
 
+#include <QElapsedTimer>
+#include <QHash>
 #include <QMap>
+#include <QQueue>
+#include <QSet>
 
 #include "TLTypes.hpp"
 #include "TelegramNamespace.hpp"
 #include "FileRequestDescriptor.hpp"
+#include "MediaCache.hpp"
 
 QT_FORWARD_DECLARE_CLASS(QIODevice)
 
+class PartialFile;
+
 class CTelegramMediaModule : public CTelegramModule
 {
     Q_OBJECT
@@ -36,8 +43,15 @@ public:
     ~CTelegramMediaModule();
 
     void setMediaDataBufferSize(quint32 size);
+    QString downloadDirectory() const { return m_downloadDirectory; }
+    void setDownloadDirectory(const QString &path);
+    QString mediaCacheDirectory() const { return m_mediaCache.directory(); }
+    void setMediaCacheDirectory(const QString &path);
+    void setMediaCacheSize(quint64 bytes);
     Q_REQUIRED_RESULT QString peerPictureToken(const Telegram::Peer &peer, const Telegram::PeerPictureSize size) const;
     quint32 requestFile(const Telegram::RemoteFile *file, quint32 chunkSize = 0);
+    void prefetchPeerPictures(const QVector<Telegram::Peer> &peers, Telegram::PeerPictureSize size);
+    void setVisiblePeers(const QVector<Telegram::Peer> &peers);
     bool getMessageMediaInfo(Telegram::MessageMediaInfo *messageInfo, quint32 messageId, const Telegram::Peer &peer) const;
 
     quint32 uploadFile(const QByteArray &fileContent, const QString &fileName);
@@ -51,13 +65,18 @@ signals:
     void filePartUploaded(quint32 requestId, quint32 offset, quint32 size);
     void fileRequestFinished(quint32 requestId, Telegram::RemoteFile uploadInfo);
     void filePartReceived(quint32 requestId, const QByteArray &data, const QString &mimeType, quint32 offset, quint32 totalSize);
+    void fileDownloaded(quint32 requestId, const QString &filePath);
+    void fileRequestFailed(quint32 requestId);
 
     void avatarReceived(quint32 userId, const QByteArray &data, const QString &mimeType, const QString &avatarToken);
+    void peerPictureReceived(Telegram::Peer peer, const QByteArray &data, const QString &mimeType, const QString &pictureToken);
     void messageMediaDataReceived(Telegram::Peer peer, quint32 messageId, const QByteArray &data, const QString &mimeType, TelegramNamespace::MessageType type, quint32 offset, quint32 size);
 
 protected slots:
     void onFileDataReceived(const TLUploadFile &file, quint32 requestId, quint32 offset);
-    void onFileDataUploaded(quint32 requestId);
+    void onFileDataUploaded(quint32 requestId, quint32 part);
+    void onFileDataUploadFailed(quint32 requestId, quint32 part);
+    void onFileDataReceiveFailed(quint32 requestId, quint32 offset);
 
 protected:
     void onConnectionStateChanged(TelegramNamespace::ConnectionState newConnectionState) override;
@@ -68,14 +87,47 @@ protected:
     Q_REQUIRED_RESULT QString getPictureToken(const T *peerData, const Telegram::PeerPictureSize size) const;
 
     template <typename T>
-    Q_REQUIRED_RESULT quint32 getPeerPicture(const T *peerData, const Telegram::PeerPictureSize size);
+    bool getPeerPictureFile(const T *peerData, const Telegram::PeerPictureSize size, Telegram::RemoteFile *file) const;
+    bool getPeerPictureFile(const Telegram::Peer &peer, const Telegram::PeerPictureSize size, Telegram::RemoteFile *file) const;
 
-    quint32 addFileRequest(const FileRequestDescriptor &descriptor);
+    virtual quint32 addFileRequest(const FileRequestDescriptor &descriptor);
+    PartialFile *openPartialFile(FileRequestDescriptor *descriptor);
+    void deliverDownloadedFile(quint32 requestId, PartialFile *file, quint32 chunkSize, const Telegram::RemoteFile &result);
     void processFileRequestForConnection(CTelegramConnection *connection, quint32 requestId);
 
+    void deliverFilePart(quint32 requestId, const QByteArray &data, const QString &mimeType, quint32 offset, quint32 totalSize);
+    void finishFileRequest(quint32 requestId, const Telegram::RemoteFile &result);
+    void failFileRequest(quint32 requestId);
+
+    bool isInternalRequest(quint32 requestId) const;
+    bool hasInteractiveRequests() const;
+    void schedulePrefetch();
+
+    struct PrefetchEntry {
+        PrefetchEntry() : requestId(0), isRequestedByApplication(false) { }
+        Telegram::RemoteFile file;
+        QVector<Telegram::Peer> peers;
+        quint32 requestId;
+        bool isRequestedByApplication; // The request id is returned by requestFile() as well
+        QString mimeType;
+        QByteArray data;
+    };
+
     quint32 m_mediaDataBufferSize;
     QMap<quint32, FileRequestDescriptor> m_requestedFileDescriptors; // fileId, file request descriptor
     quint32 m_fileRequestCounter;
+    QElapsedTimer m_clock;
+    QObject *m_localRequestsContext; // The context of the scheduled completions of the requests served without the network
+    QString m_downloadDirectory;
+    QHash<quint32, PartialFile*> m_partialFiles; // request id, file
+    MediaCache m_mediaCache;
+    QHash<quint32, QByteArray> m_cacheBuffers; // request id, data of a small file to put into the cache
+
+    QHash<QString, PrefetchEntry> m_prefetchEntries; // picture token, entry (queued or requested)
+    QQueue<QString> m_visiblePrefetchQueue; // The pictures of the visible peers go first
+    QQueue<QString> m_prefetchQueue;
+    QHash<quint32, QString> m_prefetchRequests; // request id, picture token
+    QSet<Telegram::Peer> m_visiblePeers;
 
 };
 
@@ -16,6 +16,7 @@
  */
 
 #include "CTelegramStream_p.hpp"
+#include "AbridgedLength.hpp"
 
 #include <QtEndian>
 
@@ -101,6 +102,59 @@ template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLKeyboardB
 // End of generated vector write templates instancing
 template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLDcOption> &v);
 
+CTelegramStream &CTelegramStream::operator>>(QString &str)
+{
+    Telegram::AbridgedLength length;
+    *this >> length;
+    const int size = static_cast<int>(length);
+
+    // Convert right from the packet data, if possible
+    const char *data = peekBytes(size);
+    if (data) {
+        str = QString::fromUtf8(data, size);
+        skipBytes(size + length.paddingForAlignment(4));
+        return *this;
+    }
+
+    QByteArray bytes;
+    bytes.resize(size);
+    read(bytes.data(), size);
+    readBytes(length.paddingForAlignment(4));
+    str = QString::fromUtf8(bytes);
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const QString &str)
+{
+    // Most of the sent strings (phone numbers, codes, user names) are short ASCII ones;
+    // write them without the UTF-8 conversion and a temporary byte array.
+    static const int maxShortSize = 0xfe - 1;
+    const int size = str.size();
+    if (size <= maxShortSize) {
+        char buffer[1 + maxShortSize + 3]; // The length, the data and the padding
+        buffer[0] = static_cast<char>(size);
+        int i = 0;
+        for (; i < size; ++i) {
+            const ushort c = str.at(i).unicode();
+            if (c >= 0x80) {
+                break;
+            }
+            buffer[1 + i] = static_cast<char>(c);
+        }
+        if (i == size) {
+            int total = 1 + size;
+            while (total % 4) {
+                buffer[total++] = 0;
+            }
+            write(buffer, total);
+            return *this;
+        }
+    }
+
+    *this << str.toUtf8();
+    return *this;
+}
+
 template <int Size>
 CTelegramStream &CTelegramStream::operator>>(TLNumber<Size> &n)
 {
@@ -126,350 +180,461 @@ CTelegramStream &CTelegramStream::operator<<(const TLDcOption &dcOption)
     return *this;
 }
 
+template <>
+void CTelegramStream::skip<bool>()
+{
+    skipBytes(4);
+}
+
+template <>
+void CTelegramStream::skip<quint32>()
+{
+    skipBytes(4);
+}
+
+template <>
+void CTelegramStream::skip<quint64>()
+{
+    skipBytes(8);
+}
+
+template <>
+void CTelegramStream::skip<double>()
+{
+    skipBytes(8);
+}
+
+template <>
+void CTelegramStream::skip<QByteArray>()
+{
+    Telegram::AbridgedLength length;
+    *this >> length;
+    skipBytes(static_cast<int>(length) + length.paddingForAlignment(4));
+}
+
+template <>
+void CTelegramStream::skip<QString>()
+{
+    skip<QByteArray>();
+}
+
+template <>
+void CTelegramStream::skip<TLNumber128>()
+{
+    skipBytes(128 / 8);
+}
+
+template <>
+void CTelegramStream::skip<TLNumber256>()
+{
+    skipBytes(256 / 8);
+}
+
+CTelegramStream &CTelegramStream::readMessageHeader(TLMessage *message)
+{
+    *message = TLMessage();
+
+    *this >> message->tlType;
+
+    switch (message->tlType) {
+    case TLValue::MessageEmpty:
+        *this >> message->id;
+        break;
+    case TLValue::Message:
+        *this >> message->flags;
+        *this >> message->id;
+        if (message->flags & TLMessage::FromId) {
+            *this >> message->fromId;
+        }
+        *this >> message->toId;
+        if (message->flags & TLMessage::FwdFromId) {
+            *this >> message->fwdFromId;
+            *this >> message->fwdDate;
+        }
+        if (message->flags & TLMessage::ViaBotId) {
+            *this >> message->viaBotId;
+        }
+        if (message->flags & TLMessage::ReplyToMsgId) {
+            *this >> message->replyToMsgId;
+        }
+        *this >> message->date;
+        // The flags are kept as is, even though the body is not read
+        skip<QString>();
+        if (message->flags & TLMessage::Media) {
+            skip<TLMessageMedia>();
+        }
+        if (message->flags & TLMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        if (message->flags & TLMessage::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        if (message->flags & TLMessage::Views) {
+            *this >> message->views;
+        }
+        break;
+    case TLValue::MessageService:
+        *this >> message->flags;
+        *this >> message->id;
+        if (message->flags & TLMessage::FromId) {
+            *this >> message->fromId;
+        }
+        *this >> message->toId;
+        *this >> message->date;
+        skip<TLMessageAction>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::readDialogsPage(TLMessagesDialogs *dialogs)
+{
+    *dialogs = TLMessagesDialogs();
+
+    *this >> dialogs->tlType;
+
+    if ((dialogs->tlType != TLValue::MessagesDialogs) && (dialogs->tlType != TLValue::MessagesDialogsSlice)) {
+        return *this;
+    }
+    if (dialogs->tlType == TLValue::MessagesDialogsSlice) {
+        *this >> dialogs->count;
+    }
+    *this >> dialogs->dialogs;
+    *this >> dialogs->messages.tlType;
+    if (dialogs->messages.tlType == TLValue::Vector) {
+        quint32 length = 0;
+        if (readVectorLength(&length)) {
+            dialogs->messages.resize(static_cast<int>(length));
+            for (TLMessage &message : dialogs->messages) {
+                readMessageHeader(&message);
+            }
+        }
+    }
+    *this >> dialogs->chats;
+    *this >> dialogs->users;
+
+    return *this;
+}
+
 // Generated read operators implementation
 CTelegramStream &CTelegramStream::operator>>(TLAccountDaysTTL &accountDaysTTLValue)
 {
-    TLAccountDaysTTL result;
+    accountDaysTTLValue = TLAccountDaysTTL();
 
-    *this >> result.tlType;
+    *this >> accountDaysTTLValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountDaysTTLValue.tlType) {
     case TLValue::AccountDaysTTL:
-        *this >> result.days;
+        *this >> accountDaysTTLValue.days;
         break;
     default:
         break;
     }
 
-    accountDaysTTLValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPassword &accountPasswordValue)
 {
-    TLAccountPassword result;
+    accountPasswordValue = TLAccountPassword();
 
-    *this >> result.tlType;
+    *this >> accountPasswordValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPasswordValue.tlType) {
     case TLValue::AccountNoPassword:
-        *this >> result.newSalt;
-        *this >> result.emailUnconfirmedPattern;
+        *this >> accountPasswordValue.newSalt;
+        *this >> accountPasswordValue.emailUnconfirmedPattern;
         break;
     case TLValue::AccountPassword:
-        *this >> result.currentSalt;
-        *this >> result.newSalt;
-        *this >> result.hint;
-        *this >> result.hasRecovery;
-        *this >> result.emailUnconfirmedPattern;
+        *this >> accountPasswordValue.currentSalt;
+        *this >> accountPasswordValue.newSalt;
+        *this >> accountPasswordValue.hint;
+        *this >> accountPasswordValue.hasRecovery;
+        *this >> accountPasswordValue.emailUnconfirmedPattern;
         break;
     default:
         break;
     }
 
-    accountPasswordValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
 {
-    TLAccountPasswordInputSettings result;
+    accountPasswordInputSettingsValue = TLAccountPasswordInputSettings();
 
-    *this >> result.tlType;
+    *this >> accountPasswordInputSettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPasswordInputSettingsValue.tlType) {
     case TLValue::AccountPasswordInputSettings:
-        *this >> result.flags;
-        if (result.flags & 1 << 0) {
-            *this >> result.newSalt;
+        *this >> accountPasswordInputSettingsValue.flags;
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this >> accountPasswordInputSettingsValue.newSalt;
         }
-        if (result.flags & 1 << 0) {
-            *this >> result.newPasswordHash;
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this >> accountPasswordInputSettingsValue.newPasswordHash;
         }
-        if (result.flags & 1 << 0) {
-            *this >> result.hint;
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this >> accountPasswordInputSettingsValue.hint;
         }
-        if (result.flags & 1 << 1) {
-            *this >> result.email;
+        if (accountPasswordInputSettingsValue.flags & 1 << 1) {
+            *this >> accountPasswordInputSettingsValue.email;
         }
         break;
     default:
         break;
     }
 
-    accountPasswordInputSettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordSettings &accountPasswordSettingsValue)
 {
-    TLAccountPasswordSettings result;
+    accountPasswordSettingsValue = TLAccountPasswordSettings();
 
-    *this >> result.tlType;
+    *this >> accountPasswordSettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPasswordSettingsValue.tlType) {
     case TLValue::AccountPasswordSettings:
-        *this >> result.email;
+        *this >> accountPasswordSettingsValue.email;
         break;
     default:
         break;
     }
 
-    accountPasswordSettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue)
 {
-    TLAccountSentChangePhoneCode result;
+    accountSentChangePhoneCodeValue = TLAccountSentChangePhoneCode();
 
-    *this >> result.tlType;
+    *this >> accountSentChangePhoneCodeValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountSentChangePhoneCodeValue.tlType) {
     case TLValue::AccountSentChangePhoneCode:
-        *this >> result.phoneCodeHash;
-        *this >> result.sendCallTimeout;
+        *this >> accountSentChangePhoneCodeValue.phoneCodeHash;
+        *this >> accountSentChangePhoneCodeValue.sendCallTimeout;
         break;
     default:
         break;
     }
 
-    accountSentChangePhoneCodeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAudio &audioValue)
 {
-    TLAudio result;
+    audioValue = TLAudio();
 
-    *this >> result.tlType;
+    *this >> audioValue.tlType;
 
-    switch (result.tlType) {
+    switch (audioValue.tlType) {
     case TLValue::AudioEmpty:
-        *this >> result.id;
+        *this >> audioValue.id;
         break;
     case TLValue::Audio:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.duration;
-        *this >> result.mimeType;
-        *this >> result.size;
-        *this >> result.dcId;
+        *this >> audioValue.id;
+        *this >> audioValue.accessHash;
+        *this >> audioValue.date;
+        *this >> audioValue.duration;
+        *this >> audioValue.mimeType;
+        *this >> audioValue.size;
+        *this >> audioValue.dcId;
         break;
     default:
         break;
     }
 
-    audioValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthCheckedPhone &authCheckedPhoneValue)
 {
-    TLAuthCheckedPhone result;
+    authCheckedPhoneValue = TLAuthCheckedPhone();
 
-    *this >> result.tlType;
+    *this >> authCheckedPhoneValue.tlType;
 
-    switch (result.tlType) {
+    switch (authCheckedPhoneValue.tlType) {
     case TLValue::AuthCheckedPhone:
-        *this >> result.phoneRegistered;
+        *this >> authCheckedPhoneValue.phoneRegistered;
         break;
     default:
         break;
     }
 
-    authCheckedPhoneValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthExportedAuthorization &authExportedAuthorizationValue)
 {
-    TLAuthExportedAuthorization result;
+    authExportedAuthorizationValue = TLAuthExportedAuthorization();
 
-    *this >> result.tlType;
+    *this >> authExportedAuthorizationValue.tlType;
 
-    switch (result.tlType) {
+    switch (authExportedAuthorizationValue.tlType) {
     case TLValue::AuthExportedAuthorization:
-        *this >> result.id;
-        *this >> result.bytes;
+        *this >> authExportedAuthorizationValue.id;
+        *this >> authExportedAuthorizationValue.bytes;
         break;
     default:
         break;
     }
 
-    authExportedAuthorizationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthPasswordRecovery &authPasswordRecoveryValue)
 {
-    TLAuthPasswordRecovery result;
+    authPasswordRecoveryValue = TLAuthPasswordRecovery();
 
-    *this >> result.tlType;
+    *this >> authPasswordRecoveryValue.tlType;
 
-    switch (result.tlType) {
+    switch (authPasswordRecoveryValue.tlType) {
     case TLValue::AuthPasswordRecovery:
-        *this >> result.emailPattern;
+        *this >> authPasswordRecoveryValue.emailPattern;
         break;
     default:
         break;
     }
 
-    authPasswordRecoveryValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthSentCode &authSentCodeValue)
 {
-    TLAuthSentCode result;
+    authSentCodeValue = TLAuthSentCode();
 
-    *this >> result.tlType;
+    *this >> authSentCodeValue.tlType;
 
-    switch (result.tlType) {
+    switch (authSentCodeValue.tlType) {
     case TLValue::AuthSentCode:
     case TLValue::AuthSentAppCode:
-        *this >> result.phoneRegistered;
-        *this >> result.phoneCodeHash;
-        *this >> result.sendCallTimeout;
-        *this >> result.isPassword;
+        *this >> authSentCodeValue.phoneRegistered;
+        *this >> authSentCodeValue.phoneCodeHash;
+        *this >> authSentCodeValue.sendCallTimeout;
+        *this >> authSentCodeValue.isPassword;
         break;
     default:
         break;
     }
 
-    authSentCodeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthorization &authorizationValue)
 {
-    TLAuthorization result;
+    authorizationValue = TLAuthorization();
 
-    *this >> result.tlType;
+    *this >> authorizationValue.tlType;
 
-    switch (result.tlType) {
+    switch (authorizationValue.tlType) {
     case TLValue::Authorization:
-        *this >> result.hash;
-        *this >> result.flags;
-        *this >> result.deviceModel;
-        *this >> result.platform;
-        *this >> result.systemVersion;
-        *this >> result.apiId;
-        *this >> result.appName;
-        *this >> result.appVersion;
-        *this >> result.dateCreated;
-        *this >> result.dateActive;
-        *this >> result.ip;
-        *this >> result.country;
-        *this >> result.region;
+        *this >> authorizationValue.hash;
+        *this >> authorizationValue.flags;
+        *this >> authorizationValue.deviceModel;
+        *this >> authorizationValue.platform;
+        *this >> authorizationValue.systemVersion;
+        *this >> authorizationValue.apiId;
+        *this >> authorizationValue.appName;
+        *this >> authorizationValue.appVersion;
+        *this >> authorizationValue.dateCreated;
+        *this >> authorizationValue.dateActive;
+        *this >> authorizationValue.ip;
+        *this >> authorizationValue.country;
+        *this >> authorizationValue.region;
         break;
     default:
         break;
     }
 
-    authorizationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLBotCommand &botCommandValue)
 {
-    TLBotCommand result;
+    botCommandValue = TLBotCommand();
 
-    *this >> result.tlType;
+    *this >> botCommandValue.tlType;
 
-    switch (result.tlType) {
+    switch (botCommandValue.tlType) {
     case TLValue::BotCommand:
-        *this >> result.command;
-        *this >> result.description;
+        *this >> botCommandValue.command;
+        *this >> botCommandValue.description;
         break;
     default:
         break;
     }
 
-    botCommandValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLBotInfo &botInfoValue)
 {
-    TLBotInfo result;
+    botInfoValue = TLBotInfo();
 
-    *this >> result.tlType;
+    *this >> botInfoValue.tlType;
 
-    switch (result.tlType) {
+    switch (botInfoValue.tlType) {
     case TLValue::BotInfoEmpty:
         break;
     case TLValue::BotInfo:
-        *this >> result.userId;
-        *this >> result.version;
-        *this >> result.shareText;
-        *this >> result.description;
-        *this >> result.commands;
+        *this >> botInfoValue.userId;
+        *this >> botInfoValue.version;
+        *this >> botInfoValue.shareText;
+        *this >> botInfoValue.description;
+        *this >> botInfoValue.commands;
         break;
     default:
         break;
     }
 
-    botInfoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChannelParticipant &channelParticipantValue)
 {
-    TLChannelParticipant result;
+    channelParticipantValue = TLChannelParticipant();
 
-    *this >> result.tlType;
+    *this >> channelParticipantValue.tlType;
 
-    switch (result.tlType) {
+    switch (channelParticipantValue.tlType) {
     case TLValue::ChannelParticipant:
-        *this >> result.userId;
-        *this >> result.date;
+        *this >> channelParticipantValue.userId;
+        *this >> channelParticipantValue.date;
         break;
     case TLValue::ChannelParticipantSelf:
     case TLValue::ChannelParticipantModerator:
     case TLValue::ChannelParticipantEditor:
-        *this >> result.userId;
-        *this >> result.inviterId;
-        *this >> result.date;
+        *this >> channelParticipantValue.userId;
+        *this >> channelParticipantValue.inviterId;
+        *this >> channelParticipantValue.date;
         break;
     case TLValue::ChannelParticipantKicked:
-        *this >> result.userId;
-        *this >> result.kickedBy;
-        *this >> result.date;
+        *this >> channelParticipantValue.userId;
+        *this >> channelParticipantValue.kickedBy;
+        *this >> channelParticipantValue.date;
         break;
     case TLValue::ChannelParticipantCreator:
-        *this >> result.userId;
+        *this >> channelParticipantValue.userId;
         break;
     default:
         break;
     }
 
-    channelParticipantValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChannelParticipantRole &channelParticipantRoleValue)
 {
-    TLChannelParticipantRole result;
+    channelParticipantRoleValue = TLChannelParticipantRole();
 
-    *this >> result.tlType;
+    *this >> channelParticipantRoleValue.tlType;
 
-    switch (result.tlType) {
+    switch (channelParticipantRoleValue.tlType) {
     case TLValue::ChannelRoleEmpty:
     case TLValue::ChannelRoleModerator:
     case TLValue::ChannelRoleEditor:
@@ -478,18 +643,16 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelParticipantRole &channelPa
         break;
     }
 
-    channelParticipantRoleValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChannelParticipantsFilter &channelParticipantsFilterValue)
 {
-    TLChannelParticipantsFilter result;
+    channelParticipantsFilterValue = TLChannelParticipantsFilter();
 
-    *this >> result.tlType;
+    *this >> channelParticipantsFilterValue.tlType;
 
-    switch (result.tlType) {
+    switch (channelParticipantsFilterValue.tlType) {
     case TLValue::ChannelParticipantsRecent:
     case TLValue::ChannelParticipantsAdmins:
     case TLValue::ChannelParticipantsKicked:
@@ -499,111 +662,101 @@ CTelegramStream &CTelegramStream::operator>>(TLChannelParticipantsFilter &channe
         break;
     }
 
-    channelParticipantsFilterValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatParticipant &chatParticipantValue)
 {
-    TLChatParticipant result;
+    chatParticipantValue = TLChatParticipant();
 
-    *this >> result.tlType;
+    *this >> chatParticipantValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatParticipantValue.tlType) {
     case TLValue::ChatParticipant:
     case TLValue::ChatParticipantAdmin:
-        *this >> result.userId;
-        *this >> result.inviterId;
-        *this >> result.date;
+        *this >> chatParticipantValue.userId;
+        *this >> chatParticipantValue.inviterId;
+        *this >> chatParticipantValue.date;
         break;
     case TLValue::ChatParticipantCreator:
-        *this >> result.userId;
+        *this >> chatParticipantValue.userId;
         break;
     default:
         break;
     }
 
-    chatParticipantValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatParticipants &chatParticipantsValue)
 {
-    TLChatParticipants result;
+    chatParticipantsValue = TLChatParticipants();
 
-    *this >> result.tlType;
+    *this >> chatParticipantsValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatParticipantsValue.tlType) {
     case TLValue::ChatParticipantsForbidden:
-        *this >> result.flags;
-        *this >> result.chatId;
-        if (result.flags & 1 << 0) {
-            *this >> result.selfParticipant;
+        *this >> chatParticipantsValue.flags;
+        *this >> chatParticipantsValue.chatId;
+        if (chatParticipantsValue.flags & 1 << 0) {
+            *this >> chatParticipantsValue.selfParticipant;
         }
         break;
     case TLValue::ChatParticipants:
-        *this >> result.chatId;
-        *this >> result.participants;
-        *this >> result.version;
+        *this >> chatParticipantsValue.chatId;
+        *this >> chatParticipantsValue.participants;
+        *this >> chatParticipantsValue.version;
         break;
     default:
         break;
     }
 
-    chatParticipantsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContact &contactValue)
 {
-    TLContact result;
+    contactValue = TLContact();
 
-    *this >> result.tlType;
+    *this >> contactValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactValue.tlType) {
     case TLValue::Contact:
-        *this >> result.userId;
-        *this >> result.mutual;
+        *this >> contactValue.userId;
+        *this >> contactValue.mutual;
         break;
     default:
         break;
     }
 
-    contactValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactBlocked &contactBlockedValue)
 {
-    TLContactBlocked result;
+    contactBlockedValue = TLContactBlocked();
 
-    *this >> result.tlType;
+    *this >> contactBlockedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactBlockedValue.tlType) {
     case TLValue::ContactBlocked:
-        *this >> result.userId;
-        *this >> result.date;
+        *this >> contactBlockedValue.userId;
+        *this >> contactBlockedValue.date;
         break;
     default:
         break;
     }
 
-    contactBlockedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactLink &contactLinkValue)
 {
-    TLContactLink result;
+    contactLinkValue = TLContactLink();
 
-    *this >> result.tlType;
+    *this >> contactLinkValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactLinkValue.tlType) {
     case TLValue::ContactLinkUnknown:
     case TLValue::ContactLinkNone:
     case TLValue::ContactLinkHasPhone:
@@ -613,272 +766,250 @@ CTelegramStream &CTelegramStream::operator>>(TLContactLink &contactLinkValue)
         break;
     }
 
-    contactLinkValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactSuggested &contactSuggestedValue)
 {
-    TLContactSuggested result;
+    contactSuggestedValue = TLContactSuggested();
 
-    *this >> result.tlType;
+    *this >> contactSuggestedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactSuggestedValue.tlType) {
     case TLValue::ContactSuggested:
-        *this >> result.userId;
-        *this >> result.mutualContacts;
+        *this >> contactSuggestedValue.userId;
+        *this >> contactSuggestedValue.mutualContacts;
         break;
     default:
         break;
     }
 
-    contactSuggestedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDisabledFeature &disabledFeatureValue)
 {
-    TLDisabledFeature result;
+    disabledFeatureValue = TLDisabledFeature();
 
-    *this >> result.tlType;
+    *this >> disabledFeatureValue.tlType;
 
-    switch (result.tlType) {
+    switch (disabledFeatureValue.tlType) {
     case TLValue::DisabledFeature:
-        *this >> result.feature;
-        *this >> result.description;
+        *this >> disabledFeatureValue.feature;
+        *this >> disabledFeatureValue.description;
         break;
     default:
         break;
     }
 
-    disabledFeatureValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLEncryptedChat &encryptedChatValue)
 {
-    TLEncryptedChat result;
+    encryptedChatValue = TLEncryptedChat();
 
-    *this >> result.tlType;
+    *this >> encryptedChatValue.tlType;
 
-    switch (result.tlType) {
+    switch (encryptedChatValue.tlType) {
     case TLValue::EncryptedChatEmpty:
     case TLValue::EncryptedChatDiscarded:
-        *this >> result.id;
+        *this >> encryptedChatValue.id;
         break;
     case TLValue::EncryptedChatWaiting:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.adminId;
-        *this >> result.participantId;
+        *this >> encryptedChatValue.id;
+        *this >> encryptedChatValue.accessHash;
+        *this >> encryptedChatValue.date;
+        *this >> encryptedChatValue.adminId;
+        *this >> encryptedChatValue.participantId;
         break;
     case TLValue::EncryptedChatRequested:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.adminId;
-        *this >> result.participantId;
-        *this >> result.gA;
+        *this >> encryptedChatValue.id;
+        *this >> encryptedChatValue.accessHash;
+        *this >> encryptedChatValue.date;
+        *this >> encryptedChatValue.adminId;
+        *this >> encryptedChatValue.participantId;
+        *this >> encryptedChatValue.gA;
         break;
     case TLValue::EncryptedChat:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.adminId;
-        *this >> result.participantId;
-        *this >> result.gAOrB;
-        *this >> result.keyFingerprint;
+        *this >> encryptedChatValue.id;
+        *this >> encryptedChatValue.accessHash;
+        *this >> encryptedChatValue.date;
+        *this >> encryptedChatValue.adminId;
+        *this >> encryptedChatValue.participantId;
+        *this >> encryptedChatValue.gAOrB;
+        *this >> encryptedChatValue.keyFingerprint;
         break;
     default:
         break;
     }
 
-    encryptedChatValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLEncryptedFile &encryptedFileValue)
 {
-    TLEncryptedFile result;
+    encryptedFileValue = TLEncryptedFile();
 
-    *this >> result.tlType;
+    *this >> encryptedFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (encryptedFileValue.tlType) {
     case TLValue::EncryptedFileEmpty:
         break;
     case TLValue::EncryptedFile:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.size;
-        *this >> result.dcId;
-        *this >> result.keyFingerprint;
+        *this >> encryptedFileValue.id;
+        *this >> encryptedFileValue.accessHash;
+        *this >> encryptedFileValue.size;
+        *this >> encryptedFileValue.dcId;
+        *this >> encryptedFileValue.keyFingerprint;
         break;
     default:
         break;
     }
 
-    encryptedFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLEncryptedMessage &encryptedMessageValue)
 {
-    TLEncryptedMessage result;
+    encryptedMessageValue = TLEncryptedMessage();
 
-    *this >> result.tlType;
+    *this >> encryptedMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (encryptedMessageValue.tlType) {
     case TLValue::EncryptedMessage:
-        *this >> result.randomId;
-        *this >> result.chatId;
-        *this >> result.date;
-        *this >> result.bytes;
-        *this >> result.file;
+        *this >> encryptedMessageValue.randomId;
+        *this >> encryptedMessageValue.chatId;
+        *this >> encryptedMessageValue.date;
+        *this >> encryptedMessageValue.bytes;
+        *this >> encryptedMessageValue.file;
         break;
     case TLValue::EncryptedMessageService:
-        *this >> result.randomId;
-        *this >> result.chatId;
-        *this >> result.date;
-        *this >> result.bytes;
+        *this >> encryptedMessageValue.randomId;
+        *this >> encryptedMessageValue.chatId;
+        *this >> encryptedMessageValue.date;
+        *this >> encryptedMessageValue.bytes;
         break;
     default:
         break;
     }
 
-    encryptedMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLError &errorValue)
 {
-    TLError result;
+    errorValue = TLError();
 
-    *this >> result.tlType;
+    *this >> errorValue.tlType;
 
-    switch (result.tlType) {
+    switch (errorValue.tlType) {
     case TLValue::Error:
-        *this >> result.code;
-        *this >> result.text;
+        *this >> errorValue.code;
+        *this >> errorValue.text;
         break;
     default:
         break;
     }
 
-    errorValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLExportedChatInvite &exportedChatInviteValue)
 {
-    TLExportedChatInvite result;
+    exportedChatInviteValue = TLExportedChatInvite();
 
-    *this >> result.tlType;
+    *this >> exportedChatInviteValue.tlType;
 
-    switch (result.tlType) {
+    switch (exportedChatInviteValue.tlType) {
     case TLValue::ChatInviteEmpty:
         break;
     case TLValue::ChatInviteExported:
-        *this >> result.link;
+        *this >> exportedChatInviteValue.link;
         break;
     default:
         break;
     }
 
-    exportedChatInviteValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLFileLocation &fileLocationValue)
 {
-    TLFileLocation result;
+    fileLocationValue = TLFileLocation();
 
-    *this >> result.tlType;
+    *this >> fileLocationValue.tlType;
 
-    switch (result.tlType) {
+    switch (fileLocationValue.tlType) {
     case TLValue::FileLocationUnavailable:
-        *this >> result.volumeId;
-        *this >> result.localId;
-        *this >> result.secret;
+        *this >> fileLocationValue.volumeId;
+        *this >> fileLocationValue.localId;
+        *this >> fileLocationValue.secret;
         break;
     case TLValue::FileLocation:
-        *this >> result.dcId;
-        *this >> result.volumeId;
-        *this >> result.localId;
-        *this >> result.secret;
+        *this >> fileLocationValue.dcId;
+        *this >> fileLocationValue.volumeId;
+        *this >> fileLocationValue.localId;
+        *this >> fileLocationValue.secret;
         break;
     default:
         break;
     }
 
-    fileLocationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLGeoPoint &geoPointValue)
 {
-    TLGeoPoint result;
+    geoPointValue = TLGeoPoint();
 
-    *this >> result.tlType;
+    *this >> geoPointValue.tlType;
 
-    switch (result.tlType) {
+    switch (geoPointValue.tlType) {
     case TLValue::GeoPointEmpty:
         break;
     case TLValue::GeoPoint:
-        *this >> result.longitude;
-        *this >> result.latitude;
+        *this >> geoPointValue.longitude;
+        *this >> geoPointValue.latitude;
         break;
     default:
         break;
     }
 
-    geoPointValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpAppChangelog &helpAppChangelogValue)
 {
-    TLHelpAppChangelog result;
+    helpAppChangelogValue = TLHelpAppChangelog();
 
-    *this >> result.tlType;
+    *this >> helpAppChangelogValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpAppChangelogValue.tlType) {
     case TLValue::HelpAppChangelogEmpty:
         break;
     case TLValue::HelpAppChangelog:
-        *this >> result.text;
+        *this >> helpAppChangelogValue.text;
         break;
     default:
         break;
     }
 
-    helpAppChangelogValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpAppUpdate &helpAppUpdateValue)
 {
-    TLHelpAppUpdate result;
+    helpAppUpdateValue = TLHelpAppUpdate();
 
-    *this >> result.tlType;
+    *this >> helpAppUpdateValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpAppUpdateValue.tlType) {
     case TLValue::HelpAppUpdate:
-        *this >> result.id;
-        *this >> result.critical;
-        *this >> result.url;
-        *this >> result.text;
+        *this >> helpAppUpdateValue.id;
+        *this >> helpAppUpdateValue.critical;
+        *this >> helpAppUpdateValue.url;
+        *this >> helpAppUpdateValue.text;
         break;
     case TLValue::HelpNoAppUpdate:
         break;
@@ -886,346 +1017,316 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpAppUpdate &helpAppUpdateValue
         break;
     }
 
-    helpAppUpdateValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpInviteText &helpInviteTextValue)
 {
-    TLHelpInviteText result;
+    helpInviteTextValue = TLHelpInviteText();
 
-    *this >> result.tlType;
+    *this >> helpInviteTextValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpInviteTextValue.tlType) {
     case TLValue::HelpInviteText:
-        *this >> result.message;
+        *this >> helpInviteTextValue.message;
         break;
     default:
         break;
     }
 
-    helpInviteTextValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpTermsOfService &helpTermsOfServiceValue)
 {
-    TLHelpTermsOfService result;
+    helpTermsOfServiceValue = TLHelpTermsOfService();
 
-    *this >> result.tlType;
+    *this >> helpTermsOfServiceValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpTermsOfServiceValue.tlType) {
     case TLValue::HelpTermsOfService:
-        *this >> result.text;
+        *this >> helpTermsOfServiceValue.text;
         break;
     default:
         break;
     }
 
-    helpTermsOfServiceValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLImportedContact &importedContactValue)
 {
-    TLImportedContact result;
+    importedContactValue = TLImportedContact();
 
-    *this >> result.tlType;
+    *this >> importedContactValue.tlType;
 
-    switch (result.tlType) {
+    switch (importedContactValue.tlType) {
     case TLValue::ImportedContact:
-        *this >> result.userId;
-        *this >> result.clientId;
+        *this >> importedContactValue.userId;
+        *this >> importedContactValue.clientId;
         break;
     default:
         break;
     }
 
-    importedContactValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputAppEvent &inputAppEventValue)
 {
-    TLInputAppEvent result;
+    inputAppEventValue = TLInputAppEvent();
 
-    *this >> result.tlType;
+    *this >> inputAppEventValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputAppEventValue.tlType) {
     case TLValue::InputAppEvent:
-        *this >> result.time;
-        *this >> result.type;
-        *this >> result.peer;
-        *this >> result.data;
+        *this >> inputAppEventValue.time;
+        *this >> inputAppEventValue.type;
+        *this >> inputAppEventValue.peer;
+        *this >> inputAppEventValue.data;
         break;
     default:
         break;
     }
 
-    inputAppEventValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputAudio &inputAudioValue)
 {
-    TLInputAudio result;
+    inputAudioValue = TLInputAudio();
 
-    *this >> result.tlType;
+    *this >> inputAudioValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputAudioValue.tlType) {
     case TLValue::InputAudioEmpty:
         break;
     case TLValue::InputAudio:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputAudioValue.id;
+        *this >> inputAudioValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputAudioValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputChannel &inputChannelValue)
 {
-    TLInputChannel result;
+    inputChannelValue = TLInputChannel();
 
-    *this >> result.tlType;
+    *this >> inputChannelValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputChannelValue.tlType) {
     case TLValue::InputChannelEmpty:
         break;
     case TLValue::InputChannel:
-        *this >> result.channelId;
-        *this >> result.accessHash;
+        *this >> inputChannelValue.channelId;
+        *this >> inputChannelValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputChannelValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputContact &inputContactValue)
 {
-    TLInputContact result;
+    inputContactValue = TLInputContact();
 
-    *this >> result.tlType;
+    *this >> inputContactValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputContactValue.tlType) {
     case TLValue::InputPhoneContact:
-        *this >> result.clientId;
-        *this >> result.phone;
-        *this >> result.firstName;
-        *this >> result.lastName;
+        *this >> inputContactValue.clientId;
+        *this >> inputContactValue.phone;
+        *this >> inputContactValue.firstName;
+        *this >> inputContactValue.lastName;
         break;
     default:
         break;
     }
 
-    inputContactValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputDocument &inputDocumentValue)
 {
-    TLInputDocument result;
+    inputDocumentValue = TLInputDocument();
 
-    *this >> result.tlType;
+    *this >> inputDocumentValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputDocumentValue.tlType) {
     case TLValue::InputDocumentEmpty:
         break;
     case TLValue::InputDocument:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputDocumentValue.id;
+        *this >> inputDocumentValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputDocumentValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedChat &inputEncryptedChatValue)
 {
-    TLInputEncryptedChat result;
+    inputEncryptedChatValue = TLInputEncryptedChat();
 
-    *this >> result.tlType;
+    *this >> inputEncryptedChatValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputEncryptedChatValue.tlType) {
     case TLValue::InputEncryptedChat:
-        *this >> result.chatId;
-        *this >> result.accessHash;
+        *this >> inputEncryptedChatValue.chatId;
+        *this >> inputEncryptedChatValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputEncryptedChatValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedFile &inputEncryptedFileValue)
 {
-    TLInputEncryptedFile result;
+    inputEncryptedFileValue = TLInputEncryptedFile();
 
-    *this >> result.tlType;
+    *this >> inputEncryptedFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputEncryptedFileValue.tlType) {
     case TLValue::InputEncryptedFileEmpty:
         break;
     case TLValue::InputEncryptedFileUploaded:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.md5Checksum;
-        *this >> result.keyFingerprint;
+        *this >> inputEncryptedFileValue.id;
+        *this >> inputEncryptedFileValue.parts;
+        *this >> inputEncryptedFileValue.md5Checksum;
+        *this >> inputEncryptedFileValue.keyFingerprint;
         break;
     case TLValue::InputEncryptedFile:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputEncryptedFileValue.id;
+        *this >> inputEncryptedFileValue.accessHash;
         break;
     case TLValue::InputEncryptedFileBigUploaded:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.keyFingerprint;
+        *this >> inputEncryptedFileValue.id;
+        *this >> inputEncryptedFileValue.parts;
+        *this >> inputEncryptedFileValue.keyFingerprint;
         break;
     default:
         break;
     }
 
-    inputEncryptedFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputFile &inputFileValue)
 {
-    TLInputFile result;
+    inputFileValue = TLInputFile();
 
-    *this >> result.tlType;
+    *this >> inputFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputFileValue.tlType) {
     case TLValue::InputFile:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.name;
-        *this >> result.md5Checksum;
+        *this >> inputFileValue.id;
+        *this >> inputFileValue.parts;
+        *this >> inputFileValue.name;
+        *this >> inputFileValue.md5Checksum;
         break;
     case TLValue::InputFileBig:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.name;
+        *this >> inputFileValue.id;
+        *this >> inputFileValue.parts;
+        *this >> inputFileValue.name;
         break;
     default:
         break;
     }
 
-    inputFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputFileLocation &inputFileLocationValue)
 {
-    TLInputFileLocation result;
+    inputFileLocationValue = TLInputFileLocation();
 
-    *this >> result.tlType;
+    *this >> inputFileLocationValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputFileLocationValue.tlType) {
     case TLValue::InputFileLocation:
-        *this >> result.volumeId;
-        *this >> result.localId;
-        *this >> result.secret;
+        *this >> inputFileLocationValue.volumeId;
+        *this >> inputFileLocationValue.localId;
+        *this >> inputFileLocationValue.secret;
         break;
     case TLValue::InputVideoFileLocation:
     case TLValue::InputEncryptedFileLocation:
     case TLValue::InputAudioFileLocation:
     case TLValue::InputDocumentFileLocation:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputFileLocationValue.id;
+        *this >> inputFileLocationValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputFileLocationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputGeoPoint &inputGeoPointValue)
 {
-    TLInputGeoPoint result;
+    inputGeoPointValue = TLInputGeoPoint();
 
-    *this >> result.tlType;
+    *this >> inputGeoPointValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputGeoPointValue.tlType) {
     case TLValue::InputGeoPointEmpty:
         break;
     case TLValue::InputGeoPoint:
-        *this >> result.latitude;
-        *this >> result.longitude;
+        *this >> inputGeoPointValue.latitude;
+        *this >> inputGeoPointValue.longitude;
         break;
     default:
         break;
     }
 
-    inputGeoPointValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPeer &inputPeerValue)
 {
-    TLInputPeer result;
+    inputPeerValue = TLInputPeer();
 
-    *this >> result.tlType;
+    *this >> inputPeerValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPeerValue.tlType) {
     case TLValue::InputPeerEmpty:
     case TLValue::InputPeerSelf:
         break;
     case TLValue::InputPeerChat:
-        *this >> result.chatId;
+        *this >> inputPeerValue.chatId;
         break;
     case TLValue::InputPeerUser:
-        *this >> result.userId;
-        *this >> result.accessHash;
+        *this >> inputPeerValue.userId;
+        *this >> inputPeerValue.accessHash;
         break;
     case TLValue::InputPeerChannel:
-        *this >> result.channelId;
-        *this >> result.accessHash;
+        *this >> inputPeerValue.channelId;
+        *this >> inputPeerValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputPeerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
 {
-    TLInputPeerNotifyEvents result;
+    inputPeerNotifyEventsValue = TLInputPeerNotifyEvents();
 
-    *this >> result.tlType;
+    *this >> inputPeerNotifyEventsValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPeerNotifyEventsValue.tlType) {
     case TLValue::InputPeerNotifyEventsEmpty:
     case TLValue::InputPeerNotifyEventsAll:
         break;
@@ -1233,211 +1334,191 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifyEvents &inputPeerN
         break;
     }
 
-    inputPeerNotifyEventsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
 {
-    TLInputPeerNotifySettings result;
+    inputPeerNotifySettingsValue = TLInputPeerNotifySettings();
 
-    *this >> result.tlType;
+    *this >> inputPeerNotifySettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPeerNotifySettingsValue.tlType) {
     case TLValue::InputPeerNotifySettings:
-        *this >> result.muteUntil;
-        *this >> result.sound;
-        *this >> result.showPreviews;
-        *this >> result.eventsMask;
+        *this >> inputPeerNotifySettingsValue.muteUntil;
+        *this >> inputPeerNotifySettingsValue.sound;
+        *this >> inputPeerNotifySettingsValue.showPreviews;
+        *this >> inputPeerNotifySettingsValue.eventsMask;
         break;
     default:
         break;
     }
 
-    inputPeerNotifySettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPhoto &inputPhotoValue)
 {
-    TLInputPhoto result;
+    inputPhotoValue = TLInputPhoto();
 
-    *this >> result.tlType;
+    *this >> inputPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPhotoValue.tlType) {
     case TLValue::InputPhotoEmpty:
         break;
     case TLValue::InputPhoto:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputPhotoValue.id;
+        *this >> inputPhotoValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPhotoCrop &inputPhotoCropValue)
 {
-    TLInputPhotoCrop result;
+    inputPhotoCropValue = TLInputPhotoCrop();
 
-    *this >> result.tlType;
+    *this >> inputPhotoCropValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPhotoCropValue.tlType) {
     case TLValue::InputPhotoCropAuto:
         break;
     case TLValue::InputPhotoCrop:
-        *this >> result.cropLeft;
-        *this >> result.cropTop;
-        *this >> result.cropWidth;
+        *this >> inputPhotoCropValue.cropLeft;
+        *this >> inputPhotoCropValue.cropTop;
+        *this >> inputPhotoCropValue.cropWidth;
         break;
     default:
         break;
     }
 
-    inputPhotoCropValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyKey &inputPrivacyKeyValue)
 {
-    TLInputPrivacyKey result;
+    inputPrivacyKeyValue = TLInputPrivacyKey();
 
-    *this >> result.tlType;
+    *this >> inputPrivacyKeyValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPrivacyKeyValue.tlType) {
     case TLValue::InputPrivacyKeyStatusTimestamp:
         break;
     default:
         break;
     }
 
-    inputPrivacyKeyValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputStickerSet &inputStickerSetValue)
 {
-    TLInputStickerSet result;
+    inputStickerSetValue = TLInputStickerSet();
 
-    *this >> result.tlType;
+    *this >> inputStickerSetValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputStickerSetValue.tlType) {
     case TLValue::InputStickerSetEmpty:
         break;
     case TLValue::InputStickerSetID:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputStickerSetValue.id;
+        *this >> inputStickerSetValue.accessHash;
         break;
     case TLValue::InputStickerSetShortName:
-        *this >> result.shortName;
+        *this >> inputStickerSetValue.shortName;
         break;
     default:
         break;
     }
 
-    inputStickerSetValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputUser &inputUserValue)
 {
-    TLInputUser result;
+    inputUserValue = TLInputUser();
 
-    *this >> result.tlType;
+    *this >> inputUserValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputUserValue.tlType) {
     case TLValue::InputUserEmpty:
     case TLValue::InputUserSelf:
         break;
     case TLValue::InputUser:
-        *this >> result.userId;
-        *this >> result.accessHash;
+        *this >> inputUserValue.userId;
+        *this >> inputUserValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputUserValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputVideo &inputVideoValue)
 {
-    TLInputVideo result;
+    inputVideoValue = TLInputVideo();
 
-    *this >> result.tlType;
+    *this >> inputVideoValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputVideoValue.tlType) {
     case TLValue::InputVideoEmpty:
         break;
     case TLValue::InputVideo:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputVideoValue.id;
+        *this >> inputVideoValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputVideoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLKeyboardButton &keyboardButtonValue)
 {
-    TLKeyboardButton result;
+    keyboardButtonValue = TLKeyboardButton();
 
-    *this >> result.tlType;
+    *this >> keyboardButtonValue.tlType;
 
-    switch (result.tlType) {
+    switch (keyboardButtonValue.tlType) {
     case TLValue::KeyboardButton:
-        *this >> result.text;
+        *this >> keyboardButtonValue.text;
         break;
     default:
         break;
     }
 
-    keyboardButtonValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLKeyboardButtonRow &keyboardButtonRowValue)
 {
-    TLKeyboardButtonRow result;
+    keyboardButtonRowValue = TLKeyboardButtonRow();
 
-    *this >> result.tlType;
+    *this >> keyboardButtonRowValue.tlType;
 
-    switch (result.tlType) {
+    switch (keyboardButtonRowValue.tlType) {
     case TLValue::KeyboardButtonRow:
-        *this >> result.buttons;
+        *this >> keyboardButtonRowValue.buttons;
         break;
     default:
         break;
     }
 
-    keyboardButtonRowValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessageEntity &messageEntityValue)
 {
-    TLMessageEntity result;
+    messageEntityValue = TLMessageEntity();
 
-    *this >> result.tlType;
+    *this >> messageEntityValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageEntityValue.tlType) {
     case TLValue::MessageEntityUnknown:
     case TLValue::MessageEntityMention:
     case TLValue::MessageEntityHashtag:
@@ -1447,143 +1528,131 @@ CTelegramStream &CTelegramStream::operator>>(TLMessageEntity &messageEntityValue
     case TLValue::MessageEntityBold:
     case TLValue::MessageEntityItalic:
     case TLValue::MessageEntityCode:
-        *this >> result.offset;
-        *this >> result.length;
+        *this >> messageEntityValue.offset;
+        *this >> messageEntityValue.length;
         break;
     case TLValue::MessageEntityPre:
-        *this >> result.offset;
-        *this >> result.length;
-        *this >> result.language;
+        *this >> messageEntityValue.offset;
+        *this >> messageEntityValue.length;
+        *this >> messageEntityValue.language;
         break;
     case TLValue::MessageEntityTextUrl:
-        *this >> result.offset;
-        *this >> result.length;
-        *this >> result.url;
+        *this >> messageEntityValue.offset;
+        *this >> messageEntityValue.length;
+        *this >> messageEntityValue.url;
         break;
     default:
         break;
     }
 
-    messageEntityValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessageGroup &messageGroupValue)
 {
-    TLMessageGroup result;
+    messageGroupValue = TLMessageGroup();
 
-    *this >> result.tlType;
+    *this >> messageGroupValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageGroupValue.tlType) {
     case TLValue::MessageGroup:
-        *this >> result.minId;
-        *this >> result.maxId;
-        *this >> result.count;
-        *this >> result.date;
+        *this >> messageGroupValue.minId;
+        *this >> messageGroupValue.maxId;
+        *this >> messageGroupValue.count;
+        *this >> messageGroupValue.date;
         break;
     default:
         break;
     }
 
-    messageGroupValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessageRange &messageRangeValue)
 {
-    TLMessageRange result;
+    messageRangeValue = TLMessageRange();
 
-    *this >> result.tlType;
+    *this >> messageRangeValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageRangeValue.tlType) {
     case TLValue::MessageRange:
-        *this >> result.minId;
-        *this >> result.maxId;
+        *this >> messageRangeValue.minId;
+        *this >> messageRangeValue.maxId;
         break;
     default:
         break;
     }
 
-    messageRangeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedHistory &messagesAffectedHistoryValue)
 {
-    TLMessagesAffectedHistory result;
+    messagesAffectedHistoryValue = TLMessagesAffectedHistory();
 
-    *this >> result.tlType;
+    *this >> messagesAffectedHistoryValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesAffectedHistoryValue.tlType) {
     case TLValue::MessagesAffectedHistory:
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.offset;
+        *this >> messagesAffectedHistoryValue.pts;
+        *this >> messagesAffectedHistoryValue.ptsCount;
+        *this >> messagesAffectedHistoryValue.offset;
         break;
     default:
         break;
     }
 
-    messagesAffectedHistoryValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedMessages &messagesAffectedMessagesValue)
 {
-    TLMessagesAffectedMessages result;
+    messagesAffectedMessagesValue = TLMessagesAffectedMessages();
 
-    *this >> result.tlType;
+    *this >> messagesAffectedMessagesValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesAffectedMessagesValue.tlType) {
     case TLValue::MessagesAffectedMessages:
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> messagesAffectedMessagesValue.pts;
+        *this >> messagesAffectedMessagesValue.ptsCount;
         break;
     default:
         break;
     }
 
-    messagesAffectedMessagesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesDhConfig &messagesDhConfigValue)
 {
-    TLMessagesDhConfig result;
+    messagesDhConfigValue = TLMessagesDhConfig();
 
-    *this >> result.tlType;
+    *this >> messagesDhConfigValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesDhConfigValue.tlType) {
     case TLValue::MessagesDhConfigNotModified:
-        *this >> result.random;
+        *this >> messagesDhConfigValue.random;
         break;
     case TLValue::MessagesDhConfig:
-        *this >> result.g;
-        *this >> result.p;
-        *this >> result.version;
-        *this >> result.random;
+        *this >> messagesDhConfigValue.g;
+        *this >> messagesDhConfigValue.p;
+        *this >> messagesDhConfigValue.version;
+        *this >> messagesDhConfigValue.random;
         break;
     default:
         break;
     }
 
-    messagesDhConfigValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesFilter &messagesFilterValue)
 {
-    TLMessagesFilter result;
+    messagesFilterValue = TLMessagesFilter();
 
-    *this >> result.tlType;
+    *this >> messagesFilterValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesFilterValue.tlType) {
     case TLValue::InputMessagesFilterEmpty:
     case TLValue::InputMessagesFilterPhotos:
     case TLValue::InputMessagesFilterVideo:
@@ -1599,87 +1668,79 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesFilter &messagesFilterVal
         break;
     }
 
-    messagesFilterValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue)
 {
-    TLMessagesSentEncryptedMessage result;
+    messagesSentEncryptedMessageValue = TLMessagesSentEncryptedMessage();
 
-    *this >> result.tlType;
+    *this >> messagesSentEncryptedMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesSentEncryptedMessageValue.tlType) {
     case TLValue::MessagesSentEncryptedMessage:
-        *this >> result.date;
+        *this >> messagesSentEncryptedMessageValue.date;
         break;
     case TLValue::MessagesSentEncryptedFile:
-        *this >> result.date;
-        *this >> result.file;
+        *this >> messagesSentEncryptedMessageValue.date;
+        *this >> messagesSentEncryptedMessageValue.file;
         break;
     default:
         break;
     }
 
-    messagesSentEncryptedMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLNearestDc &nearestDcValue)
 {
-    TLNearestDc result;
+    nearestDcValue = TLNearestDc();
 
-    *this >> result.tlType;
+    *this >> nearestDcValue.tlType;
 
-    switch (result.tlType) {
+    switch (nearestDcValue.tlType) {
     case TLValue::NearestDc:
-        *this >> result.country;
-        *this >> result.thisDc;
-        *this >> result.nearestDc;
+        *this >> nearestDcValue.country;
+        *this >> nearestDcValue.thisDc;
+        *this >> nearestDcValue.nearestDc;
         break;
     default:
         break;
     }
 
-    nearestDcValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPeer &peerValue)
 {
-    TLPeer result;
+    peerValue = TLPeer();
 
-    *this >> result.tlType;
+    *this >> peerValue.tlType;
 
-    switch (result.tlType) {
+    switch (peerValue.tlType) {
     case TLValue::PeerUser:
-        *this >> result.userId;
+        *this >> peerValue.userId;
         break;
     case TLValue::PeerChat:
-        *this >> result.chatId;
+        *this >> peerValue.chatId;
         break;
     case TLValue::PeerChannel:
-        *this >> result.channelId;
+        *this >> peerValue.channelId;
         break;
     default:
         break;
     }
 
-    peerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPeerNotifyEvents &peerNotifyEventsValue)
 {
-    TLPeerNotifyEvents result;
+    peerNotifyEventsValue = TLPeerNotifyEvents();
 
-    *this >> result.tlType;
+    *this >> peerNotifyEventsValue.tlType;
 
-    switch (result.tlType) {
+    switch (peerNotifyEventsValue.tlType) {
     case TLValue::PeerNotifyEventsEmpty:
     case TLValue::PeerNotifyEventsAll:
         break;
@@ -1687,93 +1748,85 @@ CTelegramStream &CTelegramStream::operator>>(TLPeerNotifyEvents &peerNotifyEvent
         break;
     }
 
-    peerNotifyEventsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPeerNotifySettings &peerNotifySettingsValue)
 {
-    TLPeerNotifySettings result;
+    peerNotifySettingsValue = TLPeerNotifySettings();
 
-    *this >> result.tlType;
+    *this >> peerNotifySettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (peerNotifySettingsValue.tlType) {
     case TLValue::PeerNotifySettingsEmpty:
         break;
     case TLValue::PeerNotifySettings:
-        *this >> result.muteUntil;
-        *this >> result.sound;
-        *this >> result.showPreviews;
-        *this >> result.eventsMask;
+        *this >> peerNotifySettingsValue.muteUntil;
+        *this >> peerNotifySettingsValue.sound;
+        *this >> peerNotifySettingsValue.showPreviews;
+        *this >> peerNotifySettingsValue.eventsMask;
         break;
     default:
         break;
     }
 
-    peerNotifySettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhotoSize &photoSizeValue)
 {
-    TLPhotoSize result;
+    photoSizeValue = TLPhotoSize();
 
-    *this >> result.tlType;
+    *this >> photoSizeValue.tlType;
 
-    switch (result.tlType) {
+    switch (photoSizeValue.tlType) {
     case TLValue::PhotoSizeEmpty:
-        *this >> result.type;
+        *this >> photoSizeValue.type;
         break;
     case TLValue::PhotoSize:
-        *this >> result.type;
-        *this >> result.location;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.size;
+        *this >> photoSizeValue.type;
+        *this >> photoSizeValue.location;
+        *this >> photoSizeValue.w;
+        *this >> photoSizeValue.h;
+        *this >> photoSizeValue.size;
         break;
     case TLValue::PhotoCachedSize:
-        *this >> result.type;
-        *this >> result.location;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.bytes;
+        *this >> photoSizeValue.type;
+        *this >> photoSizeValue.location;
+        *this >> photoSizeValue.w;
+        *this >> photoSizeValue.h;
+        *this >> photoSizeValue.bytes;
         break;
     default:
         break;
     }
 
-    photoSizeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPrivacyKey &privacyKeyValue)
 {
-    TLPrivacyKey result;
+    privacyKeyValue = TLPrivacyKey();
 
-    *this >> result.tlType;
+    *this >> privacyKeyValue.tlType;
 
-    switch (result.tlType) {
+    switch (privacyKeyValue.tlType) {
     case TLValue::PrivacyKeyStatusTimestamp:
         break;
     default:
         break;
     }
 
-    privacyKeyValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPrivacyRule &privacyRuleValue)
 {
-    TLPrivacyRule result;
+    privacyRuleValue = TLPrivacyRule();
 
-    *this >> result.tlType;
+    *this >> privacyRuleValue.tlType;
 
-    switch (result.tlType) {
+    switch (privacyRuleValue.tlType) {
     case TLValue::PrivacyValueAllowContacts:
     case TLValue::PrivacyValueAllowAll:
     case TLValue::PrivacyValueDisallowContacts:
@@ -1781,67 +1834,61 @@ CTelegramStream &CTelegramStream::operator>>(TLPrivacyRule &privacyRuleValue)
         break;
     case TLValue::PrivacyValueAllowUsers:
     case TLValue::PrivacyValueDisallowUsers:
-        *this >> result.users;
+        *this >> privacyRuleValue.users;
         break;
     default:
         break;
     }
 
-    privacyRuleValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLReceivedNotifyMessage &receivedNotifyMessageValue)
 {
-    TLReceivedNotifyMessage result;
+    receivedNotifyMessageValue = TLReceivedNotifyMessage();
 
-    *this >> result.tlType;
+    *this >> receivedNotifyMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (receivedNotifyMessageValue.tlType) {
     case TLValue::ReceivedNotifyMessage:
-        *this >> result.id;
-        *this >> result.flags;
+        *this >> receivedNotifyMessageValue.id;
+        *this >> receivedNotifyMessageValue.flags;
         break;
     default:
         break;
     }
 
-    receivedNotifyMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLReportReason &reportReasonValue)
 {
-    TLReportReason result;
+    reportReasonValue = TLReportReason();
 
-    *this >> result.tlType;
+    *this >> reportReasonValue.tlType;
 
-    switch (result.tlType) {
+    switch (reportReasonValue.tlType) {
     case TLValue::InputReportReasonSpam:
     case TLValue::InputReportReasonViolence:
     case TLValue::InputReportReasonPornography:
         break;
     case TLValue::InputReportReasonOther:
-        *this >> result.text;
+        *this >> reportReasonValue.text;
         break;
     default:
         break;
     }
 
-    reportReasonValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLSendMessageAction &sendMessageActionValue)
 {
-    TLSendMessageAction result;
+    sendMessageActionValue = TLSendMessageAction();
 
-    *this >> result.tlType;
+    *this >> sendMessageActionValue.tlType;
 
-    switch (result.tlType) {
+    switch (sendMessageActionValue.tlType) {
     case TLValue::SendMessageTypingAction:
     case TLValue::SendMessageCancelAction:
     case TLValue::SendMessageRecordVideoAction:
@@ -1853,44 +1900,40 @@ CTelegramStream &CTelegramStream::operator>>(TLSendMessageAction &sendMessageAct
     case TLValue::SendMessageUploadAudioAction:
     case TLValue::SendMessageUploadPhotoAction:
     case TLValue::SendMessageUploadDocumentAction:
-        *this >> result.progress;
+        *this >> sendMessageActionValue.progress;
         break;
     default:
         break;
     }
 
-    sendMessageActionValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLStickerPack &stickerPackValue)
 {
-    TLStickerPack result;
+    stickerPackValue = TLStickerPack();
 
-    *this >> result.tlType;
+    *this >> stickerPackValue.tlType;
 
-    switch (result.tlType) {
+    switch (stickerPackValue.tlType) {
     case TLValue::StickerPack:
-        *this >> result.emoticon;
-        *this >> result.documents;
+        *this >> stickerPackValue.emoticon;
+        *this >> stickerPackValue.documents;
         break;
     default:
         break;
     }
 
-    stickerPackValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLStorageFileType &storageFileTypeValue)
 {
-    TLStorageFileType result;
+    storageFileTypeValue = TLStorageFileType();
 
-    *this >> result.tlType;
+    *this >> storageFileTypeValue.tlType;
 
-    switch (result.tlType) {
+    switch (storageFileTypeValue.tlType) {
     case TLValue::StorageFileUnknown:
     case TLValue::StorageFileJpeg:
     case TLValue::StorageFileGif:
@@ -1906,569 +1949,531 @@ CTelegramStream &CTelegramStream::operator>>(TLStorageFileType &storageFileTypeV
         break;
     }
 
-    storageFileTypeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdatesState &updatesStateValue)
 {
-    TLUpdatesState result;
+    updatesStateValue = TLUpdatesState();
 
-    *this >> result.tlType;
+    *this >> updatesStateValue.tlType;
 
-    switch (result.tlType) {
+    switch (updatesStateValue.tlType) {
     case TLValue::UpdatesState:
-        *this >> result.pts;
-        *this >> result.qts;
-        *this >> result.date;
-        *this >> result.seq;
-        *this >> result.unreadCount;
+        *this >> updatesStateValue.pts;
+        *this >> updatesStateValue.qts;
+        *this >> updatesStateValue.date;
+        *this >> updatesStateValue.seq;
+        *this >> updatesStateValue.unreadCount;
         break;
     default:
         break;
     }
 
-    updatesStateValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUploadFile &uploadFileValue)
 {
-    TLUploadFile result;
+    uploadFileValue = TLUploadFile();
 
-    *this >> result.tlType;
+    *this >> uploadFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (uploadFileValue.tlType) {
     case TLValue::UploadFile:
-        *this >> result.type;
-        *this >> result.mtime;
-        *this >> result.bytes;
+        *this >> uploadFileValue.type;
+        *this >> uploadFileValue.mtime;
+        *this >> uploadFileValue.bytes;
         break;
     default:
         break;
     }
 
-    uploadFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUserProfilePhoto &userProfilePhotoValue)
 {
-    TLUserProfilePhoto result;
+    userProfilePhotoValue = TLUserProfilePhoto();
 
-    *this >> result.tlType;
+    *this >> userProfilePhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (userProfilePhotoValue.tlType) {
     case TLValue::UserProfilePhotoEmpty:
         break;
     case TLValue::UserProfilePhoto:
-        *this >> result.photoId;
-        *this >> result.photoSmall;
-        *this >> result.photoBig;
+        *this >> userProfilePhotoValue.photoId;
+        *this >> userProfilePhotoValue.photoSmall;
+        *this >> userProfilePhotoValue.photoBig;
         break;
     default:
         break;
     }
 
-    userProfilePhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUserStatus &userStatusValue)
 {
-    TLUserStatus result;
+    userStatusValue = TLUserStatus();
 
-    *this >> result.tlType;
+    *this >> userStatusValue.tlType;
 
-    switch (result.tlType) {
+    switch (userStatusValue.tlType) {
     case TLValue::UserStatusEmpty:
     case TLValue::UserStatusRecently:
     case TLValue::UserStatusLastWeek:
     case TLValue::UserStatusLastMonth:
         break;
     case TLValue::UserStatusOnline:
-        *this >> result.expires;
+        *this >> userStatusValue.expires;
         break;
     case TLValue::UserStatusOffline:
-        *this >> result.wasOnline;
+        *this >> userStatusValue.wasOnline;
         break;
     default:
         break;
     }
 
-    userStatusValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLVideo &videoValue)
 {
-    TLVideo result;
+    videoValue = TLVideo();
 
-    *this >> result.tlType;
+    *this >> videoValue.tlType;
 
-    switch (result.tlType) {
+    switch (videoValue.tlType) {
     case TLValue::VideoEmpty:
-        *this >> result.id;
+        *this >> videoValue.id;
         break;
     case TLValue::Video:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.duration;
-        *this >> result.mimeType;
-        *this >> result.size;
-        *this >> result.thumb;
-        *this >> result.dcId;
-        *this >> result.w;
-        *this >> result.h;
+        *this >> videoValue.id;
+        *this >> videoValue.accessHash;
+        *this >> videoValue.date;
+        *this >> videoValue.duration;
+        *this >> videoValue.mimeType;
+        *this >> videoValue.size;
+        *this >> videoValue.thumb;
+        *this >> videoValue.dcId;
+        *this >> videoValue.w;
+        *this >> videoValue.h;
         break;
     default:
         break;
     }
 
-    videoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLWallPaper &wallPaperValue)
 {
-    TLWallPaper result;
+    wallPaperValue = TLWallPaper();
 
-    *this >> result.tlType;
+    *this >> wallPaperValue.tlType;
 
-    switch (result.tlType) {
+    switch (wallPaperValue.tlType) {
     case TLValue::WallPaper:
-        *this >> result.id;
-        *this >> result.title;
-        *this >> result.sizes;
-        *this >> result.color;
+        *this >> wallPaperValue.id;
+        *this >> wallPaperValue.title;
+        *this >> wallPaperValue.sizes;
+        *this >> wallPaperValue.color;
         break;
     case TLValue::WallPaperSolid:
-        *this >> result.id;
-        *this >> result.title;
-        *this >> result.bgColor;
-        *this >> result.color;
+        *this >> wallPaperValue.id;
+        *this >> wallPaperValue.title;
+        *this >> wallPaperValue.bgColor;
+        *this >> wallPaperValue.color;
         break;
     default:
         break;
     }
 
-    wallPaperValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountAuthorizations &accountAuthorizationsValue)
 {
-    TLAccountAuthorizations result;
+    accountAuthorizationsValue = TLAccountAuthorizations();
 
-    *this >> result.tlType;
+    *this >> accountAuthorizationsValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountAuthorizationsValue.tlType) {
     case TLValue::AccountAuthorizations:
-        *this >> result.authorizations;
+        *this >> accountAuthorizationsValue.authorizations;
         break;
     default:
         break;
     }
 
-    accountAuthorizationsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLBotInlineMessage &botInlineMessageValue)
 {
-    TLBotInlineMessage result;
+    botInlineMessageValue = TLBotInlineMessage();
 
-    *this >> result.tlType;
+    *this >> botInlineMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (botInlineMessageValue.tlType) {
     case TLValue::BotInlineMessageMediaAuto:
-        *this >> result.caption;
+        *this >> botInlineMessageValue.caption;
         break;
     case TLValue::BotInlineMessageText:
-        *this >> result.flags;
-        *this >> result.message;
-        if (result.flags & 1 << 1) {
-            *this >> result.entities;
+        *this >> botInlineMessageValue.flags;
+        *this >> botInlineMessageValue.message;
+        if (botInlineMessageValue.flags & 1 << 1) {
+            *this >> botInlineMessageValue.entities;
         }
         break;
     default:
         break;
     }
 
-    botInlineMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChannelMessagesFilter &channelMessagesFilterValue)
 {
-    TLChannelMessagesFilter result;
+    channelMessagesFilterValue = TLChannelMessagesFilter();
 
-    *this >> result.tlType;
+    *this >> channelMessagesFilterValue.tlType;
 
-    switch (result.tlType) {
+    switch (channelMessagesFilterValue.tlType) {
     case TLValue::ChannelMessagesFilterEmpty:
     case TLValue::ChannelMessagesFilterCollapsed:
         break;
     case TLValue::ChannelMessagesFilter:
-        *this >> result.flags;
-        *this >> result.ranges;
+        *this >> channelMessagesFilterValue.flags;
+        *this >> channelMessagesFilterValue.ranges;
         break;
     default:
         break;
     }
 
-    channelMessagesFilterValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatPhoto &chatPhotoValue)
 {
-    TLChatPhoto result;
+    chatPhotoValue = TLChatPhoto();
 
-    *this >> result.tlType;
+    *this >> chatPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatPhotoValue.tlType) {
     case TLValue::ChatPhotoEmpty:
         break;
     case TLValue::ChatPhoto:
-        *this >> result.photoSmall;
-        *this >> result.photoBig;
+        *this >> chatPhotoValue.photoSmall;
+        *this >> chatPhotoValue.photoBig;
         break;
     default:
         break;
     }
 
-    chatPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactStatus &contactStatusValue)
 {
-    TLContactStatus result;
+    contactStatusValue = TLContactStatus();
 
-    *this >> result.tlType;
+    *this >> contactStatusValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactStatusValue.tlType) {
     case TLValue::ContactStatus:
-        *this >> result.userId;
-        *this >> result.status;
+        *this >> contactStatusValue.userId;
+        *this >> contactStatusValue.status;
         break;
     default:
         break;
     }
 
-    contactStatusValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDcOption &dcOptionValue)
 {
-    TLDcOption result;
+    dcOptionValue = TLDcOption();
 
-    *this >> result.tlType;
+    *this >> dcOptionValue.tlType;
 
-    switch (result.tlType) {
+    switch (dcOptionValue.tlType) {
     case TLValue::DcOption:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.ipAddress;
-        *this >> result.port;
+        *this >> dcOptionValue.flags;
+        *this >> dcOptionValue.id;
+        *this >> dcOptionValue.ipAddress;
+        *this >> dcOptionValue.port;
         break;
     default:
         break;
     }
 
-    dcOptionValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDialog &dialogValue)
 {
-    TLDialog result;
+    dialogValue = TLDialog();
 
-    *this >> result.tlType;
+    *this >> dialogValue.tlType;
 
-    switch (result.tlType) {
+    switch (dialogValue.tlType) {
     case TLValue::Dialog:
-        *this >> result.peer;
-        *this >> result.topMessage;
-        *this >> result.readInboxMaxId;
-        *this >> result.unreadCount;
-        *this >> result.notifySettings;
+        *this >> dialogValue.peer;
+        *this >> dialogValue.topMessage;
+        *this >> dialogValue.readInboxMaxId;
+        *this >> dialogValue.unreadCount;
+        *this >> dialogValue.notifySettings;
         break;
     case TLValue::DialogChannel:
-        *this >> result.peer;
-        *this >> result.topMessage;
-        *this >> result.topImportantMessage;
-        *this >> result.readInboxMaxId;
-        *this >> result.unreadCount;
-        *this >> result.unreadImportantCount;
-        *this >> result.notifySettings;
-        *this >> result.pts;
+        *this >> dialogValue.peer;
+        *this >> dialogValue.topMessage;
+        *this >> dialogValue.topImportantMessage;
+        *this >> dialogValue.readInboxMaxId;
+        *this >> dialogValue.unreadCount;
+        *this >> dialogValue.unreadImportantCount;
+        *this >> dialogValue.notifySettings;
+        *this >> dialogValue.pts;
         break;
     default:
         break;
     }
 
-    dialogValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDocumentAttribute &documentAttributeValue)
 {
-    TLDocumentAttribute result;
+    documentAttributeValue = TLDocumentAttribute();
 
-    *this >> result.tlType;
+    *this >> documentAttributeValue.tlType;
 
-    switch (result.tlType) {
+    switch (documentAttributeValue.tlType) {
     case TLValue::DocumentAttributeImageSize:
-        *this >> result.w;
-        *this >> result.h;
+        *this >> documentAttributeValue.w;
+        *this >> documentAttributeValue.h;
         break;
     case TLValue::DocumentAttributeAnimated:
         break;
     case TLValue::DocumentAttributeSticker:
-        *this >> result.alt;
-        *this >> result.stickerset;
+        *this >> documentAttributeValue.alt;
+        *this >> documentAttributeValue.stickerset;
         break;
     case TLValue::DocumentAttributeVideo:
-        *this >> result.duration;
-        *this >> result.w;
-        *this >> result.h;
+        *this >> documentAttributeValue.duration;
+        *this >> documentAttributeValue.w;
+        *this >> documentAttributeValue.h;
         break;
     case TLValue::DocumentAttributeAudio:
-        *this >> result.duration;
-        *this >> result.title;
-        *this >> result.performer;
+        *this >> documentAttributeValue.duration;
+        *this >> documentAttributeValue.title;
+        *this >> documentAttributeValue.performer;
         break;
     case TLValue::DocumentAttributeFilename:
-        *this >> result.fileName;
+        *this >> documentAttributeValue.fileName;
         break;
     default:
         break;
     }
 
-    documentAttributeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputBotInlineMessage &inputBotInlineMessageValue)
 {
-    TLInputBotInlineMessage result;
+    inputBotInlineMessageValue = TLInputBotInlineMessage();
 
-    *this >> result.tlType;
+    *this >> inputBotInlineMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputBotInlineMessageValue.tlType) {
     case TLValue::InputBotInlineMessageMediaAuto:
-        *this >> result.caption;
+        *this >> inputBotInlineMessageValue.caption;
         break;
     case TLValue::InputBotInlineMessageText:
-        *this >> result.flags;
-        *this >> result.message;
-        if (result.flags & 1 << 1) {
-            *this >> result.entities;
+        *this >> inputBotInlineMessageValue.flags;
+        *this >> inputBotInlineMessageValue.message;
+        if (inputBotInlineMessageValue.flags & 1 << 1) {
+            *this >> inputBotInlineMessageValue.entities;
         }
         break;
     default:
         break;
     }
 
-    inputBotInlineMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputBotInlineResult &inputBotInlineResultValue)
 {
-    TLInputBotInlineResult result;
+    inputBotInlineResultValue = TLInputBotInlineResult();
 
-    *this >> result.tlType;
+    *this >> inputBotInlineResultValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputBotInlineResultValue.tlType) {
     case TLValue::InputBotInlineResult:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.type;
-        if (result.flags & 1 << 1) {
-            *this >> result.title;
+        *this >> inputBotInlineResultValue.flags;
+        *this >> inputBotInlineResultValue.id;
+        *this >> inputBotInlineResultValue.type;
+        if (inputBotInlineResultValue.flags & 1 << 1) {
+            *this >> inputBotInlineResultValue.title;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.description;
+        if (inputBotInlineResultValue.flags & 1 << 2) {
+            *this >> inputBotInlineResultValue.description;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.url;
+        if (inputBotInlineResultValue.flags & 1 << 3) {
+            *this >> inputBotInlineResultValue.url;
         }
-        if (result.flags & 1 << 4) {
-            *this >> result.thumbUrl;
+        if (inputBotInlineResultValue.flags & 1 << 4) {
+            *this >> inputBotInlineResultValue.thumbUrl;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.contentUrl;
+        if (inputBotInlineResultValue.flags & 1 << 5) {
+            *this >> inputBotInlineResultValue.contentUrl;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.contentType;
+        if (inputBotInlineResultValue.flags & 1 << 5) {
+            *this >> inputBotInlineResultValue.contentType;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.w;
+        if (inputBotInlineResultValue.flags & 1 << 6) {
+            *this >> inputBotInlineResultValue.w;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.h;
+        if (inputBotInlineResultValue.flags & 1 << 6) {
+            *this >> inputBotInlineResultValue.h;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.duration;
+        if (inputBotInlineResultValue.flags & 1 << 7) {
+            *this >> inputBotInlineResultValue.duration;
         }
-        *this >> result.sendMessage;
+        *this >> inputBotInlineResultValue.sendMessage;
         break;
     default:
         break;
     }
 
-    inputBotInlineResultValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputChatPhoto &inputChatPhotoValue)
 {
-    TLInputChatPhoto result;
+    inputChatPhotoValue = TLInputChatPhoto();
 
-    *this >> result.tlType;
+    *this >> inputChatPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputChatPhotoValue.tlType) {
     case TLValue::InputChatPhotoEmpty:
         break;
     case TLValue::InputChatUploadedPhoto:
-        *this >> result.file;
-        *this >> result.crop;
+        *this >> inputChatPhotoValue.file;
+        *this >> inputChatPhotoValue.crop;
         break;
     case TLValue::InputChatPhoto:
-        *this >> result.id;
-        *this >> result.crop;
+        *this >> inputChatPhotoValue.id;
+        *this >> inputChatPhotoValue.crop;
         break;
     default:
         break;
     }
 
-    inputChatPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputMedia &inputMediaValue)
 {
-    TLInputMedia result;
+    inputMediaValue = TLInputMedia();
 
-    *this >> result.tlType;
+    *this >> inputMediaValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputMediaValue.tlType) {
     case TLValue::InputMediaEmpty:
         break;
     case TLValue::InputMediaUploadedPhoto:
-        *this >> result.file;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaPhoto:
-        *this >> result.inputPhotoId;
-        *this >> result.caption;
+        *this >> inputMediaValue.inputPhotoId;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaGeoPoint:
-        *this >> result.geoPoint;
+        *this >> inputMediaValue.geoPoint;
         break;
     case TLValue::InputMediaContact:
-        *this >> result.phoneNumber;
-        *this >> result.firstName;
-        *this >> result.lastName;
+        *this >> inputMediaValue.phoneNumber;
+        *this >> inputMediaValue.firstName;
+        *this >> inputMediaValue.lastName;
         break;
     case TLValue::InputMediaUploadedVideo:
-        *this >> result.file;
-        *this >> result.duration;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.mimeType;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.duration;
+        *this >> inputMediaValue.w;
+        *this >> inputMediaValue.h;
+        *this >> inputMediaValue.mimeType;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaUploadedThumbVideo:
-        *this >> result.file;
-        *this >> result.thumb;
-        *this >> result.duration;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.mimeType;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.thumb;
+        *this >> inputMediaValue.duration;
+        *this >> inputMediaValue.w;
+        *this >> inputMediaValue.h;
+        *this >> inputMediaValue.mimeType;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaVideo:
-        *this >> result.inputVideoId;
-        *this >> result.caption;
+        *this >> inputMediaValue.inputVideoId;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaUploadedAudio:
-        *this >> result.file;
-        *this >> result.duration;
-        *this >> result.mimeType;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.duration;
+        *this >> inputMediaValue.mimeType;
         break;
     case TLValue::InputMediaAudio:
-        *this >> result.inputAudioId;
+        *this >> inputMediaValue.inputAudioId;
         break;
     case TLValue::InputMediaUploadedDocument:
-        *this >> result.file;
-        *this >> result.mimeType;
-        *this >> result.attributes;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.mimeType;
+        *this >> inputMediaValue.attributes;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaUploadedThumbDocument:
-        *this >> result.file;
-        *this >> result.thumb;
-        *this >> result.mimeType;
-        *this >> result.attributes;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.thumb;
+        *this >> inputMediaValue.mimeType;
+        *this >> inputMediaValue.attributes;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaDocument:
-        *this >> result.inputDocumentId;
-        *this >> result.caption;
+        *this >> inputMediaValue.inputDocumentId;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaVenue:
-        *this >> result.geoPoint;
-        *this >> result.title;
-        *this >> result.address;
-        *this >> result.provider;
-        *this >> result.venueId;
+        *this >> inputMediaValue.geoPoint;
+        *this >> inputMediaValue.title;
+        *this >> inputMediaValue.address;
+        *this >> inputMediaValue.provider;
+        *this >> inputMediaValue.venueId;
         break;
     case TLValue::InputMediaGifExternal:
-        *this >> result.url;
-        *this >> result.q;
+        *this >> inputMediaValue.url;
+        *this >> inputMediaValue.q;
         break;
     default:
         break;
     }
 
-    inputMediaValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputNotifyPeer &inputNotifyPeerValue)
 {
-    TLInputNotifyPeer result;
+    inputNotifyPeerValue = TLInputNotifyPeer();
 
-    *this >> result.tlType;
+    *this >> inputNotifyPeerValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputNotifyPeerValue.tlType) {
     case TLValue::InputNotifyPeer:
-        *this >> result.peer;
+        *this >> inputNotifyPeerValue.peer;
         break;
     case TLValue::InputNotifyUsers:
     case TLValue::InputNotifyChats:
@@ -2478,18 +2483,16 @@ CTelegramStream &CTelegramStream::operator>>(TLInputNotifyPeer &inputNotifyPeerV
         break;
     }
 
-    inputNotifyPeerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyRule &inputPrivacyRuleValue)
 {
-    TLInputPrivacyRule result;
+    inputPrivacyRuleValue = TLInputPrivacyRule();
 
-    *this >> result.tlType;
+    *this >> inputPrivacyRuleValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPrivacyRuleValue.tlType) {
     case TLValue::InputPrivacyValueAllowContacts:
     case TLValue::InputPrivacyValueAllowAll:
     case TLValue::InputPrivacyValueDisallowContacts:
@@ -2497,26 +2500,24 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyRule &inputPrivacyRul
         break;
     case TLValue::InputPrivacyValueAllowUsers:
     case TLValue::InputPrivacyValueDisallowUsers:
-        *this >> result.users;
+        *this >> inputPrivacyRuleValue.users;
         break;
     default:
         break;
     }
 
-    inputPrivacyRuleValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLNotifyPeer &notifyPeerValue)
 {
-    TLNotifyPeer result;
+    notifyPeerValue = TLNotifyPeer();
 
-    *this >> result.tlType;
+    *this >> notifyPeerValue.tlType;
 
-    switch (result.tlType) {
+    switch (notifyPeerValue.tlType) {
     case TLValue::NotifyPeer:
-        *this >> result.peer;
+        *this >> notifyPeerValue.peer;
         break;
     case TLValue::NotifyUsers:
     case TLValue::NotifyChats:
@@ -2526,1583 +2527,8457 @@ CTelegramStream &CTelegramStream::operator>>(TLNotifyPeer &notifyPeerValue)
         break;
     }
 
-    notifyPeerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhoto &photoValue)
 {
-    TLPhoto result;
+    photoValue = TLPhoto();
 
-    *this >> result.tlType;
+    *this >> photoValue.tlType;
 
-    switch (result.tlType) {
+    switch (photoValue.tlType) {
     case TLValue::PhotoEmpty:
-        *this >> result.id;
+        *this >> photoValue.id;
         break;
     case TLValue::Photo:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.sizes;
+        *this >> photoValue.id;
+        *this >> photoValue.accessHash;
+        *this >> photoValue.date;
+        *this >> photoValue.sizes;
         break;
     default:
         break;
     }
 
-    photoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLReplyMarkup &replyMarkupValue)
 {
-    TLReplyMarkup result;
+    replyMarkupValue = TLReplyMarkup();
 
-    *this >> result.tlType;
+    *this >> replyMarkupValue.tlType;
 
-    switch (result.tlType) {
+    switch (replyMarkupValue.tlType) {
     case TLValue::ReplyKeyboardHide:
     case TLValue::ReplyKeyboardForceReply:
-        *this >> result.flags;
+        *this >> replyMarkupValue.flags;
         break;
     case TLValue::ReplyKeyboardMarkup:
-        *this >> result.flags;
-        *this >> result.rows;
+        *this >> replyMarkupValue.flags;
+        *this >> replyMarkupValue.rows;
         break;
     default:
         break;
     }
 
-    replyMarkupValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLStickerSet &stickerSetValue)
 {
-    TLStickerSet result;
+    stickerSetValue = TLStickerSet();
 
-    *this >> result.tlType;
+    *this >> stickerSetValue.tlType;
 
-    switch (result.tlType) {
+    switch (stickerSetValue.tlType) {
     case TLValue::StickerSet:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.title;
-        *this >> result.shortName;
-        *this >> result.count;
-        *this >> result.hash;
+        *this >> stickerSetValue.flags;
+        *this >> stickerSetValue.id;
+        *this >> stickerSetValue.accessHash;
+        *this >> stickerSetValue.title;
+        *this >> stickerSetValue.shortName;
+        *this >> stickerSetValue.count;
+        *this >> stickerSetValue.hash;
         break;
     default:
         break;
     }
 
-    stickerSetValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUser &userValue)
 {
-    TLUser result;
+    userValue = TLUser();
 
-    *this >> result.tlType;
+    *this >> userValue.tlType;
 
-    switch (result.tlType) {
+    switch (userValue.tlType) {
     case TLValue::UserEmpty:
-        *this >> result.id;
+        *this >> userValue.id;
         break;
     case TLValue::User:
-        *this >> result.flags;
-        *this >> result.id;
-        if (result.flags & 1 << 0) {
-            *this >> result.accessHash;
+        *this >> userValue.flags;
+        *this >> userValue.id;
+        if (userValue.flags & 1 << 0) {
+            *this >> userValue.accessHash;
         }
-        if (result.flags & 1 << 1) {
-            *this >> result.firstName;
+        if (userValue.flags & 1 << 1) {
+            *this >> userValue.firstName;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.lastName;
+        if (userValue.flags & 1 << 2) {
+            *this >> userValue.lastName;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.username;
+        if (userValue.flags & 1 << 3) {
+            *this >> userValue.username;
         }
-        if (result.flags & 1 << 4) {
-            *this >> result.phone;
+        if (userValue.flags & 1 << 4) {
+            *this >> userValue.phone;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.photo;
+        if (userValue.flags & 1 << 5) {
+            *this >> userValue.photo;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.status;
+        if (userValue.flags & 1 << 6) {
+            *this >> userValue.status;
         }
-        if (result.flags & 1 << 14) {
-            *this >> result.botInfoVersion;
+        if (userValue.flags & 1 << 14) {
+            *this >> userValue.botInfoVersion;
         }
-        if (result.flags & 1 << 18) {
-            *this >> result.restrictionReason;
+        if (userValue.flags & 1 << 18) {
+            *this >> userValue.restrictionReason;
         }
-        if (result.flags & 1 << 19) {
-            *this >> result.botInlinePlaceholder;
+        if (userValue.flags & 1 << 19) {
+            *this >> userValue.botInlinePlaceholder;
         }
         break;
     default:
         break;
     }
 
-    userValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPrivacyRules &accountPrivacyRulesValue)
 {
-    TLAccountPrivacyRules result;
+    accountPrivacyRulesValue = TLAccountPrivacyRules();
 
-    *this >> result.tlType;
+    *this >> accountPrivacyRulesValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPrivacyRulesValue.tlType) {
     case TLValue::AccountPrivacyRules:
-        *this >> result.rules;
-        *this >> result.users;
+        *this >> accountPrivacyRulesValue.rules;
+        *this >> accountPrivacyRulesValue.users;
         break;
     default:
         break;
     }
 
-    accountPrivacyRulesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthAuthorization &authAuthorizationValue)
 {
-    TLAuthAuthorization result;
+    authAuthorizationValue = TLAuthAuthorization();
 
-    *this >> result.tlType;
+    *this >> authAuthorizationValue.tlType;
 
-    switch (result.tlType) {
+    switch (authAuthorizationValue.tlType) {
     case TLValue::AuthAuthorization:
-        *this >> result.user;
+        *this >> authAuthorizationValue.user;
         break;
     default:
         break;
     }
 
-    authAuthorizationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChannelsChannelParticipant &channelsChannelParticipantValue)
 {
-    TLChannelsChannelParticipant result;
+    channelsChannelParticipantValue = TLChannelsChannelParticipant();
 
-    *this >> result.tlType;
+    *this >> channelsChannelParticipantValue.tlType;
 
-    switch (result.tlType) {
+    switch (channelsChannelParticipantValue.tlType) {
     case TLValue::ChannelsChannelParticipant:
-        *this >> result.participant;
-        *this >> result.users;
+        *this >> channelsChannelParticipantValue.participant;
+        *this >> channelsChannelParticipantValue.users;
         break;
     default:
         break;
     }
 
-    channelsChannelParticipantValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChannelsChannelParticipants &channelsChannelParticipantsValue)
 {
-    TLChannelsChannelParticipants result;
+    channelsChannelParticipantsValue = TLChannelsChannelParticipants();
 
-    *this >> result.tlType;
+    *this >> channelsChannelParticipantsValue.tlType;
 
-    switch (result.tlType) {
+    switch (channelsChannelParticipantsValue.tlType) {
     case TLValue::ChannelsChannelParticipants:
-        *this >> result.count;
-        *this >> result.participants;
-        *this >> result.users;
+        *this >> channelsChannelParticipantsValue.count;
+        *this >> channelsChannelParticipantsValue.participants;
+        *this >> channelsChannelParticipantsValue.users;
         break;
     default:
         break;
     }
 
-    channelsChannelParticipantsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChat &chatValue)
 {
-    TLChat result;
+    chatValue = TLChat();
 
-    *this >> result.tlType;
+    *this >> chatValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatValue.tlType) {
     case TLValue::ChatEmpty:
-        *this >> result.id;
+        *this >> chatValue.id;
         break;
     case TLValue::Chat:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.title;
-        *this >> result.photo;
-        *this >> result.participantsCount;
-        *this >> result.date;
-        *this >> result.version;
-        if (result.flags & 1 << 6) {
-            *this >> result.migratedTo;
+        *this >> chatValue.flags;
+        *this >> chatValue.id;
+        *this >> chatValue.title;
+        *this >> chatValue.photo;
+        *this >> chatValue.participantsCount;
+        *this >> chatValue.date;
+        *this >> chatValue.version;
+        if (chatValue.flags & 1 << 6) {
+            *this >> chatValue.migratedTo;
         }
         break;
     case TLValue::ChatForbidden:
-        *this >> result.id;
-        *this >> result.title;
+        *this >> chatValue.id;
+        *this >> chatValue.title;
         break;
     case TLValue::Channel:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.title;
-        if (result.flags & 1 << 6) {
-            *this >> result.username;
+        *this >> chatValue.flags;
+        *this >> chatValue.id;
+        *this >> chatValue.accessHash;
+        *this >> chatValue.title;
+        if (chatValue.flags & 1 << 6) {
+            *this >> chatValue.username;
         }
-        *this >> result.photo;
-        *this >> result.date;
-        *this >> result.version;
-        if (result.flags & 1 << 9) {
-            *this >> result.restrictionReason;
+        *this >> chatValue.photo;
+        *this >> chatValue.date;
+        *this >> chatValue.version;
+        if (chatValue.flags & 1 << 9) {
+            *this >> chatValue.restrictionReason;
         }
         break;
     case TLValue::ChannelForbidden:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.title;
+        *this >> chatValue.id;
+        *this >> chatValue.accessHash;
+        *this >> chatValue.title;
         break;
     default:
         break;
     }
 
-    chatValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatFull &chatFullValue)
 {
-    TLChatFull result;
+    chatFullValue = TLChatFull();
 
-    *this >> result.tlType;
+    *this >> chatFullValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatFullValue.tlType) {
     case TLValue::ChatFull:
-        *this >> result.id;
-        *this >> result.participants;
-        *this >> result.chatPhoto;
-        *this >> result.notifySettings;
-        *this >> result.exportedInvite;
-        *this >> result.botInfo;
+        *this >> chatFullValue.id;
+        *this >> chatFullValue.participants;
+        *this >> chatFullValue.chatPhoto;
+        *this >> chatFullValue.notifySettings;
+        *this >> chatFullValue.exportedInvite;
+        *this >> chatFullValue.botInfo;
         break;
     case TLValue::ChannelFull:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.about;
-        if (result.flags & 1 << 0) {
-            *this >> result.participantsCount;
+        *this >> chatFullValue.flags;
+        *this >> chatFullValue.id;
+        *this >> chatFullValue.about;
+        if (chatFullValue.flags & 1 << 0) {
+            *this >> chatFullValue.participantsCount;
         }
-        if (result.flags & 1 << 1) {
-            *this >> result.adminsCount;
+        if (chatFullValue.flags & 1 << 1) {
+            *this >> chatFullValue.adminsCount;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.kickedCount;
+        if (chatFullValue.flags & 1 << 2) {
+            *this >> chatFullValue.kickedCount;
         }
-        *this >> result.readInboxMaxId;
-        *this >> result.unreadCount;
-        *this >> result.unreadImportantCount;
-        *this >> result.chatPhoto;
-        *this >> result.notifySettings;
-        *this >> result.exportedInvite;
-        *this >> result.botInfo;
-        if (result.flags & 1 << 4) {
-            *this >> result.migratedFromChatId;
+        *this >> chatFullValue.readInboxMaxId;
+        *this >> chatFullValue.unreadCount;
+        *this >> chatFullValue.unreadImportantCount;
+        *this >> chatFullValue.chatPhoto;
+        *this >> chatFullValue.notifySettings;
+        *this >> chatFullValue.exportedInvite;
+        *this >> chatFullValue.botInfo;
+        if (chatFullValue.flags & 1 << 4) {
+            *this >> chatFullValue.migratedFromChatId;
         }
-        if (result.flags & 1 << 4) {
-            *this >> result.migratedFromMaxId;
+        if (chatFullValue.flags & 1 << 4) {
+            *this >> chatFullValue.migratedFromMaxId;
         }
         break;
     default:
         break;
     }
 
-    chatFullValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatInvite &chatInviteValue)
 {
-    TLChatInvite result;
+    chatInviteValue = TLChatInvite();
 
-    *this >> result.tlType;
+    *this >> chatInviteValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatInviteValue.tlType) {
     case TLValue::ChatInviteAlready:
-        *this >> result.chat;
+        *this >> chatInviteValue.chat;
         break;
     case TLValue::ChatInvite:
-        *this >> result.flags;
-        *this >> result.title;
+        *this >> chatInviteValue.flags;
+        *this >> chatInviteValue.title;
         break;
     default:
         break;
     }
 
-    chatInviteValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLConfig &configValue)
 {
-    TLConfig result;
+    configValue = TLConfig();
 
-    *this >> result.tlType;
+    *this >> configValue.tlType;
 
-    switch (result.tlType) {
+    switch (configValue.tlType) {
     case TLValue::Config:
-        *this >> result.date;
-        *this >> result.expires;
-        *this >> result.testMode;
-        *this >> result.thisDc;
-        *this >> result.dcOptions;
-        *this >> result.chatSizeMax;
-        *this >> result.megagroupSizeMax;
-        *this >> result.forwardedCountMax;
-        *this >> result.onlineUpdatePeriodMs;
-        *this >> result.offlineBlurTimeoutMs;
-        *this >> result.offlineIdleTimeoutMs;
-        *this >> result.onlineCloudTimeoutMs;
-        *this >> result.notifyCloudDelayMs;
-        *this >> result.notifyDefaultDelayMs;
-        *this >> result.chatBigSize;
-        *this >> result.pushChatPeriodMs;
-        *this >> result.pushChatLimit;
-        *this >> result.savedGifsLimit;
-        *this >> result.disabledFeatures;
+        *this >> configValue.date;
+        *this >> configValue.expires;
+        *this >> configValue.testMode;
+        *this >> configValue.thisDc;
+        *this >> configValue.dcOptions;
+        *this >> configValue.chatSizeMax;
+        *this >> configValue.megagroupSizeMax;
+        *this >> configValue.forwardedCountMax;
+        *this >> configValue.onlineUpdatePeriodMs;
+        *this >> configValue.offlineBlurTimeoutMs;
+        *this >> configValue.offlineIdleTimeoutMs;
+        *this >> configValue.onlineCloudTimeoutMs;
+        *this >> configValue.notifyCloudDelayMs;
+        *this >> configValue.notifyDefaultDelayMs;
+        *this >> configValue.chatBigSize;
+        *this >> configValue.pushChatPeriodMs;
+        *this >> configValue.pushChatLimit;
+        *this >> configValue.savedGifsLimit;
+        *this >> configValue.disabledFeatures;
         break;
     default:
         break;
     }
 
-    configValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsBlocked &contactsBlockedValue)
 {
-    TLContactsBlocked result;
+    contactsBlockedValue = TLContactsBlocked();
 
-    *this >> result.tlType;
+    *this >> contactsBlockedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsBlockedValue.tlType) {
     case TLValue::ContactsBlocked:
-        *this >> result.blocked;
-        *this >> result.users;
+        *this >> contactsBlockedValue.blocked;
+        *this >> contactsBlockedValue.users;
         break;
     case TLValue::ContactsBlockedSlice:
-        *this >> result.count;
-        *this >> result.blocked;
-        *this >> result.users;
+        *this >> contactsBlockedValue.count;
+        *this >> contactsBlockedValue.blocked;
+        *this >> contactsBlockedValue.users;
         break;
     default:
         break;
     }
 
-    contactsBlockedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsContacts &contactsContactsValue)
 {
-    TLContactsContacts result;
+    contactsContactsValue = TLContactsContacts();
 
-    *this >> result.tlType;
+    *this >> contactsContactsValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsContactsValue.tlType) {
     case TLValue::ContactsContactsNotModified:
         break;
     case TLValue::ContactsContacts:
-        *this >> result.contacts;
-        *this >> result.users;
+        *this >> contactsContactsValue.contacts;
+        *this >> contactsContactsValue.users;
         break;
     default:
         break;
     }
 
-    contactsContactsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsFound &contactsFoundValue)
 {
-    TLContactsFound result;
+    contactsFoundValue = TLContactsFound();
 
-    *this >> result.tlType;
+    *this >> contactsFoundValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsFoundValue.tlType) {
     case TLValue::ContactsFound:
-        *this >> result.results;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> contactsFoundValue.results;
+        *this >> contactsFoundValue.chats;
+        *this >> contactsFoundValue.users;
         break;
     default:
         break;
     }
 
-    contactsFoundValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsImportedContacts &contactsImportedContactsValue)
 {
-    TLContactsImportedContacts result;
+    contactsImportedContactsValue = TLContactsImportedContacts();
 
-    *this >> result.tlType;
+    *this >> contactsImportedContactsValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsImportedContactsValue.tlType) {
     case TLValue::ContactsImportedContacts:
-        *this >> result.imported;
-        *this >> result.retryContacts;
-        *this >> result.users;
+        *this >> contactsImportedContactsValue.imported;
+        *this >> contactsImportedContactsValue.retryContacts;
+        *this >> contactsImportedContactsValue.users;
         break;
     default:
         break;
     }
 
-    contactsImportedContactsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsLink &contactsLinkValue)
 {
-    TLContactsLink result;
+    contactsLinkValue = TLContactsLink();
 
-    *this >> result.tlType;
+    *this >> contactsLinkValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsLinkValue.tlType) {
     case TLValue::ContactsLink:
-        *this >> result.myLink;
-        *this >> result.foreignLink;
-        *this >> result.user;
+        *this >> contactsLinkValue.myLink;
+        *this >> contactsLinkValue.foreignLink;
+        *this >> contactsLinkValue.user;
         break;
     default:
         break;
     }
 
-    contactsLinkValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsResolvedPeer &contactsResolvedPeerValue)
 {
-    TLContactsResolvedPeer result;
+    contactsResolvedPeerValue = TLContactsResolvedPeer();
 
-    *this >> result.tlType;
+    *this >> contactsResolvedPeerValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsResolvedPeerValue.tlType) {
     case TLValue::ContactsResolvedPeer:
-        *this >> result.peer;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> contactsResolvedPeerValue.peer;
+        *this >> contactsResolvedPeerValue.chats;
+        *this >> contactsResolvedPeerValue.users;
         break;
     default:
         break;
     }
 
-    contactsResolvedPeerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsSuggested &contactsSuggestedValue)
 {
-    TLContactsSuggested result;
+    contactsSuggestedValue = TLContactsSuggested();
 
-    *this >> result.tlType;
+    *this >> contactsSuggestedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsSuggestedValue.tlType) {
     case TLValue::ContactsSuggested:
-        *this >> result.results;
-        *this >> result.users;
+        *this >> contactsSuggestedValue.results;
+        *this >> contactsSuggestedValue.users;
         break;
     default:
         break;
     }
 
-    contactsSuggestedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDocument &documentValue)
 {
-    TLDocument result;
+    documentValue = TLDocument();
 
-    *this >> result.tlType;
+    *this >> documentValue.tlType;
 
-    switch (result.tlType) {
+    switch (documentValue.tlType) {
     case TLValue::DocumentEmpty:
-        *this >> result.id;
+        *this >> documentValue.id;
         break;
     case TLValue::Document:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.mimeType;
-        *this >> result.size;
-        *this >> result.thumb;
-        *this >> result.dcId;
-        *this >> result.attributes;
+        *this >> documentValue.id;
+        *this >> documentValue.accessHash;
+        *this >> documentValue.date;
+        *this >> documentValue.mimeType;
+        *this >> documentValue.size;
+        *this >> documentValue.thumb;
+        *this >> documentValue.dcId;
+        *this >> documentValue.attributes;
         break;
     default:
         break;
     }
 
-    documentValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLFoundGif &foundGifValue)
 {
-    TLFoundGif result;
+    foundGifValue = TLFoundGif();
 
-    *this >> result.tlType;
+    *this >> foundGifValue.tlType;
 
-    switch (result.tlType) {
+    switch (foundGifValue.tlType) {
     case TLValue::FoundGif:
-        *this >> result.url;
-        *this >> result.thumbUrl;
-        *this >> result.contentUrl;
-        *this >> result.contentType;
-        *this >> result.w;
-        *this >> result.h;
+        *this >> foundGifValue.url;
+        *this >> foundGifValue.thumbUrl;
+        *this >> foundGifValue.contentUrl;
+        *this >> foundGifValue.contentType;
+        *this >> foundGifValue.w;
+        *this >> foundGifValue.h;
         break;
     case TLValue::FoundGifCached:
-        *this >> result.url;
-        *this >> result.photo;
-        *this >> result.document;
+        *this >> foundGifValue.url;
+        *this >> foundGifValue.photo;
+        *this >> foundGifValue.document;
         break;
     default:
         break;
     }
 
-    foundGifValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpSupport &helpSupportValue)
 {
-    TLHelpSupport result;
+    helpSupportValue = TLHelpSupport();
 
-    *this >> result.tlType;
+    *this >> helpSupportValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpSupportValue.tlType) {
     case TLValue::HelpSupport:
-        *this >> result.phoneNumber;
-        *this >> result.user;
+        *this >> helpSupportValue.phoneNumber;
+        *this >> helpSupportValue.user;
         break;
     default:
         break;
     }
 
-    helpSupportValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessageAction &messageActionValue)
 {
-    TLMessageAction result;
+    messageActionValue = TLMessageAction();
 
-    *this >> result.tlType;
+    *this >> messageActionValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageActionValue.tlType) {
     case TLValue::MessageActionEmpty:
     case TLValue::MessageActionChatDeletePhoto:
         break;
     case TLValue::MessageActionChatCreate:
-        *this >> result.title;
-        *this >> result.users;
+        *this >> messageActionValue.title;
+        *this >> messageActionValue.users;
         break;
     case TLValue::MessageActionChatEditTitle:
     case TLValue::MessageActionChannelCreate:
-        *this >> result.title;
+        *this >> messageActionValue.title;
         break;
     case TLValue::MessageActionChatEditPhoto:
-        *this >> result.photo;
+        *this >> messageActionValue.photo;
         break;
     case TLValue::MessageActionChatAddUser:
-        *this >> result.users;
+        *this >> messageActionValue.users;
         break;
     case TLValue::MessageActionChatDeleteUser:
-        *this >> result.userId;
+        *this >> messageActionValue.userId;
         break;
     case TLValue::MessageActionChatJoinedByLink:
-        *this >> result.inviterId;
+        *this >> messageActionValue.inviterId;
         break;
     case TLValue::MessageActionChatMigrateTo:
-        *this >> result.channelId;
+        *this >> messageActionValue.channelId;
         break;
     case TLValue::MessageActionChannelMigrateFrom:
-        *this >> result.title;
-        *this >> result.chatId;
+        *this >> messageActionValue.title;
+        *this >> messageActionValue.chatId;
         break;
     default:
         break;
     }
 
-    messageActionValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesAllStickers &messagesAllStickersValue)
 {
-    TLMessagesAllStickers result;
+    messagesAllStickersValue = TLMessagesAllStickers();
 
-    *this >> result.tlType;
+    *this >> messagesAllStickersValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesAllStickersValue.tlType) {
     case TLValue::MessagesAllStickersNotModified:
         break;
     case TLValue::MessagesAllStickers:
-        *this >> result.hash;
-        *this >> result.sets;
+        *this >> messagesAllStickersValue.hash;
+        *this >> messagesAllStickersValue.sets;
         break;
     default:
         break;
     }
 
-    messagesAllStickersValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesChatFull &messagesChatFullValue)
 {
-    TLMessagesChatFull result;
+    messagesChatFullValue = TLMessagesChatFull();
 
-    *this >> result.tlType;
+    *this >> messagesChatFullValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesChatFullValue.tlType) {
     case TLValue::MessagesChatFull:
-        *this >> result.fullChat;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesChatFullValue.fullChat;
+        *this >> messagesChatFullValue.chats;
+        *this >> messagesChatFullValue.users;
         break;
     default:
         break;
     }
 
-    messagesChatFullValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesChats &messagesChatsValue)
 {
-    TLMessagesChats result;
+    messagesChatsValue = TLMessagesChats();
 
-    *this >> result.tlType;
+    *this >> messagesChatsValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesChatsValue.tlType) {
     case TLValue::MessagesChats:
-        *this >> result.chats;
+        *this >> messagesChatsValue.chats;
         break;
     default:
         break;
     }
 
-    messagesChatsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesFoundGifs &messagesFoundGifsValue)
 {
-    TLMessagesFoundGifs result;
+    messagesFoundGifsValue = TLMessagesFoundGifs();
 
-    *this >> result.tlType;
+    *this >> messagesFoundGifsValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesFoundGifsValue.tlType) {
     case TLValue::MessagesFoundGifs:
-        *this >> result.nextOffset;
-        *this >> result.results;
+        *this >> messagesFoundGifsValue.nextOffset;
+        *this >> messagesFoundGifsValue.results;
         break;
     default:
         break;
     }
 
-    messagesFoundGifsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesSavedGifs &messagesSavedGifsValue)
 {
-    TLMessagesSavedGifs result;
+    messagesSavedGifsValue = TLMessagesSavedGifs();
 
-    *this >> result.tlType;
+    *this >> messagesSavedGifsValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesSavedGifsValue.tlType) {
     case TLValue::MessagesSavedGifsNotModified:
         break;
     case TLValue::MessagesSavedGifs:
-        *this >> result.hash;
-        *this >> result.gifs;
+        *this >> messagesSavedGifsValue.hash;
+        *this >> messagesSavedGifsValue.gifs;
         break;
     default:
         break;
     }
 
-    messagesSavedGifsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesStickerSet &messagesStickerSetValue)
 {
-    TLMessagesStickerSet result;
+    messagesStickerSetValue = TLMessagesStickerSet();
 
-    *this >> result.tlType;
+    *this >> messagesStickerSetValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesStickerSetValue.tlType) {
     case TLValue::MessagesStickerSet:
-        *this >> result.set;
-        *this >> result.packs;
-        *this >> result.documents;
+        *this >> messagesStickerSetValue.set;
+        *this >> messagesStickerSetValue.packs;
+        *this >> messagesStickerSetValue.documents;
         break;
     default:
         break;
     }
 
-    messagesStickerSetValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesStickers &messagesStickersValue)
 {
-    TLMessagesStickers result;
+    messagesStickersValue = TLMessagesStickers();
 
-    *this >> result.tlType;
+    *this >> messagesStickersValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesStickersValue.tlType) {
     case TLValue::MessagesStickersNotModified:
         break;
     case TLValue::MessagesStickers:
-        *this >> result.hash;
-        *this >> result.stickers;
+        *this >> messagesStickersValue.hash;
+        *this >> messagesStickersValue.stickers;
         break;
     default:
         break;
     }
 
-    messagesStickersValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhotosPhoto &photosPhotoValue)
 {
-    TLPhotosPhoto result;
+    photosPhotoValue = TLPhotosPhoto();
 
-    *this >> result.tlType;
+    *this >> photosPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (photosPhotoValue.tlType) {
     case TLValue::PhotosPhoto:
-        *this >> result.photo;
-        *this >> result.users;
+        *this >> photosPhotoValue.photo;
+        *this >> photosPhotoValue.users;
         break;
     default:
         break;
     }
 
-    photosPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhotosPhotos &photosPhotosValue)
 {
-    TLPhotosPhotos result;
+    photosPhotosValue = TLPhotosPhotos();
 
-    *this >> result.tlType;
+    *this >> photosPhotosValue.tlType;
 
-    switch (result.tlType) {
+    switch (photosPhotosValue.tlType) {
     case TLValue::PhotosPhotos:
-        *this >> result.photos;
-        *this >> result.users;
+        *this >> photosPhotosValue.photos;
+        *this >> photosPhotosValue.users;
         break;
     case TLValue::PhotosPhotosSlice:
-        *this >> result.count;
-        *this >> result.photos;
-        *this >> result.users;
+        *this >> photosPhotosValue.count;
+        *this >> photosPhotosValue.photos;
+        *this >> photosPhotosValue.users;
         break;
     default:
         break;
     }
 
-    photosPhotosValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUserFull &userFullValue)
 {
-    TLUserFull result;
+    userFullValue = TLUserFull();
 
-    *this >> result.tlType;
+    *this >> userFullValue.tlType;
 
-    switch (result.tlType) {
+    switch (userFullValue.tlType) {
     case TLValue::UserFull:
-        *this >> result.user;
-        *this >> result.link;
-        *this >> result.profilePhoto;
-        *this >> result.notifySettings;
-        *this >> result.blocked;
-        *this >> result.botInfo;
+        *this >> userFullValue.user;
+        *this >> userFullValue.link;
+        *this >> userFullValue.profilePhoto;
+        *this >> userFullValue.notifySettings;
+        *this >> userFullValue.blocked;
+        *this >> userFullValue.botInfo;
         break;
     default:
         break;
     }
 
-    userFullValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLWebPage &webPageValue)
 {
-    TLWebPage result;
+    webPageValue = TLWebPage();
 
-    *this >> result.tlType;
+    *this >> webPageValue.tlType;
 
-    switch (result.tlType) {
+    switch (webPageValue.tlType) {
     case TLValue::WebPageEmpty:
-        *this >> result.id;
+        *this >> webPageValue.id;
         break;
     case TLValue::WebPagePending:
-        *this >> result.id;
-        *this >> result.date;
+        *this >> webPageValue.id;
+        *this >> webPageValue.date;
         break;
     case TLValue::WebPage:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.url;
-        *this >> result.displayUrl;
-        if (result.flags & 1 << 0) {
-            *this >> result.type;
+        *this >> webPageValue.flags;
+        *this >> webPageValue.id;
+        *this >> webPageValue.url;
+        *this >> webPageValue.displayUrl;
+        if (webPageValue.flags & 1 << 0) {
+            *this >> webPageValue.type;
         }
-        if (result.flags & 1 << 1) {
-            *this >> result.siteName;
+        if (webPageValue.flags & 1 << 1) {
+            *this >> webPageValue.siteName;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.title;
+        if (webPageValue.flags & 1 << 2) {
+            *this >> webPageValue.title;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.description;
+        if (webPageValue.flags & 1 << 3) {
+            *this >> webPageValue.description;
         }
-        if (result.flags & 1 << 4) {
-            *this >> result.photo;
+        if (webPageValue.flags & 1 << 4) {
+            *this >> webPageValue.photo;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.embedUrl;
+        if (webPageValue.flags & 1 << 5) {
+            *this >> webPageValue.embedUrl;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.embedType;
+        if (webPageValue.flags & 1 << 5) {
+            *this >> webPageValue.embedType;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.embedWidth;
+        if (webPageValue.flags & 1 << 6) {
+            *this >> webPageValue.embedWidth;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.embedHeight;
+        if (webPageValue.flags & 1 << 6) {
+            *this >> webPageValue.embedHeight;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.duration;
+        if (webPageValue.flags & 1 << 7) {
+            *this >> webPageValue.duration;
         }
-        if (result.flags & 1 << 8) {
-            *this >> result.author;
+        if (webPageValue.flags & 1 << 8) {
+            *this >> webPageValue.author;
         }
-        if (result.flags & 1 << 9) {
-            *this >> result.document;
+        if (webPageValue.flags & 1 << 9) {
+            *this >> webPageValue.document;
         }
         break;
     default:
         break;
     }
 
-    webPageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLBotInlineResult &botInlineResultValue)
 {
-    TLBotInlineResult result;
+    botInlineResultValue = TLBotInlineResult();
 
-    *this >> result.tlType;
+    *this >> botInlineResultValue.tlType;
 
-    switch (result.tlType) {
+    switch (botInlineResultValue.tlType) {
     case TLValue::BotInlineMediaResultDocument:
-        *this >> result.id;
-        *this >> result.type;
-        *this >> result.document;
-        *this >> result.sendMessage;
+        *this >> botInlineResultValue.id;
+        *this >> botInlineResultValue.type;
+        *this >> botInlineResultValue.document;
+        *this >> botInlineResultValue.sendMessage;
         break;
     case TLValue::BotInlineMediaResultPhoto:
-        *this >> result.id;
-        *this >> result.type;
-        *this >> result.photo;
-        *this >> result.sendMessage;
+        *this >> botInlineResultValue.id;
+        *this >> botInlineResultValue.type;
+        *this >> botInlineResultValue.photo;
+        *this >> botInlineResultValue.sendMessage;
         break;
     case TLValue::BotInlineResult:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.type;
-        if (result.flags & 1 << 1) {
-            *this >> result.title;
+        *this >> botInlineResultValue.flags;
+        *this >> botInlineResultValue.id;
+        *this >> botInlineResultValue.type;
+        if (botInlineResultValue.flags & 1 << 1) {
+            *this >> botInlineResultValue.title;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.description;
+        if (botInlineResultValue.flags & 1 << 2) {
+            *this >> botInlineResultValue.description;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.url;
+        if (botInlineResultValue.flags & 1 << 3) {
+            *this >> botInlineResultValue.url;
         }
-        if (result.flags & 1 << 4) {
-            *this >> result.thumbUrl;
+        if (botInlineResultValue.flags & 1 << 4) {
+            *this >> botInlineResultValue.thumbUrl;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.contentUrl;
+        if (botInlineResultValue.flags & 1 << 5) {
+            *this >> botInlineResultValue.contentUrl;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.contentType;
+        if (botInlineResultValue.flags & 1 << 5) {
+            *this >> botInlineResultValue.contentType;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.w;
+        if (botInlineResultValue.flags & 1 << 6) {
+            *this >> botInlineResultValue.w;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.h;
+        if (botInlineResultValue.flags & 1 << 6) {
+            *this >> botInlineResultValue.h;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.duration;
+        if (botInlineResultValue.flags & 1 << 7) {
+            *this >> botInlineResultValue.duration;
         }
-        *this >> result.sendMessage;
+        *this >> botInlineResultValue.sendMessage;
         break;
     default:
         break;
     }
 
-    botInlineResultValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue)
 {
-    TLMessageMedia result;
+    messageMediaValue = TLMessageMedia();
 
-    *this >> result.tlType;
+    *this >> messageMediaValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageMediaValue.tlType) {
     case TLValue::MessageMediaEmpty:
     case TLValue::MessageMediaUnsupported:
         break;
     case TLValue::MessageMediaPhoto:
-        *this >> result.photo;
-        *this >> result.caption;
+        *this >> messageMediaValue.photo;
+        *this >> messageMediaValue.caption;
         break;
     case TLValue::MessageMediaVideo:
-        *this >> result.video;
-        *this >> result.caption;
+        *this >> messageMediaValue.video;
+        *this >> messageMediaValue.caption;
         break;
     case TLValue::MessageMediaGeo:
-        *this >> result.geo;
+        *this >> messageMediaValue.geo;
         break;
     case TLValue::MessageMediaContact:
-        *this >> result.phoneNumber;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.userId;
+        *this >> messageMediaValue.phoneNumber;
+        *this >> messageMediaValue.firstName;
+        *this >> messageMediaValue.lastName;
+        *this >> messageMediaValue.userId;
         break;
     case TLValue::MessageMediaDocument:
-        *this >> result.document;
-        *this >> result.caption;
+        *this >> messageMediaValue.document;
+        *this >> messageMediaValue.caption;
         break;
     case TLValue::MessageMediaAudio:
-        *this >> result.audio;
+        *this >> messageMediaValue.audio;
         break;
     case TLValue::MessageMediaWebPage:
-        *this >> result.webpage;
+        *this >> messageMediaValue.webpage;
         break;
     case TLValue::MessageMediaVenue:
-        *this >> result.geo;
-        *this >> result.title;
-        *this >> result.address;
-        *this >> result.provider;
-        *this >> result.venueId;
+        *this >> messageMediaValue.geo;
+        *this >> messageMediaValue.title;
+        *this >> messageMediaValue.address;
+        *this >> messageMediaValue.provider;
+        *this >> messageMediaValue.venueId;
         break;
     default:
         break;
     }
 
-    messageMediaValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesBotResults &messagesBotResultsValue)
 {
-    TLMessagesBotResults result;
+    messagesBotResultsValue = TLMessagesBotResults();
 
-    *this >> result.tlType;
+    *this >> messagesBotResultsValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesBotResultsValue.tlType) {
     case TLValue::MessagesBotResults:
-        *this >> result.flags;
-        *this >> result.queryId;
-        if (result.flags & 1 << 1) {
-            *this >> result.nextOffset;
+        *this >> messagesBotResultsValue.flags;
+        *this >> messagesBotResultsValue.queryId;
+        if (messagesBotResultsValue.flags & 1 << 1) {
+            *this >> messagesBotResultsValue.nextOffset;
         }
-        *this >> result.results;
+        *this >> messagesBotResultsValue.results;
         break;
     default:
         break;
     }
 
-    messagesBotResultsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessage &messageValue)
 {
-    TLMessage result;
+    messageValue = TLMessage();
 
-    *this >> result.tlType;
+    *this >> messageValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageValue.tlType) {
     case TLValue::MessageEmpty:
-        *this >> result.id;
+        *this >> messageValue.id;
         break;
     case TLValue::Message:
-        *this >> result.flags;
-        *this >> result.id;
-        if (result.flags & 1 << 8) {
-            *this >> result.fromId;
+        *this >> messageValue.flags;
+        *this >> messageValue.id;
+        if (messageValue.flags & 1 << 8) {
+            *this >> messageValue.fromId;
         }
-        *this >> result.toId;
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdFromId;
+        *this >> messageValue.toId;
+        if (messageValue.flags & 1 << 2) {
+            *this >> messageValue.fwdFromId;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdDate;
+        if (messageValue.flags & 1 << 2) {
+            *this >> messageValue.fwdDate;
         }
-        if (result.flags & 1 << 11) {
-            *this >> result.viaBotId;
+        if (messageValue.flags & 1 << 11) {
+            *this >> messageValue.viaBotId;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.replyToMsgId;
+        if (messageValue.flags & 1 << 3) {
+            *this >> messageValue.replyToMsgId;
         }
-        *this >> result.date;
-        *this >> result.message;
-        if (result.flags & 1 << 9) {
-            *this >> result.media;
+        *this >> messageValue.date;
+        *this >> messageValue.message;
+        if (messageValue.flags & 1 << 9) {
+            *this >> messageValue.media;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.replyMarkup;
+        if (messageValue.flags & 1 << 6) {
+            *this >> messageValue.replyMarkup;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.entities;
+        if (messageValue.flags & 1 << 7) {
+            *this >> messageValue.entities;
         }
-        if (result.flags & 1 << 10) {
-            *this >> result.views;
+        if (messageValue.flags & 1 << 10) {
+            *this >> messageValue.views;
         }
         break;
     case TLValue::MessageService:
-        *this >> result.flags;
-        *this >> result.id;
-        if (result.flags & 1 << 8) {
-            *this >> result.fromId;
+        *this >> messageValue.flags;
+        *this >> messageValue.id;
+        if (messageValue.flags & 1 << 8) {
+            *this >> messageValue.fromId;
         }
-        *this >> result.toId;
-        *this >> result.date;
-        *this >> result.action;
+        *this >> messageValue.toId;
+        *this >> messageValue.date;
+        *this >> messageValue.action;
         break;
     default:
         break;
     }
 
-    messageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesDialogs &messagesDialogsValue)
 {
-    TLMessagesDialogs result;
+    messagesDialogsValue = TLMessagesDialogs();
 
-    *this >> result.tlType;
+    *this >> messagesDialogsValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesDialogsValue.tlType) {
     case TLValue::MessagesDialogs:
-        *this >> result.dialogs;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesDialogsValue.dialogs;
+        *this >> messagesDialogsValue.messages;
+        *this >> messagesDialogsValue.chats;
+        *this >> messagesDialogsValue.users;
         break;
     case TLValue::MessagesDialogsSlice:
-        *this >> result.count;
-        *this >> result.dialogs;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesDialogsValue.count;
+        *this >> messagesDialogsValue.dialogs;
+        *this >> messagesDialogsValue.messages;
+        *this >> messagesDialogsValue.chats;
+        *this >> messagesDialogsValue.users;
         break;
     default:
         break;
     }
 
-    messagesDialogsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesMessages &messagesMessagesValue)
 {
-    TLMessagesMessages result;
+    messagesMessagesValue = TLMessagesMessages();
 
-    *this >> result.tlType;
+    *this >> messagesMessagesValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesMessagesValue.tlType) {
     case TLValue::MessagesMessages:
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesMessagesValue.messages;
+        *this >> messagesMessagesValue.chats;
+        *this >> messagesMessagesValue.users;
         break;
     case TLValue::MessagesMessagesSlice:
-        *this >> result.count;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesMessagesValue.count;
+        *this >> messagesMessagesValue.messages;
+        *this >> messagesMessagesValue.chats;
+        *this >> messagesMessagesValue.users;
         break;
     case TLValue::MessagesChannelMessages:
-        *this >> result.flags;
-        *this >> result.pts;
-        *this >> result.count;
-        *this >> result.messages;
-        if (result.flags & 1 << 0) {
-            *this >> result.collapsed;
+        *this >> messagesMessagesValue.flags;
+        *this >> messagesMessagesValue.pts;
+        *this >> messagesMessagesValue.count;
+        *this >> messagesMessagesValue.messages;
+        if (messagesMessagesValue.flags & 1 << 0) {
+            *this >> messagesMessagesValue.collapsed;
         }
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesMessagesValue.chats;
+        *this >> messagesMessagesValue.users;
         break;
     default:
         break;
     }
 
-    messagesMessagesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
 {
-    TLUpdate result;
+    updateValue = TLUpdate();
 
-    *this >> result.tlType;
+    *this >> updateValue.tlType;
 
-    switch (result.tlType) {
+    switch (updateValue.tlType) {
     case TLValue::UpdateNewMessage:
     case TLValue::UpdateNewChannelMessage:
-        *this >> result.message;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.message;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateMessageID:
-        *this >> result.id;
-        *this >> result.randomId;
+        *this >> updateValue.id;
+        *this >> updateValue.randomId;
         break;
     case TLValue::UpdateDeleteMessages:
     case TLValue::UpdateReadMessagesContents:
-        *this >> result.messages;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.messages;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateUserTyping:
-        *this >> result.userId;
-        *this >> result.action;
+        *this >> updateValue.userId;
+        *this >> updateValue.action;
         break;
     case TLValue::UpdateChatUserTyping:
-        *this >> result.chatId;
-        *this >> result.userId;
-        *this >> result.action;
+        *this >> updateValue.chatId;
+        *this >> updateValue.userId;
+        *this >> updateValue.action;
         break;
     case TLValue::UpdateChatParticipants:
-        *this >> result.participants;
+        *this >> updateValue.participants;
         break;
     case TLValue::UpdateUserStatus:
-        *this >> result.userId;
-        *this >> result.status;
+        *this >> updateValue.userId;
+        *this >> updateValue.status;
         break;
     case TLValue::UpdateUserName:
-        *this >> result.userId;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.username;
+        *this >> updateValue.userId;
+        *this >> updateValue.firstName;
+        *this >> updateValue.lastName;
+        *this >> updateValue.username;
         break;
     case TLValue::UpdateUserPhoto:
-        *this >> result.userId;
-        *this >> result.date;
-        *this >> result.photo;
-        *this >> result.previous;
+        *this >> updateValue.userId;
+        *this >> updateValue.date;
+        *this >> updateValue.photo;
+        *this >> updateValue.previous;
         break;
     case TLValue::UpdateContactRegistered:
-        *this >> result.userId;
-        *this >> result.date;
+        *this >> updateValue.userId;
+        *this >> updateValue.date;
         break;
     case TLValue::UpdateContactLink:
-        *this >> result.userId;
-        *this >> result.myLink;
-        *this >> result.foreignLink;
+        *this >> updateValue.userId;
+        *this >> updateValue.myLink;
+        *this >> updateValue.foreignLink;
         break;
     case TLValue::UpdateNewAuthorization:
-        *this >> result.authKeyId;
-        *this >> result.date;
-        *this >> result.device;
-        *this >> result.location;
+        *this >> updateValue.authKeyId;
+        *this >> updateValue.date;
+        *this >> updateValue.device;
+        *this >> updateValue.location;
         break;
     case TLValue::UpdateNewEncryptedMessage:
-        *this >> result.encryptedMessage;
-        *this >> result.qts;
+        *this >> updateValue.encryptedMessage;
+        *this >> updateValue.qts;
         break;
     case TLValue::UpdateEncryptedChatTyping:
-        *this >> result.chatId;
+        *this >> updateValue.chatId;
         break;
     case TLValue::UpdateEncryption:
-        *this >> result.chat;
-        *this >> result.date;
+        *this >> updateValue.chat;
+        *this >> updateValue.date;
         break;
     case TLValue::UpdateEncryptedMessagesRead:
-        *this >> result.chatId;
-        *this >> result.maxDate;
-        *this >> result.date;
+        *this >> updateValue.chatId;
+        *this >> updateValue.maxDate;
+        *this >> updateValue.date;
         break;
     case TLValue::UpdateChatParticipantAdd:
-        *this >> result.chatId;
-        *this >> result.userId;
-        *this >> result.inviterId;
-        *this >> result.date;
-        *this >> result.version;
+        *this >> updateValue.chatId;
+        *this >> updateValue.userId;
+        *this >> updateValue.inviterId;
+        *this >> updateValue.date;
+        *this >> updateValue.version;
         break;
     case TLValue::UpdateChatParticipantDelete:
-        *this >> result.chatId;
-        *this >> result.userId;
-        *this >> result.version;
+        *this >> updateValue.chatId;
+        *this >> updateValue.userId;
+        *this >> updateValue.version;
         break;
     case TLValue::UpdateDcOptions:
-        *this >> result.dcOptions;
+        *this >> updateValue.dcOptions;
         break;
     case TLValue::UpdateUserBlocked:
-        *this >> result.userId;
-        *this >> result.blocked;
+        *this >> updateValue.userId;
+        *this >> updateValue.blocked;
         break;
     case TLValue::UpdateNotifySettings:
-        *this >> result.notifyPeer;
-        *this >> result.notifySettings;
+        *this >> updateValue.notifyPeer;
+        *this >> updateValue.notifySettings;
         break;
     case TLValue::UpdateServiceNotification:
-        *this >> result.type;
-        *this >> result.stringMessage;
-        *this >> result.media;
-        *this >> result.popup;
+        *this >> updateValue.type;
+        *this >> updateValue.stringMessage;
+        *this >> updateValue.media;
+        *this >> updateValue.popup;
         break;
     case TLValue::UpdatePrivacy:
-        *this >> result.key;
-        *this >> result.rules;
+        *this >> updateValue.key;
+        *this >> updateValue.rules;
         break;
     case TLValue::UpdateUserPhone:
-        *this >> result.userId;
-        *this >> result.phone;
+        *this >> updateValue.userId;
+        *this >> updateValue.phone;
         break;
     case TLValue::UpdateReadHistoryInbox:
     case TLValue::UpdateReadHistoryOutbox:
-        *this >> result.peer;
-        *this >> result.maxId;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.peer;
+        *this >> updateValue.maxId;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateWebPage:
-        *this >> result.webpage;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.webpage;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateChannelTooLong:
     case TLValue::UpdateChannel:
-        *this >> result.channelId;
+        *this >> updateValue.channelId;
         break;
     case TLValue::UpdateChannelGroup:
-        *this >> result.channelId;
-        *this >> result.group;
+        *this >> updateValue.channelId;
+        *this >> updateValue.group;
         break;
     case TLValue::UpdateReadChannelInbox:
-        *this >> result.channelId;
-        *this >> result.maxId;
+        *this >> updateValue.channelId;
+        *this >> updateValue.maxId;
         break;
     case TLValue::UpdateDeleteChannelMessages:
-        *this >> result.channelId;
-        *this >> result.messages;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.channelId;
+        *this >> updateValue.messages;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateChannelMessageViews:
-        *this >> result.channelId;
-        *this >> result.id;
-        *this >> result.views;
+        *this >> updateValue.channelId;
+        *this >> updateValue.id;
+        *this >> updateValue.views;
         break;
     case TLValue::UpdateChatAdmins:
-        *this >> result.chatId;
-        *this >> result.enabled;
-        *this >> result.version;
+        *this >> updateValue.chatId;
+        *this >> updateValue.enabled;
+        *this >> updateValue.version;
         break;
     case TLValue::UpdateChatParticipantAdmin:
-        *this >> result.chatId;
-        *this >> result.userId;
-        *this >> result.isAdmin;
-        *this >> result.version;
+        *this >> updateValue.chatId;
+        *this >> updateValue.userId;
+        *this >> updateValue.isAdmin;
+        *this >> updateValue.version;
         break;
     case TLValue::UpdateNewStickerSet:
-        *this >> result.stickerset;
+        *this >> updateValue.stickerset;
         break;
     case TLValue::UpdateStickerSetsOrder:
-        *this >> result.order;
+        *this >> updateValue.order;
         break;
     case TLValue::UpdateStickerSets:
     case TLValue::UpdateSavedGifs:
         break;
     case TLValue::UpdateBotInlineQuery:
-        *this >> result.queryId;
-        *this >> result.userId;
-        *this >> result.query;
-        *this >> result.offset;
+        *this >> updateValue.queryId;
+        *this >> updateValue.userId;
+        *this >> updateValue.query;
+        *this >> updateValue.offset;
         break;
     default:
         break;
     }
 
-    updateValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdates &updatesValue)
 {
-    TLUpdates result;
+    updatesValue = TLUpdates();
 
-    *this >> result.tlType;
+    *this >> updatesValue.tlType;
 
-    switch (result.tlType) {
+    switch (updatesValue.tlType) {
     case TLValue::UpdatesTooLong:
         break;
     case TLValue::UpdateShortMessage:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.userId;
-        *this >> result.message;
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.date;
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdFromId;
+        *this >> updatesValue.flags;
+        *this >> updatesValue.id;
+        *this >> updatesValue.userId;
+        *this >> updatesValue.message;
+        *this >> updatesValue.pts;
+        *this >> updatesValue.ptsCount;
+        *this >> updatesValue.date;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdFromId;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdDate;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdDate;
         }
-        if (result.flags & 1 << 11) {
-            *this >> result.viaBotId;
+        if (updatesValue.flags & 1 << 11) {
+            *this >> updatesValue.viaBotId;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.replyToMsgId;
+        if (updatesValue.flags & 1 << 3) {
+            *this >> updatesValue.replyToMsgId;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.entities;
+        if (updatesValue.flags & 1 << 7) {
+            *this >> updatesValue.entities;
         }
         break;
     case TLValue::UpdateShortChatMessage:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.fromId;
-        *this >> result.chatId;
-        *this >> result.message;
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.date;
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdFromId;
+        *this >> updatesValue.flags;
+        *this >> updatesValue.id;
+        *this >> updatesValue.fromId;
+        *this >> updatesValue.chatId;
+        *this >> updatesValue.message;
+        *this >> updatesValue.pts;
+        *this >> updatesValue.ptsCount;
+        *this >> updatesValue.date;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdFromId;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdDate;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdDate;
         }
-        if (result.flags & 1 << 11) {
-            *this >> result.viaBotId;
+        if (updatesValue.flags & 1 << 11) {
+            *this >> updatesValue.viaBotId;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.replyToMsgId;
+        if (updatesValue.flags & 1 << 3) {
+            *this >> updatesValue.replyToMsgId;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.entities;
+        if (updatesValue.flags & 1 << 7) {
+            *this >> updatesValue.entities;
         }
         break;
     case TLValue::UpdateShort:
-        *this >> result.update;
-        *this >> result.date;
+        *this >> updatesValue.update;
+        *this >> updatesValue.date;
         break;
     case TLValue::UpdatesCombined:
-        *this >> result.updates;
-        *this >> result.users;
-        *this >> result.chats;
-        *this >> result.date;
-        *this >> result.seqStart;
-        *this >> result.seq;
+        *this >> updatesValue.updates;
+        *this >> updatesValue.users;
+        *this >> updatesValue.chats;
+        *this >> updatesValue.date;
+        *this >> updatesValue.seqStart;
+        *this >> updatesValue.seq;
         break;
     case TLValue::Updates:
-        *this >> result.updates;
-        *this >> result.users;
-        *this >> result.chats;
-        *this >> result.date;
-        *this >> result.seq;
+        *this >> updatesValue.updates;
+        *this >> updatesValue.users;
+        *this >> updatesValue.chats;
+        *this >> updatesValue.date;
+        *this >> updatesValue.seq;
         break;
     case TLValue::UpdateShortSentMessage:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.date;
-        if (result.flags & 1 << 9) {
-            *this >> result.media;
+        *this >> updatesValue.flags;
+        *this >> updatesValue.id;
+        *this >> updatesValue.pts;
+        *this >> updatesValue.ptsCount;
+        *this >> updatesValue.date;
+        if (updatesValue.flags & 1 << 9) {
+            *this >> updatesValue.media;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.entities;
+        if (updatesValue.flags & 1 << 7) {
+            *this >> updatesValue.entities;
         }
         break;
     default:
         break;
     }
 
-    updatesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdatesChannelDifference &updatesChannelDifferenceValue)
 {
-    TLUpdatesChannelDifference result;
+    updatesChannelDifferenceValue = TLUpdatesChannelDifference();
 
-    *this >> result.tlType;
+    *this >> updatesChannelDifferenceValue.tlType;
 
-    switch (result.tlType) {
+    switch (updatesChannelDifferenceValue.tlType) {
     case TLValue::UpdatesChannelDifferenceEmpty:
-        *this >> result.flags;
-        *this >> result.pts;
-        if (result.flags & 1 << 1) {
-            *this >> result.timeout;
+        *this >> updatesChannelDifferenceValue.flags;
+        *this >> updatesChannelDifferenceValue.pts;
+        if (updatesChannelDifferenceValue.flags & 1 << 1) {
+            *this >> updatesChannelDifferenceValue.timeout;
         }
         break;
     case TLValue::UpdatesChannelDifferenceTooLong:
-        *this >> result.flags;
-        *this >> result.pts;
-        if (result.flags & 1 << 1) {
-            *this >> result.timeout;
-        }
-        *this >> result.topMessage;
-        *this >> result.topImportantMessage;
-        *this >> result.readInboxMaxId;
-        *this >> result.unreadCount;
-        *this >> result.unreadImportantCount;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> updatesChannelDifferenceValue.flags;
+        *this >> updatesChannelDifferenceValue.pts;
+        if (updatesChannelDifferenceValue.flags & 1 << 1) {
+            *this >> updatesChannelDifferenceValue.timeout;
+        }
+        *this >> updatesChannelDifferenceValue.topMessage;
+        *this >> updatesChannelDifferenceValue.topImportantMessage;
+        *this >> updatesChannelDifferenceValue.readInboxMaxId;
+        *this >> updatesChannelDifferenceValue.unreadCount;
+        *this >> updatesChannelDifferenceValue.unreadImportantCount;
+        *this >> updatesChannelDifferenceValue.messages;
+        *this >> updatesChannelDifferenceValue.chats;
+        *this >> updatesChannelDifferenceValue.users;
         break;
     case TLValue::UpdatesChannelDifference:
-        *this >> result.flags;
-        *this >> result.pts;
-        if (result.flags & 1 << 1) {
-            *this >> result.timeout;
+        *this >> updatesChannelDifferenceValue.flags;
+        *this >> updatesChannelDifferenceValue.pts;
+        if (updatesChannelDifferenceValue.flags & 1 << 1) {
+            *this >> updatesChannelDifferenceValue.timeout;
         }
-        *this >> result.newMessages;
-        *this >> result.otherUpdates;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> updatesChannelDifferenceValue.newMessages;
+        *this >> updatesChannelDifferenceValue.otherUpdates;
+        *this >> updatesChannelDifferenceValue.chats;
+        *this >> updatesChannelDifferenceValue.users;
         break;
     default:
         break;
     }
 
-    updatesChannelDifferenceValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdatesDifference &updatesDifferenceValue)
 {
-    TLUpdatesDifference result;
+    updatesDifferenceValue = TLUpdatesDifference();
 
-    *this >> result.tlType;
+    *this >> updatesDifferenceValue.tlType;
 
-    switch (result.tlType) {
+    switch (updatesDifferenceValue.tlType) {
     case TLValue::UpdatesDifferenceEmpty:
-        *this >> result.date;
-        *this >> result.seq;
+        *this >> updatesDifferenceValue.date;
+        *this >> updatesDifferenceValue.seq;
         break;
     case TLValue::UpdatesDifference:
-        *this >> result.newMessages;
-        *this >> result.newEncryptedMessages;
-        *this >> result.otherUpdates;
-        *this >> result.chats;
-        *this >> result.users;
-        *this >> result.state;
+        *this >> updatesDifferenceValue.newMessages;
+        *this >> updatesDifferenceValue.newEncryptedMessages;
+        *this >> updatesDifferenceValue.otherUpdates;
+        *this >> updatesDifferenceValue.chats;
+        *this >> updatesDifferenceValue.users;
+        *this >> updatesDifferenceValue.state;
         break;
     case TLValue::UpdatesDifferenceSlice:
-        *this >> result.newMessages;
-        *this >> result.newEncryptedMessages;
-        *this >> result.otherUpdates;
-        *this >> result.chats;
-        *this >> result.users;
-        *this >> result.intermediateState;
+        *this >> updatesDifferenceValue.newMessages;
+        *this >> updatesDifferenceValue.newEncryptedMessages;
+        *this >> updatesDifferenceValue.otherUpdates;
+        *this >> updatesDifferenceValue.chats;
+        *this >> updatesDifferenceValue.users;
+        *this >> updatesDifferenceValue.intermediateState;
         break;
     default:
         break;
     }
 
-    updatesDifferenceValue = result;
-
     return *this;
 }
 
 // End of generated read operators implementation
 
+// Generated skip implementation
+template <>
+void CTelegramStream::skip<TLAccountDaysTTL>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AccountDaysTTL:
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAccountPassword>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AccountNoPassword:
+        skip<QByteArray>();
+        skip<QString>();
+        break;
+    case TLValue::AccountPassword:
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skip<QString>();
+        skip<bool>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAccountPasswordInputSettings>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::AccountPasswordInputSettings:
+        *this >> flags;
+        if (flags & 1 << 0) {
+            skip<QByteArray>();
+        }
+        if (flags & 1 << 0) {
+            skip<QByteArray>();
+        }
+        if (flags & 1 << 0) {
+            skip<QString>();
+        }
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAccountPasswordSettings>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AccountPasswordSettings:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAccountSentChangePhoneCode>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AccountSentChangePhoneCode:
+        skip<QString>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAudio>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AudioEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Audio:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAuthCheckedPhone>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AuthCheckedPhone:
+        skip<bool>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAuthExportedAuthorization>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AuthExportedAuthorization:
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAuthPasswordRecovery>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AuthPasswordRecovery:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAuthSentCode>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AuthSentCode:
+    case TLValue::AuthSentAppCode:
+        skip<bool>();
+        skip<QString>();
+        skip<quint32>();
+        skip<bool>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAuthorization>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::Authorization:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLBotCommand>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::BotCommand:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLBotInfo>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::BotInfoEmpty:
+        break;
+    case TLValue::BotInfo:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skipVector<TLBotCommand>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChannelParticipant>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChannelParticipant:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantSelf:
+    case TLValue::ChannelParticipantModerator:
+    case TLValue::ChannelParticipantEditor:
+    case TLValue::ChannelParticipantKicked:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantCreator:
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChannelParticipantRole>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChannelRoleEmpty:
+    case TLValue::ChannelRoleModerator:
+    case TLValue::ChannelRoleEditor:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChannelParticipantsFilter>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChannelParticipantsRecent:
+    case TLValue::ChannelParticipantsAdmins:
+    case TLValue::ChannelParticipantsKicked:
+    case TLValue::ChannelParticipantsBots:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChatParticipant>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChatParticipant:
+    case TLValue::ChatParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChatParticipantCreator:
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChatParticipants>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::ChatParticipantsForbidden:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & 1 << 0) {
+            skip<TLChatParticipant>();
+        }
+        break;
+    case TLValue::ChatParticipants:
+        skip<quint32>();
+        skipVector<TLChatParticipant>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContact>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::Contact:
+        skip<quint32>();
+        skip<bool>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactBlocked>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactBlocked:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactLink>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactLinkUnknown:
+    case TLValue::ContactLinkNone:
+    case TLValue::ContactLinkHasPhone:
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactSuggested>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactSuggested:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLDisabledFeature>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::DisabledFeature:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLEncryptedChat>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::EncryptedChatEmpty:
+    case TLValue::EncryptedChatDiscarded:
+        skip<quint32>();
+        break;
+    case TLValue::EncryptedChatWaiting:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::EncryptedChatRequested:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    case TLValue::EncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLEncryptedFile>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLEncryptedMessage>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::EncryptedMessage:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLEncryptedFile>();
+        break;
+    case TLValue::EncryptedMessageService:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLError>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::Error:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLExportedChatInvite>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLFileLocation>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::FileLocationUnavailable:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::FileLocation:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLGeoPoint>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLHelpAppChangelog>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::HelpAppChangelogEmpty:
+        break;
+    case TLValue::HelpAppChangelog:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLHelpAppUpdate>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::HelpAppUpdate:
+        skip<quint32>();
+        skip<bool>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLHelpInviteText>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::HelpInviteText:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLHelpTermsOfService>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::HelpTermsOfService:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLImportedContact>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ImportedContact:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputAppEvent>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputAppEvent:
+        skip<double>();
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputAudio>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputAudioEmpty:
+        break;
+    case TLValue::InputAudio:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputChannel>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputChannelEmpty:
+        break;
+    case TLValue::InputChannel:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputContact>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPhoneContact:
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputDocument>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputEncryptedChat>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputEncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputEncryptedFile>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::InputEncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputFile>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputFile:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputFileBig:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputFileLocation>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputFileLocation:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::InputVideoFileLocation:
+    case TLValue::InputEncryptedFileLocation:
+    case TLValue::InputAudioFileLocation:
+    case TLValue::InputDocumentFileLocation:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputGeoPoint>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputPeer>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerChat:
+        skip<quint32>();
+        break;
+    case TLValue::InputPeerUser:
+    case TLValue::InputPeerChannel:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputPeerNotifyEvents>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputPeerNotifySettings>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPeerNotifySettings:
+        skip<quint32>();
+        skip<QString>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputPhoto>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputPhotoCrop>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPhotoCropAuto:
+        break;
+    case TLValue::InputPhotoCrop:
+        skip<double>();
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputPrivacyKey>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputStickerSet>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputStickerSetShortName:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputUser>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputUserEmpty:
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUser:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputVideo>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputVideoEmpty:
+        break;
+    case TLValue::InputVideo:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLKeyboardButton>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::KeyboardButton:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLKeyboardButtonRow>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::KeyboardButtonRow:
+        skipVector<TLKeyboardButton>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessageEntity>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessageEntityUnknown:
+    case TLValue::MessageEntityMention:
+    case TLValue::MessageEntityHashtag:
+    case TLValue::MessageEntityBotCommand:
+    case TLValue::MessageEntityUrl:
+    case TLValue::MessageEntityEmail:
+    case TLValue::MessageEntityBold:
+    case TLValue::MessageEntityItalic:
+    case TLValue::MessageEntityCode:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageEntityPre:
+    case TLValue::MessageEntityTextUrl:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessageGroup>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessageGroup:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessageRange>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessageRange:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesAffectedHistory>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesAffectedHistory:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesAffectedMessages>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesAffectedMessages:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesDhConfig>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesDhConfigNotModified:
+        skip<QByteArray>();
+        break;
+    case TLValue::MessagesDhConfig:
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesFilter>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputMessagesFilterEmpty:
+    case TLValue::InputMessagesFilterPhotos:
+    case TLValue::InputMessagesFilterVideo:
+    case TLValue::InputMessagesFilterPhotoVideo:
+    case TLValue::InputMessagesFilterPhotoVideoDocuments:
+    case TLValue::InputMessagesFilterDocument:
+    case TLValue::InputMessagesFilterAudio:
+    case TLValue::InputMessagesFilterAudioDocuments:
+    case TLValue::InputMessagesFilterUrl:
+    case TLValue::InputMessagesFilterGif:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesSentEncryptedMessage>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesSentEncryptedMessage:
+        skip<quint32>();
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        skip<quint32>();
+        skip<TLEncryptedFile>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLNearestDc>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::NearestDc:
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPeer>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PeerUser:
+    case TLValue::PeerChat:
+    case TLValue::PeerChannel:
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPeerNotifyEvents>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PeerNotifyEventsEmpty:
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPeerNotifySettings>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        skip<quint32>();
+        skip<QString>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPhotoSize>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PhotoSizeEmpty:
+        skip<QString>();
+        break;
+    case TLValue::PhotoSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::PhotoCachedSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPrivacyKey>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPrivacyRule>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PrivacyValueAllowContacts:
+    case TLValue::PrivacyValueAllowAll:
+    case TLValue::PrivacyValueDisallowContacts:
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+    case TLValue::PrivacyValueDisallowUsers:
+        skipVector<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLReceivedNotifyMessage>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ReceivedNotifyMessage:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLReportReason>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputReportReasonSpam:
+    case TLValue::InputReportReasonViolence:
+    case TLValue::InputReportReasonPornography:
+        break;
+    case TLValue::InputReportReasonOther:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLSendMessageAction>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::SendMessageTypingAction:
+    case TLValue::SendMessageCancelAction:
+    case TLValue::SendMessageRecordVideoAction:
+    case TLValue::SendMessageRecordAudioAction:
+    case TLValue::SendMessageGeoLocationAction:
+    case TLValue::SendMessageChooseContactAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+    case TLValue::SendMessageUploadAudioAction:
+    case TLValue::SendMessageUploadPhotoAction:
+    case TLValue::SendMessageUploadDocumentAction:
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLStickerPack>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::StickerPack:
+        skip<QString>();
+        skipVector<quint64>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLStorageFileType>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::StorageFileUnknown:
+    case TLValue::StorageFileJpeg:
+    case TLValue::StorageFileGif:
+    case TLValue::StorageFilePng:
+    case TLValue::StorageFilePdf:
+    case TLValue::StorageFileMp3:
+    case TLValue::StorageFileMov:
+    case TLValue::StorageFilePartial:
+    case TLValue::StorageFileMp4:
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUpdatesState>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::UpdatesState:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUploadFile>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::UploadFile:
+        skip<TLStorageFileType>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUserProfilePhoto>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        skip<quint64>();
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUserStatus>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::UserStatusEmpty:
+    case TLValue::UserStatusRecently:
+    case TLValue::UserStatusLastWeek:
+    case TLValue::UserStatusLastMonth:
+        break;
+    case TLValue::UserStatusOnline:
+    case TLValue::UserStatusOffline:
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLVideo>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::VideoEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Video:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<TLPhotoSize>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLWallPaper>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::WallPaper:
+        skip<quint32>();
+        skip<QString>();
+        skipVector<TLPhotoSize>();
+        skip<quint32>();
+        break;
+    case TLValue::WallPaperSolid:
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAccountAuthorizations>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AccountAuthorizations:
+        skipVector<TLAuthorization>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLBotInlineMessage>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::BotInlineMessageMediaAuto:
+        skip<QString>();
+        break;
+    case TLValue::BotInlineMessageText:
+        *this >> flags;
+        skip<QString>();
+        if (flags & 1 << 1) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChannelMessagesFilter>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChannelMessagesFilterEmpty:
+    case TLValue::ChannelMessagesFilterCollapsed:
+        break;
+    case TLValue::ChannelMessagesFilter:
+        skip<quint32>();
+        skipVector<TLMessageRange>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChatPhoto>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactStatus>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLDcOption>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::DcOption:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLDialog>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::Dialog:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPeerNotifySettings>();
+        break;
+    case TLValue::DialogChannel:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPeerNotifySettings>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLDocumentAttribute>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::DocumentAttributeImageSize:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAnimated:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        skip<QString>();
+        skip<TLInputStickerSet>();
+        break;
+    case TLValue::DocumentAttributeVideo:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAudio:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::DocumentAttributeFilename:
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputBotInlineMessage>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::InputBotInlineMessageMediaAuto:
+        skip<QString>();
+        break;
+    case TLValue::InputBotInlineMessageText:
+        *this >> flags;
+        skip<QString>();
+        if (flags & 1 << 1) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputBotInlineResult>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::InputBotInlineResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
+        if (flags & 1 << 2) {
+            skip<QString>();
+        }
+        if (flags & 1 << 3) {
+            skip<QString>();
+        }
+        if (flags & 1 << 4) {
+            skip<QString>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 7) {
+            skip<quint32>();
+        }
+        skip<TLInputBotInlineMessage>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputChatPhoto>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        skip<TLInputFile>();
+        skip<TLInputPhotoCrop>();
+        break;
+    case TLValue::InputChatPhoto:
+        skip<TLInputPhoto>();
+        skip<TLInputPhotoCrop>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputMedia>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        skip<TLInputFile>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaPhoto:
+        skip<TLInputPhoto>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaGeoPoint:
+        skip<TLInputGeoPoint>();
+        break;
+    case TLValue::InputMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedVideo:
+        skip<TLInputFile>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedThumbVideo:
+        skip<TLInputFile>();
+        skip<TLInputFile>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaVideo:
+        skip<TLInputVideo>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedAudio:
+        skip<TLInputFile>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaAudio:
+        skip<TLInputAudio>();
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        skip<TLInputFile>();
+        skip<QString>();
+        skipVector<TLDocumentAttribute>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedThumbDocument:
+        skip<TLInputFile>();
+        skip<TLInputFile>();
+        skip<QString>();
+        skipVector<TLDocumentAttribute>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaDocument:
+        skip<TLInputDocument>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaVenue:
+        skip<TLInputGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaGifExternal:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputNotifyPeer>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputNotifyPeer:
+        skip<TLInputPeer>();
+        break;
+    case TLValue::InputNotifyUsers:
+    case TLValue::InputNotifyChats:
+    case TLValue::InputNotifyAll:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLInputPrivacyRule>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::InputPrivacyValueAllowContacts:
+    case TLValue::InputPrivacyValueAllowAll:
+    case TLValue::InputPrivacyValueDisallowContacts:
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+    case TLValue::InputPrivacyValueDisallowUsers:
+        skipVector<TLInputUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLNotifyPeer>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::NotifyPeer:
+        skip<TLPeer>();
+        break;
+    case TLValue::NotifyUsers:
+    case TLValue::NotifyChats:
+    case TLValue::NotifyAll:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPhoto>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PhotoEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Photo:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skipVector<TLPhotoSize>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLReplyMarkup>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ReplyKeyboardHide:
+    case TLValue::ReplyKeyboardForceReply:
+        skip<quint32>();
+        break;
+    case TLValue::ReplyKeyboardMarkup:
+        skip<quint32>();
+        skipVector<TLKeyboardButtonRow>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLStickerSet>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::StickerSet:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUser>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::UserEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::User:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & 1 << 0) {
+            skip<quint64>();
+        }
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
+        if (flags & 1 << 2) {
+            skip<QString>();
+        }
+        if (flags & 1 << 3) {
+            skip<QString>();
+        }
+        if (flags & 1 << 4) {
+            skip<QString>();
+        }
+        if (flags & 1 << 5) {
+            skip<TLUserProfilePhoto>();
+        }
+        if (flags & 1 << 6) {
+            skip<TLUserStatus>();
+        }
+        if (flags & 1 << 14) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 18) {
+            skip<QString>();
+        }
+        if (flags & 1 << 19) {
+            skip<QString>();
+        }
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAccountPrivacyRules>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AccountPrivacyRules:
+        skipVector<TLPrivacyRule>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLAuthAuthorization>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::AuthAuthorization:
+        skip<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChannelsChannelParticipant>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChannelsChannelParticipant:
+        skip<TLChannelParticipant>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChannelsChannelParticipants>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChannelsChannelParticipants:
+        skip<quint32>();
+        skipVector<TLChannelParticipant>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChat>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::ChatEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Chat:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & 1 << 6) {
+            skip<TLInputChannel>();
+        }
+        break;
+    case TLValue::ChatForbidden:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::Channel:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint64>();
+        skip<QString>();
+        if (flags & 1 << 6) {
+            skip<QString>();
+        }
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & 1 << 9) {
+            skip<QString>();
+        }
+        break;
+    case TLValue::ChannelForbidden:
+        skip<quint32>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChatFull>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::ChatFull:
+        skip<quint32>();
+        skip<TLChatParticipants>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<TLExportedChatInvite>();
+        skipVector<TLBotInfo>();
+        break;
+    case TLValue::ChannelFull:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        if (flags & 1 << 0) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 1) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<TLExportedChatInvite>();
+        skipVector<TLBotInfo>();
+        if (flags & 1 << 4) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 4) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLChatInvite>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ChatInviteAlready:
+        skip<TLChat>();
+        break;
+    case TLValue::ChatInvite:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLConfig>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::Config:
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        skipVector<TLDcOption>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLDisabledFeature>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactsBlocked>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactsBlocked:
+        skipVector<TLContactBlocked>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::ContactsBlockedSlice:
+        skip<quint32>();
+        skipVector<TLContactBlocked>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactsContacts>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        skipVector<TLContact>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactsFound>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactsFound:
+        skipVector<TLPeer>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactsImportedContacts>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactsImportedContacts:
+        skipVector<TLImportedContact>();
+        skipVector<quint64>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactsLink>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactsLink:
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        skip<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactsResolvedPeer>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactsResolvedPeer:
+        skip<TLPeer>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLContactsSuggested>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::ContactsSuggested:
+        skipVector<TLContactSuggested>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLDocument>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::DocumentEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Document:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<TLPhotoSize>();
+        skip<quint32>();
+        skipVector<TLDocumentAttribute>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLFoundGif>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::FoundGif:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::FoundGifCached:
+        skip<QString>();
+        skip<TLPhoto>();
+        skip<TLDocument>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLHelpSupport>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::HelpSupport:
+        skip<QString>();
+        skip<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessageAction>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessageActionEmpty:
+    case TLValue::MessageActionChatDeletePhoto:
+        break;
+    case TLValue::MessageActionChatCreate:
+        skip<QString>();
+        skipVector<quint32>();
+        break;
+    case TLValue::MessageActionChatEditTitle:
+    case TLValue::MessageActionChannelCreate:
+        skip<QString>();
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        skip<TLPhoto>();
+        break;
+    case TLValue::MessageActionChatAddUser:
+        skipVector<quint32>();
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+    case TLValue::MessageActionChatJoinedByLink:
+    case TLValue::MessageActionChatMigrateTo:
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionChannelMigrateFrom:
+        skip<QString>();
+        skip<quint32>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesAllStickers>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        skip<quint32>();
+        skipVector<TLStickerSet>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesChatFull>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesChatFull:
+        skip<TLChatFull>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesChats>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesChats:
+        skipVector<TLChat>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesFoundGifs>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesFoundGifs:
+        skip<quint32>();
+        skipVector<TLFoundGif>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesSavedGifs>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesSavedGifsNotModified:
+        break;
+    case TLValue::MessagesSavedGifs:
+        skip<quint32>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesStickerSet>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesStickerSet:
+        skip<TLStickerSet>();
+        skipVector<TLStickerPack>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesStickers>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        skip<QString>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPhotosPhoto>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PhotosPhoto:
+        skip<TLPhoto>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLPhotosPhotos>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::PhotosPhotos:
+        skipVector<TLPhoto>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::PhotosPhotosSlice:
+        skip<quint32>();
+        skipVector<TLPhoto>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUserFull>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::UserFull:
+        skip<TLUser>();
+        skip<TLContactsLink>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<bool>();
+        skip<TLBotInfo>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLWebPage>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::WebPageEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::WebPagePending:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    case TLValue::WebPage:
+        *this >> flags;
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & 1 << 0) {
+            skip<QString>();
+        }
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
+        if (flags & 1 << 2) {
+            skip<QString>();
+        }
+        if (flags & 1 << 3) {
+            skip<QString>();
+        }
+        if (flags & 1 << 4) {
+            skip<TLPhoto>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 7) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 8) {
+            skip<QString>();
+        }
+        if (flags & 1 << 9) {
+            skip<TLDocument>();
+        }
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLBotInlineResult>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::BotInlineMediaResultDocument:
+        skip<QString>();
+        skip<QString>();
+        skip<TLDocument>();
+        skip<TLBotInlineMessage>();
+        break;
+    case TLValue::BotInlineMediaResultPhoto:
+        skip<QString>();
+        skip<QString>();
+        skip<TLPhoto>();
+        skip<TLBotInlineMessage>();
+        break;
+    case TLValue::BotInlineResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
+        if (flags & 1 << 2) {
+            skip<QString>();
+        }
+        if (flags & 1 << 3) {
+            skip<QString>();
+        }
+        if (flags & 1 << 4) {
+            skip<QString>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 7) {
+            skip<quint32>();
+        }
+        skip<TLBotInlineMessage>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessageMedia>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessageMediaEmpty:
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaPhoto:
+        skip<TLPhoto>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaVideo:
+        skip<TLVideo>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaGeo:
+        skip<TLGeoPoint>();
+        break;
+    case TLValue::MessageMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageMediaDocument:
+        skip<TLDocument>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaAudio:
+        skip<TLAudio>();
+        break;
+    case TLValue::MessageMediaWebPage:
+        skip<TLWebPage>();
+        break;
+    case TLValue::MessageMediaVenue:
+        skip<TLGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesBotResults>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::MessagesBotResults:
+        *this >> flags;
+        skip<quint64>();
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
+        skipVector<TLBotInlineResult>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessage>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::MessageEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Message:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & 1 << 8) {
+            skip<quint32>();
+        }
+        skip<TLPeer>();
+        if (flags & 1 << 2) {
+            skip<TLPeer>();
+        }
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 11) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 3) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<QString>();
+        if (flags & 1 << 9) {
+            skip<TLMessageMedia>();
+        }
+        if (flags & 1 << 6) {
+            skip<TLReplyMarkup>();
+        }
+        if (flags & 1 << 7) {
+            skipVector<TLMessageEntity>();
+        }
+        if (flags & 1 << 10) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::MessageService:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & 1 << 8) {
+            skip<quint32>();
+        }
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<TLMessageAction>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesDialogs>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::MessagesDialogs:
+        skipVector<TLDialog>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::MessagesDialogsSlice:
+        skip<quint32>();
+        skipVector<TLDialog>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLMessagesMessages>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::MessagesMessages:
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::MessagesMessagesSlice:
+        skip<quint32>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::MessagesChannelMessages:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLMessage>();
+        if (flags & 1 << 0) {
+            skipVector<TLMessageGroup>();
+        }
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUpdate>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+        skip<TLMessage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateMessageID:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+        skipVector<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateUserTyping:
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatUserTyping:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatParticipants:
+        skip<TLChatParticipants>();
+        break;
+    case TLValue::UpdateUserStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UpdateUserName:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateUserPhoto:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLUserProfilePhoto>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateContactRegistered:
+    case TLValue::UpdateReadChannelInbox:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateContactLink:
+        skip<quint32>();
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        break;
+    case TLValue::UpdateNewAuthorization:
+    case TLValue::UpdateBotInlineQuery:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        skip<TLEncryptedMessage>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+    case TLValue::UpdateChannelTooLong:
+    case TLValue::UpdateChannel:
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryption:
+        skip<TLEncryptedChat>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+    case TLValue::UpdateChatParticipantDelete:
+    case TLValue::UpdateChannelMessageViews:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateDcOptions:
+        skipVector<TLDcOption>();
+        break;
+    case TLValue::UpdateUserBlocked:
+        skip<quint32>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateNotifySettings:
+        skip<TLNotifyPeer>();
+        skip<TLPeerNotifySettings>();
+        break;
+    case TLValue::UpdateServiceNotification:
+        skip<QString>();
+        skip<QString>();
+        skip<TLMessageMedia>();
+        skip<bool>();
+        break;
+    case TLValue::UpdatePrivacy:
+        skip<TLPrivacyKey>();
+        skipVector<TLPrivacyRule>();
+        break;
+    case TLValue::UpdateUserPhone:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateWebPage:
+        skip<TLWebPage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChannelGroup:
+        skip<quint32>();
+        skip<TLMessageGroup>();
+        break;
+    case TLValue::UpdateDeleteChannelMessages:
+        skip<quint32>();
+        skipVector<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatAdmins:
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateNewStickerSet:
+        skip<TLMessagesStickerSet>();
+        break;
+    case TLValue::UpdateStickerSetsOrder:
+        skipVector<quint64>();
+        break;
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUpdates>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & 1 << 2) {
+            skip<TLPeer>();
+        }
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 11) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 3) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 7) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & 1 << 2) {
+            skip<TLPeer>();
+        }
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 11) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 3) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 7) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    case TLValue::UpdateShort:
+        skip<TLUpdate>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesCombined:
+        skipVector<TLUpdate>();
+        skipVector<TLUser>();
+        skipVector<TLChat>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::Updates:
+        skipVector<TLUpdate>();
+        skipVector<TLUser>();
+        skipVector<TLChat>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateShortSentMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & 1 << 9) {
+            skip<TLMessageMedia>();
+        }
+        if (flags & 1 << 7) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUpdatesChannelDifference>()
+{
+    TLValue type;
+    *this >> type;
+    quint32 flags = 0;
+
+    switch (type) {
+    case TLValue::UpdatesChannelDifferenceEmpty:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & 1 << 1) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::UpdatesChannelDifferenceTooLong:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & 1 << 1) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::UpdatesChannelDifference:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & 1 << 1) {
+            skip<quint32>();
+        }
+        skipVector<TLMessage>();
+        skipVector<TLUpdate>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+template <>
+void CTelegramStream::skip<TLUpdatesDifference>()
+{
+    TLValue type;
+    *this >> type;
+
+    switch (type) {
+    case TLValue::UpdatesDifferenceEmpty:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesDifference:
+    case TLValue::UpdatesDifferenceSlice:
+        skipVector<TLMessage>();
+        skipVector<TLEncryptedMessage>();
+        skipVector<TLUpdate>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        skip<TLUpdatesState>();
+        break;
+    default:
+        setError(true);
+        break;
+    }
+}
+
+// End of generated skip implementation
+
+quint32 tlEncodedSize(const QByteArray &data)
+{
+    const Telegram::AbridgedLength length(static_cast<quint32>(data.size()));
+    return length.packedSize() + length + length.paddingForAlignment(4);
+}
+
+quint32 tlEncodedSize(const QString &string)
+{
+    // Strings are sent in UTF-8; count the bytes without the conversion
+    quint32 utf8Size = 0;
+    const int count = string.size();
+    for (int i = 0; i < count; ++i) {
+        const ushort c = string.at(i).unicode();
+        if (c < 0x80) {
+            utf8Size += 1;
+        } else if (c < 0x800) {
+            utf8Size += 2;
+        } else if (QChar::isHighSurrogate(c) && (i + 1 < count) && string.at(i + 1).isLowSurrogate()) {
+            utf8Size += 4;
+            ++i;
+        } else {
+            utf8Size += 3;
+        }
+    }
+    const Telegram::AbridgedLength length(utf8Size);
+    return length.packedSize() + length + length.paddingForAlignment(4);
+}
+
+// Generated encoded size implementation
+quint32 tlEncodedSize(const TLAccountDaysTTL &accountDaysTTLValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (accountDaysTTLValue.tlType) {
+    case TLValue::AccountDaysTTL:
+        size += tlEncodedSize(accountDaysTTLValue.days);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAccountPassword &accountPasswordValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (accountPasswordValue.tlType) {
+    case TLValue::AccountNoPassword:
+        size += tlEncodedSize(accountPasswordValue.newSalt);
+        size += tlEncodedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    case TLValue::AccountPassword:
+        size += tlEncodedSize(accountPasswordValue.currentSalt);
+        size += tlEncodedSize(accountPasswordValue.newSalt);
+        size += tlEncodedSize(accountPasswordValue.hint);
+        size += tlEncodedSize(accountPasswordValue.hasRecovery);
+        size += tlEncodedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (accountPasswordInputSettingsValue.tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        size += tlEncodedSize(accountPasswordInputSettingsValue.flags);
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            size += tlEncodedSize(accountPasswordInputSettingsValue.newSalt);
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            size += tlEncodedSize(accountPasswordInputSettingsValue.newPasswordHash);
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            size += tlEncodedSize(accountPasswordInputSettingsValue.hint);
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 1) {
+            size += tlEncodedSize(accountPasswordInputSettingsValue.email);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (accountPasswordSettingsValue.tlType) {
+    case TLValue::AccountPasswordSettings:
+        size += tlEncodedSize(accountPasswordSettingsValue.email);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (accountSentChangePhoneCodeValue.tlType) {
+    case TLValue::AccountSentChangePhoneCode:
+        size += tlEncodedSize(accountSentChangePhoneCodeValue.phoneCodeHash);
+        size += tlEncodedSize(accountSentChangePhoneCodeValue.sendCallTimeout);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAudio &audioValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (audioValue.tlType) {
+    case TLValue::AudioEmpty:
+        size += tlEncodedSize(audioValue.id);
+        break;
+    case TLValue::Audio:
+        size += tlEncodedSize(audioValue.id);
+        size += tlEncodedSize(audioValue.accessHash);
+        size += tlEncodedSize(audioValue.date);
+        size += tlEncodedSize(audioValue.duration);
+        size += tlEncodedSize(audioValue.mimeType);
+        size += tlEncodedSize(audioValue.size);
+        size += tlEncodedSize(audioValue.dcId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAuthCheckedPhone &authCheckedPhoneValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (authCheckedPhoneValue.tlType) {
+    case TLValue::AuthCheckedPhone:
+        size += tlEncodedSize(authCheckedPhoneValue.phoneRegistered);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (authExportedAuthorizationValue.tlType) {
+    case TLValue::AuthExportedAuthorization:
+        size += tlEncodedSize(authExportedAuthorizationValue.id);
+        size += tlEncodedSize(authExportedAuthorizationValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (authPasswordRecoveryValue.tlType) {
+    case TLValue::AuthPasswordRecovery:
+        size += tlEncodedSize(authPasswordRecoveryValue.emailPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAuthSentCode &authSentCodeValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (authSentCodeValue.tlType) {
+    case TLValue::AuthSentCode:
+    case TLValue::AuthSentAppCode:
+        size += tlEncodedSize(authSentCodeValue.phoneRegistered);
+        size += tlEncodedSize(authSentCodeValue.phoneCodeHash);
+        size += tlEncodedSize(authSentCodeValue.sendCallTimeout);
+        size += tlEncodedSize(authSentCodeValue.isPassword);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAuthorization &authorizationValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (authorizationValue.tlType) {
+    case TLValue::Authorization:
+        size += tlEncodedSize(authorizationValue.hash);
+        size += tlEncodedSize(authorizationValue.flags);
+        size += tlEncodedSize(authorizationValue.deviceModel);
+        size += tlEncodedSize(authorizationValue.platform);
+        size += tlEncodedSize(authorizationValue.systemVersion);
+        size += tlEncodedSize(authorizationValue.apiId);
+        size += tlEncodedSize(authorizationValue.appName);
+        size += tlEncodedSize(authorizationValue.appVersion);
+        size += tlEncodedSize(authorizationValue.dateCreated);
+        size += tlEncodedSize(authorizationValue.dateActive);
+        size += tlEncodedSize(authorizationValue.ip);
+        size += tlEncodedSize(authorizationValue.country);
+        size += tlEncodedSize(authorizationValue.region);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLBotCommand &botCommandValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (botCommandValue.tlType) {
+    case TLValue::BotCommand:
+        size += tlEncodedSize(botCommandValue.command);
+        size += tlEncodedSize(botCommandValue.description);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLBotInfo &botInfoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (botInfoValue.tlType) {
+    case TLValue::BotInfoEmpty:
+        break;
+    case TLValue::BotInfo:
+        size += tlEncodedSize(botInfoValue.userId);
+        size += tlEncodedSize(botInfoValue.version);
+        size += tlEncodedSize(botInfoValue.shareText);
+        size += tlEncodedSize(botInfoValue.description);
+        size += tlEncodedSize(botInfoValue.commands);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChannelParticipant &channelParticipantValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (channelParticipantValue.tlType) {
+    case TLValue::ChannelParticipant:
+        size += tlEncodedSize(channelParticipantValue.userId);
+        size += tlEncodedSize(channelParticipantValue.date);
+        break;
+    case TLValue::ChannelParticipantSelf:
+    case TLValue::ChannelParticipantModerator:
+    case TLValue::ChannelParticipantEditor:
+        size += tlEncodedSize(channelParticipantValue.userId);
+        size += tlEncodedSize(channelParticipantValue.inviterId);
+        size += tlEncodedSize(channelParticipantValue.date);
+        break;
+    case TLValue::ChannelParticipantKicked:
+        size += tlEncodedSize(channelParticipantValue.userId);
+        size += tlEncodedSize(channelParticipantValue.kickedBy);
+        size += tlEncodedSize(channelParticipantValue.date);
+        break;
+    case TLValue::ChannelParticipantCreator:
+        size += tlEncodedSize(channelParticipantValue.userId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChannelParticipantRole &channelParticipantRoleValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (channelParticipantRoleValue.tlType) {
+    case TLValue::ChannelRoleEmpty:
+    case TLValue::ChannelRoleModerator:
+    case TLValue::ChannelRoleEditor:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChannelParticipantsFilter &channelParticipantsFilterValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (channelParticipantsFilterValue.tlType) {
+    case TLValue::ChannelParticipantsRecent:
+    case TLValue::ChannelParticipantsAdmins:
+    case TLValue::ChannelParticipantsKicked:
+    case TLValue::ChannelParticipantsBots:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChatParticipant &chatParticipantValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (chatParticipantValue.tlType) {
+    case TLValue::ChatParticipant:
+    case TLValue::ChatParticipantAdmin:
+        size += tlEncodedSize(chatParticipantValue.userId);
+        size += tlEncodedSize(chatParticipantValue.inviterId);
+        size += tlEncodedSize(chatParticipantValue.date);
+        break;
+    case TLValue::ChatParticipantCreator:
+        size += tlEncodedSize(chatParticipantValue.userId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChatParticipants &chatParticipantsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (chatParticipantsValue.tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        size += tlEncodedSize(chatParticipantsValue.flags);
+        size += tlEncodedSize(chatParticipantsValue.chatId);
+        if (chatParticipantsValue.flags & 1 << 0) {
+            size += tlEncodedSize(chatParticipantsValue.selfParticipant);
+        }
+        break;
+    case TLValue::ChatParticipants:
+        size += tlEncodedSize(chatParticipantsValue.chatId);
+        size += tlEncodedSize(chatParticipantsValue.participants);
+        size += tlEncodedSize(chatParticipantsValue.version);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContact &contactValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactValue.tlType) {
+    case TLValue::Contact:
+        size += tlEncodedSize(contactValue.userId);
+        size += tlEncodedSize(contactValue.mutual);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactBlocked &contactBlockedValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactBlockedValue.tlType) {
+    case TLValue::ContactBlocked:
+        size += tlEncodedSize(contactBlockedValue.userId);
+        size += tlEncodedSize(contactBlockedValue.date);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactLink &contactLinkValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactLinkValue.tlType) {
+    case TLValue::ContactLinkUnknown:
+    case TLValue::ContactLinkNone:
+    case TLValue::ContactLinkHasPhone:
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactSuggested &contactSuggestedValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactSuggestedValue.tlType) {
+    case TLValue::ContactSuggested:
+        size += tlEncodedSize(contactSuggestedValue.userId);
+        size += tlEncodedSize(contactSuggestedValue.mutualContacts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLDisabledFeature &disabledFeatureValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (disabledFeatureValue.tlType) {
+    case TLValue::DisabledFeature:
+        size += tlEncodedSize(disabledFeatureValue.feature);
+        size += tlEncodedSize(disabledFeatureValue.description);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLEncryptedChat &encryptedChatValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (encryptedChatValue.tlType) {
+    case TLValue::EncryptedChatEmpty:
+    case TLValue::EncryptedChatDiscarded:
+        size += tlEncodedSize(encryptedChatValue.id);
+        break;
+    case TLValue::EncryptedChatWaiting:
+        size += tlEncodedSize(encryptedChatValue.id);
+        size += tlEncodedSize(encryptedChatValue.accessHash);
+        size += tlEncodedSize(encryptedChatValue.date);
+        size += tlEncodedSize(encryptedChatValue.adminId);
+        size += tlEncodedSize(encryptedChatValue.participantId);
+        break;
+    case TLValue::EncryptedChatRequested:
+        size += tlEncodedSize(encryptedChatValue.id);
+        size += tlEncodedSize(encryptedChatValue.accessHash);
+        size += tlEncodedSize(encryptedChatValue.date);
+        size += tlEncodedSize(encryptedChatValue.adminId);
+        size += tlEncodedSize(encryptedChatValue.participantId);
+        size += tlEncodedSize(encryptedChatValue.gA);
+        break;
+    case TLValue::EncryptedChat:
+        size += tlEncodedSize(encryptedChatValue.id);
+        size += tlEncodedSize(encryptedChatValue.accessHash);
+        size += tlEncodedSize(encryptedChatValue.date);
+        size += tlEncodedSize(encryptedChatValue.adminId);
+        size += tlEncodedSize(encryptedChatValue.participantId);
+        size += tlEncodedSize(encryptedChatValue.gAOrB);
+        size += tlEncodedSize(encryptedChatValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLEncryptedFile &encryptedFileValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (encryptedFileValue.tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        size += tlEncodedSize(encryptedFileValue.id);
+        size += tlEncodedSize(encryptedFileValue.accessHash);
+        size += tlEncodedSize(encryptedFileValue.size);
+        size += tlEncodedSize(encryptedFileValue.dcId);
+        size += tlEncodedSize(encryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLEncryptedMessage &encryptedMessageValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (encryptedMessageValue.tlType) {
+    case TLValue::EncryptedMessage:
+        size += tlEncodedSize(encryptedMessageValue.randomId);
+        size += tlEncodedSize(encryptedMessageValue.chatId);
+        size += tlEncodedSize(encryptedMessageValue.date);
+        size += tlEncodedSize(encryptedMessageValue.bytes);
+        size += tlEncodedSize(encryptedMessageValue.file);
+        break;
+    case TLValue::EncryptedMessageService:
+        size += tlEncodedSize(encryptedMessageValue.randomId);
+        size += tlEncodedSize(encryptedMessageValue.chatId);
+        size += tlEncodedSize(encryptedMessageValue.date);
+        size += tlEncodedSize(encryptedMessageValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLError &errorValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (errorValue.tlType) {
+    case TLValue::Error:
+        size += tlEncodedSize(errorValue.code);
+        size += tlEncodedSize(errorValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLExportedChatInvite &exportedChatInviteValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (exportedChatInviteValue.tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        size += tlEncodedSize(exportedChatInviteValue.link);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLFileLocation &fileLocationValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (fileLocationValue.tlType) {
+    case TLValue::FileLocationUnavailable:
+        size += tlEncodedSize(fileLocationValue.volumeId);
+        size += tlEncodedSize(fileLocationValue.localId);
+        size += tlEncodedSize(fileLocationValue.secret);
+        break;
+    case TLValue::FileLocation:
+        size += tlEncodedSize(fileLocationValue.dcId);
+        size += tlEncodedSize(fileLocationValue.volumeId);
+        size += tlEncodedSize(fileLocationValue.localId);
+        size += tlEncodedSize(fileLocationValue.secret);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLGeoPoint &geoPointValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (geoPointValue.tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        size += tlEncodedSize(geoPointValue.longitude);
+        size += tlEncodedSize(geoPointValue.latitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLHelpAppChangelog &helpAppChangelogValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (helpAppChangelogValue.tlType) {
+    case TLValue::HelpAppChangelogEmpty:
+        break;
+    case TLValue::HelpAppChangelog:
+        size += tlEncodedSize(helpAppChangelogValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLHelpAppUpdate &helpAppUpdateValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (helpAppUpdateValue.tlType) {
+    case TLValue::HelpAppUpdate:
+        size += tlEncodedSize(helpAppUpdateValue.id);
+        size += tlEncodedSize(helpAppUpdateValue.critical);
+        size += tlEncodedSize(helpAppUpdateValue.url);
+        size += tlEncodedSize(helpAppUpdateValue.text);
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLHelpInviteText &helpInviteTextValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (helpInviteTextValue.tlType) {
+    case TLValue::HelpInviteText:
+        size += tlEncodedSize(helpInviteTextValue.message);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLHelpTermsOfService &helpTermsOfServiceValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (helpTermsOfServiceValue.tlType) {
+    case TLValue::HelpTermsOfService:
+        size += tlEncodedSize(helpTermsOfServiceValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLImportedContact &importedContactValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (importedContactValue.tlType) {
+    case TLValue::ImportedContact:
+        size += tlEncodedSize(importedContactValue.userId);
+        size += tlEncodedSize(importedContactValue.clientId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputAppEvent &inputAppEventValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputAppEventValue.tlType) {
+    case TLValue::InputAppEvent:
+        size += tlEncodedSize(inputAppEventValue.time);
+        size += tlEncodedSize(inputAppEventValue.type);
+        size += tlEncodedSize(inputAppEventValue.peer);
+        size += tlEncodedSize(inputAppEventValue.data);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputAudio &inputAudioValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputAudioValue.tlType) {
+    case TLValue::InputAudioEmpty:
+        break;
+    case TLValue::InputAudio:
+        size += tlEncodedSize(inputAudioValue.id);
+        size += tlEncodedSize(inputAudioValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputChannel &inputChannelValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputChannelValue.tlType) {
+    case TLValue::InputChannelEmpty:
+        break;
+    case TLValue::InputChannel:
+        size += tlEncodedSize(inputChannelValue.channelId);
+        size += tlEncodedSize(inputChannelValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputContact &inputContactValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputContactValue.tlType) {
+    case TLValue::InputPhoneContact:
+        size += tlEncodedSize(inputContactValue.clientId);
+        size += tlEncodedSize(inputContactValue.phone);
+        size += tlEncodedSize(inputContactValue.firstName);
+        size += tlEncodedSize(inputContactValue.lastName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputDocument &inputDocumentValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputDocumentValue.tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        size += tlEncodedSize(inputDocumentValue.id);
+        size += tlEncodedSize(inputDocumentValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputEncryptedChat &inputEncryptedChatValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputEncryptedChatValue.tlType) {
+    case TLValue::InputEncryptedChat:
+        size += tlEncodedSize(inputEncryptedChatValue.chatId);
+        size += tlEncodedSize(inputEncryptedChatValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputEncryptedFile &inputEncryptedFileValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputEncryptedFileValue.tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        size += tlEncodedSize(inputEncryptedFileValue.id);
+        size += tlEncodedSize(inputEncryptedFileValue.parts);
+        size += tlEncodedSize(inputEncryptedFileValue.md5Checksum);
+        size += tlEncodedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    case TLValue::InputEncryptedFile:
+        size += tlEncodedSize(inputEncryptedFileValue.id);
+        size += tlEncodedSize(inputEncryptedFileValue.accessHash);
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        size += tlEncodedSize(inputEncryptedFileValue.id);
+        size += tlEncodedSize(inputEncryptedFileValue.parts);
+        size += tlEncodedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputFile &inputFileValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputFileValue.tlType) {
+    case TLValue::InputFile:
+        size += tlEncodedSize(inputFileValue.id);
+        size += tlEncodedSize(inputFileValue.parts);
+        size += tlEncodedSize(inputFileValue.name);
+        size += tlEncodedSize(inputFileValue.md5Checksum);
+        break;
+    case TLValue::InputFileBig:
+        size += tlEncodedSize(inputFileValue.id);
+        size += tlEncodedSize(inputFileValue.parts);
+        size += tlEncodedSize(inputFileValue.name);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputFileLocation &inputFileLocationValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputFileLocationValue.tlType) {
+    case TLValue::InputFileLocation:
+        size += tlEncodedSize(inputFileLocationValue.volumeId);
+        size += tlEncodedSize(inputFileLocationValue.localId);
+        size += tlEncodedSize(inputFileLocationValue.secret);
+        break;
+    case TLValue::InputVideoFileLocation:
+    case TLValue::InputEncryptedFileLocation:
+    case TLValue::InputAudioFileLocation:
+    case TLValue::InputDocumentFileLocation:
+        size += tlEncodedSize(inputFileLocationValue.id);
+        size += tlEncodedSize(inputFileLocationValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputGeoPoint &inputGeoPointValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputGeoPointValue.tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        size += tlEncodedSize(inputGeoPointValue.latitude);
+        size += tlEncodedSize(inputGeoPointValue.longitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputPeer &inputPeerValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputPeerValue.tlType) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerChat:
+        size += tlEncodedSize(inputPeerValue.chatId);
+        break;
+    case TLValue::InputPeerUser:
+        size += tlEncodedSize(inputPeerValue.userId);
+        size += tlEncodedSize(inputPeerValue.accessHash);
+        break;
+    case TLValue::InputPeerChannel:
+        size += tlEncodedSize(inputPeerValue.channelId);
+        size += tlEncodedSize(inputPeerValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputPeerNotifyEventsValue.tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputPeerNotifySettingsValue.tlType) {
+    case TLValue::InputPeerNotifySettings:
+        size += tlEncodedSize(inputPeerNotifySettingsValue.muteUntil);
+        size += tlEncodedSize(inputPeerNotifySettingsValue.sound);
+        size += tlEncodedSize(inputPeerNotifySettingsValue.showPreviews);
+        size += tlEncodedSize(inputPeerNotifySettingsValue.eventsMask);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputPhoto &inputPhotoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputPhotoValue.tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        size += tlEncodedSize(inputPhotoValue.id);
+        size += tlEncodedSize(inputPhotoValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputPhotoCrop &inputPhotoCropValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputPhotoCropValue.tlType) {
+    case TLValue::InputPhotoCropAuto:
+        break;
+    case TLValue::InputPhotoCrop:
+        size += tlEncodedSize(inputPhotoCropValue.cropLeft);
+        size += tlEncodedSize(inputPhotoCropValue.cropTop);
+        size += tlEncodedSize(inputPhotoCropValue.cropWidth);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputPrivacyKey &inputPrivacyKeyValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputPrivacyKeyValue.tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputStickerSet &inputStickerSetValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputStickerSetValue.tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        size += tlEncodedSize(inputStickerSetValue.id);
+        size += tlEncodedSize(inputStickerSetValue.accessHash);
+        break;
+    case TLValue::InputStickerSetShortName:
+        size += tlEncodedSize(inputStickerSetValue.shortName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputUser &inputUserValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputUserValue.tlType) {
+    case TLValue::InputUserEmpty:
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUser:
+        size += tlEncodedSize(inputUserValue.userId);
+        size += tlEncodedSize(inputUserValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputVideo &inputVideoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputVideoValue.tlType) {
+    case TLValue::InputVideoEmpty:
+        break;
+    case TLValue::InputVideo:
+        size += tlEncodedSize(inputVideoValue.id);
+        size += tlEncodedSize(inputVideoValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLKeyboardButton &keyboardButtonValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (keyboardButtonValue.tlType) {
+    case TLValue::KeyboardButton:
+        size += tlEncodedSize(keyboardButtonValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLKeyboardButtonRow &keyboardButtonRowValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (keyboardButtonRowValue.tlType) {
+    case TLValue::KeyboardButtonRow:
+        size += tlEncodedSize(keyboardButtonRowValue.buttons);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessageEntity &messageEntityValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messageEntityValue.tlType) {
+    case TLValue::MessageEntityUnknown:
+    case TLValue::MessageEntityMention:
+    case TLValue::MessageEntityHashtag:
+    case TLValue::MessageEntityBotCommand:
+    case TLValue::MessageEntityUrl:
+    case TLValue::MessageEntityEmail:
+    case TLValue::MessageEntityBold:
+    case TLValue::MessageEntityItalic:
+    case TLValue::MessageEntityCode:
+        size += tlEncodedSize(messageEntityValue.offset);
+        size += tlEncodedSize(messageEntityValue.length);
+        break;
+    case TLValue::MessageEntityPre:
+        size += tlEncodedSize(messageEntityValue.offset);
+        size += tlEncodedSize(messageEntityValue.length);
+        size += tlEncodedSize(messageEntityValue.language);
+        break;
+    case TLValue::MessageEntityTextUrl:
+        size += tlEncodedSize(messageEntityValue.offset);
+        size += tlEncodedSize(messageEntityValue.length);
+        size += tlEncodedSize(messageEntityValue.url);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessageGroup &messageGroupValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messageGroupValue.tlType) {
+    case TLValue::MessageGroup:
+        size += tlEncodedSize(messageGroupValue.minId);
+        size += tlEncodedSize(messageGroupValue.maxId);
+        size += tlEncodedSize(messageGroupValue.count);
+        size += tlEncodedSize(messageGroupValue.date);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessageRange &messageRangeValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messageRangeValue.tlType) {
+    case TLValue::MessageRange:
+        size += tlEncodedSize(messageRangeValue.minId);
+        size += tlEncodedSize(messageRangeValue.maxId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesAffectedHistory &messagesAffectedHistoryValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesAffectedHistoryValue.tlType) {
+    case TLValue::MessagesAffectedHistory:
+        size += tlEncodedSize(messagesAffectedHistoryValue.pts);
+        size += tlEncodedSize(messagesAffectedHistoryValue.ptsCount);
+        size += tlEncodedSize(messagesAffectedHistoryValue.offset);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesAffectedMessages &messagesAffectedMessagesValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesAffectedMessagesValue.tlType) {
+    case TLValue::MessagesAffectedMessages:
+        size += tlEncodedSize(messagesAffectedMessagesValue.pts);
+        size += tlEncodedSize(messagesAffectedMessagesValue.ptsCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesDhConfig &messagesDhConfigValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesDhConfigValue.tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        size += tlEncodedSize(messagesDhConfigValue.random);
+        break;
+    case TLValue::MessagesDhConfig:
+        size += tlEncodedSize(messagesDhConfigValue.g);
+        size += tlEncodedSize(messagesDhConfigValue.p);
+        size += tlEncodedSize(messagesDhConfigValue.version);
+        size += tlEncodedSize(messagesDhConfigValue.random);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesFilter &messagesFilterValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesFilterValue.tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+    case TLValue::InputMessagesFilterPhotos:
+    case TLValue::InputMessagesFilterVideo:
+    case TLValue::InputMessagesFilterPhotoVideo:
+    case TLValue::InputMessagesFilterPhotoVideoDocuments:
+    case TLValue::InputMessagesFilterDocument:
+    case TLValue::InputMessagesFilterAudio:
+    case TLValue::InputMessagesFilterAudioDocuments:
+    case TLValue::InputMessagesFilterUrl:
+    case TLValue::InputMessagesFilterGif:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesSentEncryptedMessageValue.tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        size += tlEncodedSize(messagesSentEncryptedMessageValue.date);
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        size += tlEncodedSize(messagesSentEncryptedMessageValue.date);
+        size += tlEncodedSize(messagesSentEncryptedMessageValue.file);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLNearestDc &nearestDcValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (nearestDcValue.tlType) {
+    case TLValue::NearestDc:
+        size += tlEncodedSize(nearestDcValue.country);
+        size += tlEncodedSize(nearestDcValue.thisDc);
+        size += tlEncodedSize(nearestDcValue.nearestDc);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPeer &peerValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (peerValue.tlType) {
+    case TLValue::PeerUser:
+        size += tlEncodedSize(peerValue.userId);
+        break;
+    case TLValue::PeerChat:
+        size += tlEncodedSize(peerValue.chatId);
+        break;
+    case TLValue::PeerChannel:
+        size += tlEncodedSize(peerValue.channelId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPeerNotifyEvents &peerNotifyEventsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (peerNotifyEventsValue.tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPeerNotifySettings &peerNotifySettingsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (peerNotifySettingsValue.tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        size += tlEncodedSize(peerNotifySettingsValue.muteUntil);
+        size += tlEncodedSize(peerNotifySettingsValue.sound);
+        size += tlEncodedSize(peerNotifySettingsValue.showPreviews);
+        size += tlEncodedSize(peerNotifySettingsValue.eventsMask);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPhotoSize &photoSizeValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (photoSizeValue.tlType) {
+    case TLValue::PhotoSizeEmpty:
+        size += tlEncodedSize(photoSizeValue.type);
+        break;
+    case TLValue::PhotoSize:
+        size += tlEncodedSize(photoSizeValue.type);
+        size += tlEncodedSize(photoSizeValue.location);
+        size += tlEncodedSize(photoSizeValue.w);
+        size += tlEncodedSize(photoSizeValue.h);
+        size += tlEncodedSize(photoSizeValue.size);
+        break;
+    case TLValue::PhotoCachedSize:
+        size += tlEncodedSize(photoSizeValue.type);
+        size += tlEncodedSize(photoSizeValue.location);
+        size += tlEncodedSize(photoSizeValue.w);
+        size += tlEncodedSize(photoSizeValue.h);
+        size += tlEncodedSize(photoSizeValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPrivacyKey &privacyKeyValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (privacyKeyValue.tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPrivacyRule &privacyRuleValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (privacyRuleValue.tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+    case TLValue::PrivacyValueAllowAll:
+    case TLValue::PrivacyValueDisallowContacts:
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+    case TLValue::PrivacyValueDisallowUsers:
+        size += tlEncodedSize(privacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLReceivedNotifyMessage &receivedNotifyMessageValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (receivedNotifyMessageValue.tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        size += tlEncodedSize(receivedNotifyMessageValue.id);
+        size += tlEncodedSize(receivedNotifyMessageValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLReportReason &reportReasonValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (reportReasonValue.tlType) {
+    case TLValue::InputReportReasonSpam:
+    case TLValue::InputReportReasonViolence:
+    case TLValue::InputReportReasonPornography:
+        break;
+    case TLValue::InputReportReasonOther:
+        size += tlEncodedSize(reportReasonValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLSendMessageAction &sendMessageActionValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (sendMessageActionValue.tlType) {
+    case TLValue::SendMessageTypingAction:
+    case TLValue::SendMessageCancelAction:
+    case TLValue::SendMessageRecordVideoAction:
+    case TLValue::SendMessageRecordAudioAction:
+    case TLValue::SendMessageGeoLocationAction:
+    case TLValue::SendMessageChooseContactAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+    case TLValue::SendMessageUploadAudioAction:
+    case TLValue::SendMessageUploadPhotoAction:
+    case TLValue::SendMessageUploadDocumentAction:
+        size += tlEncodedSize(sendMessageActionValue.progress);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLStickerPack &stickerPackValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (stickerPackValue.tlType) {
+    case TLValue::StickerPack:
+        size += tlEncodedSize(stickerPackValue.emoticon);
+        size += tlEncodedSize(stickerPackValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLStorageFileType &storageFileTypeValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (storageFileTypeValue.tlType) {
+    case TLValue::StorageFileUnknown:
+    case TLValue::StorageFileJpeg:
+    case TLValue::StorageFileGif:
+    case TLValue::StorageFilePng:
+    case TLValue::StorageFilePdf:
+    case TLValue::StorageFileMp3:
+    case TLValue::StorageFileMov:
+    case TLValue::StorageFilePartial:
+    case TLValue::StorageFileMp4:
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUpdatesState &updatesStateValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (updatesStateValue.tlType) {
+    case TLValue::UpdatesState:
+        size += tlEncodedSize(updatesStateValue.pts);
+        size += tlEncodedSize(updatesStateValue.qts);
+        size += tlEncodedSize(updatesStateValue.date);
+        size += tlEncodedSize(updatesStateValue.seq);
+        size += tlEncodedSize(updatesStateValue.unreadCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUploadFile &uploadFileValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (uploadFileValue.tlType) {
+    case TLValue::UploadFile:
+        size += tlEncodedSize(uploadFileValue.type);
+        size += tlEncodedSize(uploadFileValue.mtime);
+        size += tlEncodedSize(uploadFileValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUserProfilePhoto &userProfilePhotoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (userProfilePhotoValue.tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        size += tlEncodedSize(userProfilePhotoValue.photoId);
+        size += tlEncodedSize(userProfilePhotoValue.photoSmall);
+        size += tlEncodedSize(userProfilePhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUserStatus &userStatusValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (userStatusValue.tlType) {
+    case TLValue::UserStatusEmpty:
+    case TLValue::UserStatusRecently:
+    case TLValue::UserStatusLastWeek:
+    case TLValue::UserStatusLastMonth:
+        break;
+    case TLValue::UserStatusOnline:
+        size += tlEncodedSize(userStatusValue.expires);
+        break;
+    case TLValue::UserStatusOffline:
+        size += tlEncodedSize(userStatusValue.wasOnline);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLVideo &videoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (videoValue.tlType) {
+    case TLValue::VideoEmpty:
+        size += tlEncodedSize(videoValue.id);
+        break;
+    case TLValue::Video:
+        size += tlEncodedSize(videoValue.id);
+        size += tlEncodedSize(videoValue.accessHash);
+        size += tlEncodedSize(videoValue.date);
+        size += tlEncodedSize(videoValue.duration);
+        size += tlEncodedSize(videoValue.mimeType);
+        size += tlEncodedSize(videoValue.size);
+        size += tlEncodedSize(videoValue.thumb);
+        size += tlEncodedSize(videoValue.dcId);
+        size += tlEncodedSize(videoValue.w);
+        size += tlEncodedSize(videoValue.h);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLWallPaper &wallPaperValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (wallPaperValue.tlType) {
+    case TLValue::WallPaper:
+        size += tlEncodedSize(wallPaperValue.id);
+        size += tlEncodedSize(wallPaperValue.title);
+        size += tlEncodedSize(wallPaperValue.sizes);
+        size += tlEncodedSize(wallPaperValue.color);
+        break;
+    case TLValue::WallPaperSolid:
+        size += tlEncodedSize(wallPaperValue.id);
+        size += tlEncodedSize(wallPaperValue.title);
+        size += tlEncodedSize(wallPaperValue.bgColor);
+        size += tlEncodedSize(wallPaperValue.color);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAccountAuthorizations &accountAuthorizationsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (accountAuthorizationsValue.tlType) {
+    case TLValue::AccountAuthorizations:
+        size += tlEncodedSize(accountAuthorizationsValue.authorizations);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLBotInlineMessage &botInlineMessageValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (botInlineMessageValue.tlType) {
+    case TLValue::BotInlineMessageMediaAuto:
+        size += tlEncodedSize(botInlineMessageValue.caption);
+        break;
+    case TLValue::BotInlineMessageText:
+        size += tlEncodedSize(botInlineMessageValue.flags);
+        size += tlEncodedSize(botInlineMessageValue.message);
+        if (botInlineMessageValue.flags & 1 << 1) {
+            size += tlEncodedSize(botInlineMessageValue.entities);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChannelMessagesFilter &channelMessagesFilterValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (channelMessagesFilterValue.tlType) {
+    case TLValue::ChannelMessagesFilterEmpty:
+    case TLValue::ChannelMessagesFilterCollapsed:
+        break;
+    case TLValue::ChannelMessagesFilter:
+        size += tlEncodedSize(channelMessagesFilterValue.flags);
+        size += tlEncodedSize(channelMessagesFilterValue.ranges);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChatPhoto &chatPhotoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (chatPhotoValue.tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        size += tlEncodedSize(chatPhotoValue.photoSmall);
+        size += tlEncodedSize(chatPhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactStatus &contactStatusValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactStatusValue.tlType) {
+    case TLValue::ContactStatus:
+        size += tlEncodedSize(contactStatusValue.userId);
+        size += tlEncodedSize(contactStatusValue.status);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLDcOption &dcOptionValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (dcOptionValue.tlType) {
+    case TLValue::DcOption:
+        size += tlEncodedSize(dcOptionValue.flags);
+        size += tlEncodedSize(dcOptionValue.id);
+        size += tlEncodedSize(dcOptionValue.ipAddress);
+        size += tlEncodedSize(dcOptionValue.port);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLDialog &dialogValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (dialogValue.tlType) {
+    case TLValue::Dialog:
+        size += tlEncodedSize(dialogValue.peer);
+        size += tlEncodedSize(dialogValue.topMessage);
+        size += tlEncodedSize(dialogValue.readInboxMaxId);
+        size += tlEncodedSize(dialogValue.unreadCount);
+        size += tlEncodedSize(dialogValue.notifySettings);
+        break;
+    case TLValue::DialogChannel:
+        size += tlEncodedSize(dialogValue.peer);
+        size += tlEncodedSize(dialogValue.topMessage);
+        size += tlEncodedSize(dialogValue.topImportantMessage);
+        size += tlEncodedSize(dialogValue.readInboxMaxId);
+        size += tlEncodedSize(dialogValue.unreadCount);
+        size += tlEncodedSize(dialogValue.unreadImportantCount);
+        size += tlEncodedSize(dialogValue.notifySettings);
+        size += tlEncodedSize(dialogValue.pts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLDocumentAttribute &documentAttributeValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (documentAttributeValue.tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        size += tlEncodedSize(documentAttributeValue.w);
+        size += tlEncodedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAnimated:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        size += tlEncodedSize(documentAttributeValue.alt);
+        size += tlEncodedSize(documentAttributeValue.stickerset);
+        break;
+    case TLValue::DocumentAttributeVideo:
+        size += tlEncodedSize(documentAttributeValue.duration);
+        size += tlEncodedSize(documentAttributeValue.w);
+        size += tlEncodedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAudio:
+        size += tlEncodedSize(documentAttributeValue.duration);
+        size += tlEncodedSize(documentAttributeValue.title);
+        size += tlEncodedSize(documentAttributeValue.performer);
+        break;
+    case TLValue::DocumentAttributeFilename:
+        size += tlEncodedSize(documentAttributeValue.fileName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputBotInlineMessage &inputBotInlineMessageValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputBotInlineMessageValue.tlType) {
+    case TLValue::InputBotInlineMessageMediaAuto:
+        size += tlEncodedSize(inputBotInlineMessageValue.caption);
+        break;
+    case TLValue::InputBotInlineMessageText:
+        size += tlEncodedSize(inputBotInlineMessageValue.flags);
+        size += tlEncodedSize(inputBotInlineMessageValue.message);
+        if (inputBotInlineMessageValue.flags & 1 << 1) {
+            size += tlEncodedSize(inputBotInlineMessageValue.entities);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputBotInlineResult &inputBotInlineResultValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputBotInlineResultValue.tlType) {
+    case TLValue::InputBotInlineResult:
+        size += tlEncodedSize(inputBotInlineResultValue.flags);
+        size += tlEncodedSize(inputBotInlineResultValue.id);
+        size += tlEncodedSize(inputBotInlineResultValue.type);
+        if (inputBotInlineResultValue.flags & 1 << 1) {
+            size += tlEncodedSize(inputBotInlineResultValue.title);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 2) {
+            size += tlEncodedSize(inputBotInlineResultValue.description);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 3) {
+            size += tlEncodedSize(inputBotInlineResultValue.url);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 4) {
+            size += tlEncodedSize(inputBotInlineResultValue.thumbUrl);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 5) {
+            size += tlEncodedSize(inputBotInlineResultValue.contentUrl);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 5) {
+            size += tlEncodedSize(inputBotInlineResultValue.contentType);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 6) {
+            size += tlEncodedSize(inputBotInlineResultValue.w);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 6) {
+            size += tlEncodedSize(inputBotInlineResultValue.h);
+        }
+        if (inputBotInlineResultValue.flags & 1 << 7) {
+            size += tlEncodedSize(inputBotInlineResultValue.duration);
+        }
+        size += tlEncodedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputChatPhoto &inputChatPhotoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputChatPhotoValue.tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        size += tlEncodedSize(inputChatPhotoValue.file);
+        size += tlEncodedSize(inputChatPhotoValue.crop);
+        break;
+    case TLValue::InputChatPhoto:
+        size += tlEncodedSize(inputChatPhotoValue.id);
+        size += tlEncodedSize(inputChatPhotoValue.crop);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputMedia &inputMediaValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputMediaValue.tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        size += tlEncodedSize(inputMediaValue.file);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaPhoto:
+        size += tlEncodedSize(inputMediaValue.inputPhotoId);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaGeoPoint:
+        size += tlEncodedSize(inputMediaValue.geoPoint);
+        break;
+    case TLValue::InputMediaContact:
+        size += tlEncodedSize(inputMediaValue.phoneNumber);
+        size += tlEncodedSize(inputMediaValue.firstName);
+        size += tlEncodedSize(inputMediaValue.lastName);
+        break;
+    case TLValue::InputMediaUploadedVideo:
+        size += tlEncodedSize(inputMediaValue.file);
+        size += tlEncodedSize(inputMediaValue.duration);
+        size += tlEncodedSize(inputMediaValue.w);
+        size += tlEncodedSize(inputMediaValue.h);
+        size += tlEncodedSize(inputMediaValue.mimeType);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaUploadedThumbVideo:
+        size += tlEncodedSize(inputMediaValue.file);
+        size += tlEncodedSize(inputMediaValue.thumb);
+        size += tlEncodedSize(inputMediaValue.duration);
+        size += tlEncodedSize(inputMediaValue.w);
+        size += tlEncodedSize(inputMediaValue.h);
+        size += tlEncodedSize(inputMediaValue.mimeType);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaVideo:
+        size += tlEncodedSize(inputMediaValue.inputVideoId);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaUploadedAudio:
+        size += tlEncodedSize(inputMediaValue.file);
+        size += tlEncodedSize(inputMediaValue.duration);
+        size += tlEncodedSize(inputMediaValue.mimeType);
+        break;
+    case TLValue::InputMediaAudio:
+        size += tlEncodedSize(inputMediaValue.inputAudioId);
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        size += tlEncodedSize(inputMediaValue.file);
+        size += tlEncodedSize(inputMediaValue.mimeType);
+        size += tlEncodedSize(inputMediaValue.attributes);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaUploadedThumbDocument:
+        size += tlEncodedSize(inputMediaValue.file);
+        size += tlEncodedSize(inputMediaValue.thumb);
+        size += tlEncodedSize(inputMediaValue.mimeType);
+        size += tlEncodedSize(inputMediaValue.attributes);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaDocument:
+        size += tlEncodedSize(inputMediaValue.inputDocumentId);
+        size += tlEncodedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaVenue:
+        size += tlEncodedSize(inputMediaValue.geoPoint);
+        size += tlEncodedSize(inputMediaValue.title);
+        size += tlEncodedSize(inputMediaValue.address);
+        size += tlEncodedSize(inputMediaValue.provider);
+        size += tlEncodedSize(inputMediaValue.venueId);
+        break;
+    case TLValue::InputMediaGifExternal:
+        size += tlEncodedSize(inputMediaValue.url);
+        size += tlEncodedSize(inputMediaValue.q);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputNotifyPeer &inputNotifyPeerValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputNotifyPeerValue.tlType) {
+    case TLValue::InputNotifyPeer:
+        size += tlEncodedSize(inputNotifyPeerValue.peer);
+        break;
+    case TLValue::InputNotifyUsers:
+    case TLValue::InputNotifyChats:
+    case TLValue::InputNotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLInputPrivacyRule &inputPrivacyRuleValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (inputPrivacyRuleValue.tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+    case TLValue::InputPrivacyValueAllowAll:
+    case TLValue::InputPrivacyValueDisallowContacts:
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+    case TLValue::InputPrivacyValueDisallowUsers:
+        size += tlEncodedSize(inputPrivacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLNotifyPeer &notifyPeerValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (notifyPeerValue.tlType) {
+    case TLValue::NotifyPeer:
+        size += tlEncodedSize(notifyPeerValue.peer);
+        break;
+    case TLValue::NotifyUsers:
+    case TLValue::NotifyChats:
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPhoto &photoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (photoValue.tlType) {
+    case TLValue::PhotoEmpty:
+        size += tlEncodedSize(photoValue.id);
+        break;
+    case TLValue::Photo:
+        size += tlEncodedSize(photoValue.id);
+        size += tlEncodedSize(photoValue.accessHash);
+        size += tlEncodedSize(photoValue.date);
+        size += tlEncodedSize(photoValue.sizes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLReplyMarkup &replyMarkupValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (replyMarkupValue.tlType) {
+    case TLValue::ReplyKeyboardHide:
+    case TLValue::ReplyKeyboardForceReply:
+        size += tlEncodedSize(replyMarkupValue.flags);
+        break;
+    case TLValue::ReplyKeyboardMarkup:
+        size += tlEncodedSize(replyMarkupValue.flags);
+        size += tlEncodedSize(replyMarkupValue.rows);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLStickerSet &stickerSetValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (stickerSetValue.tlType) {
+    case TLValue::StickerSet:
+        size += tlEncodedSize(stickerSetValue.flags);
+        size += tlEncodedSize(stickerSetValue.id);
+        size += tlEncodedSize(stickerSetValue.accessHash);
+        size += tlEncodedSize(stickerSetValue.title);
+        size += tlEncodedSize(stickerSetValue.shortName);
+        size += tlEncodedSize(stickerSetValue.count);
+        size += tlEncodedSize(stickerSetValue.hash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUser &userValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (userValue.tlType) {
+    case TLValue::UserEmpty:
+        size += tlEncodedSize(userValue.id);
+        break;
+    case TLValue::User:
+        size += tlEncodedSize(userValue.flags);
+        size += tlEncodedSize(userValue.id);
+        if (userValue.flags & 1 << 0) {
+            size += tlEncodedSize(userValue.accessHash);
+        }
+        if (userValue.flags & 1 << 1) {
+            size += tlEncodedSize(userValue.firstName);
+        }
+        if (userValue.flags & 1 << 2) {
+            size += tlEncodedSize(userValue.lastName);
+        }
+        if (userValue.flags & 1 << 3) {
+            size += tlEncodedSize(userValue.username);
+        }
+        if (userValue.flags & 1 << 4) {
+            size += tlEncodedSize(userValue.phone);
+        }
+        if (userValue.flags & 1 << 5) {
+            size += tlEncodedSize(userValue.photo);
+        }
+        if (userValue.flags & 1 << 6) {
+            size += tlEncodedSize(userValue.status);
+        }
+        if (userValue.flags & 1 << 14) {
+            size += tlEncodedSize(userValue.botInfoVersion);
+        }
+        if (userValue.flags & 1 << 18) {
+            size += tlEncodedSize(userValue.restrictionReason);
+        }
+        if (userValue.flags & 1 << 19) {
+            size += tlEncodedSize(userValue.botInlinePlaceholder);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (accountPrivacyRulesValue.tlType) {
+    case TLValue::AccountPrivacyRules:
+        size += tlEncodedSize(accountPrivacyRulesValue.rules);
+        size += tlEncodedSize(accountPrivacyRulesValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLAuthAuthorization &authAuthorizationValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (authAuthorizationValue.tlType) {
+    case TLValue::AuthAuthorization:
+        size += tlEncodedSize(authAuthorizationValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChannelsChannelParticipant &channelsChannelParticipantValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (channelsChannelParticipantValue.tlType) {
+    case TLValue::ChannelsChannelParticipant:
+        size += tlEncodedSize(channelsChannelParticipantValue.participant);
+        size += tlEncodedSize(channelsChannelParticipantValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChannelsChannelParticipants &channelsChannelParticipantsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (channelsChannelParticipantsValue.tlType) {
+    case TLValue::ChannelsChannelParticipants:
+        size += tlEncodedSize(channelsChannelParticipantsValue.count);
+        size += tlEncodedSize(channelsChannelParticipantsValue.participants);
+        size += tlEncodedSize(channelsChannelParticipantsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChat &chatValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (chatValue.tlType) {
+    case TLValue::ChatEmpty:
+        size += tlEncodedSize(chatValue.id);
+        break;
+    case TLValue::Chat:
+        size += tlEncodedSize(chatValue.flags);
+        size += tlEncodedSize(chatValue.id);
+        size += tlEncodedSize(chatValue.title);
+        size += tlEncodedSize(chatValue.photo);
+        size += tlEncodedSize(chatValue.participantsCount);
+        size += tlEncodedSize(chatValue.date);
+        size += tlEncodedSize(chatValue.version);
+        if (chatValue.flags & 1 << 6) {
+            size += tlEncodedSize(chatValue.migratedTo);
+        }
+        break;
+    case TLValue::ChatForbidden:
+        size += tlEncodedSize(chatValue.id);
+        size += tlEncodedSize(chatValue.title);
+        break;
+    case TLValue::Channel:
+        size += tlEncodedSize(chatValue.flags);
+        size += tlEncodedSize(chatValue.id);
+        size += tlEncodedSize(chatValue.accessHash);
+        size += tlEncodedSize(chatValue.title);
+        if (chatValue.flags & 1 << 6) {
+            size += tlEncodedSize(chatValue.username);
+        }
+        size += tlEncodedSize(chatValue.photo);
+        size += tlEncodedSize(chatValue.date);
+        size += tlEncodedSize(chatValue.version);
+        if (chatValue.flags & 1 << 9) {
+            size += tlEncodedSize(chatValue.restrictionReason);
+        }
+        break;
+    case TLValue::ChannelForbidden:
+        size += tlEncodedSize(chatValue.id);
+        size += tlEncodedSize(chatValue.accessHash);
+        size += tlEncodedSize(chatValue.title);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChatFull &chatFullValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (chatFullValue.tlType) {
+    case TLValue::ChatFull:
+        size += tlEncodedSize(chatFullValue.id);
+        size += tlEncodedSize(chatFullValue.participants);
+        size += tlEncodedSize(chatFullValue.chatPhoto);
+        size += tlEncodedSize(chatFullValue.notifySettings);
+        size += tlEncodedSize(chatFullValue.exportedInvite);
+        size += tlEncodedSize(chatFullValue.botInfo);
+        break;
+    case TLValue::ChannelFull:
+        size += tlEncodedSize(chatFullValue.flags);
+        size += tlEncodedSize(chatFullValue.id);
+        size += tlEncodedSize(chatFullValue.about);
+        if (chatFullValue.flags & 1 << 0) {
+            size += tlEncodedSize(chatFullValue.participantsCount);
+        }
+        if (chatFullValue.flags & 1 << 1) {
+            size += tlEncodedSize(chatFullValue.adminsCount);
+        }
+        if (chatFullValue.flags & 1 << 2) {
+            size += tlEncodedSize(chatFullValue.kickedCount);
+        }
+        size += tlEncodedSize(chatFullValue.readInboxMaxId);
+        size += tlEncodedSize(chatFullValue.unreadCount);
+        size += tlEncodedSize(chatFullValue.unreadImportantCount);
+        size += tlEncodedSize(chatFullValue.chatPhoto);
+        size += tlEncodedSize(chatFullValue.notifySettings);
+        size += tlEncodedSize(chatFullValue.exportedInvite);
+        size += tlEncodedSize(chatFullValue.botInfo);
+        if (chatFullValue.flags & 1 << 4) {
+            size += tlEncodedSize(chatFullValue.migratedFromChatId);
+        }
+        if (chatFullValue.flags & 1 << 4) {
+            size += tlEncodedSize(chatFullValue.migratedFromMaxId);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLChatInvite &chatInviteValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (chatInviteValue.tlType) {
+    case TLValue::ChatInviteAlready:
+        size += tlEncodedSize(chatInviteValue.chat);
+        break;
+    case TLValue::ChatInvite:
+        size += tlEncodedSize(chatInviteValue.flags);
+        size += tlEncodedSize(chatInviteValue.title);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLConfig &configValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (configValue.tlType) {
+    case TLValue::Config:
+        size += tlEncodedSize(configValue.date);
+        size += tlEncodedSize(configValue.expires);
+        size += tlEncodedSize(configValue.testMode);
+        size += tlEncodedSize(configValue.thisDc);
+        size += tlEncodedSize(configValue.dcOptions);
+        size += tlEncodedSize(configValue.chatSizeMax);
+        size += tlEncodedSize(configValue.megagroupSizeMax);
+        size += tlEncodedSize(configValue.forwardedCountMax);
+        size += tlEncodedSize(configValue.onlineUpdatePeriodMs);
+        size += tlEncodedSize(configValue.offlineBlurTimeoutMs);
+        size += tlEncodedSize(configValue.offlineIdleTimeoutMs);
+        size += tlEncodedSize(configValue.onlineCloudTimeoutMs);
+        size += tlEncodedSize(configValue.notifyCloudDelayMs);
+        size += tlEncodedSize(configValue.notifyDefaultDelayMs);
+        size += tlEncodedSize(configValue.chatBigSize);
+        size += tlEncodedSize(configValue.pushChatPeriodMs);
+        size += tlEncodedSize(configValue.pushChatLimit);
+        size += tlEncodedSize(configValue.savedGifsLimit);
+        size += tlEncodedSize(configValue.disabledFeatures);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactsBlocked &contactsBlockedValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactsBlockedValue.tlType) {
+    case TLValue::ContactsBlocked:
+        size += tlEncodedSize(contactsBlockedValue.blocked);
+        size += tlEncodedSize(contactsBlockedValue.users);
+        break;
+    case TLValue::ContactsBlockedSlice:
+        size += tlEncodedSize(contactsBlockedValue.count);
+        size += tlEncodedSize(contactsBlockedValue.blocked);
+        size += tlEncodedSize(contactsBlockedValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactsContacts &contactsContactsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactsContactsValue.tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        size += tlEncodedSize(contactsContactsValue.contacts);
+        size += tlEncodedSize(contactsContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactsFound &contactsFoundValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactsFoundValue.tlType) {
+    case TLValue::ContactsFound:
+        size += tlEncodedSize(contactsFoundValue.results);
+        size += tlEncodedSize(contactsFoundValue.chats);
+        size += tlEncodedSize(contactsFoundValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactsImportedContacts &contactsImportedContactsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactsImportedContactsValue.tlType) {
+    case TLValue::ContactsImportedContacts:
+        size += tlEncodedSize(contactsImportedContactsValue.imported);
+        size += tlEncodedSize(contactsImportedContactsValue.retryContacts);
+        size += tlEncodedSize(contactsImportedContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactsLink &contactsLinkValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactsLinkValue.tlType) {
+    case TLValue::ContactsLink:
+        size += tlEncodedSize(contactsLinkValue.myLink);
+        size += tlEncodedSize(contactsLinkValue.foreignLink);
+        size += tlEncodedSize(contactsLinkValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactsResolvedPeer &contactsResolvedPeerValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactsResolvedPeerValue.tlType) {
+    case TLValue::ContactsResolvedPeer:
+        size += tlEncodedSize(contactsResolvedPeerValue.peer);
+        size += tlEncodedSize(contactsResolvedPeerValue.chats);
+        size += tlEncodedSize(contactsResolvedPeerValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLContactsSuggested &contactsSuggestedValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (contactsSuggestedValue.tlType) {
+    case TLValue::ContactsSuggested:
+        size += tlEncodedSize(contactsSuggestedValue.results);
+        size += tlEncodedSize(contactsSuggestedValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLDocument &documentValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (documentValue.tlType) {
+    case TLValue::DocumentEmpty:
+        size += tlEncodedSize(documentValue.id);
+        break;
+    case TLValue::Document:
+        size += tlEncodedSize(documentValue.id);
+        size += tlEncodedSize(documentValue.accessHash);
+        size += tlEncodedSize(documentValue.date);
+        size += tlEncodedSize(documentValue.mimeType);
+        size += tlEncodedSize(documentValue.size);
+        size += tlEncodedSize(documentValue.thumb);
+        size += tlEncodedSize(documentValue.dcId);
+        size += tlEncodedSize(documentValue.attributes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLFoundGif &foundGifValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (foundGifValue.tlType) {
+    case TLValue::FoundGif:
+        size += tlEncodedSize(foundGifValue.url);
+        size += tlEncodedSize(foundGifValue.thumbUrl);
+        size += tlEncodedSize(foundGifValue.contentUrl);
+        size += tlEncodedSize(foundGifValue.contentType);
+        size += tlEncodedSize(foundGifValue.w);
+        size += tlEncodedSize(foundGifValue.h);
+        break;
+    case TLValue::FoundGifCached:
+        size += tlEncodedSize(foundGifValue.url);
+        size += tlEncodedSize(foundGifValue.photo);
+        size += tlEncodedSize(foundGifValue.document);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLHelpSupport &helpSupportValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (helpSupportValue.tlType) {
+    case TLValue::HelpSupport:
+        size += tlEncodedSize(helpSupportValue.phoneNumber);
+        size += tlEncodedSize(helpSupportValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessageAction &messageActionValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messageActionValue.tlType) {
+    case TLValue::MessageActionEmpty:
+    case TLValue::MessageActionChatDeletePhoto:
+        break;
+    case TLValue::MessageActionChatCreate:
+        size += tlEncodedSize(messageActionValue.title);
+        size += tlEncodedSize(messageActionValue.users);
+        break;
+    case TLValue::MessageActionChatEditTitle:
+    case TLValue::MessageActionChannelCreate:
+        size += tlEncodedSize(messageActionValue.title);
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        size += tlEncodedSize(messageActionValue.photo);
+        break;
+    case TLValue::MessageActionChatAddUser:
+        size += tlEncodedSize(messageActionValue.users);
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+        size += tlEncodedSize(messageActionValue.userId);
+        break;
+    case TLValue::MessageActionChatJoinedByLink:
+        size += tlEncodedSize(messageActionValue.inviterId);
+        break;
+    case TLValue::MessageActionChatMigrateTo:
+        size += tlEncodedSize(messageActionValue.channelId);
+        break;
+    case TLValue::MessageActionChannelMigrateFrom:
+        size += tlEncodedSize(messageActionValue.title);
+        size += tlEncodedSize(messageActionValue.chatId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesAllStickers &messagesAllStickersValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesAllStickersValue.tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        size += tlEncodedSize(messagesAllStickersValue.hash);
+        size += tlEncodedSize(messagesAllStickersValue.sets);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesChatFull &messagesChatFullValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesChatFullValue.tlType) {
+    case TLValue::MessagesChatFull:
+        size += tlEncodedSize(messagesChatFullValue.fullChat);
+        size += tlEncodedSize(messagesChatFullValue.chats);
+        size += tlEncodedSize(messagesChatFullValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesChats &messagesChatsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesChatsValue.tlType) {
+    case TLValue::MessagesChats:
+        size += tlEncodedSize(messagesChatsValue.chats);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesFoundGifs &messagesFoundGifsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesFoundGifsValue.tlType) {
+    case TLValue::MessagesFoundGifs:
+        size += tlEncodedSize(messagesFoundGifsValue.nextOffset);
+        size += tlEncodedSize(messagesFoundGifsValue.results);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesSavedGifs &messagesSavedGifsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesSavedGifsValue.tlType) {
+    case TLValue::MessagesSavedGifsNotModified:
+        break;
+    case TLValue::MessagesSavedGifs:
+        size += tlEncodedSize(messagesSavedGifsValue.hash);
+        size += tlEncodedSize(messagesSavedGifsValue.gifs);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesStickerSet &messagesStickerSetValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesStickerSetValue.tlType) {
+    case TLValue::MessagesStickerSet:
+        size += tlEncodedSize(messagesStickerSetValue.set);
+        size += tlEncodedSize(messagesStickerSetValue.packs);
+        size += tlEncodedSize(messagesStickerSetValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesStickers &messagesStickersValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesStickersValue.tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        size += tlEncodedSize(messagesStickersValue.hash);
+        size += tlEncodedSize(messagesStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPhotosPhoto &photosPhotoValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (photosPhotoValue.tlType) {
+    case TLValue::PhotosPhoto:
+        size += tlEncodedSize(photosPhotoValue.photo);
+        size += tlEncodedSize(photosPhotoValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLPhotosPhotos &photosPhotosValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (photosPhotosValue.tlType) {
+    case TLValue::PhotosPhotos:
+        size += tlEncodedSize(photosPhotosValue.photos);
+        size += tlEncodedSize(photosPhotosValue.users);
+        break;
+    case TLValue::PhotosPhotosSlice:
+        size += tlEncodedSize(photosPhotosValue.count);
+        size += tlEncodedSize(photosPhotosValue.photos);
+        size += tlEncodedSize(photosPhotosValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUserFull &userFullValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (userFullValue.tlType) {
+    case TLValue::UserFull:
+        size += tlEncodedSize(userFullValue.user);
+        size += tlEncodedSize(userFullValue.link);
+        size += tlEncodedSize(userFullValue.profilePhoto);
+        size += tlEncodedSize(userFullValue.notifySettings);
+        size += tlEncodedSize(userFullValue.blocked);
+        size += tlEncodedSize(userFullValue.botInfo);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLWebPage &webPageValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (webPageValue.tlType) {
+    case TLValue::WebPageEmpty:
+        size += tlEncodedSize(webPageValue.id);
+        break;
+    case TLValue::WebPagePending:
+        size += tlEncodedSize(webPageValue.id);
+        size += tlEncodedSize(webPageValue.date);
+        break;
+    case TLValue::WebPage:
+        size += tlEncodedSize(webPageValue.flags);
+        size += tlEncodedSize(webPageValue.id);
+        size += tlEncodedSize(webPageValue.url);
+        size += tlEncodedSize(webPageValue.displayUrl);
+        if (webPageValue.flags & 1 << 0) {
+            size += tlEncodedSize(webPageValue.type);
+        }
+        if (webPageValue.flags & 1 << 1) {
+            size += tlEncodedSize(webPageValue.siteName);
+        }
+        if (webPageValue.flags & 1 << 2) {
+            size += tlEncodedSize(webPageValue.title);
+        }
+        if (webPageValue.flags & 1 << 3) {
+            size += tlEncodedSize(webPageValue.description);
+        }
+        if (webPageValue.flags & 1 << 4) {
+            size += tlEncodedSize(webPageValue.photo);
+        }
+        if (webPageValue.flags & 1 << 5) {
+            size += tlEncodedSize(webPageValue.embedUrl);
+        }
+        if (webPageValue.flags & 1 << 5) {
+            size += tlEncodedSize(webPageValue.embedType);
+        }
+        if (webPageValue.flags & 1 << 6) {
+            size += tlEncodedSize(webPageValue.embedWidth);
+        }
+        if (webPageValue.flags & 1 << 6) {
+            size += tlEncodedSize(webPageValue.embedHeight);
+        }
+        if (webPageValue.flags & 1 << 7) {
+            size += tlEncodedSize(webPageValue.duration);
+        }
+        if (webPageValue.flags & 1 << 8) {
+            size += tlEncodedSize(webPageValue.author);
+        }
+        if (webPageValue.flags & 1 << 9) {
+            size += tlEncodedSize(webPageValue.document);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLBotInlineResult &botInlineResultValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (botInlineResultValue.tlType) {
+    case TLValue::BotInlineMediaResultDocument:
+        size += tlEncodedSize(botInlineResultValue.id);
+        size += tlEncodedSize(botInlineResultValue.type);
+        size += tlEncodedSize(botInlineResultValue.document);
+        size += tlEncodedSize(botInlineResultValue.sendMessage);
+        break;
+    case TLValue::BotInlineMediaResultPhoto:
+        size += tlEncodedSize(botInlineResultValue.id);
+        size += tlEncodedSize(botInlineResultValue.type);
+        size += tlEncodedSize(botInlineResultValue.photo);
+        size += tlEncodedSize(botInlineResultValue.sendMessage);
+        break;
+    case TLValue::BotInlineResult:
+        size += tlEncodedSize(botInlineResultValue.flags);
+        size += tlEncodedSize(botInlineResultValue.id);
+        size += tlEncodedSize(botInlineResultValue.type);
+        if (botInlineResultValue.flags & 1 << 1) {
+            size += tlEncodedSize(botInlineResultValue.title);
+        }
+        if (botInlineResultValue.flags & 1 << 2) {
+            size += tlEncodedSize(botInlineResultValue.description);
+        }
+        if (botInlineResultValue.flags & 1 << 3) {
+            size += tlEncodedSize(botInlineResultValue.url);
+        }
+        if (botInlineResultValue.flags & 1 << 4) {
+            size += tlEncodedSize(botInlineResultValue.thumbUrl);
+        }
+        if (botInlineResultValue.flags & 1 << 5) {
+            size += tlEncodedSize(botInlineResultValue.contentUrl);
+        }
+        if (botInlineResultValue.flags & 1 << 5) {
+            size += tlEncodedSize(botInlineResultValue.contentType);
+        }
+        if (botInlineResultValue.flags & 1 << 6) {
+            size += tlEncodedSize(botInlineResultValue.w);
+        }
+        if (botInlineResultValue.flags & 1 << 6) {
+            size += tlEncodedSize(botInlineResultValue.h);
+        }
+        if (botInlineResultValue.flags & 1 << 7) {
+            size += tlEncodedSize(botInlineResultValue.duration);
+        }
+        size += tlEncodedSize(botInlineResultValue.sendMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessageMedia &messageMediaValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messageMediaValue.tlType) {
+    case TLValue::MessageMediaEmpty:
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaPhoto:
+        size += tlEncodedSize(messageMediaValue.photo);
+        size += tlEncodedSize(messageMediaValue.caption);
+        break;
+    case TLValue::MessageMediaVideo:
+        size += tlEncodedSize(messageMediaValue.video);
+        size += tlEncodedSize(messageMediaValue.caption);
+        break;
+    case TLValue::MessageMediaGeo:
+        size += tlEncodedSize(messageMediaValue.geo);
+        break;
+    case TLValue::MessageMediaContact:
+        size += tlEncodedSize(messageMediaValue.phoneNumber);
+        size += tlEncodedSize(messageMediaValue.firstName);
+        size += tlEncodedSize(messageMediaValue.lastName);
+        size += tlEncodedSize(messageMediaValue.userId);
+        break;
+    case TLValue::MessageMediaDocument:
+        size += tlEncodedSize(messageMediaValue.document);
+        size += tlEncodedSize(messageMediaValue.caption);
+        break;
+    case TLValue::MessageMediaAudio:
+        size += tlEncodedSize(messageMediaValue.audio);
+        break;
+    case TLValue::MessageMediaWebPage:
+        size += tlEncodedSize(messageMediaValue.webpage);
+        break;
+    case TLValue::MessageMediaVenue:
+        size += tlEncodedSize(messageMediaValue.geo);
+        size += tlEncodedSize(messageMediaValue.title);
+        size += tlEncodedSize(messageMediaValue.address);
+        size += tlEncodedSize(messageMediaValue.provider);
+        size += tlEncodedSize(messageMediaValue.venueId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesBotResults &messagesBotResultsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesBotResultsValue.tlType) {
+    case TLValue::MessagesBotResults:
+        size += tlEncodedSize(messagesBotResultsValue.flags);
+        size += tlEncodedSize(messagesBotResultsValue.queryId);
+        if (messagesBotResultsValue.flags & 1 << 1) {
+            size += tlEncodedSize(messagesBotResultsValue.nextOffset);
+        }
+        size += tlEncodedSize(messagesBotResultsValue.results);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessage &messageValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messageValue.tlType) {
+    case TLValue::MessageEmpty:
+        size += tlEncodedSize(messageValue.id);
+        break;
+    case TLValue::Message:
+        size += tlEncodedSize(messageValue.flags);
+        size += tlEncodedSize(messageValue.id);
+        if (messageValue.flags & 1 << 8) {
+            size += tlEncodedSize(messageValue.fromId);
+        }
+        size += tlEncodedSize(messageValue.toId);
+        if (messageValue.flags & 1 << 2) {
+            size += tlEncodedSize(messageValue.fwdFromId);
+        }
+        if (messageValue.flags & 1 << 2) {
+            size += tlEncodedSize(messageValue.fwdDate);
+        }
+        if (messageValue.flags & 1 << 11) {
+            size += tlEncodedSize(messageValue.viaBotId);
+        }
+        if (messageValue.flags & 1 << 3) {
+            size += tlEncodedSize(messageValue.replyToMsgId);
+        }
+        size += tlEncodedSize(messageValue.date);
+        size += tlEncodedSize(messageValue.message);
+        if (messageValue.flags & 1 << 9) {
+            size += tlEncodedSize(messageValue.media);
+        }
+        if (messageValue.flags & 1 << 6) {
+            size += tlEncodedSize(messageValue.replyMarkup);
+        }
+        if (messageValue.flags & 1 << 7) {
+            size += tlEncodedSize(messageValue.entities);
+        }
+        if (messageValue.flags & 1 << 10) {
+            size += tlEncodedSize(messageValue.views);
+        }
+        break;
+    case TLValue::MessageService:
+        size += tlEncodedSize(messageValue.flags);
+        size += tlEncodedSize(messageValue.id);
+        if (messageValue.flags & 1 << 8) {
+            size += tlEncodedSize(messageValue.fromId);
+        }
+        size += tlEncodedSize(messageValue.toId);
+        size += tlEncodedSize(messageValue.date);
+        size += tlEncodedSize(messageValue.action);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesDialogs &messagesDialogsValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesDialogsValue.tlType) {
+    case TLValue::MessagesDialogs:
+        size += tlEncodedSize(messagesDialogsValue.dialogs);
+        size += tlEncodedSize(messagesDialogsValue.messages);
+        size += tlEncodedSize(messagesDialogsValue.chats);
+        size += tlEncodedSize(messagesDialogsValue.users);
+        break;
+    case TLValue::MessagesDialogsSlice:
+        size += tlEncodedSize(messagesDialogsValue.count);
+        size += tlEncodedSize(messagesDialogsValue.dialogs);
+        size += tlEncodedSize(messagesDialogsValue.messages);
+        size += tlEncodedSize(messagesDialogsValue.chats);
+        size += tlEncodedSize(messagesDialogsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLMessagesMessages &messagesMessagesValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (messagesMessagesValue.tlType) {
+    case TLValue::MessagesMessages:
+        size += tlEncodedSize(messagesMessagesValue.messages);
+        size += tlEncodedSize(messagesMessagesValue.chats);
+        size += tlEncodedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesMessagesSlice:
+        size += tlEncodedSize(messagesMessagesValue.count);
+        size += tlEncodedSize(messagesMessagesValue.messages);
+        size += tlEncodedSize(messagesMessagesValue.chats);
+        size += tlEncodedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesChannelMessages:
+        size += tlEncodedSize(messagesMessagesValue.flags);
+        size += tlEncodedSize(messagesMessagesValue.pts);
+        size += tlEncodedSize(messagesMessagesValue.count);
+        size += tlEncodedSize(messagesMessagesValue.messages);
+        if (messagesMessagesValue.flags & 1 << 0) {
+            size += tlEncodedSize(messagesMessagesValue.collapsed);
+        }
+        size += tlEncodedSize(messagesMessagesValue.chats);
+        size += tlEncodedSize(messagesMessagesValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUpdate &updateValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (updateValue.tlType) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+        size += tlEncodedSize(updateValue.message);
+        size += tlEncodedSize(updateValue.pts);
+        size += tlEncodedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateMessageID:
+        size += tlEncodedSize(updateValue.id);
+        size += tlEncodedSize(updateValue.randomId);
+        break;
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+        size += tlEncodedSize(updateValue.messages);
+        size += tlEncodedSize(updateValue.pts);
+        size += tlEncodedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateUserTyping:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatUserTyping:
+        size += tlEncodedSize(updateValue.chatId);
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatParticipants:
+        size += tlEncodedSize(updateValue.participants);
+        break;
+    case TLValue::UpdateUserStatus:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.status);
+        break;
+    case TLValue::UpdateUserName:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.firstName);
+        size += tlEncodedSize(updateValue.lastName);
+        size += tlEncodedSize(updateValue.username);
+        break;
+    case TLValue::UpdateUserPhoto:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.date);
+        size += tlEncodedSize(updateValue.photo);
+        size += tlEncodedSize(updateValue.previous);
+        break;
+    case TLValue::UpdateContactRegistered:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.date);
+        break;
+    case TLValue::UpdateContactLink:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.myLink);
+        size += tlEncodedSize(updateValue.foreignLink);
+        break;
+    case TLValue::UpdateNewAuthorization:
+        size += tlEncodedSize(updateValue.authKeyId);
+        size += tlEncodedSize(updateValue.date);
+        size += tlEncodedSize(updateValue.device);
+        size += tlEncodedSize(updateValue.location);
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        size += tlEncodedSize(updateValue.encryptedMessage);
+        size += tlEncodedSize(updateValue.qts);
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+        size += tlEncodedSize(updateValue.chatId);
+        break;
+    case TLValue::UpdateEncryption:
+        size += tlEncodedSize(updateValue.chat);
+        size += tlEncodedSize(updateValue.date);
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+        size += tlEncodedSize(updateValue.chatId);
+        size += tlEncodedSize(updateValue.maxDate);
+        size += tlEncodedSize(updateValue.date);
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        size += tlEncodedSize(updateValue.chatId);
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.inviterId);
+        size += tlEncodedSize(updateValue.date);
+        size += tlEncodedSize(updateValue.version);
+        break;
+    case TLValue::UpdateChatParticipantDelete:
+        size += tlEncodedSize(updateValue.chatId);
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.version);
+        break;
+    case TLValue::UpdateDcOptions:
+        size += tlEncodedSize(updateValue.dcOptions);
+        break;
+    case TLValue::UpdateUserBlocked:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.blocked);
+        break;
+    case TLValue::UpdateNotifySettings:
+        size += tlEncodedSize(updateValue.notifyPeer);
+        size += tlEncodedSize(updateValue.notifySettings);
+        break;
+    case TLValue::UpdateServiceNotification:
+        size += tlEncodedSize(updateValue.type);
+        size += tlEncodedSize(updateValue.stringMessage);
+        size += tlEncodedSize(updateValue.media);
+        size += tlEncodedSize(updateValue.popup);
+        break;
+    case TLValue::UpdatePrivacy:
+        size += tlEncodedSize(updateValue.key);
+        size += tlEncodedSize(updateValue.rules);
+        break;
+    case TLValue::UpdateUserPhone:
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.phone);
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+        size += tlEncodedSize(updateValue.peer);
+        size += tlEncodedSize(updateValue.maxId);
+        size += tlEncodedSize(updateValue.pts);
+        size += tlEncodedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateWebPage:
+        size += tlEncodedSize(updateValue.webpage);
+        size += tlEncodedSize(updateValue.pts);
+        size += tlEncodedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateChannelTooLong:
+    case TLValue::UpdateChannel:
+        size += tlEncodedSize(updateValue.channelId);
+        break;
+    case TLValue::UpdateChannelGroup:
+        size += tlEncodedSize(updateValue.channelId);
+        size += tlEncodedSize(updateValue.group);
+        break;
+    case TLValue::UpdateReadChannelInbox:
+        size += tlEncodedSize(updateValue.channelId);
+        size += tlEncodedSize(updateValue.maxId);
+        break;
+    case TLValue::UpdateDeleteChannelMessages:
+        size += tlEncodedSize(updateValue.channelId);
+        size += tlEncodedSize(updateValue.messages);
+        size += tlEncodedSize(updateValue.pts);
+        size += tlEncodedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateChannelMessageViews:
+        size += tlEncodedSize(updateValue.channelId);
+        size += tlEncodedSize(updateValue.id);
+        size += tlEncodedSize(updateValue.views);
+        break;
+    case TLValue::UpdateChatAdmins:
+        size += tlEncodedSize(updateValue.chatId);
+        size += tlEncodedSize(updateValue.enabled);
+        size += tlEncodedSize(updateValue.version);
+        break;
+    case TLValue::UpdateChatParticipantAdmin:
+        size += tlEncodedSize(updateValue.chatId);
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.isAdmin);
+        size += tlEncodedSize(updateValue.version);
+        break;
+    case TLValue::UpdateNewStickerSet:
+        size += tlEncodedSize(updateValue.stickerset);
+        break;
+    case TLValue::UpdateStickerSetsOrder:
+        size += tlEncodedSize(updateValue.order);
+        break;
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+        break;
+    case TLValue::UpdateBotInlineQuery:
+        size += tlEncodedSize(updateValue.queryId);
+        size += tlEncodedSize(updateValue.userId);
+        size += tlEncodedSize(updateValue.query);
+        size += tlEncodedSize(updateValue.offset);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUpdates &updatesValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (updatesValue.tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        size += tlEncodedSize(updatesValue.flags);
+        size += tlEncodedSize(updatesValue.id);
+        size += tlEncodedSize(updatesValue.userId);
+        size += tlEncodedSize(updatesValue.message);
+        size += tlEncodedSize(updatesValue.pts);
+        size += tlEncodedSize(updatesValue.ptsCount);
+        size += tlEncodedSize(updatesValue.date);
+        if (updatesValue.flags & 1 << 2) {
+            size += tlEncodedSize(updatesValue.fwdFromId);
+        }
+        if (updatesValue.flags & 1 << 2) {
+            size += tlEncodedSize(updatesValue.fwdDate);
+        }
+        if (updatesValue.flags & 1 << 11) {
+            size += tlEncodedSize(updatesValue.viaBotId);
+        }
+        if (updatesValue.flags & 1 << 3) {
+            size += tlEncodedSize(updatesValue.replyToMsgId);
+        }
+        if (updatesValue.flags & 1 << 7) {
+            size += tlEncodedSize(updatesValue.entities);
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        size += tlEncodedSize(updatesValue.flags);
+        size += tlEncodedSize(updatesValue.id);
+        size += tlEncodedSize(updatesValue.fromId);
+        size += tlEncodedSize(updatesValue.chatId);
+        size += tlEncodedSize(updatesValue.message);
+        size += tlEncodedSize(updatesValue.pts);
+        size += tlEncodedSize(updatesValue.ptsCount);
+        size += tlEncodedSize(updatesValue.date);
+        if (updatesValue.flags & 1 << 2) {
+            size += tlEncodedSize(updatesValue.fwdFromId);
+        }
+        if (updatesValue.flags & 1 << 2) {
+            size += tlEncodedSize(updatesValue.fwdDate);
+        }
+        if (updatesValue.flags & 1 << 11) {
+            size += tlEncodedSize(updatesValue.viaBotId);
+        }
+        if (updatesValue.flags & 1 << 3) {
+            size += tlEncodedSize(updatesValue.replyToMsgId);
+        }
+        if (updatesValue.flags & 1 << 7) {
+            size += tlEncodedSize(updatesValue.entities);
+        }
+        break;
+    case TLValue::UpdateShort:
+        size += tlEncodedSize(updatesValue.update);
+        size += tlEncodedSize(updatesValue.date);
+        break;
+    case TLValue::UpdatesCombined:
+        size += tlEncodedSize(updatesValue.updates);
+        size += tlEncodedSize(updatesValue.users);
+        size += tlEncodedSize(updatesValue.chats);
+        size += tlEncodedSize(updatesValue.date);
+        size += tlEncodedSize(updatesValue.seqStart);
+        size += tlEncodedSize(updatesValue.seq);
+        break;
+    case TLValue::Updates:
+        size += tlEncodedSize(updatesValue.updates);
+        size += tlEncodedSize(updatesValue.users);
+        size += tlEncodedSize(updatesValue.chats);
+        size += tlEncodedSize(updatesValue.date);
+        size += tlEncodedSize(updatesValue.seq);
+        break;
+    case TLValue::UpdateShortSentMessage:
+        size += tlEncodedSize(updatesValue.flags);
+        size += tlEncodedSize(updatesValue.id);
+        size += tlEncodedSize(updatesValue.pts);
+        size += tlEncodedSize(updatesValue.ptsCount);
+        size += tlEncodedSize(updatesValue.date);
+        if (updatesValue.flags & 1 << 9) {
+            size += tlEncodedSize(updatesValue.media);
+        }
+        if (updatesValue.flags & 1 << 7) {
+            size += tlEncodedSize(updatesValue.entities);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUpdatesChannelDifference &updatesChannelDifferenceValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (updatesChannelDifferenceValue.tlType) {
+    case TLValue::UpdatesChannelDifferenceEmpty:
+        size += tlEncodedSize(updatesChannelDifferenceValue.flags);
+        size += tlEncodedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & 1 << 1) {
+            size += tlEncodedSize(updatesChannelDifferenceValue.timeout);
+        }
+        break;
+    case TLValue::UpdatesChannelDifferenceTooLong:
+        size += tlEncodedSize(updatesChannelDifferenceValue.flags);
+        size += tlEncodedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & 1 << 1) {
+            size += tlEncodedSize(updatesChannelDifferenceValue.timeout);
+        }
+        size += tlEncodedSize(updatesChannelDifferenceValue.topMessage);
+        size += tlEncodedSize(updatesChannelDifferenceValue.topImportantMessage);
+        size += tlEncodedSize(updatesChannelDifferenceValue.readInboxMaxId);
+        size += tlEncodedSize(updatesChannelDifferenceValue.unreadCount);
+        size += tlEncodedSize(updatesChannelDifferenceValue.unreadImportantCount);
+        size += tlEncodedSize(updatesChannelDifferenceValue.messages);
+        size += tlEncodedSize(updatesChannelDifferenceValue.chats);
+        size += tlEncodedSize(updatesChannelDifferenceValue.users);
+        break;
+    case TLValue::UpdatesChannelDifference:
+        size += tlEncodedSize(updatesChannelDifferenceValue.flags);
+        size += tlEncodedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & 1 << 1) {
+            size += tlEncodedSize(updatesChannelDifferenceValue.timeout);
+        }
+        size += tlEncodedSize(updatesChannelDifferenceValue.newMessages);
+        size += tlEncodedSize(updatesChannelDifferenceValue.otherUpdates);
+        size += tlEncodedSize(updatesChannelDifferenceValue.chats);
+        size += tlEncodedSize(updatesChannelDifferenceValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 tlEncodedSize(const TLUpdatesDifference &updatesDifferenceValue)
+{
+    quint32 size = 4; // tlType
+
+    switch (updatesDifferenceValue.tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        size += tlEncodedSize(updatesDifferenceValue.date);
+        size += tlEncodedSize(updatesDifferenceValue.seq);
+        break;
+    case TLValue::UpdatesDifference:
+        size += tlEncodedSize(updatesDifferenceValue.newMessages);
+        size += tlEncodedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += tlEncodedSize(updatesDifferenceValue.otherUpdates);
+        size += tlEncodedSize(updatesDifferenceValue.chats);
+        size += tlEncodedSize(updatesDifferenceValue.users);
+        size += tlEncodedSize(updatesDifferenceValue.state);
+        break;
+    case TLValue::UpdatesDifferenceSlice:
+        size += tlEncodedSize(updatesDifferenceValue.newMessages);
+        size += tlEncodedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += tlEncodedSize(updatesDifferenceValue.otherUpdates);
+        size += tlEncodedSize(updatesDifferenceValue.chats);
+        size += tlEncodedSize(updatesDifferenceValue.users);
+        size += tlEncodedSize(updatesDifferenceValue.intermediateState);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+// End of generated encoded size implementation
+
 // Generated write operators implementation
 CTelegramStream &CTelegramStream::operator<<(const TLAccountDaysTTL &accountDaysTTLValue)
 {
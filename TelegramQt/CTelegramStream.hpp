@@ -57,6 +57,20 @@ public:
     template <int Size>
     CTelegramStream &operator>>(TLNumber<Size> &n);
 
+    // Skip an encoded value without decoding it
+    template <typename T>
+    void skip();
+    template <typename T>
+    void skipVector();
+    // Read the encoded value as is to decode it later (requires a random-access device)
+    template <typename T>
+    QByteArray readEncoded();
+
+    // Read only the fields which identify the message (the type, flags, id, peers and date) and skip the body
+    CTelegramStream &readMessageHeader(TLMessage *message);
+    // Read the dialogs answer with the headers of the top messages (see readMessageHeader())
+    CTelegramStream &readDialogsPage(TLMessagesDialogs *dialogs);
+
     // Generated read operators
     CTelegramStream &operator>>(TLAccountDaysTTL &accountDaysTTLValue);
     CTelegramStream &operator>>(TLAccountPassword &accountPasswordValue);
@@ -241,20 +255,358 @@ public:
     CTelegramStream &operator<<(const TLInputPrivacyRule &inputPrivacyRuleValue);
     CTelegramStream &operator<<(const TLReplyMarkup &replyMarkupValue);
     // End of generated write operators
+
+protected:
+    bool readVectorLength(quint32 *length);
 };
 
-inline CTelegramStream &CTelegramStream::operator>>(QString &str)
+template <> void CTelegramStream::skip<bool>();
+template <> void CTelegramStream::skip<quint32>();
+template <> void CTelegramStream::skip<quint64>();
+template <> void CTelegramStream::skip<double>();
+template <> void CTelegramStream::skip<QString>();
+template <> void CTelegramStream::skip<QByteArray>();
+template <> void CTelegramStream::skip<TLNumber128>();
+template <> void CTelegramStream::skip<TLNumber256>();
+
+// Generated skip declarations
+template <> void CTelegramStream::skip<TLAccountDaysTTL>();
+template <> void CTelegramStream::skip<TLAccountPassword>();
+template <> void CTelegramStream::skip<TLAccountPasswordInputSettings>();
+template <> void CTelegramStream::skip<TLAccountPasswordSettings>();
+template <> void CTelegramStream::skip<TLAccountSentChangePhoneCode>();
+template <> void CTelegramStream::skip<TLAudio>();
+template <> void CTelegramStream::skip<TLAuthCheckedPhone>();
+template <> void CTelegramStream::skip<TLAuthExportedAuthorization>();
+template <> void CTelegramStream::skip<TLAuthPasswordRecovery>();
+template <> void CTelegramStream::skip<TLAuthSentCode>();
+template <> void CTelegramStream::skip<TLAuthorization>();
+template <> void CTelegramStream::skip<TLBotCommand>();
+template <> void CTelegramStream::skip<TLBotInfo>();
+template <> void CTelegramStream::skip<TLChannelParticipant>();
+template <> void CTelegramStream::skip<TLChannelParticipantRole>();
+template <> void CTelegramStream::skip<TLChannelParticipantsFilter>();
+template <> void CTelegramStream::skip<TLChatParticipant>();
+template <> void CTelegramStream::skip<TLChatParticipants>();
+template <> void CTelegramStream::skip<TLContact>();
+template <> void CTelegramStream::skip<TLContactBlocked>();
+template <> void CTelegramStream::skip<TLContactLink>();
+template <> void CTelegramStream::skip<TLContactSuggested>();
+template <> void CTelegramStream::skip<TLDisabledFeature>();
+template <> void CTelegramStream::skip<TLEncryptedChat>();
+template <> void CTelegramStream::skip<TLEncryptedFile>();
+template <> void CTelegramStream::skip<TLEncryptedMessage>();
+template <> void CTelegramStream::skip<TLError>();
+template <> void CTelegramStream::skip<TLExportedChatInvite>();
+template <> void CTelegramStream::skip<TLFileLocation>();
+template <> void CTelegramStream::skip<TLGeoPoint>();
+template <> void CTelegramStream::skip<TLHelpAppChangelog>();
+template <> void CTelegramStream::skip<TLHelpAppUpdate>();
+template <> void CTelegramStream::skip<TLHelpInviteText>();
+template <> void CTelegramStream::skip<TLHelpTermsOfService>();
+template <> void CTelegramStream::skip<TLImportedContact>();
+template <> void CTelegramStream::skip<TLInputAppEvent>();
+template <> void CTelegramStream::skip<TLInputAudio>();
+template <> void CTelegramStream::skip<TLInputChannel>();
+template <> void CTelegramStream::skip<TLInputContact>();
+template <> void CTelegramStream::skip<TLInputDocument>();
+template <> void CTelegramStream::skip<TLInputEncryptedChat>();
+template <> void CTelegramStream::skip<TLInputEncryptedFile>();
+template <> void CTelegramStream::skip<TLInputFile>();
+template <> void CTelegramStream::skip<TLInputFileLocation>();
+template <> void CTelegramStream::skip<TLInputGeoPoint>();
+template <> void CTelegramStream::skip<TLInputPeer>();
+template <> void CTelegramStream::skip<TLInputPeerNotifyEvents>();
+template <> void CTelegramStream::skip<TLInputPeerNotifySettings>();
+template <> void CTelegramStream::skip<TLInputPhoto>();
+template <> void CTelegramStream::skip<TLInputPhotoCrop>();
+template <> void CTelegramStream::skip<TLInputPrivacyKey>();
+template <> void CTelegramStream::skip<TLInputStickerSet>();
+template <> void CTelegramStream::skip<TLInputUser>();
+template <> void CTelegramStream::skip<TLInputVideo>();
+template <> void CTelegramStream::skip<TLKeyboardButton>();
+template <> void CTelegramStream::skip<TLKeyboardButtonRow>();
+template <> void CTelegramStream::skip<TLMessageEntity>();
+template <> void CTelegramStream::skip<TLMessageGroup>();
+template <> void CTelegramStream::skip<TLMessageRange>();
+template <> void CTelegramStream::skip<TLMessagesAffectedHistory>();
+template <> void CTelegramStream::skip<TLMessagesAffectedMessages>();
+template <> void CTelegramStream::skip<TLMessagesDhConfig>();
+template <> void CTelegramStream::skip<TLMessagesFilter>();
+template <> void CTelegramStream::skip<TLMessagesSentEncryptedMessage>();
+template <> void CTelegramStream::skip<TLNearestDc>();
+template <> void CTelegramStream::skip<TLPeer>();
+template <> void CTelegramStream::skip<TLPeerNotifyEvents>();
+template <> void CTelegramStream::skip<TLPeerNotifySettings>();
+template <> void CTelegramStream::skip<TLPhotoSize>();
+template <> void CTelegramStream::skip<TLPrivacyKey>();
+template <> void CTelegramStream::skip<TLPrivacyRule>();
+template <> void CTelegramStream::skip<TLReceivedNotifyMessage>();
+template <> void CTelegramStream::skip<TLReportReason>();
+template <> void CTelegramStream::skip<TLSendMessageAction>();
+template <> void CTelegramStream::skip<TLStickerPack>();
+template <> void CTelegramStream::skip<TLStorageFileType>();
+template <> void CTelegramStream::skip<TLUpdatesState>();
+template <> void CTelegramStream::skip<TLUploadFile>();
+template <> void CTelegramStream::skip<TLUserProfilePhoto>();
+template <> void CTelegramStream::skip<TLUserStatus>();
+template <> void CTelegramStream::skip<TLVideo>();
+template <> void CTelegramStream::skip<TLWallPaper>();
+template <> void CTelegramStream::skip<TLAccountAuthorizations>();
+template <> void CTelegramStream::skip<TLBotInlineMessage>();
+template <> void CTelegramStream::skip<TLChannelMessagesFilter>();
+template <> void CTelegramStream::skip<TLChatPhoto>();
+template <> void CTelegramStream::skip<TLContactStatus>();
+template <> void CTelegramStream::skip<TLDcOption>();
+template <> void CTelegramStream::skip<TLDialog>();
+template <> void CTelegramStream::skip<TLDocumentAttribute>();
+template <> void CTelegramStream::skip<TLInputBotInlineMessage>();
+template <> void CTelegramStream::skip<TLInputBotInlineResult>();
+template <> void CTelegramStream::skip<TLInputChatPhoto>();
+template <> void CTelegramStream::skip<TLInputMedia>();
+template <> void CTelegramStream::skip<TLInputNotifyPeer>();
+template <> void CTelegramStream::skip<TLInputPrivacyRule>();
+template <> void CTelegramStream::skip<TLNotifyPeer>();
+template <> void CTelegramStream::skip<TLPhoto>();
+template <> void CTelegramStream::skip<TLReplyMarkup>();
+template <> void CTelegramStream::skip<TLStickerSet>();
+template <> void CTelegramStream::skip<TLUser>();
+template <> void CTelegramStream::skip<TLAccountPrivacyRules>();
+template <> void CTelegramStream::skip<TLAuthAuthorization>();
+template <> void CTelegramStream::skip<TLChannelsChannelParticipant>();
+template <> void CTelegramStream::skip<TLChannelsChannelParticipants>();
+template <> void CTelegramStream::skip<TLChat>();
+template <> void CTelegramStream::skip<TLChatFull>();
+template <> void CTelegramStream::skip<TLChatInvite>();
+template <> void CTelegramStream::skip<TLConfig>();
+template <> void CTelegramStream::skip<TLContactsBlocked>();
+template <> void CTelegramStream::skip<TLContactsContacts>();
+template <> void CTelegramStream::skip<TLContactsFound>();
+template <> void CTelegramStream::skip<TLContactsImportedContacts>();
+template <> void CTelegramStream::skip<TLContactsLink>();
+template <> void CTelegramStream::skip<TLContactsResolvedPeer>();
+template <> void CTelegramStream::skip<TLContactsSuggested>();
+template <> void CTelegramStream::skip<TLDocument>();
+template <> void CTelegramStream::skip<TLFoundGif>();
+template <> void CTelegramStream::skip<TLHelpSupport>();
+template <> void CTelegramStream::skip<TLMessageAction>();
+template <> void CTelegramStream::skip<TLMessagesAllStickers>();
+template <> void CTelegramStream::skip<TLMessagesChatFull>();
+template <> void CTelegramStream::skip<TLMessagesChats>();
+template <> void CTelegramStream::skip<TLMessagesFoundGifs>();
+template <> void CTelegramStream::skip<TLMessagesSavedGifs>();
+template <> void CTelegramStream::skip<TLMessagesStickerSet>();
+template <> void CTelegramStream::skip<TLMessagesStickers>();
+template <> void CTelegramStream::skip<TLPhotosPhoto>();
+template <> void CTelegramStream::skip<TLPhotosPhotos>();
+template <> void CTelegramStream::skip<TLUserFull>();
+template <> void CTelegramStream::skip<TLWebPage>();
+template <> void CTelegramStream::skip<TLBotInlineResult>();
+template <> void CTelegramStream::skip<TLMessageMedia>();
+template <> void CTelegramStream::skip<TLMessagesBotResults>();
+template <> void CTelegramStream::skip<TLMessage>();
+template <> void CTelegramStream::skip<TLMessagesDialogs>();
+template <> void CTelegramStream::skip<TLMessagesMessages>();
+template <> void CTelegramStream::skip<TLUpdate>();
+template <> void CTelegramStream::skip<TLUpdates>();
+template <> void CTelegramStream::skip<TLUpdatesChannelDifference>();
+template <> void CTelegramStream::skip<TLUpdatesDifference>();
+// End of generated skip declarations
+
+// Size of the value in the wire format (e.g. to allocate the output buffer once)
+inline quint32 tlEncodedSize(bool) { return 4; }
+inline quint32 tlEncodedSize(quint32) { return 4; }
+inline quint32 tlEncodedSize(quint64) { return 8; }
+inline quint32 tlEncodedSize(double) { return 8; }
+inline quint32 tlEncodedSize(TLValue) { return 4; }
+quint32 tlEncodedSize(const QByteArray &data);
+quint32 tlEncodedSize(const QString &string);
+
+template <int Size>
+inline quint32 tlEncodedSize(const TLNumber<Size> &) { return Size / 8; }
+
+// Generated encoded size declarations
+quint32 tlEncodedSize(const TLAccountDaysTTL &accountDaysTTLValue);
+quint32 tlEncodedSize(const TLAccountPassword &accountPasswordValue);
+quint32 tlEncodedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue);
+quint32 tlEncodedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue);
+quint32 tlEncodedSize(const TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue);
+quint32 tlEncodedSize(const TLAudio &audioValue);
+quint32 tlEncodedSize(const TLAuthCheckedPhone &authCheckedPhoneValue);
+quint32 tlEncodedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue);
+quint32 tlEncodedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue);
+quint32 tlEncodedSize(const TLAuthSentCode &authSentCodeValue);
+quint32 tlEncodedSize(const TLAuthorization &authorizationValue);
+quint32 tlEncodedSize(const TLBotCommand &botCommandValue);
+quint32 tlEncodedSize(const TLBotInfo &botInfoValue);
+quint32 tlEncodedSize(const TLChannelParticipant &channelParticipantValue);
+quint32 tlEncodedSize(const TLChannelParticipantRole &channelParticipantRoleValue);
+quint32 tlEncodedSize(const TLChannelParticipantsFilter &channelParticipantsFilterValue);
+quint32 tlEncodedSize(const TLChatParticipant &chatParticipantValue);
+quint32 tlEncodedSize(const TLChatParticipants &chatParticipantsValue);
+quint32 tlEncodedSize(const TLContact &contactValue);
+quint32 tlEncodedSize(const TLContactBlocked &contactBlockedValue);
+quint32 tlEncodedSize(const TLContactLink &contactLinkValue);
+quint32 tlEncodedSize(const TLContactSuggested &contactSuggestedValue);
+quint32 tlEncodedSize(const TLDisabledFeature &disabledFeatureValue);
+quint32 tlEncodedSize(const TLEncryptedChat &encryptedChatValue);
+quint32 tlEncodedSize(const TLEncryptedFile &encryptedFileValue);
+quint32 tlEncodedSize(const TLEncryptedMessage &encryptedMessageValue);
+quint32 tlEncodedSize(const TLError &errorValue);
+quint32 tlEncodedSize(const TLExportedChatInvite &exportedChatInviteValue);
+quint32 tlEncodedSize(const TLFileLocation &fileLocationValue);
+quint32 tlEncodedSize(const TLGeoPoint &geoPointValue);
+quint32 tlEncodedSize(const TLHelpAppChangelog &helpAppChangelogValue);
+quint32 tlEncodedSize(const TLHelpAppUpdate &helpAppUpdateValue);
+quint32 tlEncodedSize(const TLHelpInviteText &helpInviteTextValue);
+quint32 tlEncodedSize(const TLHelpTermsOfService &helpTermsOfServiceValue);
+quint32 tlEncodedSize(const TLImportedContact &importedContactValue);
+quint32 tlEncodedSize(const TLInputAppEvent &inputAppEventValue);
+quint32 tlEncodedSize(const TLInputAudio &inputAudioValue);
+quint32 tlEncodedSize(const TLInputChannel &inputChannelValue);
+quint32 tlEncodedSize(const TLInputContact &inputContactValue);
+quint32 tlEncodedSize(const TLInputDocument &inputDocumentValue);
+quint32 tlEncodedSize(const TLInputEncryptedChat &inputEncryptedChatValue);
+quint32 tlEncodedSize(const TLInputEncryptedFile &inputEncryptedFileValue);
+quint32 tlEncodedSize(const TLInputFile &inputFileValue);
+quint32 tlEncodedSize(const TLInputFileLocation &inputFileLocationValue);
+quint32 tlEncodedSize(const TLInputGeoPoint &inputGeoPointValue);
+quint32 tlEncodedSize(const TLInputPeer &inputPeerValue);
+quint32 tlEncodedSize(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue);
+quint32 tlEncodedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue);
+quint32 tlEncodedSize(const TLInputPhoto &inputPhotoValue);
+quint32 tlEncodedSize(const TLInputPhotoCrop &inputPhotoCropValue);
+quint32 tlEncodedSize(const TLInputPrivacyKey &inputPrivacyKeyValue);
+quint32 tlEncodedSize(const TLInputStickerSet &inputStickerSetValue);
+quint32 tlEncodedSize(const TLInputUser &inputUserValue);
+quint32 tlEncodedSize(const TLInputVideo &inputVideoValue);
+quint32 tlEncodedSize(const TLKeyboardButton &keyboardButtonValue);
+quint32 tlEncodedSize(const TLKeyboardButtonRow &keyboardButtonRowValue);
+quint32 tlEncodedSize(const TLMessageEntity &messageEntityValue);
+quint32 tlEncodedSize(const TLMessageGroup &messageGroupValue);
+quint32 tlEncodedSize(const TLMessageRange &messageRangeValue);
+quint32 tlEncodedSize(const TLMessagesAffectedHistory &messagesAffectedHistoryValue);
+quint32 tlEncodedSize(const TLMessagesAffectedMessages &messagesAffectedMessagesValue);
+quint32 tlEncodedSize(const TLMessagesDhConfig &messagesDhConfigValue);
+quint32 tlEncodedSize(const TLMessagesFilter &messagesFilterValue);
+quint32 tlEncodedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue);
+quint32 tlEncodedSize(const TLNearestDc &nearestDcValue);
+quint32 tlEncodedSize(const TLPeer &peerValue);
+quint32 tlEncodedSize(const TLPeerNotifyEvents &peerNotifyEventsValue);
+quint32 tlEncodedSize(const TLPeerNotifySettings &peerNotifySettingsValue);
+quint32 tlEncodedSize(const TLPhotoSize &photoSizeValue);
+quint32 tlEncodedSize(const TLPrivacyKey &privacyKeyValue);
+quint32 tlEncodedSize(const TLPrivacyRule &privacyRuleValue);
+quint32 tlEncodedSize(const TLReceivedNotifyMessage &receivedNotifyMessageValue);
+quint32 tlEncodedSize(const TLReportReason &reportReasonValue);
+quint32 tlEncodedSize(const TLSendMessageAction &sendMessageActionValue);
+quint32 tlEncodedSize(const TLStickerPack &stickerPackValue);
+quint32 tlEncodedSize(const TLStorageFileType &storageFileTypeValue);
+quint32 tlEncodedSize(const TLUpdatesState &updatesStateValue);
+quint32 tlEncodedSize(const TLUploadFile &uploadFileValue);
+quint32 tlEncodedSize(const TLUserProfilePhoto &userProfilePhotoValue);
+quint32 tlEncodedSize(const TLUserStatus &userStatusValue);
+quint32 tlEncodedSize(const TLVideo &videoValue);
+quint32 tlEncodedSize(const TLWallPaper &wallPaperValue);
+quint32 tlEncodedSize(const TLAccountAuthorizations &accountAuthorizationsValue);
+quint32 tlEncodedSize(const TLBotInlineMessage &botInlineMessageValue);
+quint32 tlEncodedSize(const TLChannelMessagesFilter &channelMessagesFilterValue);
+quint32 tlEncodedSize(const TLChatPhoto &chatPhotoValue);
+quint32 tlEncodedSize(const TLContactStatus &contactStatusValue);
+quint32 tlEncodedSize(const TLDcOption &dcOptionValue);
+quint32 tlEncodedSize(const TLDialog &dialogValue);
+quint32 tlEncodedSize(const TLDocumentAttribute &documentAttributeValue);
+quint32 tlEncodedSize(const TLInputBotInlineMessage &inputBotInlineMessageValue);
+quint32 tlEncodedSize(const TLInputBotInlineResult &inputBotInlineResultValue);
+quint32 tlEncodedSize(const TLInputChatPhoto &inputChatPhotoValue);
+quint32 tlEncodedSize(const TLInputMedia &inputMediaValue);
+quint32 tlEncodedSize(const TLInputNotifyPeer &inputNotifyPeerValue);
+quint32 tlEncodedSize(const TLInputPrivacyRule &inputPrivacyRuleValue);
+quint32 tlEncodedSize(const TLNotifyPeer &notifyPeerValue);
+quint32 tlEncodedSize(const TLPhoto &photoValue);
+quint32 tlEncodedSize(const TLReplyMarkup &replyMarkupValue);
+quint32 tlEncodedSize(const TLStickerSet &stickerSetValue);
+quint32 tlEncodedSize(const TLUser &userValue);
+quint32 tlEncodedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue);
+quint32 tlEncodedSize(const TLAuthAuthorization &authAuthorizationValue);
+quint32 tlEncodedSize(const TLChannelsChannelParticipant &channelsChannelParticipantValue);
+quint32 tlEncodedSize(const TLChannelsChannelParticipants &channelsChannelParticipantsValue);
+quint32 tlEncodedSize(const TLChat &chatValue);
+quint32 tlEncodedSize(const TLChatFull &chatFullValue);
+quint32 tlEncodedSize(const TLChatInvite &chatInviteValue);
+quint32 tlEncodedSize(const TLConfig &configValue);
+quint32 tlEncodedSize(const TLContactsBlocked &contactsBlockedValue);
+quint32 tlEncodedSize(const TLContactsContacts &contactsContactsValue);
+quint32 tlEncodedSize(const TLContactsFound &contactsFoundValue);
+quint32 tlEncodedSize(const TLContactsImportedContacts &contactsImportedContactsValue);
+quint32 tlEncodedSize(const TLContactsLink &contactsLinkValue);
+quint32 tlEncodedSize(const TLContactsResolvedPeer &contactsResolvedPeerValue);
+quint32 tlEncodedSize(const TLContactsSuggested &contactsSuggestedValue);
+quint32 tlEncodedSize(const TLDocument &documentValue);
+quint32 tlEncodedSize(const TLFoundGif &foundGifValue);
+quint32 tlEncodedSize(const TLHelpSupport &helpSupportValue);
+quint32 tlEncodedSize(const TLMessageAction &messageActionValue);
+quint32 tlEncodedSize(const TLMessagesAllStickers &messagesAllStickersValue);
+quint32 tlEncodedSize(const TLMessagesChatFull &messagesChatFullValue);
+quint32 tlEncodedSize(const TLMessagesChats &messagesChatsValue);
+quint32 tlEncodedSize(const TLMessagesFoundGifs &messagesFoundGifsValue);
+quint32 tlEncodedSize(const TLMessagesSavedGifs &messagesSavedGifsValue);
+quint32 tlEncodedSize(const TLMessagesStickerSet &messagesStickerSetValue);
+quint32 tlEncodedSize(const TLMessagesStickers &messagesStickersValue);
+quint32 tlEncodedSize(const TLPhotosPhoto &photosPhotoValue);
+quint32 tlEncodedSize(const TLPhotosPhotos &photosPhotosValue);
+quint32 tlEncodedSize(const TLUserFull &userFullValue);
+quint32 tlEncodedSize(const TLWebPage &webPageValue);
+quint32 tlEncodedSize(const TLBotInlineResult &botInlineResultValue);
+quint32 tlEncodedSize(const TLMessageMedia &messageMediaValue);
+quint32 tlEncodedSize(const TLMessagesBotResults &messagesBotResultsValue);
+quint32 tlEncodedSize(const TLMessage &messageValue);
+quint32 tlEncodedSize(const TLMessagesDialogs &messagesDialogsValue);
+quint32 tlEncodedSize(const TLMessagesMessages &messagesMessagesValue);
+quint32 tlEncodedSize(const TLUpdate &updateValue);
+quint32 tlEncodedSize(const TLUpdates &updatesValue);
+quint32 tlEncodedSize(const TLUpdatesChannelDifference &updatesChannelDifferenceValue);
+quint32 tlEncodedSize(const TLUpdatesDifference &updatesDifferenceValue);
+// End of generated encoded size declarations
+
+template <typename T>
+quint32 tlEncodedSize(const T *value)
 {
-    QByteArray data;
-    *this >> data;
-    str = QString::fromUtf8(data);
-    return *this;
+    return tlEncodedSize(*value);
 }
 
-inline CTelegramStream &CTelegramStream::operator<<(const QString &str)
+template <typename T>
+quint32 tlEncodedSize(const TLVector<T> &vector)
 {
-    *this << str.toUtf8();
-    return *this;
+    quint32 size = 8; // Vector type and length
+    for (const T &item : vector) {
+        size += tlEncodedSize(item);
+    }
+    return size;
+}
+
+template <typename T>
+CTelegramStream &operator>>(CTelegramStream &stream, TLShared<T> &value)
+{
+    return stream >> value.data();
+}
+
+template <typename T>
+CTelegramStream &operator<<(CTelegramStream &stream, const TLShared<T> &value)
+{
+    return stream << value.value();
+}
+
+inline bool CTelegramStream::readVectorLength(quint32 *length)
+{
+    *this >> *length;
+    // Any encoded item takes at least 4 bytes, so do not trust (and allocate for) a length beyond the data
+    if (*length > static_cast<quint32>(bytesAvailable()) / 4) {
+        setError(true);
+        *length = 0;
+        return false;
+    }
+    return true;
 }
 
 inline CTelegramStream &CTelegramStream::operator>>(bool &data)
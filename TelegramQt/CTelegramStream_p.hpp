@@ -20,46 +20,48 @@
 
 #include "CTelegramStream.hpp"
 
+#include <QIODevice>
+
 template <typename T>
 CTelegramStream &CTelegramStream::operator>>(TLVector<T> &v)
 {
-    TLVector<T> result;
-
-    *this >> result.tlType;
+    v.clear();
+    *this >> v.tlType;
 
-    if (result.tlType == TLValue::Vector) {
+    if (v.tlType == TLValue::Vector) {
         quint32 length = 0;
-        *this >> length;
-        for (quint32 i = 0; i < length; ++i) {
-            T value;
-            *this >> value;
-            result.append(value);
+        if (readVectorLength(&length)) {
+            // Decode the items in place
+            v.resize(static_cast<int>(length));
+            T *items = v.data();
+            for (quint32 i = 0; i < length; ++i) {
+                *this >> items[i];
+            }
         }
     }
 
-    v = result;
     return *this;
 }
 
 template <typename T>
 CTelegramStream &CTelegramStream::operator>>(TLVector<T*> &v)
 {
-    TLVector<T*> result;
-
-    *this >> result.tlType;
+    qDeleteAll(v);
+    v.clear();
+    *this >> v.tlType;
 
-    if (result.tlType == TLValue::Vector) {
+    if (v.tlType == TLValue::Vector) {
         quint32 length = 0;
-        *this >> length;
-        for (quint32 i = 0; i < length; ++i) {
-            T *value = new T;
-            *this >> *value;
-            result.append(value);
+        if (readVectorLength(&length)) {
+            v.reserve(static_cast<int>(length));
+            for (quint32 i = 0; i < length; ++i) {
+                T *value = new T;
+                *this >> *value;
+                v.append(value);
+            }
         }
     }
 
-    qDeleteAll(v);
-    v = result;
     return *this;
 }
 
@@ -95,4 +97,37 @@ CTelegramStream &CTelegramStream::operator<<(const TLVector<T*> &v)
     return *this;
 }
 
+template <typename T>
+void CTelegramStream::skipVector()
+{
+    TLValue type;
+    *this >> type;
+
+    if (type != TLValue::Vector) {
+        return;
+    }
+    quint32 length = 0;
+    if (!readVectorLength(&length)) {
+        return;
+    }
+    for (quint32 i = 0; (i < length) && !error(); ++i) {
+        skip<T>();
+    }
+}
+
+template <typename T>
+QByteArray CTelegramStream::readEncoded()
+{
+    QIODevice *d = device();
+    if (!d || d->isSequential()) {
+        setError(true);
+        return QByteArray();
+    }
+    const qint64 start = d->pos();
+    skip<T>();
+    const qint64 size = d->pos() - start;
+    d->seek(start);
+    return readBytes(static_cast<int>(size));
+}
+
 #endif // TELEGRAM_STREAM_P_HPP
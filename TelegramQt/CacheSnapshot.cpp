@@ -0,0 +1,186 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "CacheSnapshot.hpp"
+
+#include "CTelegramStream.hpp"
+#include "CTelegramStreamExtraOperators.hpp"
+
+#include <QDebug>
+#include <QIODevice>
+
+static const quint32 s_snapshotMagic = 0x54514353; // "SCQT"
+static const quint32 s_snapshotFormatVersion = 3;
+
+// The smallest possible size of a serialized entry. Used to reject corrupted counts before any allocation.
+static const int s_minimumEntrySize = 4;
+
+namespace {
+
+bool readCount(CTelegramStream &stream, int *count)
+{
+    quint32 value = 0;
+    stream >> value;
+    if (stream.error() || (value > quint32(stream.bytesAvailable() / s_minimumEntrySize))) {
+        return false;
+    }
+    *count = static_cast<int>(value);
+    return true;
+}
+
+} // anonymous namespace
+
+CacheSnapshot::CacheSnapshot() :
+    authId(0),
+    maxMessageId(0)
+{
+}
+
+quint32 CacheSnapshot::formatVersion()
+{
+    return s_snapshotFormatVersion;
+}
+
+bool CacheSnapshot::write(QIODevice *device) const
+{
+    if (!device || !device->isWritable()) {
+        qWarning() << Q_FUNC_INFO << "The device is not writable";
+        return false;
+    }
+
+    CTelegramStream stream(device);
+    stream << s_snapshotMagic;
+    stream << s_snapshotFormatVersion;
+    stream << TLValue::CurrentLayer;
+    stream << authId;
+    stream << maxMessageId;
+
+    stream << quint32(users.count());
+    for (const TLUser &user : users) {
+        stream << user;
+    }
+
+    stream << quint32(chats.count());
+    for (const TLChat &chat : chats) {
+        stream << chat;
+    }
+
+    stream << quint32(dialogs.count());
+    for (const Dialog &dialog : dialogs) {
+        stream << dialog.dialog;
+        stream << dialog.date;
+    }
+
+    stream << quint32(contactList.count());
+    for (quint32 userId : contactList) {
+        stream << userId;
+    }
+
+    stream << quint32(recentMessages.count());
+    for (const Message &message : recentMessages) {
+        stream << quint8(message.peer.type);
+        stream << message.peer.id;
+        stream << message.message;
+    }
+
+    return !stream.error();
+}
+
+bool CacheSnapshot::read(QIODevice *device)
+{
+    if (!device || !device->isReadable()) {
+        qWarning() << Q_FUNC_INFO << "The device is not readable";
+        return false;
+    }
+
+    CTelegramStream stream(device);
+    quint32 magic = 0;
+    quint32 format = 0;
+    quint32 layer = 0;
+    stream >> magic;
+    stream >> format;
+    stream >> layer;
+    if (magic != s_snapshotMagic) {
+        qWarning() << Q_FUNC_INFO << "Invalid snapshot data";
+        return false;
+    }
+    if (format != s_snapshotFormatVersion) {
+        // The snapshot is just a cache, so it is fine to drop an incompatible one and sync from scratch.
+        qDebug() << Q_FUNC_INFO << "Unsupported format version" << format;
+        return false;
+    }
+    if (layer != TLValue::CurrentLayer) {
+        // The TL values are stored as is, so they can not be read with another schema
+        qDebug() << Q_FUNC_INFO << "The snapshot is made with another API layer" << layer;
+        return false;
+    }
+
+    stream >> authId;
+    stream >> maxMessageId;
+
+    int count = 0;
+    if (!readCount(stream, &count)) {
+        return false;
+    }
+    users.resize(count);
+    for (TLUser &user : users) {
+        stream >> user;
+    }
+
+    if (!readCount(stream, &count)) {
+        return false;
+    }
+    chats.resize(count);
+    for (TLChat &chat : chats) {
+        stream >> chat;
+    }
+
+    if (!readCount(stream, &count)) {
+        return false;
+    }
+    dialogs.resize(count);
+    for (Dialog &dialog : dialogs) {
+        stream >> dialog.dialog;
+        stream >> dialog.date;
+    }
+
+    if (!readCount(stream, &count)) {
+        return false;
+    }
+    contactList.resize(count);
+    for (quint32 &userId : contactList) {
+        stream >> userId;
+    }
+
+    if (!readCount(stream, &count)) {
+        return false;
+    }
+    recentMessages.resize(count);
+    for (Message &message : recentMessages) {
+        quint8 peerType = 0;
+        stream >> peerType;
+        stream >> message.peer.id;
+        stream >> message.message;
+        message.peer.type = static_cast<Telegram::Peer::Type>(peerType);
+    }
+
+    if (stream.error()) {
+        qWarning() << Q_FUNC_INFO << "Read error occurred";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,60 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef CACHESNAPSHOT_HPP
+#define CACHESNAPSHOT_HPP
+
+#include <QVector>
+
+#include "TLTypes.hpp"
+#include "TelegramNamespace.hpp"
+
+QT_FORWARD_DECLARE_CLASS(QIODevice)
+
+// Versioned binary snapshot of the dispatcher caches, which allows to skip the initial sync on a warm start.
+// The TL values are written with the generated TL operators, so the snapshot follows the schema. A snapshot of
+// another API layer is rejected. The data is streamed, so it can be written to or read from a file directly.
+struct CacheSnapshot
+{
+    struct Dialog {
+        Dialog() : date(0) { }
+        TLDialog dialog;
+        quint32 date;
+    };
+
+    struct Message {
+        Telegram::Peer peer;
+        TLMessage message;
+    };
+
+    CacheSnapshot();
+
+    static quint32 formatVersion();
+
+    bool write(QIODevice *device) const;
+    bool read(QIODevice *device);
+
+    quint64 authId; // The snapshot is valid only for the session with this auth key
+    quint32 maxMessageId;
+    QVector<TLUser> users;
+    QVector<TLChat> chats; // In order of the public chat ids
+    QVector<Dialog> dialogs;
+    QVector<quint32> contactList;
+    QVector<Message> recentMessages; // Most recently used first
+};
+
+#endif // CACHESNAPSHOT_HPP
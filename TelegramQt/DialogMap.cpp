@@ -0,0 +1,225 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "DialogMap.hpp"
+
+#include <algorithm>
+
+static const int s_minimumCapacity = 16;
+
+DialogMap::DialogMap()
+{
+}
+
+TLDialog *DialogMap::find(const Telegram::Peer &peer)
+{
+    const int index = indexOf(peer);
+    if (index < 0) {
+        return nullptr;
+    }
+    return &m_entries[index].dialog;
+}
+
+const TLDialog *DialogMap::find(const Telegram::Peer &peer) const
+{
+    const int index = indexOf(peer);
+    if (index < 0) {
+        return nullptr;
+    }
+    return &m_entries.at(index).dialog;
+}
+
+TLDialog DialogMap::value(const Telegram::Peer &peer) const
+{
+    const TLDialog *dialog = find(peer);
+    if (!dialog) {
+        return TLDialog();
+    }
+    return *dialog;
+}
+
+bool DialogMap::insert(const Telegram::Peer &peer, const TLDialog &dialog, quint32 date)
+{
+    const int index = indexOf(peer);
+    if (index >= 0) {
+        m_entries[index].dialog = dialog;
+        setDate(peer, date);
+        return false;
+    }
+
+    if ((m_entries.count() + 1) * 2 > m_slots.count()) {
+        rehash(qMax(s_minimumCapacity, m_slots.count() * 2));
+    }
+
+    Entry entry;
+    entry.peer = peer;
+    entry.dialog = dialog;
+    entry.date = date;
+    m_entries.append(entry);
+
+    const int newIndex = m_entries.count() - 1;
+    m_slots[findSlot(peer)] = newIndex;
+    addToOrder(newIndex);
+    return true;
+}
+
+bool DialogMap::remove(const Telegram::Peer &peer)
+{
+    int slot = findSlot(peer);
+    if ((slot < 0) || (m_slots.at(slot) < 0)) {
+        return false;
+    }
+    const int index = m_slots.at(slot);
+
+    // Backward shift deletion keeps the probe sequences intact without tombstones
+    const int mask = m_slots.count() - 1;
+    m_slots[slot] = -1;
+    int next = slot;
+    forever {
+        next = (next + 1) & mask;
+        const int nextIndex = m_slots.at(next);
+        if (nextIndex < 0) {
+            break;
+        }
+        const int ideal = qHash(m_entries.at(nextIndex).peer) & mask;
+        const bool keep = (slot <= next) ? ((slot < ideal) && (ideal <= next))
+                                         : ((slot < ideal) || (ideal <= next));
+        if (keep) {
+            continue;
+        }
+        m_slots[slot] = nextIndex;
+        m_slots[next] = -1;
+        slot = next;
+    }
+
+    m_order.remove(orderPosition(index));
+
+    // Move the last entry into the freed place
+    const int lastIndex = m_entries.count() - 1;
+    if (index != lastIndex) {
+        m_order[orderPosition(lastIndex)] = index;
+        m_entries[index] = m_entries.at(lastIndex);
+        m_slots[findSlot(m_entries.at(index).peer)] = index;
+    }
+    m_entries.removeLast();
+    return true;
+}
+
+void DialogMap::clear()
+{
+    m_entries.clear();
+    m_slots.clear();
+    m_order.clear();
+}
+
+void DialogMap::reserve(int size)
+{
+    m_entries.reserve(size);
+    m_order.reserve(size);
+    int capacity = s_minimumCapacity;
+    while (capacity < size * 2) {
+        capacity *= 2;
+    }
+    if (capacity > m_slots.count()) {
+        rehash(capacity);
+    }
+}
+
+quint32 DialogMap::date(const Telegram::Peer &peer) const
+{
+    const int index = indexOf(peer);
+    if (index < 0) {
+        return 0;
+    }
+    return m_entries.at(index).date;
+}
+
+void DialogMap::setDate(const Telegram::Peer &peer, quint32 date)
+{
+    const int index = indexOf(peer);
+    if ((index < 0) || (m_entries.at(index).date == date)) {
+        return;
+    }
+    m_order.remove(orderPosition(index));
+    m_entries[index].date = date;
+    addToOrder(index);
+}
+
+QVector<Telegram::Peer> DialogMap::peers() const
+{
+    QVector<Telegram::Peer> result;
+    result.reserve(m_order.count());
+    for (int index : m_order) {
+        result.append(m_entries.at(index).peer);
+    }
+    return result;
+}
+
+int DialogMap::indexOf(const Telegram::Peer &peer) const
+{
+    const int slot = findSlot(peer);
+    if (slot < 0) {
+        return -1;
+    }
+    return m_slots.at(slot);
+}
+
+int DialogMap::findSlot(const Telegram::Peer &peer) const
+{
+    if (m_slots.isEmpty()) {
+        return -1;
+    }
+    const int mask = m_slots.count() - 1;
+    int slot = qHash(peer) & mask;
+    forever {
+        const int index = m_slots.at(slot);
+        if ((index < 0) || (m_entries.at(index).peer == peer)) {
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+void DialogMap::rehash(int capacity)
+{
+    m_slots.fill(-1, capacity);
+    for (int i = 0; i < m_entries.count(); ++i) {
+        m_slots[findSlot(m_entries.at(i).peer)] = i;
+    }
+}
+
+void DialogMap::addToOrder(int entryIndex)
+{
+    const quint32 date = m_entries.at(entryIndex).date;
+    // Insert after the dialogs with the same date to keep the order stable
+    const auto it = std::upper_bound(m_order.begin(), m_order.end(), date, [this](quint32 d, int index) {
+        return d > m_entries.at(index).date;
+    });
+    m_order.insert(it, entryIndex);
+}
+
+int DialogMap::orderPosition(int entryIndex) const
+{
+    const quint32 date = m_entries.at(entryIndex).date;
+    auto it = std::lower_bound(m_order.constBegin(), m_order.constEnd(), date, [this](int index, quint32 d) {
+        return m_entries.at(index).date > d;
+    });
+    while ((it != m_order.constEnd()) && (*it != entryIndex)) {
+        ++it;
+    }
+    return it - m_order.constBegin();
+}
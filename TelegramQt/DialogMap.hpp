@@ -0,0 +1,74 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef DIALOGMAP_HPP
+#define DIALOGMAP_HPP
+
+#include <QVector>
+
+#include "TLTypes.hpp"
+#include "TelegramNamespace.hpp"
+
+// Flat (open addressing) Peer to TLDialog map, which iterates in order of the top message date (the most recent first).
+class DialogMap
+{
+public:
+    DialogMap();
+
+    int count() const { return m_entries.count(); }
+    bool isEmpty() const { return m_entries.isEmpty(); }
+    bool contains(const Telegram::Peer &peer) const { return indexOf(peer) >= 0; }
+
+    TLDialog *find(const Telegram::Peer &peer);
+    const TLDialog *find(const Telegram::Peer &peer) const;
+    TLDialog value(const Telegram::Peer &peer) const;
+
+    // Returns true if the dialog has been added and false if an existing one has been replaced.
+    bool insert(const Telegram::Peer &peer, const TLDialog &dialog, quint32 date);
+    bool remove(const Telegram::Peer &peer);
+    void clear();
+    void reserve(int size);
+
+    quint32 date(const Telegram::Peer &peer) const;
+    void setDate(const Telegram::Peer &peer, quint32 date);
+
+    // Access in the date order
+    Telegram::Peer peerAt(int i) const { return m_entries.at(m_order.at(i)).peer; }
+    const TLDialog &dialogAt(int i) const { return m_entries.at(m_order.at(i)).dialog; }
+    QVector<Telegram::Peer> peers() const;
+
+protected:
+    struct Entry {
+        Entry() : date(0) { }
+        Telegram::Peer peer;
+        TLDialog dialog;
+        quint32 date;
+    };
+
+    int indexOf(const Telegram::Peer &peer) const;
+    int findSlot(const Telegram::Peer &peer) const;
+    void rehash(int capacity);
+    void addToOrder(int entryIndex);
+    int orderPosition(int entryIndex) const;
+
+    QVector<Entry> m_entries;
+    QVector<int> m_slots; // Entry index or -1 (capacity is a power of two)
+    QVector<int> m_order; // Entry indices, sorted by date
+
+};
+
+#endif // DIALOGMAP_HPP
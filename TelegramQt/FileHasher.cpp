@@ -0,0 +1,91 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include "FileHasher.hpp"
+
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QThreadPool>
+
+class FileHasher::Task : public QRunnable
+{
+public:
+    explicit Task(FileHasher *hasher) : m_hasher(hasher) { }
+    void run() override { m_hasher->process(); }
+
+protected:
+    FileHasher *m_hasher;
+};
+
+FileHasher::FileHasher() :
+    m_hash(QCryptographicHash::Md5),
+    m_running(false)
+{
+}
+
+FileHasher::~FileHasher()
+{
+    QMutexLocker locker(&m_mutex);
+    while (m_running) {
+        m_idle.wait(&m_mutex);
+    }
+}
+
+void FileHasher::addData(const QByteArray &data)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_result.isEmpty()) {
+        return;
+    }
+    m_queue.enqueue(data);
+    if (!m_running) {
+        // There is at most one task at a time, so the parts are hashed in order
+        m_running = true;
+        QThreadPool::globalInstance()->start(new Task(this));
+    }
+}
+
+QByteArray FileHasher::result()
+{
+    QMutexLocker locker(&m_mutex);
+    while (m_running) {
+        m_idle.wait(&m_mutex);
+    }
+    if (m_result.isEmpty()) {
+        m_result = m_hash.result();
+    }
+    return m_result;
+}
+
+void FileHasher::process()
+{
+    forever {
+        QByteArray data;
+        {
+            QMutexLocker locker(&m_mutex);
+            if (m_queue.isEmpty()) {
+                m_running = false;
+                m_idle.wakeAll();
+                return;
+            }
+            data = m_queue.dequeue();
+        }
+        // Only the running task touches m_hash
+        m_hash.addData(data);
+    }
+}
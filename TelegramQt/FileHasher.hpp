@@ -0,0 +1,55 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#ifndef FILEHASHER_HPP
+#define FILEHASHER_HPP
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QMutex>
+#include <QQueue>
+#include <QWaitCondition>
+
+// Incremental MD5 of the data parts added in order. The parts are hashed on the global thread pool,
+// so the caller does not wait for the hashing until result() is requested.
+class FileHasher
+{
+public:
+    FileHasher();
+    ~FileHasher();
+
+    // The data is not copied; a raw data view must stay valid until the hasher is idle.
+    void addData(const QByteArray &data);
+    QByteArray result();
+
+protected:
+    class Task;
+    friend class Task;
+
+    void process();
+
+    QMutex m_mutex;
+    QWaitCondition m_idle;
+    QQueue<QByteArray> m_queue;
+    QCryptographicHash m_hash;
+    QByteArray m_result;
+    bool m_running;
+
+};
+
+#endif // FILEHASHER_HPP
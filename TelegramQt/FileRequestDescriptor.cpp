@@ -18,8 +18,10 @@
 #include "FileRequestDescriptor.hpp"
 #include "Utils.hpp"
 
-#include <QCryptographicHash>
 #include <QDebug>
+#include <QIODevice>
+
+#include <algorithm>
 
 #ifdef DEVELOPER_BUILD
 #include "TLTypesDebug.hpp"
@@ -27,6 +29,24 @@
 
 using namespace Telegram;
 
+static const int s_initialDownloadWindow = 2;
+static const int s_maxDownloadWindow = 8;
+static const quint32 s_maxDownloadPartSize = 512 * 1024; // Server-side limit
+static const quint32 s_maxUploadPartSize = 512 * 1024; // Server-side limit
+static const quint32 s_maxUploadParts = 3000; // Server-side limit
+static const quint32 s_bigFileSize = 10 * 1024 * 1024;
+static const int s_uploadWindow = 4;
+static const int s_maxPartAttempts = 3;
+
+static quint32 uploadPartSize(quint32 fileSize)
+{
+    quint32 partSize = FileRequestDescriptor::defaultDownloadPartSize();
+    while ((partSize < s_maxUploadPartSize) && (fileSize / partSize >= s_maxUploadParts)) {
+        partSize *= 2;
+    }
+    return partSize;
+}
+
 FileRequestDescriptor FileRequestDescriptor::uploadRequest(const QByteArray &data, const QString &fileName, quint32 dc)
 {
     FileRequestDescriptor result;
@@ -34,11 +54,48 @@ FileRequestDescriptor FileRequestDescriptor::uploadRequest(const QByteArray &dat
     result.m_type = Upload;
     result.m_data = data;
     result.m_size = data.size();
+    result.m_chunkSize = uploadPartSize(result.m_size);
     result.m_fileName = fileName;
     result.m_dcId = dc;
 
     if (!result.isBigFile()) {
-        result.m_hash = new QCryptographicHash(QCryptographicHash::Md5);
+        result.m_hasher = QSharedPointer<FileHasher>::create();
+    }
+
+    Utils::randomBytes(&result.m_fileId);
+
+    return result;
+}
+
+FileRequestDescriptor FileRequestDescriptor::uploadRequest(QIODevice *source, const QString &fileName, quint32 dc)
+{
+    if (!source || !source->isReadable()) {
+        qWarning() << Q_FUNC_INFO << "The source device is not readable";
+        return FileRequestDescriptor();
+    }
+
+    if (source->isSequential()) {
+        // The number of parts must be known beforehand
+        return uploadRequest(source->readAll(), fileName, dc);
+    }
+
+    const qint64 size = source->size() - source->pos();
+    if (size > 0xffffffffll) {
+        qWarning() << Q_FUNC_INFO << "The file is too big:" << size;
+        return FileRequestDescriptor();
+    }
+
+    FileRequestDescriptor result;
+
+    result.m_type = Upload;
+    result.m_device = source;
+    result.m_size = size;
+    result.m_chunkSize = uploadPartSize(result.m_size);
+    result.m_fileName = fileName;
+    result.m_dcId = dc;
+
+    if (!result.isBigFile()) {
+        result.m_hasher = QSharedPointer<FileHasher>::create();
     }
 
     Utils::randomBytes(&result.m_fileId);
@@ -69,7 +126,7 @@ TLInputFile FileRequestDescriptor::inputFile() const
         file.tlType = TLValue::InputFileBig;
     } else {
         file.tlType = TLValue::InputFile;
-//        file.md5Checksum = QString::fromLatin1(md5Sum().toHex());
+        file.md5Checksum = QString::fromLatin1(md5Sum().toHex());
     }
 
     file.id = m_fileId;
@@ -83,6 +140,14 @@ TLInputFile FileRequestDescriptor::inputFile() const
     return file;
 }
 
+QByteArray FileRequestDescriptor::md5Sum() const
+{
+    if (!m_hasher || (m_part < parts())) {
+        return QByteArray();
+    }
+    return m_hasher->result();
+}
+
 quint32 FileRequestDescriptor::parts() const
 {
     quint32 parts = m_size / chunkSize();
@@ -95,37 +160,191 @@ quint32 FileRequestDescriptor::parts() const
 
 bool FileRequestDescriptor::isBigFile() const
 {
-    return size() > 10 * 1024 * 1024;
+    return size() > s_bigFileSize;
 }
 
 bool FileRequestDescriptor::finished() const
 {
-    return m_part * chunkSize() >= size();
+    return m_uploadedParts >= parts();
 }
 
-void FileRequestDescriptor::bumpPart()
+bool FileRequestDescriptor::canUploadPart() const
 {
-    if (m_hash) {
-        m_hash->addData(data());
+    if (!m_partsToRetry.isEmpty()) {
+        return true; // The parts to retry are already counted as in flight
+    }
+    return (m_partsInFlight.count() < s_uploadWindow) && (m_part < parts());
+}
+
+bool FileRequestDescriptor::takeNextPart(quint32 *part, QByteArray *data)
+{
+    if (!m_partsToRetry.isEmpty()) {
+        *part = m_partsToRetry.takeFirst();
+        *data = m_partsInFlight.value(*part);
+        return true;
+    }
+
+    if (m_part >= parts()) {
+        return false;
+    }
+
+    const quint32 offset = m_part * chunkSize();
+    const quint32 partSize = qMin(chunkSize(), m_size - offset);
+    if (m_device) {
+        // The parts are read in order, so there is no need to seek
+        *data = m_device->read(partSize);
+        if (quint32(data->size()) != partSize) {
+            qWarning() << Q_FUNC_INFO << "Unable to read the part" << m_part << m_device->errorString();
+            return false;
+        }
+    } else if (!m_data.isEmpty()) {
+        // A view on m_data; it is copied only once, on the package serialization
+        *data = QByteArray::fromRawData(m_data.constData() + offset, partSize);
+    } else {
+        qWarning() << Q_FUNC_INFO << "The source device is gone";
+        return false;
+    }
+
+    if (m_hasher) {
+        m_hasher->addData(*data);
     }
 
+    *part = m_part;
+    m_partsInFlight.insert(m_part, *data);
     ++m_part;
-    m_offset = m_part * chunkSize();
+    return true;
+}
 
-    if (m_offset > m_size) {
-        m_offset = m_size;
+void FileRequestDescriptor::setPartUploaded(quint32 part)
+{
+    const auto it = m_partsInFlight.find(part);
+    if (it == m_partsInFlight.end()) {
+        return;
     }
+    m_offset += it.value().size();
+    m_partsInFlight.erase(it);
+    m_partAttempts.remove(part);
+    m_partsToRetry.removeOne(part);
+    ++m_uploadedParts;
+}
 
-    if (m_hash && finished()) {
-        m_md5Sum = m_hash->result();
-        delete m_hash;
-        m_hash = 0;
+bool FileRequestDescriptor::setPartFailed(quint32 part)
+{
+    if (!m_partsInFlight.contains(part)) {
+        return true;
+    }
+    const int attempts = ++m_partAttempts[part];
+    if (attempts >= s_maxPartAttempts) {
+        return false;
     }
+    if (!m_partsToRetry.contains(part)) {
+        m_partsToRetry.append(part);
+    }
+    return true;
 }
 
-QByteArray FileRequestDescriptor::data() const
+bool FileRequestDescriptor::canRequestChunk() const
 {
-    return m_data.mid(m_part * chunkSize(), chunkSize());
+    if (!m_size) {
+        // The end of the file is unknown, so do not request anything ahead
+        return m_requestedChunks.isEmpty() && m_receivedChunks.isEmpty();
+    }
+    if (m_requestedChunks.count() >= m_window) {
+        return false;
+    }
+    quint32 offset = m_nextRequestOffset;
+    while (m_receivedChunks.contains(offset)) {
+        offset += chunkSize();
+    }
+    return offset < m_size;
+}
+
+quint32 FileRequestDescriptor::takeNextChunkOffset(qint64 time)
+{
+    while (m_receivedChunks.contains(m_nextRequestOffset) || m_requestedChunks.contains(m_nextRequestOffset)) {
+        m_nextRequestOffset += chunkSize();
+    }
+    const quint32 offset = m_nextRequestOffset;
+    m_requestedChunks.insert(offset, time);
+    m_nextRequestOffset += chunkSize();
+    return offset;
+}
+
+bool FileRequestDescriptor::addChunk(quint32 offset, const QByteArray &data, qint64 time)
+{
+    if ((offset < m_offset) || m_receivedChunks.contains(offset)) {
+        return false; // A duplicate
+    }
+    if (offset % chunkSize()) {
+        return false;
+    }
+    m_receivedChunks.insert(offset, data);
+    m_partAttempts.remove(offset);
+
+    const auto it = m_requestedChunks.find(offset);
+    if (it == m_requestedChunks.end()) {
+        // The request was sent before resetChunkRequests()
+        return true;
+    }
+
+    // Keep as many chunks in flight as the bandwidth-delay product allows, plus one to probe for more
+    const qint64 roundTripTime = qMax<qint64>(1, time - it.value());
+    m_requestedChunks.erase(it);
+    if (!m_minRoundTripTime || (roundTripTime < m_minRoundTripTime)) {
+        m_minRoundTripTime = roundTripTime;
+    }
+    if (m_lastChunkTime) {
+        const double sample = double(data.size()) / qMax<qint64>(1, time - m_lastChunkTime);
+        m_throughput = m_throughput ? (m_throughput * 3 + sample) / 4 : sample;
+        const int chunksPerRoundTrip = int(m_throughput * m_minRoundTripTime / chunkSize());
+        m_window = qBound(1, chunksPerRoundTrip + 1, s_maxDownloadWindow);
+    }
+    m_lastChunkTime = time;
+    return true;
+}
+
+bool FileRequestDescriptor::takeReadyChunk(QByteArray *data, quint32 *offset)
+{
+    const auto it = m_receivedChunks.find(m_offset);
+    if (it == m_receivedChunks.end()) {
+        return false;
+    }
+    *offset = m_offset;
+    *data = it.value();
+    m_receivedChunks.erase(it);
+    m_offset += data->size();
+    if (m_nextRequestOffset < m_offset) {
+        m_nextRequestOffset = m_offset;
+    }
+    return true;
+}
+
+bool FileRequestDescriptor::setChunkFailed(quint32 offset)
+{
+    if (!m_requestedChunks.remove(offset)) {
+        return true; // The request was sent before resetChunkRequests()
+    }
+    const int attempts = ++m_partAttempts[offset];
+    if (attempts >= s_maxPartAttempts) {
+        return false;
+    }
+    // The chunk goes first on the next request
+    if (offset < m_nextRequestOffset) {
+        m_nextRequestOffset = offset;
+    }
+    return true;
+}
+
+void FileRequestDescriptor::resetChunkRequests()
+{
+    // The replies to the lost requests (if any) are still accepted by addChunk()
+    m_requestedChunks.clear();
+    m_nextRequestOffset = m_offset;
+    m_lastChunkTime = 0;
+
+    // Send the parts in flight once again
+    m_partsToRetry = QVector<quint32>::fromList(m_partsInFlight.keys());
+    std::sort(m_partsToRetry.begin(), m_partsToRetry.end());
 }
 
 quint32 FileRequestDescriptor::chunkSize() const
@@ -147,14 +366,24 @@ quint32 FileRequestDescriptor::defaultDownloadPartSize()
     return 128 * 256; // Set chunkSize to some big number to get the whole avatar at once
 }
 
+quint32 FileRequestDescriptor::maxDownloadPartSize()
+{
+    return s_maxDownloadPartSize;
+}
+
 FileRequestDescriptor::FileRequestDescriptor() :
     m_type(Invalid),
     m_size(0),
     m_offset(0),
     m_part(0),
     m_chunkSize(0),
+    m_uploadedParts(0),
     m_fileId(0),
-    m_hash(0),
+    m_nextRequestOffset(0),
+    m_window(s_initialDownloadWindow),
+    m_minRoundTripTime(0),
+    m_lastChunkTime(0),
+    m_throughput(0),
     m_dcId(0)
 {
 }
@@ -19,11 +19,16 @@
 #define FILEREQUESTDESCRIPTOR_HPP
 
 #include <QByteArray>
+#include <QHash>
+#include <QMap>
+#include <QPointer>
+#include <QSharedPointer>
 
+#include "FileHasher.hpp"
 #include "TLTypes.hpp"
 #include "TelegramNamespace.hpp"
 
-QT_FORWARD_DECLARE_CLASS(QCryptographicHash)
+QT_FORWARD_DECLARE_CLASS(QIODevice)
 
 class FileRequestDescriptor
 {
@@ -37,6 +42,8 @@ public:
     FileRequestDescriptor();
 
     static FileRequestDescriptor uploadRequest(const QByteArray &data, const QString &fileName, quint32 dc);
+    // The source is read part by part and must stay open until the request is finished.
+    static FileRequestDescriptor uploadRequest(QIODevice *source, const QString &fileName, quint32 dc);
 
     Type type() const { return m_type; }
     void setType(Type type) { m_type = type; }
@@ -56,18 +63,33 @@ public:
 
     void setOffset(quint32 newOffset) { m_offset = newOffset; }
 
+    /* Download stuff */
+    // The chunks are requested ahead of offset() (up to window() requests in flight) and delivered in order.
+    int window() const { return m_window; }
+    int chunksInFlight() const { return m_requestedChunks.count(); }
+    bool canRequestChunk() const;
+    quint32 takeNextChunkOffset(qint64 time);
+    bool addChunk(quint32 offset, const QByteArray &data, qint64 time);
+    bool takeReadyChunk(QByteArray *data, quint32 *offset);
+    bool setChunkFailed(quint32 offset); // Returns false if there is no attempts left
+    void resetChunkRequests();
+
     /* Upload stuff */
     TLInputFile inputFile() const;
     quint32 part() const { return m_part; }
     quint32 parts() const;
-    QByteArray md5Sum() const { return m_md5Sum; }
+    QByteArray md5Sum() const;
     quint64 fileId() const { return m_fileId; }
 
     bool isBigFile() const;
     bool finished() const;
-    void bumpPart();
 
-    QByteArray data() const;
+    // The parts are read on demand and kept in memory only while they are in flight.
+    int partsInFlight() const { return m_partsInFlight.count(); }
+    bool canUploadPart() const;
+    bool takeNextPart(quint32 *part, QByteArray *data);
+    void setPartUploaded(quint32 part);
+    bool setPartFailed(quint32 part); // Returns false if there is no attempts left
 
     quint32 chunkSize() const;
     void setChunkSize(quint32 size);
@@ -75,6 +97,7 @@ public:
     QString uniqueId;
 
     static quint32 defaultDownloadPartSize();
+    static quint32 maxDownloadPartSize();
 
 protected:
     Type m_type;
@@ -83,10 +106,22 @@ protected:
     quint32 m_part;
     quint32 m_chunkSize;
     QByteArray m_data;
-    QByteArray m_md5Sum;
+    QPointer<QIODevice> m_device;
+    quint32 m_uploadedParts;
+    QHash<quint32, QByteArray> m_partsInFlight;
+    QHash<quint32, int> m_partAttempts; // part (or chunk offset), failed attempts
+    QVector<quint32> m_partsToRetry;
     QString m_fileName;
     quint64 m_fileId;
-    QCryptographicHash *m_hash;
+    QSharedPointer<FileHasher> m_hasher; // Declared after m_data, so it is destroyed (and idle) before the data
+
+    quint32 m_nextRequestOffset;
+    int m_window;
+    qint64 m_minRoundTripTime; // (ms)
+    qint64 m_lastChunkTime;
+    double m_throughput; // (bytes per ms)
+    QMap<quint32, qint64> m_requestedChunks; // offset, request time
+    QMap<quint32, QByteArray> m_receivedChunks; // offset, data (received ahead of the offset)
 
     TLInputFileLocation m_inputLocation;
     quint32 m_dcId;
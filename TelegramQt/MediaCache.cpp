@@ -0,0 +1,190 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include "MediaCache.hpp"
+
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <algorithm>
+
+#ifdef Q_OS_WIN
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+static const quint64 s_defaultMaxSize = 256 * 1024 * 1024; // 256 MB
+static const quint32 s_maxFileSize = 1024 * 1024; // Bigger files are stored by the download directory
+
+MediaCache::MediaCache() :
+    m_sequence(0),
+    m_maxSize(s_defaultMaxSize),
+    m_totalSize(0)
+{
+}
+
+bool MediaCache::setDirectory(const QString &path)
+{
+    m_directory.clear();
+    m_entries.clear();
+    m_order.clear();
+    m_totalSize = 0;
+
+    if (path.isEmpty()) {
+        return true;
+    }
+
+    QDir dir(path);
+    if (!dir.mkpath(QLatin1String("."))) {
+        qWarning() << Q_FUNC_INFO << "Unable to create the directory" << path;
+        return false;
+    }
+    m_directory = dir.absolutePath();
+
+    // Restore the usage order from the modification time of the files
+    QFileInfoList files = dir.entryInfoList(QDir::Files, QDir::Time | QDir::Reversed);
+    for (const QFileInfo &file : files) {
+        const QString uniqueId = file.fileName();
+        if (!isValidId(uniqueId)) {
+            continue;
+        }
+        Entry entry;
+        entry.size = file.size();
+        m_totalSize += entry.size;
+        touch(uniqueId, &entry);
+        m_entries.insert(uniqueId, entry);
+    }
+    trim(m_maxSize);
+    return true;
+}
+
+void MediaCache::setMaxSize(quint64 bytes)
+{
+    if (!bytes) {
+        bytes = s_defaultMaxSize;
+    }
+    m_maxSize = bytes;
+    trim(m_maxSize);
+}
+
+quint64 MediaCache::defaultMaxSize()
+{
+    return s_defaultMaxSize;
+}
+
+quint32 MediaCache::maxFileSize()
+{
+    return s_maxFileSize;
+}
+
+QString MediaCache::filePath(const QString &uniqueId) const
+{
+    return m_directory + QLatin1Char('/') + uniqueId;
+}
+
+QByteArray MediaCache::data(const QString &uniqueId)
+{
+    const auto it = m_entries.find(uniqueId);
+    if (it == m_entries.end()) {
+        return QByteArray();
+    }
+
+    QFile file(filePath(uniqueId));
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << Q_FUNC_INFO << "The cached file is gone" << file.fileName();
+        remove(uniqueId);
+        return QByteArray();
+    }
+
+    const QByteArray result = file.readAll();
+    file.close();
+
+    touch(uniqueId, &it.value());
+    // The usage order is restored from the modification time of the files
+    if (::utime(QFile::encodeName(file.fileName()).constData(), nullptr) != 0) {
+        qDebug() << Q_FUNC_INFO << "Unable to update the modification time of" << file.fileName();
+    }
+    return result;
+}
+
+bool MediaCache::insert(const QString &uniqueId, const QByteArray &data)
+{
+    if (!isEnabled() || !isValidId(uniqueId) || (quint32(data.size()) > s_maxFileSize)) {
+        return false;
+    }
+
+    QSaveFile file(filePath(uniqueId));
+    if (!file.open(QIODevice::WriteOnly) || (file.write(data) != data.size()) || !file.commit()) {
+        qWarning() << Q_FUNC_INFO << "Unable to write" << file.fileName() << file.errorString();
+        return false;
+    }
+
+    Entry &entry = m_entries[uniqueId];
+    m_totalSize -= entry.size;
+    entry.size = data.size();
+    m_totalSize += entry.size;
+    touch(uniqueId, &entry);
+
+    // Keep at least the just inserted file
+    trim(qMax<quint64>(m_maxSize, entry.size));
+    return true;
+}
+
+bool MediaCache::remove(const QString &uniqueId)
+{
+    const auto it = m_entries.find(uniqueId);
+    if (it == m_entries.end()) {
+        return false;
+    }
+    m_order.remove(it.value().sequence);
+    m_totalSize -= it.value().size;
+    m_entries.erase(it);
+    QFile::remove(filePath(uniqueId));
+    return true;
+}
+
+bool MediaCache::isValidId(const QString &uniqueId)
+{
+    // The unique ids are hex strings; reject anything else to never touch an unrelated file
+    if (uniqueId.isEmpty()) {
+        return false;
+    }
+    return std::all_of(uniqueId.constBegin(), uniqueId.constEnd(), [](const QChar &c) {
+        return ((c >= QLatin1Char('0')) && (c <= QLatin1Char('9'))) || ((c >= QLatin1Char('a')) && (c <= QLatin1Char('f')));
+    });
+}
+
+void MediaCache::touch(const QString &uniqueId, Entry *entry)
+{
+    if (entry->sequence) {
+        m_order.remove(entry->sequence);
+    }
+    entry->sequence = ++m_sequence;
+    m_order.insert(entry->sequence, uniqueId);
+}
+
+void MediaCache::trim(quint64 budget)
+{
+    while (!m_order.isEmpty() && (m_totalSize > budget)) {
+        remove(m_order.first());
+    }
+}
@@ -0,0 +1,73 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#ifndef MEDIACACHE_HPP
+#define MEDIACACHE_HPP
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+
+// Size-bounded disk cache of downloaded files, keyed by the RemoteFile unique id (which identifies the file content).
+// The least recently used files are removed when the total size exceeds the limit.
+class MediaCache
+{
+public:
+    MediaCache();
+
+    QString directory() const { return m_directory; }
+    bool setDirectory(const QString &path);
+    bool isEnabled() const { return !m_directory.isEmpty(); }
+
+    quint64 maxSize() const { return m_maxSize; }
+    void setMaxSize(quint64 bytes);
+    quint64 totalSize() const { return m_totalSize; }
+
+    static quint64 defaultMaxSize();
+    static quint32 maxFileSize();
+
+    int count() const { return m_entries.count(); }
+    bool contains(const QString &uniqueId) const { return m_entries.contains(uniqueId); }
+    QString filePath(const QString &uniqueId) const;
+
+    // Reads the file and marks it as recently used (the modification time is updated as well).
+    QByteArray data(const QString &uniqueId);
+    bool insert(const QString &uniqueId, const QByteArray &data);
+    bool remove(const QString &uniqueId);
+
+protected:
+    struct Entry {
+        Entry() : size(0), sequence(0) { }
+        quint64 size;
+        quint64 sequence;
+    };
+
+    static bool isValidId(const QString &uniqueId);
+    void touch(const QString &uniqueId, Entry *entry);
+    void trim(quint64 budget);
+
+    QString m_directory;
+    QHash<QString, Entry> m_entries;
+    QMap<quint64, QString> m_order; // Access sequence number, unique id (the least recently used first)
+    quint64 m_sequence;
+    quint64 m_maxSize;
+    quint64 m_totalSize;
+
+};
+
+#endif // MEDIACACHE_HPP
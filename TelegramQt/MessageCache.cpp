@@ -0,0 +1,247 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "MessageCache.hpp"
+
+static const quint32 s_defaultMaxCost = 8 * 1024 * 1024; // 8 MB
+static const int s_maxEvictedKeys = 4096;
+
+MessageCache::MessageCache() :
+    m_first(nullptr),
+    m_last(nullptr),
+    m_maxCost(s_defaultMaxCost),
+    m_totalCost(0),
+    m_evictionSerial(0)
+{
+}
+
+MessageCache::~MessageCache()
+{
+    clear();
+}
+
+quint32 MessageCache::defaultMaxCost()
+{
+    return s_defaultMaxCost;
+}
+
+int MessageCache::maxEvictedKeys()
+{
+    return s_maxEvictedKeys;
+}
+
+void MessageCache::setMaxCost(quint32 bytes)
+{
+    if (!bytes) {
+        bytes = s_defaultMaxCost;
+    }
+    m_maxCost = bytes;
+    trim(m_maxCost);
+}
+
+void MessageCache::insert(const Telegram::Peer &peer, const TLMessage &message)
+{
+    const Key key(peer, message.id);
+    const quint32 cost = estimateCost(message);
+
+    removeEvictedKey(key);
+
+    Node *node = m_nodes.value(key);
+    if (node) {
+        m_totalCost -= node->cost;
+        node->message = message;
+        node->cost = cost;
+        unlink(node);
+    } else {
+        node = new Node();
+        node->key = key;
+        node->message = message;
+        node->cost = cost;
+        m_nodes.insert(key, node);
+    }
+    m_totalCost += cost;
+    pushFront(node);
+
+    // Keep at least the just inserted message, even if it does not fit into the budget.
+    trim(qMax(m_maxCost, cost));
+}
+
+const TLMessage *MessageCache::object(const Telegram::Peer &peer, quint32 messageId) const
+{
+    Node *node = m_nodes.value(Key(peer, messageId));
+    if (!node) {
+        return nullptr;
+    }
+    if (node != m_first) {
+        unlink(node);
+        pushFront(node);
+    }
+    return &node->message;
+}
+
+bool MessageCache::contains(const Telegram::Peer &peer, quint32 messageId) const
+{
+    return m_nodes.contains(Key(peer, messageId));
+}
+
+bool MessageCache::remove(const Telegram::Peer &peer, quint32 messageId)
+{
+    const Key key(peer, messageId);
+    removeEvictedKey(key);
+    Node *node = m_nodes.take(key);
+    if (!node) {
+        return false;
+    }
+    unlink(node);
+    m_totalCost -= node->cost;
+    delete node;
+    return true;
+}
+
+bool MessageCache::isEvicted(const Telegram::Peer &peer, quint32 messageId) const
+{
+    return m_evictedKeys.contains(Key(peer, messageId));
+}
+
+bool MessageCache::takeEvicted(const Telegram::Peer &peer, quint32 messageId)
+{
+    return removeEvictedKey(Key(peer, messageId));
+}
+
+void MessageCache::markEvicted(const Key &key)
+{
+    if (!m_nodes.contains(key)) {
+        addEvictedKey(key);
+    }
+}
+
+QVector<MessageCache::Key> MessageCache::keys() const
+{
+    QVector<Key> result;
+    result.reserve(m_nodes.count());
+    for (const Node *node = m_first; node; node = node->next) {
+        result.append(node->key);
+    }
+    return result;
+}
+
+QVector<TLMessage> MessageCache::messages() const
+{
+    QVector<TLMessage> result;
+    result.reserve(m_nodes.count());
+    for (const Node *node = m_first; node; node = node->next) {
+        result.append(node->message);
+    }
+    return result;
+}
+
+void MessageCache::clear()
+{
+    qDeleteAll(m_nodes);
+    m_nodes.clear();
+    m_evictedKeys.clear();
+    m_evictedOrder.clear();
+    m_first = nullptr;
+    m_last = nullptr;
+    m_totalCost = 0;
+}
+
+quint32 MessageCache::estimateCost(const TLMessage &message)
+{
+    quint32 cost = sizeof(Node) + sizeof(Key) * 2; // The node and the hash entry
+    cost += message.message.size() * sizeof(QChar);
+    cost += message.entities.size() * sizeof(TLMessageEntity);
+    cost += message.replyMarkup.rows.size() * sizeof(TLKeyboardButtonRow);
+
+    const TLMessageMedia &media = message.media;
+    cost += media.caption.size() * sizeof(QChar);
+    cost += media.photo.sizes.size() * sizeof(TLPhotoSize);
+    cost += media.document.attributes.size() * sizeof(TLDocumentAttribute);
+    cost += (media.webpage.url.size() + media.webpage.displayUrl.size()
+             + media.webpage.title.size() + media.webpage.description.size()) * sizeof(QChar);
+    for (const TLPhotoSize &size : media.photo.sizes) {
+        cost += size.bytes.size();
+    }
+    cost += media.document.thumb.bytes.size();
+    cost += media.video.thumb.bytes.size();
+    return cost;
+}
+
+void MessageCache::unlink(Node *node) const
+{
+    if (node->previous) {
+        node->previous->next = node->next;
+    } else {
+        m_first = node->next;
+    }
+    if (node->next) {
+        node->next->previous = node->previous;
+    } else {
+        m_last = node->previous;
+    }
+    node->previous = nullptr;
+    node->next = nullptr;
+}
+
+void MessageCache::pushFront(Node *node) const
+{
+    node->previous = nullptr;
+    node->next = m_first;
+    if (m_first) {
+        m_first->previous = node;
+    }
+    m_first = node;
+    if (!m_last) {
+        m_last = node;
+    }
+}
+
+void MessageCache::trim(quint32 budget)
+{
+    while (m_last && (m_totalCost > budget)) {
+        Node *node = m_last;
+        unlink(node);
+        m_nodes.remove(node->key);
+        addEvictedKey(node->key);
+        m_totalCost -= node->cost;
+        delete node;
+    }
+}
+
+void MessageCache::addEvictedKey(const Key &key)
+{
+    removeEvictedKey(key);
+    const quint32 serial = ++m_evictionSerial;
+    m_evictedKeys.insert(key, serial);
+    m_evictedOrder.insert(serial, key);
+
+    // Forget the oldest evictions
+    while (m_evictedKeys.count() > s_maxEvictedKeys) {
+        m_evictedKeys.remove(m_evictedOrder.take(m_evictedOrder.firstKey()));
+    }
+}
+
+bool MessageCache::removeEvictedKey(const Key &key)
+{
+    const auto it = m_evictedKeys.find(key);
+    if (it == m_evictedKeys.end()) {
+        return false;
+    }
+    m_evictedOrder.remove(it.value());
+    m_evictedKeys.erase(it);
+    return true;
+}
@@ -0,0 +1,111 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef MESSAGECACHE_HPP
+#define MESSAGECACHE_HPP
+
+#include <QHash>
+#include <QMap>
+#include <QVector>
+
+#include "TLTypes.hpp"
+#include "TelegramNamespace.hpp"
+
+// LRU cache of TLMessage keyed by (peer, message id) with a memory budget (in bytes).
+class MessageCache
+{
+public:
+    struct Key {
+        Key(const Telegram::Peer &p = Telegram::Peer(), quint32 messageId = 0) : peer(p), id(messageId) { }
+
+        Telegram::Peer peer;
+        quint32 id;
+
+        bool operator==(const Key &key) const
+        {
+            return (key.id == id) && (key.peer == peer);
+        }
+    };
+
+    MessageCache();
+    ~MessageCache();
+
+    static quint32 defaultMaxCost();
+
+    quint32 maxCost() const { return m_maxCost; }
+    void setMaxCost(quint32 bytes);
+    quint32 totalCost() const { return m_totalCost; }
+    int count() const { return m_nodes.count(); }
+
+    void insert(const Telegram::Peer &peer, const TLMessage &message);
+    const TLMessage *object(const Telegram::Peer &peer, quint32 messageId) const;
+    bool contains(const Telegram::Peer &peer, quint32 messageId) const;
+    bool remove(const Telegram::Peer &peer, quint32 messageId);
+
+    // Returns true if the message was in the cache, but has been evicted to fit the budget.
+    // Only the last maxEvictedKeys() evicted messages are remembered.
+    bool isEvicted(const Telegram::Peer &peer, quint32 messageId) const;
+    // Returns true (once) if the message is evicted.
+    bool takeEvicted(const Telegram::Peer &peer, quint32 messageId);
+    // Marks the message as evicted, so it would be refetched on the first access (e.g. after a cache restore).
+    void markEvicted(const Key &key);
+    int evictedCount() const { return m_evictedKeys.count(); }
+
+    static int maxEvictedKeys();
+
+    QVector<Key> keys() const; // Most recently used first
+    QVector<TLMessage> messages() const; // In the order of keys()
+
+    void clear();
+
+    static quint32 estimateCost(const TLMessage &message);
+
+protected:
+    struct Node {
+        Key key;
+        TLMessage message;
+        quint32 cost;
+        Node *previous;
+        Node *next;
+    };
+
+    void unlink(Node *node) const;
+    void pushFront(Node *node) const;
+    void trim(quint32 budget);
+    void addEvictedKey(const Key &key);
+    bool removeEvictedKey(const Key &key);
+
+    QHash<Key, Node*> m_nodes;
+    QHash<Key, quint32> m_evictedKeys; // key, eviction serial
+    QMap<quint32, Key> m_evictedOrder; // eviction serial, key (the oldest first)
+    mutable Node *m_first; // Most recently used
+    mutable Node *m_last; // Least recently used
+    quint32 m_maxCost;
+    quint32 m_totalCost;
+    quint32 m_evictionSerial;
+
+private:
+    Q_DISABLE_COPY(MessageCache)
+
+};
+
+inline uint qHash(const MessageCache::Key &key, uint seed)
+{
+    return Telegram::qHash(key.peer, seed) ^ key.id;
+}
+
+#endif // MESSAGECACHE_HPP
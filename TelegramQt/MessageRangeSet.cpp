@@ -0,0 +1,67 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "MessageRangeSet.hpp"
+
+#include <algorithm>
+
+void MessageRangeSet::insert(quint32 first, quint32 last)
+{
+    if (first > last) {
+        std::swap(first, last);
+    }
+
+    // The first range which is not entirely before the new one (adjacent ranges are merged too)
+    int begin = lowerBound(first ? first - 1 : 0);
+    int end = begin;
+    while ((end < m_ranges.count()) && ((last == 0xffffffffu) || (m_ranges.at(end).first <= last + 1))) {
+        first = qMin(first, m_ranges.at(end).first);
+        last = qMax(last, m_ranges.at(end).last);
+        ++end;
+    }
+
+    if (begin == end) {
+        m_ranges.insert(begin, Range(first, last));
+        return;
+    }
+    m_ranges[begin] = Range(first, last);
+    m_ranges.remove(begin + 1, end - begin - 1);
+}
+
+bool MessageRangeSet::contains(quint32 id) const
+{
+    const int index = lowerBound(id);
+    return (index < m_ranges.count()) && (m_ranges.at(index).first <= id);
+}
+
+MessageRangeSet::Range MessageRangeSet::rangeOf(quint32 id) const
+{
+    const int index = lowerBound(id);
+    if ((index < m_ranges.count()) && (m_ranges.at(index).first <= id)) {
+        return m_ranges.at(index);
+    }
+    return Range();
+}
+
+// Index of the first range which ends at or after the id
+int MessageRangeSet::lowerBound(quint32 id) const
+{
+    const auto it = std::lower_bound(m_ranges.constBegin(), m_ranges.constEnd(), id, [](const Range &range, quint32 value) {
+        return range.last < value;
+    });
+    return it - m_ranges.constBegin();
+}
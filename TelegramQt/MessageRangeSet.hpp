@@ -0,0 +1,52 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef MESSAGERANGESET_HPP
+#define MESSAGERANGESET_HPP
+
+#include <QVector>
+
+// Set of message id ranges (closed intervals), which are kept sorted, disjoint and not adjacent.
+class MessageRangeSet
+{
+public:
+    struct Range {
+        Range(quint32 f = 0, quint32 l = 0) : first(f), last(l) { }
+        quint32 first;
+        quint32 last;
+    };
+
+    bool isEmpty() const { return m_ranges.isEmpty(); }
+    int count() const { return m_ranges.count(); }
+    const Range &at(int i) const { return m_ranges.at(i); }
+
+    void insert(quint32 first, quint32 last);
+    bool contains(quint32 id) const;
+    // Returns the range that contains the id or an empty (0, 0) range.
+    Range rangeOf(quint32 id) const;
+    void clear() { m_ranges.clear(); }
+
+protected:
+    int lowerBound(quint32 id) const;
+
+    QVector<Range> m_ranges;
+
+};
+
+Q_DECLARE_TYPEINFO(MessageRangeSet::Range, Q_PRIMITIVE_TYPE);
+
+#endif // MESSAGERANGESET_HPP
@@ -0,0 +1,277 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include "PartialFile.hpp"
+
+#include "CRawStream.hpp"
+
+#include <QDebug>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+static const quint32 s_indexMagic = 0x46505154; // "TQPF"
+static const quint32 s_indexFormatVersion = 1;
+
+// Each sync blocks the thread, so it is done once per a few chunks rather than for each one
+static const int s_syncChunks = 16;
+static const qint64 s_syncInterval = 2000; // ms
+
+// QFile::flush() only passes the data to the system; sync it to the disk.
+static bool syncFile(QFile *file)
+{
+#ifdef Q_OS_WIN
+    return _commit(file->handle()) == 0;
+#else
+    return ::fsync(file->handle()) == 0;
+#endif
+}
+
+PartialFile::PartialFile(const QString &filePath) :
+    m_filePath(filePath),
+    m_size(0),
+    m_finished(false),
+    m_unsyncedChunks(0)
+{
+}
+
+PartialFile::~PartialFile()
+{
+    close();
+}
+
+QString PartialFile::dataFilePath() const
+{
+    return m_filePath + QLatin1String(".part");
+}
+
+QString PartialFile::indexFilePath() const
+{
+    return m_filePath + QLatin1String(".part.index");
+}
+
+bool PartialFile::open(quint32 size)
+{
+    if (!size) {
+        return false;
+    }
+
+    m_size = size;
+    m_ranges.clear();
+    m_finished = false;
+    m_unsyncedChunks = 0;
+    m_syncTimer.start();
+
+    if (!QFile::exists(dataFilePath()) && (QFileInfo(m_filePath).size() == m_size)) {
+        m_file.setFileName(m_filePath);
+        if (m_file.open(QIODevice::ReadOnly)) {
+            m_ranges.insert(0, m_size - 1);
+            m_finished = true;
+            return true;
+        }
+    }
+
+    m_file.setFileName(dataFilePath());
+
+    if (!m_file.exists() || !readIndex()) {
+        // Start from scratch
+        m_ranges.clear();
+        QFile::remove(indexFilePath());
+        if (!m_file.open(QIODevice::ReadWrite | QIODevice::Truncate)) {
+            qWarning() << Q_FUNC_INFO << "Unable to open" << m_file.fileName() << m_file.errorString();
+            return false;
+        }
+    } else if (!m_file.open(QIODevice::ReadWrite)) {
+        qWarning() << Q_FUNC_INFO << "Unable to open" << m_file.fileName() << m_file.errorString();
+        return false;
+    }
+
+    // The file is sparse on the file systems which support it
+    if ((m_file.size() != m_size) && !m_file.resize(m_size)) {
+        qWarning() << Q_FUNC_INFO << "Unable to resize" << m_file.fileName() << m_file.errorString();
+        m_file.close();
+        return false;
+    }
+    return true;
+}
+
+void PartialFile::close()
+{
+    if (m_file.isOpen() && m_unsyncedChunks) {
+        sync();
+    }
+    m_file.close();
+}
+
+quint32 PartialFile::completedPrefix() const
+{
+    if (m_ranges.isEmpty() || (m_ranges.at(0).first != 0)) {
+        return 0;
+    }
+    return m_ranges.at(0).last + 1;
+}
+
+bool PartialFile::isComplete() const
+{
+    return m_size && (completedPrefix() >= m_size);
+}
+
+bool PartialFile::write(quint32 offset, const QByteArray &data)
+{
+    if (!m_file.isOpen() || m_finished) {
+        return false;
+    }
+    if (data.isEmpty()) {
+        return true;
+    }
+    if (quint64(offset) + data.size() > m_size) {
+        qWarning() << Q_FUNC_INFO << "The chunk is out of the file" << offset << data.size() << m_size;
+        return false;
+    }
+    if (!m_file.seek(offset) || (m_file.write(data) != data.size())) {
+        qWarning() << Q_FUNC_INFO << "Unable to write" << m_file.fileName() << m_file.errorString();
+        return false;
+    }
+
+    m_ranges.insert(offset, offset + data.size() - 1);
+    ++m_unsyncedChunks;
+    if ((m_unsyncedChunks < s_syncChunks) && !m_syncTimer.hasExpired(s_syncInterval)) {
+        return true;
+    }
+    return sync();
+}
+
+bool PartialFile::sync()
+{
+    if (!m_file.isOpen() || m_finished) {
+        return false;
+    }
+    m_unsyncedChunks = 0;
+    m_syncTimer.start();
+
+    // The data is on the disk before it is recorded in the index
+    if (!m_file.flush() || !syncFile(&m_file)) {
+        qWarning() << Q_FUNC_INFO << "Unable to sync" << m_file.fileName() << m_file.errorString();
+        return false;
+    }
+    return writeIndex();
+}
+
+QByteArray PartialFile::read(quint32 offset, quint32 size)
+{
+    if (!m_file.isOpen() || !m_file.seek(offset)) {
+        return QByteArray();
+    }
+    return m_file.read(size);
+}
+
+bool PartialFile::finish()
+{
+    if (!isComplete()) {
+        return false;
+    }
+    if (m_finished) {
+        m_file.close();
+        return true;
+    }
+    // The index is not needed anymore, but the data should be on the disk before the file is renamed
+    if (!m_file.flush() || !syncFile(&m_file)) {
+        qWarning() << Q_FUNC_INFO << "Unable to sync" << m_file.fileName() << m_file.errorString();
+        return false;
+    }
+    m_unsyncedChunks = 0;
+    m_file.close();
+    QFile::remove(m_filePath);
+    if (!QFile::rename(dataFilePath(), m_filePath)) {
+        qWarning() << Q_FUNC_INFO << "Unable to rename" << dataFilePath() << "to" << m_filePath;
+        return false;
+    }
+    QFile::remove(indexFilePath());
+    return true;
+}
+
+void PartialFile::remove()
+{
+    m_unsyncedChunks = 0;
+    m_file.close();
+    QFile::remove(dataFilePath());
+    QFile::remove(indexFilePath());
+    m_ranges.clear();
+}
+
+bool PartialFile::readIndex()
+{
+    QFile indexFile(indexFilePath());
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    CRawStreamEx stream(&indexFile);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 size = 0;
+    quint32 count = 0;
+    stream >> magic;
+    stream >> version;
+    stream >> size;
+    stream >> count;
+    if (stream.error() || (magic != s_indexMagic) || (version != s_indexFormatVersion) || (size != m_size)) {
+        return false;
+    }
+    if (count > quint32(stream.bytesAvailable() / 8)) {
+        return false;
+    }
+    for (quint32 i = 0; i < count; ++i) {
+        quint32 first = 0;
+        quint32 last = 0;
+        stream >> first;
+        stream >> last;
+        if (stream.error() || (first > last) || (last >= m_size)) {
+            return false;
+        }
+        m_ranges.insert(first, last);
+    }
+    return true;
+}
+
+bool PartialFile::writeIndex() const
+{
+    QSaveFile indexFile(indexFilePath());
+    if (!indexFile.open(QIODevice::WriteOnly)) {
+        qWarning() << Q_FUNC_INFO << "Unable to write" << indexFile.fileName() << indexFile.errorString();
+        return false;
+    }
+
+    {
+        CRawStreamEx stream(&indexFile);
+        stream << s_indexMagic;
+        stream << s_indexFormatVersion;
+        stream << m_size;
+        stream << quint32(m_ranges.count());
+        for (int i = 0; i < m_ranges.count(); ++i) {
+            stream << m_ranges.at(i).first;
+            stream << m_ranges.at(i).last;
+        }
+    }
+    return indexFile.commit();
+}
@@ -0,0 +1,75 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#ifndef PARTIALFILE_HPP
+#define PARTIALFILE_HPP
+
+#include <QElapsedTimer>
+#include <QFile>
+
+#include "MessageRangeSet.hpp"
+
+// A file which is being downloaded. The chunks are written in place (in any order) into a sparse data file,
+// and the written byte ranges are recorded in a sidecar index file, so the download can be resumed later.
+// The index is updated every few chunks (and on close()), so a crash loses at most the last few chunks.
+// If the file is already downloaded (there is filePath() of the same size), it is opened as finished instead.
+class PartialFile
+{
+public:
+    explicit PartialFile(const QString &filePath);
+    ~PartialFile();
+
+    QString filePath() const { return m_filePath; }
+    QString dataFilePath() const;
+    QString indexFilePath() const;
+
+    bool open(quint32 size);
+    void close();
+
+    // The file is complete in filePath() (e.g. it is downloaded by a previous request)
+    bool isFinished() const { return m_finished; }
+
+    quint32 size() const { return m_size; }
+    // The ranges are closed intervals of byte offsets
+    const MessageRangeSet &ranges() const { return m_ranges; }
+    quint32 completedPrefix() const;
+    bool isComplete() const;
+
+    bool write(quint32 offset, const QByteArray &data);
+    // Syncs the written data to the disk and records it in the index
+    bool sync();
+    QByteArray read(quint32 offset, quint32 size);
+    // Moves the complete data to filePath() and removes the index.
+    bool finish();
+    void remove();
+
+protected:
+    bool readIndex();
+    bool writeIndex() const;
+
+    QString m_filePath;
+    QFile m_file;
+    quint32 m_size;
+    MessageRangeSet m_ranges;
+    bool m_finished;
+    int m_unsyncedChunks;
+    QElapsedTimer m_syncTimer;
+
+};
+
+#endif // PARTIALFILE_HPP
@@ -0,0 +1,62 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#ifndef TLLAZY_HPP
+#define TLLAZY_HPP
+
+#include "CTelegramStream_p.hpp"
+
+// Keeps the encoded TL value and decodes it on the first access.
+// Useful for the big answers (e.g. the history), where only a part of values is actually used.
+template <typename T>
+class TLLazy
+{
+public:
+    TLLazy() : m_decoded(false) { }
+    explicit TLLazy(const QByteArray &data) : m_data(data), m_decoded(false) { }
+
+    QByteArray data() const { return m_data; }
+    void setData(const QByteArray &data) { m_data = data; m_value = T(); m_decoded = false; }
+    bool isDecoded() const { return m_decoded; }
+
+    const T &value() const
+    {
+        if (!m_decoded) {
+            CTelegramStream stream(m_data);
+            stream >> m_value;
+            m_decoded = true;
+        }
+        return m_value;
+    }
+
+    const T *operator->() const { return &value(); }
+
+protected:
+    QByteArray m_data;
+    mutable T m_value;
+    mutable bool m_decoded;
+};
+
+template <typename T>
+CTelegramStream &operator>>(CTelegramStream &stream, TLLazy<T> &lazy)
+{
+    lazy.setData(stream.readEncoded<T>());
+    return stream;
+}
+
+#endif // TLLAZY_HPP
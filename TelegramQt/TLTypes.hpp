@@ -21,6 +21,7 @@
 #include "TLValues.hpp"
 
 #include <QMetaType>
+#include <QSharedData>
 #include <QVector>
 
 template <typename T>
@@ -31,6 +32,7 @@ public:
     explicit TLVector(int size) : QVector<T>(size), tlType(TLValue::Vector) { }
     TLVector(int size, const T &t) : QVector<T>(size, t), tlType(TLValue::Vector) { }
     TLVector(const TLVector<T> &v) : QVector<T>(v), tlType(v.tlType) { }
+    TLVector(TLVector<T> &&v) : QVector<T>(std::move(v)), tlType(v.tlType) { }
     TLVector(const QVector<T> &v) : QVector<T>(v), tlType(TLValue::Vector) { }
     TLVector(std::initializer_list<T> args) : QVector<T>(args), tlType(TLValue::Vector) { }
 
@@ -62,9 +64,41 @@ public:
         return *this;
     }
 
+    TLVector &operator=(TLVector &&v) {
+        tlType = v.tlType;
+        QVector<T>::operator =(std::move(v));
+        return *this;
+    }
+
     TLValue tlType;
 };
 
+// Implicitly shared (copy on write) holder of a TL value.
+// Copying a value copies each of its (already shared) members one by one, which is noticeable for the big answers.
+template <typename T>
+class TLShared
+{
+public:
+    TLShared() : d(new Data()) { }
+    TLShared(const T &value) : d(new Data(value)) { }
+
+    const T &value() const { return d->value; }
+    T &data() { return d->value; } // Detaches
+    bool isShared() const { return d->ref.load() > 1; }
+
+    operator const T &() const { return d->value; }
+    const T *operator->() const { return &d->value; }
+    const T &operator*() const { return d->value; }
+
+protected:
+    struct Data : public QSharedData {
+        Data() { }
+        Data(const T &v) : value(v) { }
+        T value;
+    };
+    QSharedDataPointer<Data> d;
+};
+
 // Generated TLTypes
 struct TLAccountDaysTTL {
     constexpr TLAccountDaysTTL() :
@@ -342,6 +376,8 @@ struct TLBotInfo {
     TLValue tlType;
 };
 
+using TLBotInfoShared = TLShared<TLBotInfo>;
+
 struct TLChannelParticipant {
     constexpr TLChannelParticipant() :
         userId(0),
@@ -455,6 +491,8 @@ struct TLChatParticipants {
     TLValue tlType;
 };
 
+using TLChatParticipantsShared = TLShared<TLChatParticipants>;
+
 struct TLContact {
     constexpr TLContact() :
         userId(0),
@@ -1234,6 +1272,8 @@ struct TLKeyboardButtonRow {
     TLValue tlType;
 };
 
+using TLKeyboardButtonRowShared = TLShared<TLKeyboardButtonRow>;
+
 struct TLMessageEntity {
     TLMessageEntity() :
         offset(0),
@@ -1556,6 +1596,8 @@ struct TLPrivacyRule {
     TLValue tlType;
 };
 
+using TLPrivacyRuleShared = TLShared<TLPrivacyRule>;
+
 struct TLReceivedNotifyMessage {
     constexpr TLReceivedNotifyMessage() :
         id(0),
@@ -1637,6 +1679,8 @@ struct TLStickerPack {
     TLValue tlType;
 };
 
+using TLStickerPackShared = TLShared<TLStickerPack>;
+
 struct TLStorageFileType {
     constexpr TLStorageFileType() :
         tlType(TLValue::StorageFileUnknown) { }
@@ -1807,6 +1851,8 @@ struct TLWallPaper {
     TLValue tlType;
 };
 
+using TLWallPaperShared = TLShared<TLWallPaper>;
+
 struct TLAccountAuthorizations {
     TLAccountAuthorizations() :
         tlType(TLValue::AccountAuthorizations) { }
@@ -1823,6 +1869,8 @@ struct TLAccountAuthorizations {
     TLValue tlType;
 };
 
+using TLAccountAuthorizationsShared = TLShared<TLAccountAuthorizations>;
+
 struct TLBotInlineMessage {
     TLBotInlineMessage() :
         flags(0),
@@ -1849,6 +1897,8 @@ struct TLBotInlineMessage {
     TLValue tlType;
 };
 
+using TLBotInlineMessageShared = TLShared<TLBotInlineMessage>;
+
 struct TLChannelMessagesFilter {
     TLChannelMessagesFilter() :
         flags(0),
@@ -1875,6 +1925,8 @@ struct TLChannelMessagesFilter {
     TLValue tlType;
 };
 
+using TLChannelMessagesFilterShared = TLShared<TLChannelMessagesFilter>;
+
 struct TLChatPhoto {
     TLChatPhoto() :
         tlType(TLValue::ChatPhotoEmpty) { }
@@ -2026,6 +2078,8 @@ struct TLInputBotInlineMessage {
     TLValue tlType;
 };
 
+using TLInputBotInlineMessageShared = TLShared<TLInputBotInlineMessage>;
+
 struct TLInputBotInlineResult {
     TLInputBotInlineResult() :
         flags(0),
@@ -2143,6 +2197,8 @@ struct TLInputMedia {
     TLValue tlType;
 };
 
+using TLInputMediaShared = TLShared<TLInputMedia>;
+
 struct TLInputNotifyPeer {
     TLInputNotifyPeer() :
         tlType(TLValue::InputNotifyPeer) { }
@@ -2183,6 +2239,8 @@ struct TLInputPrivacyRule {
     TLValue tlType;
 };
 
+using TLInputPrivacyRuleShared = TLShared<TLInputPrivacyRule>;
+
 struct TLNotifyPeer {
     TLNotifyPeer() :
         tlType(TLValue::NotifyPeer) { }
@@ -2225,6 +2283,8 @@ struct TLPhoto {
     TLValue tlType;
 };
 
+using TLPhotoShared = TLShared<TLPhoto>;
+
 struct TLReplyMarkup {
     TLReplyMarkup() :
         flags(0),
@@ -2253,6 +2313,8 @@ struct TLReplyMarkup {
     TLValue tlType;
 };
 
+using TLReplyMarkupShared = TLShared<TLReplyMarkup>;
+
 struct TLStickerSet {
     TLStickerSet() :
         flags(0),
@@ -2367,6 +2429,8 @@ struct TLAccountPrivacyRules {
     TLValue tlType;
 };
 
+using TLAccountPrivacyRulesShared = TLShared<TLAccountPrivacyRules>;
+
 struct TLAuthAuthorization {
     TLAuthAuthorization() :
         tlType(TLValue::AuthAuthorization) { }
@@ -2400,6 +2464,8 @@ struct TLChannelsChannelParticipant {
     TLValue tlType;
 };
 
+using TLChannelsChannelParticipantShared = TLShared<TLChannelsChannelParticipant>;
+
 struct TLChannelsChannelParticipants {
     TLChannelsChannelParticipants() :
         count(0),
@@ -2419,6 +2485,8 @@ struct TLChannelsChannelParticipants {
     TLValue tlType;
 };
 
+using TLChannelsChannelParticipantsShared = TLShared<TLChannelsChannelParticipants>;
+
 struct TLChat {
     TLChat() :
         id(0),
@@ -2535,6 +2603,8 @@ struct TLChatFull {
     TLValue tlType;
 };
 
+using TLChatFullShared = TLShared<TLChatFull>;
+
 struct TLChatInvite {
     TLChatInvite() :
         flags(0),
@@ -2616,6 +2686,8 @@ struct TLConfig {
     TLValue tlType;
 };
 
+using TLConfigShared = TLShared<TLConfig>;
+
 struct TLContactsBlocked {
     TLContactsBlocked() :
         count(0),
@@ -2636,6 +2708,8 @@ struct TLContactsBlocked {
     TLValue tlType;
 };
 
+using TLContactsBlockedShared = TLShared<TLContactsBlocked>;
+
 struct TLContactsContacts {
     TLContactsContacts() :
         tlType(TLValue::ContactsContactsNotModified) { }
@@ -2654,6 +2728,8 @@ struct TLContactsContacts {
     TLValue tlType;
 };
 
+using TLContactsContactsShared = TLShared<TLContactsContacts>;
+
 struct TLContactsFound {
     TLContactsFound() :
         tlType(TLValue::ContactsFound) { }
@@ -2672,6 +2748,8 @@ struct TLContactsFound {
     TLValue tlType;
 };
 
+using TLContactsFoundShared = TLShared<TLContactsFound>;
+
 struct TLContactsImportedContacts {
     TLContactsImportedContacts() :
         tlType(TLValue::ContactsImportedContacts) { }
@@ -2690,6 +2768,8 @@ struct TLContactsImportedContacts {
     TLValue tlType;
 };
 
+using TLContactsImportedContactsShared = TLShared<TLContactsImportedContacts>;
+
 struct TLContactsLink {
     TLContactsLink() :
         tlType(TLValue::ContactsLink) { }
@@ -2726,6 +2806,8 @@ struct TLContactsResolvedPeer {
     TLValue tlType;
 };
 
+using TLContactsResolvedPeerShared = TLShared<TLContactsResolvedPeer>;
+
 struct TLContactsSuggested {
     TLContactsSuggested() :
         tlType(TLValue::ContactsSuggested) { }
@@ -2743,6 +2825,8 @@ struct TLContactsSuggested {
     TLValue tlType;
 };
 
+using TLContactsSuggestedShared = TLShared<TLContactsSuggested>;
+
 struct TLDocument {
     TLDocument() :
         id(0),
@@ -2772,6 +2856,8 @@ struct TLDocument {
     TLValue tlType;
 };
 
+using TLDocumentShared = TLShared<TLDocument>;
+
 struct TLFoundGif {
     TLFoundGif() :
         w(0),
@@ -2851,6 +2937,8 @@ struct TLMessageAction {
     TLValue tlType;
 };
 
+using TLMessageActionShared = TLShared<TLMessageAction>;
+
 struct TLMessagesAllStickers {
     TLMessagesAllStickers() :
         hash(0),
@@ -2870,6 +2958,8 @@ struct TLMessagesAllStickers {
     TLValue tlType;
 };
 
+using TLMessagesAllStickersShared = TLShared<TLMessagesAllStickers>;
+
 struct TLMessagesChatFull {
     TLMessagesChatFull() :
         tlType(TLValue::MessagesChatFull) { }
@@ -2888,6 +2978,8 @@ struct TLMessagesChatFull {
     TLValue tlType;
 };
 
+using TLMessagesChatFullShared = TLShared<TLMessagesChatFull>;
+
 struct TLMessagesChats {
     TLMessagesChats() :
         tlType(TLValue::MessagesChats) { }
@@ -2904,6 +2996,8 @@ struct TLMessagesChats {
     TLValue tlType;
 };
 
+using TLMessagesChatsShared = TLShared<TLMessagesChats>;
+
 struct TLMessagesFoundGifs {
     TLMessagesFoundGifs() :
         nextOffset(0),
@@ -2922,6 +3016,8 @@ struct TLMessagesFoundGifs {
     TLValue tlType;
 };
 
+using TLMessagesFoundGifsShared = TLShared<TLMessagesFoundGifs>;
+
 struct TLMessagesSavedGifs {
     TLMessagesSavedGifs() :
         hash(0),
@@ -2941,6 +3037,8 @@ struct TLMessagesSavedGifs {
     TLValue tlType;
 };
 
+using TLMessagesSavedGifsShared = TLShared<TLMessagesSavedGifs>;
+
 struct TLMessagesStickerSet {
     TLMessagesStickerSet() :
         tlType(TLValue::MessagesStickerSet) { }
@@ -2959,6 +3057,8 @@ struct TLMessagesStickerSet {
     TLValue tlType;
 };
 
+using TLMessagesStickerSetShared = TLShared<TLMessagesStickerSet>;
+
 struct TLMessagesStickers {
     TLMessagesStickers() :
         tlType(TLValue::MessagesStickersNotModified) { }
@@ -2977,6 +3077,8 @@ struct TLMessagesStickers {
     TLValue tlType;
 };
 
+using TLMessagesStickersShared = TLShared<TLMessagesStickers>;
+
 struct TLPhotosPhoto {
     TLPhotosPhoto() :
         tlType(TLValue::PhotosPhoto) { }
@@ -2994,6 +3096,8 @@ struct TLPhotosPhoto {
     TLValue tlType;
 };
 
+using TLPhotosPhotoShared = TLShared<TLPhotosPhoto>;
+
 struct TLPhotosPhotos {
     TLPhotosPhotos() :
         count(0),
@@ -3014,6 +3118,8 @@ struct TLPhotosPhotos {
     TLValue tlType;
 };
 
+using TLPhotosPhotosShared = TLShared<TLPhotosPhotos>;
+
 struct TLUserFull {
     TLUserFull() :
         blocked(false),
@@ -3203,6 +3309,8 @@ struct TLMessagesBotResults {
     TLValue tlType;
 };
 
+using TLMessagesBotResultsShared = TLShared<TLMessagesBotResults>;
+
 struct TLMessage {
     TLMessage() :
         id(0),
@@ -3262,6 +3370,8 @@ struct TLMessage {
     TLValue tlType;
 };
 
+using TLMessageShared = TLShared<TLMessage>;
+
 struct TLMessagesDialogs {
     TLMessagesDialogs() :
         count(0),
@@ -3284,6 +3394,8 @@ struct TLMessagesDialogs {
     TLValue tlType;
 };
 
+using TLMessagesDialogsShared = TLShared<TLMessagesDialogs>;
+
 struct TLMessagesMessages {
     TLMessagesMessages() :
         count(0),
@@ -3314,6 +3426,8 @@ struct TLMessagesMessages {
     TLValue tlType;
 };
 
+using TLMessagesMessagesShared = TLShared<TLMessagesMessages>;
+
 struct TLUpdate {
     TLUpdate() :
         pts(0),
@@ -3443,6 +3557,8 @@ struct TLUpdate {
     TLValue tlType;
 };
 
+using TLUpdateShared = TLShared<TLUpdate>;
+
 struct TLUpdates {
     TLUpdates() :
         flags(0),
@@ -3514,6 +3630,8 @@ struct TLUpdates {
     TLValue tlType;
 };
 
+using TLUpdatesShared = TLShared<TLUpdates>;
+
 struct TLUpdatesChannelDifference {
     TLUpdatesChannelDifference() :
         flags(0),
@@ -3557,6 +3675,8 @@ struct TLUpdatesChannelDifference {
     TLValue tlType;
 };
 
+using TLUpdatesChannelDifferenceShared = TLShared<TLUpdatesChannelDifference>;
+
 struct TLUpdatesDifference {
     TLUpdatesDifference() :
         date(0),
@@ -3585,6 +3705,8 @@ struct TLUpdatesDifference {
     TLValue tlType;
 };
 
+using TLUpdatesDifferenceShared = TLShared<TLUpdatesDifference>;
+
 // End of generated TLTypes
 
 Q_DECLARE_METATYPE(TLUploadFile)
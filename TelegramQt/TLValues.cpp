@@ -17,21 +17,725 @@
 
 #include "TLValues.hpp"
 
-#include <QMetaEnum>
+struct TLValueEntry
+{
+    quint32 value;
+    const char *name;
+};
+
+// Generated TLValues lookup table
+static constexpr int s_valueBucketBits = 8;
+static constexpr int s_valueSlotBits = 10;
+
+static constexpr quint16 s_valueSeeds[] = {
+    0, 0, 1, 0, 0, 2, 1, 1, 0, 4, 0, 1, 0, 0, 3, 3,
+    1, 1, 0, 0, 0, 2, 1, 6, 5, 0, 0, 1, 0, 0, 0, 1,
+    0, 2, 0, 0, 0, 1, 2, 0, 4, 13, 0, 0, 0, 0, 0, 3,
+    2, 0, 1, 2, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1,
+    0, 0, 0, 0, 0, 4, 0, 0, 1, 1, 0, 9, 0, 2, 5, 0,
+    0, 0, 2, 8, 7, 0, 0, 2, 0, 5, 0, 15, 0, 0, 5, 0,
+    0, 2, 0, 1, 0, 0, 3, 1, 2, 0, 0, 0, 0, 1, 0, 0,
+    1, 1, 1, 0, 2, 5, 0, 9, 1, 0, 0, 5, 1, 0, 3, 4,
+    0, 8, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1,
+    0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 6, 2, 0, 0, 6, 2,
+    0, 0, 0, 14, 0, 0, 0, 1, 2, 0, 6, 0, 19, 0, 1, 2,
+    0, 10, 0, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 2, 3, 0,
+    11, 0, 0, 0, 4, 5, 2, 0, 4, 1, 1, 0, 0, 4, 5, 0,
+    14, 1, 2, 1, 0, 3, 1, 1, 0, 2, 1, 0, 3, 1, 1, 7,
+    0, 3, 1, 0, 4, 0, 1, 3, 2, 5, 0, 4, 1, 0, 0, 1,
+    2, 0, 4, 7, 8, 1, 3, 1, 0, 1, 3, 1, 1, 11, 0, 1,
+};
+
+static constexpr quint16 s_valueSlots[] = {
+    121, 259, 0xffff, 0xffff, 0xffff, 0xffff, 532, 223, 135, 0xffff, 0xffff, 0xffff, 515, 0xffff, 91, 61,
+    240, 0xffff, 502, 7, 369, 0xffff, 0xffff, 531, 0xffff, 0xffff, 86, 133, 0xffff, 0xffff, 149, 0xffff,
+    0xffff, 460, 70, 427, 250, 168, 1, 174, 245, 371, 23, 20, 0xffff, 0xffff, 559, 0xffff,
+    209, 0xffff, 0xffff, 0xffff, 54, 0xffff, 117, 232, 398, 333, 237, 196, 0xffff, 6, 176, 172,
+    0xffff, 302, 257, 547, 444, 0xffff, 0xffff, 0xffff, 404, 187, 0xffff, 0xffff, 0xffff, 350, 0xffff, 0xffff,
+    0xffff, 469, 345, 0xffff, 0xffff, 0xffff, 468, 573, 0xffff, 76, 0xffff, 593, 0xffff, 0xffff, 347, 0xffff,
+    289, 306, 0xffff, 47, 0xffff, 0xffff, 0xffff, 356, 0xffff, 0xffff, 41, 355, 284, 273, 430, 0xffff,
+    159, 285, 519, 36, 364, 0xffff, 0xffff, 0xffff, 297, 110, 242, 461, 464, 21, 0xffff, 0xffff,
+    122, 0xffff, 175, 551, 233, 22, 249, 0xffff, 0xffff, 164, 0xffff, 0xffff, 0xffff, 24, 0xffff, 378,
+    50, 567, 85, 0xffff, 17, 0xffff, 328, 0xffff, 416, 100, 433, 131, 0xffff, 322, 540, 0xffff,
+    424, 406, 0xffff, 128, 127, 580, 556, 541, 263, 0xffff, 125, 287, 98, 0xffff, 0xffff, 30,
+    536, 238, 0xffff, 405, 0xffff, 0xffff, 134, 0xffff, 548, 0xffff, 0xffff, 408, 112, 5, 0xffff, 82,
+    0xffff, 0xffff, 303, 0xffff, 0xffff, 262, 0xffff, 0xffff, 329, 0xffff, 327, 0xffff, 474, 84, 380, 66,
+    130, 143, 341, 244, 0xffff, 184, 305, 510, 51, 307, 200, 0xffff, 0xffff, 0xffff, 576, 338,
+    0xffff, 420, 137, 27, 142, 340, 0xffff, 271, 0xffff, 256, 571, 0xffff, 0xffff, 0xffff, 171, 248,
+    0xffff, 0xffff, 0xffff, 0xffff, 277, 482, 170, 0xffff, 0xffff, 454, 0xffff, 550, 11, 365, 0xffff, 0xffff,
+    254, 0xffff, 57, 4, 415, 0xffff, 0xffff, 517, 62, 471, 0xffff, 118, 470, 0xffff, 0xffff, 553,
+    156, 0xffff, 266, 0xffff, 96, 0xffff, 286, 0xffff, 0xffff, 396, 106, 201, 255, 0xffff, 391, 38,
+    511, 34, 64, 269, 0xffff, 129, 0xffff, 37, 0xffff, 381, 0xffff, 88, 522, 0xffff, 311, 267,
+    15, 0xffff, 472, 293, 563, 0xffff, 412, 0xffff, 0xffff, 193, 584, 0xffff, 0xffff, 568, 353, 330,
+    0xffff, 0xffff, 261, 0xffff, 0xffff, 0xffff, 0xffff, 60, 0xffff, 360, 402, 0xffff, 241, 389, 525, 0xffff,
+    32, 179, 0xffff, 26, 0xffff, 0xffff, 0xffff, 570, 439, 0xffff, 132, 431, 0xffff, 386, 101, 588,
+    336, 204, 0xffff, 0xffff, 0xffff, 115, 393, 160, 0xffff, 0xffff, 292, 198, 0xffff, 592, 108, 0xffff,
+    278, 0xffff, 564, 0xffff, 0xffff, 0xffff, 194, 87, 0xffff, 63, 97, 216, 0xffff, 103, 0xffff, 246,
+    0xffff, 0xffff, 0xffff, 44, 0xffff, 310, 116, 491, 587, 516, 19, 577, 0xffff, 528, 448, 512,
+    0xffff, 0xffff, 0xffff, 39, 264, 361, 0xffff, 0xffff, 0xffff, 546, 0xffff, 222, 0xffff, 335, 432, 400,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 75, 0xffff, 165, 317, 139, 498, 0xffff, 214, 0xffff, 2, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 339, 0xffff, 569, 0xffff, 83, 0xffff, 208, 509, 495, 325,
+    0xffff, 288, 14, 282, 382, 0xffff, 554, 0xffff, 186, 0xffff, 177, 0xffff, 441, 252, 0xffff, 0xffff,
+    581, 346, 146, 0xffff, 0xffff, 0xffff, 594, 173, 332, 0xffff, 0xffff, 304, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 40, 0xffff, 596, 308, 183, 539, 359, 3, 126, 283, 443, 0xffff, 384, 467, 0xffff,
+    0xffff, 499, 0xffff, 247, 463, 411, 0xffff, 33, 0xffff, 590, 0xffff, 493, 529, 375, 0xffff, 0xffff,
+    206, 0xffff, 313, 53, 210, 0xffff, 0xffff, 0xffff, 0xffff, 418, 480, 403, 0xffff, 0xffff, 0xffff, 253,
+    226, 295, 0xffff, 0xffff, 422, 0xffff, 0xffff, 452, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 394, 0xffff,
+    543, 309, 486, 565, 0xffff, 0xffff, 407, 42, 504, 0xffff, 153, 162, 239, 148, 0xffff, 0xffff,
+    298, 59, 481, 413, 399, 275, 0xffff, 344, 0xffff, 535, 351, 0xffff, 0xffff, 0xffff, 323, 442,
+    437, 0xffff, 13, 0xffff, 0xffff, 52, 314, 0xffff, 0xffff, 316, 505, 95, 72, 0xffff, 109, 141,
+    89, 0xffff, 450, 334, 0xffff, 354, 157, 0xffff, 0xffff, 358, 12, 161, 0xffff, 0xffff, 507, 0xffff,
+    0xffff, 490, 478, 595, 0xffff, 0xffff, 73, 0xffff, 228, 0xffff, 462, 0xffff, 0xffff, 215, 575, 585,
+    0xffff, 453, 0xffff, 0xffff, 582, 561, 0xffff, 93, 0xffff, 0xffff, 0xffff, 409, 0xffff, 0xffff, 294, 0xffff,
+    197, 79, 181, 373, 0xffff, 425, 319, 537, 0xffff, 0xffff, 220, 560, 0xffff, 0xffff, 500, 0xffff,
+    225, 414, 0xffff, 343, 589, 49, 119, 0xffff, 270, 0xffff, 169, 0xffff, 572, 368, 0xffff, 0xffff,
+    0xffff, 370, 0xffff, 0xffff, 167, 379, 0xffff, 466, 299, 0xffff, 74, 0xffff, 0xffff, 0xffff, 0xffff, 494,
+    0xffff, 251, 0xffff, 25, 445, 180, 68, 0xffff, 0xffff, 385, 154, 258, 520, 566, 318, 387,
+    324, 120, 0xffff, 337, 10, 28, 265, 0xffff, 290, 0xffff, 331, 0xffff, 0xffff, 0xffff, 429, 190,
+    477, 0xffff, 9, 0xffff, 0xffff, 0xffff, 555, 136, 152, 151, 166, 0xffff, 579, 296, 457, 558,
+    0xffff, 0xffff, 438, 192, 321, 483, 46, 0xffff, 144, 55, 0xffff, 0xffff, 357, 213, 0xffff, 436,
+    0xffff, 383, 542, 150, 0xffff, 0xffff, 0xffff, 401, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 202, 501, 349,
+    0xffff, 230, 0xffff, 0xffff, 90, 315, 473, 485, 526, 458, 497, 591, 0xffff, 0xffff, 449, 0xffff,
+    279, 388, 426, 0xffff, 18, 211, 0xffff, 0xffff, 231, 0xffff, 182, 435, 0xffff, 0xffff, 123, 362,
+    514, 280, 99, 104, 0xffff, 301, 29, 352, 0xffff, 0xffff, 0xffff, 552, 419, 0xffff, 0xffff, 195,
+    67, 367, 0xffff, 0xffff, 69, 0xffff, 530, 189, 16, 0xffff, 0xffff, 0xffff, 538, 533, 0xffff, 0xffff,
+    111, 395, 0xffff, 390, 140, 92, 376, 513, 0xffff, 447, 276, 205, 0xffff, 0xffff, 234, 124,
+    434, 366, 0xffff, 0xffff, 8, 312, 586, 191, 0xffff, 235, 0xffff, 0xffff, 0xffff, 0xffff, 372, 0xffff,
+    417, 440, 45, 0xffff, 0xffff, 451, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 218, 0xffff, 549, 0xffff,
+    281, 58, 155, 0xffff, 0xffff, 0xffff, 496, 185, 455, 557, 0xffff, 0xffff, 0xffff, 489, 508, 0xffff,
+    423, 0xffff, 0xffff, 0xffff, 35, 272, 113, 0xffff, 578, 320, 544, 0xffff, 326, 43, 492, 428,
+    224, 114, 219, 199, 71, 0xffff, 0xffff, 56, 0xffff, 94, 0xffff, 78, 212, 147, 397, 80,
+    207, 0xffff, 229, 0, 0xffff, 0xffff, 0xffff, 236, 459, 0xffff, 446, 0xffff, 227, 465, 0xffff, 300,
+    0xffff, 0xffff, 0xffff, 243, 574, 77, 0xffff, 31, 0xffff, 583, 476, 523, 488, 0xffff, 138, 0xffff,
+    81, 521, 0xffff, 342, 0xffff, 105, 0xffff, 0xffff, 0xffff, 421, 0xffff, 348, 0xffff, 268, 484, 0xffff,
+    503, 377, 0xffff, 562, 487, 107, 48, 291, 0xffff, 0xffff, 188, 506, 102, 0xffff, 274, 260,
+    65, 163, 203, 221, 545, 392, 524, 534, 0xffff, 527, 145, 0xffff, 456, 0xffff, 374, 0xffff,
+    178, 475, 363, 479, 0xffff, 0xffff, 0xffff, 410, 0xffff, 0xffff, 158, 217, 0xffff, 0xffff, 0xffff, 518,
+};
 
-static const int ValueTypeEnumeratorIndex = TLValue::staticMetaObject.indexOfEnumerator("Value");
-static const QMetaEnum enumerator = TLValue::staticMetaObject.enumerator(ValueTypeEnumeratorIndex);
+static constexpr TLValueEntry s_valueEntries[] = {
+    { TLValue::ResPQ, "ResPQ" },
+    { TLValue::PQInnerData, "PQInnerData" },
+    { TLValue::ServerDHParamsFail, "ServerDHParamsFail" },
+    { TLValue::ServerDHParamsOk, "ServerDHParamsOk" },
+    { TLValue::ServerDHInnerData, "ServerDHInnerData" },
+    { TLValue::ClientDHInnerData, "ClientDHInnerData" },
+    { TLValue::DhGenOk, "DhGenOk" },
+    { TLValue::DhGenRetry, "DhGenRetry" },
+    { TLValue::DhGenFail, "DhGenFail" },
+    { TLValue::RpcResult, "RpcResult" },
+    { TLValue::RpcError, "RpcError" },
+    { TLValue::RpcAnswerUnknown, "RpcAnswerUnknown" },
+    { TLValue::RpcAnswerDroppedRunning, "RpcAnswerDroppedRunning" },
+    { TLValue::RpcAnswerDropped, "RpcAnswerDropped" },
+    { TLValue::FutureSalt, "FutureSalt" },
+    { TLValue::FutureSalts, "FutureSalts" },
+    { TLValue::Pong, "Pong" },
+    { TLValue::DestroySessionOk, "DestroySessionOk" },
+    { TLValue::DestroySessionNone, "DestroySessionNone" },
+    { TLValue::NewSessionCreated, "NewSessionCreated" },
+    { TLValue::MsgContainer, "MsgContainer" },
+    { TLValue::MsgCopy, "MsgCopy" },
+    { TLValue::GzipPacked, "GzipPacked" },
+    { TLValue::MsgsAck, "MsgsAck" },
+    { TLValue::BadMsgNotification, "BadMsgNotification" },
+    { TLValue::BadServerSalt, "BadServerSalt" },
+    { TLValue::MsgResendReq, "MsgResendReq" },
+    { TLValue::MsgsStateReq, "MsgsStateReq" },
+    { TLValue::MsgsStateInfo, "MsgsStateInfo" },
+    { TLValue::MsgsAllInfo, "MsgsAllInfo" },
+    { TLValue::MsgDetailedInfo, "MsgDetailedInfo" },
+    { TLValue::MsgNewDetailedInfo, "MsgNewDetailedInfo" },
+    { TLValue::ReqPq, "ReqPq" },
+    { TLValue::ReqDHParams, "ReqDHParams" },
+    { TLValue::SetClientDHParams, "SetClientDHParams" },
+    { TLValue::RpcDropAnswer, "RpcDropAnswer" },
+    { TLValue::GetFutureSalts, "GetFutureSalts" },
+    { TLValue::Ping, "Ping" },
+    { TLValue::PingDelayDisconnect, "PingDelayDisconnect" },
+    { TLValue::DestroySession, "DestroySession" },
+    { TLValue::HttpWait, "HttpWait" },
+    { TLValue::BoolFalse, "BoolFalse" },
+    { TLValue::BoolTrue, "BoolTrue" },
+    { TLValue::True, "True" },
+    { TLValue::Vector, "Vector" },
+    { TLValue::Error, "Error" },
+    { TLValue::Null, "Null" },
+    { TLValue::InputPeerEmpty, "InputPeerEmpty" },
+    { TLValue::InputPeerSelf, "InputPeerSelf" },
+    { TLValue::InputPeerChat, "InputPeerChat" },
+    { TLValue::InputPeerUser, "InputPeerUser" },
+    { TLValue::InputPeerChannel, "InputPeerChannel" },
+    { TLValue::InputUserEmpty, "InputUserEmpty" },
+    { TLValue::InputUserSelf, "InputUserSelf" },
+    { TLValue::InputUser, "InputUser" },
+    { TLValue::InputPhoneContact, "InputPhoneContact" },
+    { TLValue::InputFile, "InputFile" },
+    { TLValue::InputFileBig, "InputFileBig" },
+    { TLValue::InputMediaEmpty, "InputMediaEmpty" },
+    { TLValue::InputMediaUploadedPhoto, "InputMediaUploadedPhoto" },
+    { TLValue::InputMediaPhoto, "InputMediaPhoto" },
+    { TLValue::InputMediaGeoPoint, "InputMediaGeoPoint" },
+    { TLValue::InputMediaContact, "InputMediaContact" },
+    { TLValue::InputMediaUploadedVideo, "InputMediaUploadedVideo" },
+    { TLValue::InputMediaUploadedThumbVideo, "InputMediaUploadedThumbVideo" },
+    { TLValue::InputMediaVideo, "InputMediaVideo" },
+    { TLValue::InputMediaUploadedAudio, "InputMediaUploadedAudio" },
+    { TLValue::InputMediaAudio, "InputMediaAudio" },
+    { TLValue::InputMediaUploadedDocument, "InputMediaUploadedDocument" },
+    { TLValue::InputMediaUploadedThumbDocument, "InputMediaUploadedThumbDocument" },
+    { TLValue::InputMediaDocument, "InputMediaDocument" },
+    { TLValue::InputMediaVenue, "InputMediaVenue" },
+    { TLValue::InputMediaGifExternal, "InputMediaGifExternal" },
+    { TLValue::InputChatPhotoEmpty, "InputChatPhotoEmpty" },
+    { TLValue::InputChatUploadedPhoto, "InputChatUploadedPhoto" },
+    { TLValue::InputChatPhoto, "InputChatPhoto" },
+    { TLValue::InputGeoPointEmpty, "InputGeoPointEmpty" },
+    { TLValue::InputGeoPoint, "InputGeoPoint" },
+    { TLValue::InputPhotoEmpty, "InputPhotoEmpty" },
+    { TLValue::InputPhoto, "InputPhoto" },
+    { TLValue::InputVideoEmpty, "InputVideoEmpty" },
+    { TLValue::InputVideo, "InputVideo" },
+    { TLValue::InputFileLocation, "InputFileLocation" },
+    { TLValue::InputVideoFileLocation, "InputVideoFileLocation" },
+    { TLValue::InputEncryptedFileLocation, "InputEncryptedFileLocation" },
+    { TLValue::InputAudioFileLocation, "InputAudioFileLocation" },
+    { TLValue::InputDocumentFileLocation, "InputDocumentFileLocation" },
+    { TLValue::InputPhotoCropAuto, "InputPhotoCropAuto" },
+    { TLValue::InputPhotoCrop, "InputPhotoCrop" },
+    { TLValue::InputAppEvent, "InputAppEvent" },
+    { TLValue::PeerUser, "PeerUser" },
+    { TLValue::PeerChat, "PeerChat" },
+    { TLValue::PeerChannel, "PeerChannel" },
+    { TLValue::StorageFileUnknown, "StorageFileUnknown" },
+    { TLValue::StorageFileJpeg, "StorageFileJpeg" },
+    { TLValue::StorageFileGif, "StorageFileGif" },
+    { TLValue::StorageFilePng, "StorageFilePng" },
+    { TLValue::StorageFilePdf, "StorageFilePdf" },
+    { TLValue::StorageFileMp3, "StorageFileMp3" },
+    { TLValue::StorageFileMov, "StorageFileMov" },
+    { TLValue::StorageFilePartial, "StorageFilePartial" },
+    { TLValue::StorageFileMp4, "StorageFileMp4" },
+    { TLValue::StorageFileWebp, "StorageFileWebp" },
+    { TLValue::FileLocationUnavailable, "FileLocationUnavailable" },
+    { TLValue::FileLocation, "FileLocation" },
+    { TLValue::UserEmpty, "UserEmpty" },
+    { TLValue::User, "User" },
+    { TLValue::UserProfilePhotoEmpty, "UserProfilePhotoEmpty" },
+    { TLValue::UserProfilePhoto, "UserProfilePhoto" },
+    { TLValue::UserStatusEmpty, "UserStatusEmpty" },
+    { TLValue::UserStatusOnline, "UserStatusOnline" },
+    { TLValue::UserStatusOffline, "UserStatusOffline" },
+    { TLValue::UserStatusRecently, "UserStatusRecently" },
+    { TLValue::UserStatusLastWeek, "UserStatusLastWeek" },
+    { TLValue::UserStatusLastMonth, "UserStatusLastMonth" },
+    { TLValue::ChatEmpty, "ChatEmpty" },
+    { TLValue::Chat, "Chat" },
+    { TLValue::ChatForbidden, "ChatForbidden" },
+    { TLValue::Channel, "Channel" },
+    { TLValue::ChannelForbidden, "ChannelForbidden" },
+    { TLValue::ChatFull, "ChatFull" },
+    { TLValue::ChannelFull, "ChannelFull" },
+    { TLValue::ChatParticipant, "ChatParticipant" },
+    { TLValue::ChatParticipantCreator, "ChatParticipantCreator" },
+    { TLValue::ChatParticipantAdmin, "ChatParticipantAdmin" },
+    { TLValue::ChatParticipantsForbidden, "ChatParticipantsForbidden" },
+    { TLValue::ChatParticipants, "ChatParticipants" },
+    { TLValue::ChatPhotoEmpty, "ChatPhotoEmpty" },
+    { TLValue::ChatPhoto, "ChatPhoto" },
+    { TLValue::MessageEmpty, "MessageEmpty" },
+    { TLValue::Message, "Message" },
+    { TLValue::MessageService, "MessageService" },
+    { TLValue::MessageMediaEmpty, "MessageMediaEmpty" },
+    { TLValue::MessageMediaPhoto, "MessageMediaPhoto" },
+    { TLValue::MessageMediaVideo, "MessageMediaVideo" },
+    { TLValue::MessageMediaGeo, "MessageMediaGeo" },
+    { TLValue::MessageMediaContact, "MessageMediaContact" },
+    { TLValue::MessageMediaUnsupported, "MessageMediaUnsupported" },
+    { TLValue::MessageMediaDocument, "MessageMediaDocument" },
+    { TLValue::MessageMediaAudio, "MessageMediaAudio" },
+    { TLValue::MessageMediaWebPage, "MessageMediaWebPage" },
+    { TLValue::MessageMediaVenue, "MessageMediaVenue" },
+    { TLValue::MessageActionEmpty, "MessageActionEmpty" },
+    { TLValue::MessageActionChatCreate, "MessageActionChatCreate" },
+    { TLValue::MessageActionChatEditTitle, "MessageActionChatEditTitle" },
+    { TLValue::MessageActionChatEditPhoto, "MessageActionChatEditPhoto" },
+    { TLValue::MessageActionChatDeletePhoto, "MessageActionChatDeletePhoto" },
+    { TLValue::MessageActionChatAddUser, "MessageActionChatAddUser" },
+    { TLValue::MessageActionChatDeleteUser, "MessageActionChatDeleteUser" },
+    { TLValue::MessageActionChatJoinedByLink, "MessageActionChatJoinedByLink" },
+    { TLValue::MessageActionChannelCreate, "MessageActionChannelCreate" },
+    { TLValue::MessageActionChatMigrateTo, "MessageActionChatMigrateTo" },
+    { TLValue::MessageActionChannelMigrateFrom, "MessageActionChannelMigrateFrom" },
+    { TLValue::Dialog, "Dialog" },
+    { TLValue::DialogChannel, "DialogChannel" },
+    { TLValue::PhotoEmpty, "PhotoEmpty" },
+    { TLValue::Photo, "Photo" },
+    { TLValue::PhotoSizeEmpty, "PhotoSizeEmpty" },
+    { TLValue::PhotoSize, "PhotoSize" },
+    { TLValue::PhotoCachedSize, "PhotoCachedSize" },
+    { TLValue::VideoEmpty, "VideoEmpty" },
+    { TLValue::Video, "Video" },
+    { TLValue::GeoPointEmpty, "GeoPointEmpty" },
+    { TLValue::GeoPoint, "GeoPoint" },
+    { TLValue::AuthCheckedPhone, "AuthCheckedPhone" },
+    { TLValue::AuthSentCode, "AuthSentCode" },
+    { TLValue::AuthSentAppCode, "AuthSentAppCode" },
+    { TLValue::AuthAuthorization, "AuthAuthorization" },
+    { TLValue::AuthExportedAuthorization, "AuthExportedAuthorization" },
+    { TLValue::InputNotifyPeer, "InputNotifyPeer" },
+    { TLValue::InputNotifyUsers, "InputNotifyUsers" },
+    { TLValue::InputNotifyChats, "InputNotifyChats" },
+    { TLValue::InputNotifyAll, "InputNotifyAll" },
+    { TLValue::InputPeerNotifyEventsEmpty, "InputPeerNotifyEventsEmpty" },
+    { TLValue::InputPeerNotifyEventsAll, "InputPeerNotifyEventsAll" },
+    { TLValue::InputPeerNotifySettings, "InputPeerNotifySettings" },
+    { TLValue::PeerNotifyEventsEmpty, "PeerNotifyEventsEmpty" },
+    { TLValue::PeerNotifyEventsAll, "PeerNotifyEventsAll" },
+    { TLValue::PeerNotifySettingsEmpty, "PeerNotifySettingsEmpty" },
+    { TLValue::PeerNotifySettings, "PeerNotifySettings" },
+    { TLValue::WallPaper, "WallPaper" },
+    { TLValue::WallPaperSolid, "WallPaperSolid" },
+    { TLValue::InputReportReasonSpam, "InputReportReasonSpam" },
+    { TLValue::InputReportReasonViolence, "InputReportReasonViolence" },
+    { TLValue::InputReportReasonPornography, "InputReportReasonPornography" },
+    { TLValue::InputReportReasonOther, "InputReportReasonOther" },
+    { TLValue::UserFull, "UserFull" },
+    { TLValue::Contact, "Contact" },
+    { TLValue::ImportedContact, "ImportedContact" },
+    { TLValue::ContactBlocked, "ContactBlocked" },
+    { TLValue::ContactSuggested, "ContactSuggested" },
+    { TLValue::ContactStatus, "ContactStatus" },
+    { TLValue::ContactsLink, "ContactsLink" },
+    { TLValue::ContactsContactsNotModified, "ContactsContactsNotModified" },
+    { TLValue::ContactsContacts, "ContactsContacts" },
+    { TLValue::ContactsImportedContacts, "ContactsImportedContacts" },
+    { TLValue::ContactsBlocked, "ContactsBlocked" },
+    { TLValue::ContactsBlockedSlice, "ContactsBlockedSlice" },
+    { TLValue::ContactsSuggested, "ContactsSuggested" },
+    { TLValue::MessagesDialogs, "MessagesDialogs" },
+    { TLValue::MessagesDialogsSlice, "MessagesDialogsSlice" },
+    { TLValue::MessagesMessages, "MessagesMessages" },
+    { TLValue::MessagesMessagesSlice, "MessagesMessagesSlice" },
+    { TLValue::MessagesChannelMessages, "MessagesChannelMessages" },
+    { TLValue::MessagesChats, "MessagesChats" },
+    { TLValue::MessagesChatFull, "MessagesChatFull" },
+    { TLValue::MessagesAffectedHistory, "MessagesAffectedHistory" },
+    { TLValue::InputMessagesFilterEmpty, "InputMessagesFilterEmpty" },
+    { TLValue::InputMessagesFilterPhotos, "InputMessagesFilterPhotos" },
+    { TLValue::InputMessagesFilterVideo, "InputMessagesFilterVideo" },
+    { TLValue::InputMessagesFilterPhotoVideo, "InputMessagesFilterPhotoVideo" },
+    { TLValue::InputMessagesFilterPhotoVideoDocuments, "InputMessagesFilterPhotoVideoDocuments" },
+    { TLValue::InputMessagesFilterDocument, "InputMessagesFilterDocument" },
+    { TLValue::InputMessagesFilterAudio, "InputMessagesFilterAudio" },
+    { TLValue::InputMessagesFilterAudioDocuments, "InputMessagesFilterAudioDocuments" },
+    { TLValue::InputMessagesFilterUrl, "InputMessagesFilterUrl" },
+    { TLValue::InputMessagesFilterGif, "InputMessagesFilterGif" },
+    { TLValue::UpdateNewMessage, "UpdateNewMessage" },
+    { TLValue::UpdateMessageID, "UpdateMessageID" },
+    { TLValue::UpdateDeleteMessages, "UpdateDeleteMessages" },
+    { TLValue::UpdateUserTyping, "UpdateUserTyping" },
+    { TLValue::UpdateChatUserTyping, "UpdateChatUserTyping" },
+    { TLValue::UpdateChatParticipants, "UpdateChatParticipants" },
+    { TLValue::UpdateUserStatus, "UpdateUserStatus" },
+    { TLValue::UpdateUserName, "UpdateUserName" },
+    { TLValue::UpdateUserPhoto, "UpdateUserPhoto" },
+    { TLValue::UpdateContactRegistered, "UpdateContactRegistered" },
+    { TLValue::UpdateContactLink, "UpdateContactLink" },
+    { TLValue::UpdateNewAuthorization, "UpdateNewAuthorization" },
+    { TLValue::UpdateNewEncryptedMessage, "UpdateNewEncryptedMessage" },
+    { TLValue::UpdateEncryptedChatTyping, "UpdateEncryptedChatTyping" },
+    { TLValue::UpdateEncryption, "UpdateEncryption" },
+    { TLValue::UpdateEncryptedMessagesRead, "UpdateEncryptedMessagesRead" },
+    { TLValue::UpdateChatParticipantAdd, "UpdateChatParticipantAdd" },
+    { TLValue::UpdateChatParticipantDelete, "UpdateChatParticipantDelete" },
+    { TLValue::UpdateDcOptions, "UpdateDcOptions" },
+    { TLValue::UpdateUserBlocked, "UpdateUserBlocked" },
+    { TLValue::UpdateNotifySettings, "UpdateNotifySettings" },
+    { TLValue::UpdateServiceNotification, "UpdateServiceNotification" },
+    { TLValue::UpdatePrivacy, "UpdatePrivacy" },
+    { TLValue::UpdateUserPhone, "UpdateUserPhone" },
+    { TLValue::UpdateReadHistoryInbox, "UpdateReadHistoryInbox" },
+    { TLValue::UpdateReadHistoryOutbox, "UpdateReadHistoryOutbox" },
+    { TLValue::UpdateWebPage, "UpdateWebPage" },
+    { TLValue::UpdateReadMessagesContents, "UpdateReadMessagesContents" },
+    { TLValue::UpdateChannelTooLong, "UpdateChannelTooLong" },
+    { TLValue::UpdateChannel, "UpdateChannel" },
+    { TLValue::UpdateChannelGroup, "UpdateChannelGroup" },
+    { TLValue::UpdateNewChannelMessage, "UpdateNewChannelMessage" },
+    { TLValue::UpdateReadChannelInbox, "UpdateReadChannelInbox" },
+    { TLValue::UpdateDeleteChannelMessages, "UpdateDeleteChannelMessages" },
+    { TLValue::UpdateChannelMessageViews, "UpdateChannelMessageViews" },
+    { TLValue::UpdateChatAdmins, "UpdateChatAdmins" },
+    { TLValue::UpdateChatParticipantAdmin, "UpdateChatParticipantAdmin" },
+    { TLValue::UpdateNewStickerSet, "UpdateNewStickerSet" },
+    { TLValue::UpdateStickerSetsOrder, "UpdateStickerSetsOrder" },
+    { TLValue::UpdateStickerSets, "UpdateStickerSets" },
+    { TLValue::UpdateSavedGifs, "UpdateSavedGifs" },
+    { TLValue::UpdateBotInlineQuery, "UpdateBotInlineQuery" },
+    { TLValue::UpdatesState, "UpdatesState" },
+    { TLValue::UpdatesDifferenceEmpty, "UpdatesDifferenceEmpty" },
+    { TLValue::UpdatesDifference, "UpdatesDifference" },
+    { TLValue::UpdatesDifferenceSlice, "UpdatesDifferenceSlice" },
+    { TLValue::UpdatesTooLong, "UpdatesTooLong" },
+    { TLValue::UpdateShortMessage, "UpdateShortMessage" },
+    { TLValue::UpdateShortChatMessage, "UpdateShortChatMessage" },
+    { TLValue::UpdateShort, "UpdateShort" },
+    { TLValue::UpdatesCombined, "UpdatesCombined" },
+    { TLValue::Updates, "Updates" },
+    { TLValue::UpdateShortSentMessage, "UpdateShortSentMessage" },
+    { TLValue::PhotosPhotos, "PhotosPhotos" },
+    { TLValue::PhotosPhotosSlice, "PhotosPhotosSlice" },
+    { TLValue::PhotosPhoto, "PhotosPhoto" },
+    { TLValue::UploadFile, "UploadFile" },
+    { TLValue::DcOption, "DcOption" },
+    { TLValue::Config, "Config" },
+    { TLValue::NearestDc, "NearestDc" },
+    { TLValue::HelpAppUpdate, "HelpAppUpdate" },
+    { TLValue::HelpNoAppUpdate, "HelpNoAppUpdate" },
+    { TLValue::HelpInviteText, "HelpInviteText" },
+    { TLValue::EncryptedChatEmpty, "EncryptedChatEmpty" },
+    { TLValue::EncryptedChatWaiting, "EncryptedChatWaiting" },
+    { TLValue::EncryptedChatRequested, "EncryptedChatRequested" },
+    { TLValue::EncryptedChat, "EncryptedChat" },
+    { TLValue::EncryptedChatDiscarded, "EncryptedChatDiscarded" },
+    { TLValue::InputEncryptedChat, "InputEncryptedChat" },
+    { TLValue::EncryptedFileEmpty, "EncryptedFileEmpty" },
+    { TLValue::EncryptedFile, "EncryptedFile" },
+    { TLValue::InputEncryptedFileEmpty, "InputEncryptedFileEmpty" },
+    { TLValue::InputEncryptedFileUploaded, "InputEncryptedFileUploaded" },
+    { TLValue::InputEncryptedFile, "InputEncryptedFile" },
+    { TLValue::InputEncryptedFileBigUploaded, "InputEncryptedFileBigUploaded" },
+    { TLValue::EncryptedMessage, "EncryptedMessage" },
+    { TLValue::EncryptedMessageService, "EncryptedMessageService" },
+    { TLValue::MessagesDhConfigNotModified, "MessagesDhConfigNotModified" },
+    { TLValue::MessagesDhConfig, "MessagesDhConfig" },
+    { TLValue::MessagesSentEncryptedMessage, "MessagesSentEncryptedMessage" },
+    { TLValue::MessagesSentEncryptedFile, "MessagesSentEncryptedFile" },
+    { TLValue::InputAudioEmpty, "InputAudioEmpty" },
+    { TLValue::InputAudio, "InputAudio" },
+    { TLValue::InputDocumentEmpty, "InputDocumentEmpty" },
+    { TLValue::InputDocument, "InputDocument" },
+    { TLValue::AudioEmpty, "AudioEmpty" },
+    { TLValue::Audio, "Audio" },
+    { TLValue::DocumentEmpty, "DocumentEmpty" },
+    { TLValue::Document, "Document" },
+    { TLValue::HelpSupport, "HelpSupport" },
+    { TLValue::NotifyPeer, "NotifyPeer" },
+    { TLValue::NotifyUsers, "NotifyUsers" },
+    { TLValue::NotifyChats, "NotifyChats" },
+    { TLValue::NotifyAll, "NotifyAll" },
+    { TLValue::SendMessageTypingAction, "SendMessageTypingAction" },
+    { TLValue::SendMessageCancelAction, "SendMessageCancelAction" },
+    { TLValue::SendMessageRecordVideoAction, "SendMessageRecordVideoAction" },
+    { TLValue::SendMessageUploadVideoAction, "SendMessageUploadVideoAction" },
+    { TLValue::SendMessageRecordAudioAction, "SendMessageRecordAudioAction" },
+    { TLValue::SendMessageUploadAudioAction, "SendMessageUploadAudioAction" },
+    { TLValue::SendMessageUploadPhotoAction, "SendMessageUploadPhotoAction" },
+    { TLValue::SendMessageUploadDocumentAction, "SendMessageUploadDocumentAction" },
+    { TLValue::SendMessageGeoLocationAction, "SendMessageGeoLocationAction" },
+    { TLValue::SendMessageChooseContactAction, "SendMessageChooseContactAction" },
+    { TLValue::ContactsFound, "ContactsFound" },
+    { TLValue::InputPrivacyKeyStatusTimestamp, "InputPrivacyKeyStatusTimestamp" },
+    { TLValue::PrivacyKeyStatusTimestamp, "PrivacyKeyStatusTimestamp" },
+    { TLValue::InputPrivacyValueAllowContacts, "InputPrivacyValueAllowContacts" },
+    { TLValue::InputPrivacyValueAllowAll, "InputPrivacyValueAllowAll" },
+    { TLValue::InputPrivacyValueAllowUsers, "InputPrivacyValueAllowUsers" },
+    { TLValue::InputPrivacyValueDisallowContacts, "InputPrivacyValueDisallowContacts" },
+    { TLValue::InputPrivacyValueDisallowAll, "InputPrivacyValueDisallowAll" },
+    { TLValue::InputPrivacyValueDisallowUsers, "InputPrivacyValueDisallowUsers" },
+    { TLValue::PrivacyValueAllowContacts, "PrivacyValueAllowContacts" },
+    { TLValue::PrivacyValueAllowAll, "PrivacyValueAllowAll" },
+    { TLValue::PrivacyValueAllowUsers, "PrivacyValueAllowUsers" },
+    { TLValue::PrivacyValueDisallowContacts, "PrivacyValueDisallowContacts" },
+    { TLValue::PrivacyValueDisallowAll, "PrivacyValueDisallowAll" },
+    { TLValue::PrivacyValueDisallowUsers, "PrivacyValueDisallowUsers" },
+    { TLValue::AccountPrivacyRules, "AccountPrivacyRules" },
+    { TLValue::AccountDaysTTL, "AccountDaysTTL" },
+    { TLValue::AccountSentChangePhoneCode, "AccountSentChangePhoneCode" },
+    { TLValue::DocumentAttributeImageSize, "DocumentAttributeImageSize" },
+    { TLValue::DocumentAttributeAnimated, "DocumentAttributeAnimated" },
+    { TLValue::DocumentAttributeSticker, "DocumentAttributeSticker" },
+    { TLValue::DocumentAttributeVideo, "DocumentAttributeVideo" },
+    { TLValue::DocumentAttributeAudio, "DocumentAttributeAudio" },
+    { TLValue::DocumentAttributeFilename, "DocumentAttributeFilename" },
+    { TLValue::MessagesStickersNotModified, "MessagesStickersNotModified" },
+    { TLValue::MessagesStickers, "MessagesStickers" },
+    { TLValue::StickerPack, "StickerPack" },
+    { TLValue::MessagesAllStickersNotModified, "MessagesAllStickersNotModified" },
+    { TLValue::MessagesAllStickers, "MessagesAllStickers" },
+    { TLValue::DisabledFeature, "DisabledFeature" },
+    { TLValue::MessagesAffectedMessages, "MessagesAffectedMessages" },
+    { TLValue::ContactLinkUnknown, "ContactLinkUnknown" },
+    { TLValue::ContactLinkNone, "ContactLinkNone" },
+    { TLValue::ContactLinkHasPhone, "ContactLinkHasPhone" },
+    { TLValue::ContactLinkContact, "ContactLinkContact" },
+    { TLValue::WebPageEmpty, "WebPageEmpty" },
+    { TLValue::WebPagePending, "WebPagePending" },
+    { TLValue::WebPage, "WebPage" },
+    { TLValue::Authorization, "Authorization" },
+    { TLValue::AccountAuthorizations, "AccountAuthorizations" },
+    { TLValue::AccountNoPassword, "AccountNoPassword" },
+    { TLValue::AccountPassword, "AccountPassword" },
+    { TLValue::AccountPasswordSettings, "AccountPasswordSettings" },
+    { TLValue::AccountPasswordInputSettings, "AccountPasswordInputSettings" },
+    { TLValue::AuthPasswordRecovery, "AuthPasswordRecovery" },
+    { TLValue::ReceivedNotifyMessage, "ReceivedNotifyMessage" },
+    { TLValue::ChatInviteEmpty, "ChatInviteEmpty" },
+    { TLValue::ChatInviteExported, "ChatInviteExported" },
+    { TLValue::ChatInviteAlready, "ChatInviteAlready" },
+    { TLValue::ChatInvite, "ChatInvite" },
+    { TLValue::InputStickerSetEmpty, "InputStickerSetEmpty" },
+    { TLValue::InputStickerSetID, "InputStickerSetID" },
+    { TLValue::InputStickerSetShortName, "InputStickerSetShortName" },
+    { TLValue::StickerSet, "StickerSet" },
+    { TLValue::MessagesStickerSet, "MessagesStickerSet" },
+    { TLValue::BotCommand, "BotCommand" },
+    { TLValue::BotInfoEmpty, "BotInfoEmpty" },
+    { TLValue::BotInfo, "BotInfo" },
+    { TLValue::KeyboardButton, "KeyboardButton" },
+    { TLValue::KeyboardButtonRow, "KeyboardButtonRow" },
+    { TLValue::ReplyKeyboardHide, "ReplyKeyboardHide" },
+    { TLValue::ReplyKeyboardForceReply, "ReplyKeyboardForceReply" },
+    { TLValue::ReplyKeyboardMarkup, "ReplyKeyboardMarkup" },
+    { TLValue::HelpAppChangelogEmpty, "HelpAppChangelogEmpty" },
+    { TLValue::HelpAppChangelog, "HelpAppChangelog" },
+    { TLValue::MessageEntityUnknown, "MessageEntityUnknown" },
+    { TLValue::MessageEntityMention, "MessageEntityMention" },
+    { TLValue::MessageEntityHashtag, "MessageEntityHashtag" },
+    { TLValue::MessageEntityBotCommand, "MessageEntityBotCommand" },
+    { TLValue::MessageEntityUrl, "MessageEntityUrl" },
+    { TLValue::MessageEntityEmail, "MessageEntityEmail" },
+    { TLValue::MessageEntityBold, "MessageEntityBold" },
+    { TLValue::MessageEntityItalic, "MessageEntityItalic" },
+    { TLValue::MessageEntityCode, "MessageEntityCode" },
+    { TLValue::MessageEntityPre, "MessageEntityPre" },
+    { TLValue::MessageEntityTextUrl, "MessageEntityTextUrl" },
+    { TLValue::InputChannelEmpty, "InputChannelEmpty" },
+    { TLValue::InputChannel, "InputChannel" },
+    { TLValue::ContactsResolvedPeer, "ContactsResolvedPeer" },
+    { TLValue::MessageRange, "MessageRange" },
+    { TLValue::MessageGroup, "MessageGroup" },
+    { TLValue::UpdatesChannelDifferenceEmpty, "UpdatesChannelDifferenceEmpty" },
+    { TLValue::UpdatesChannelDifferenceTooLong, "UpdatesChannelDifferenceTooLong" },
+    { TLValue::UpdatesChannelDifference, "UpdatesChannelDifference" },
+    { TLValue::ChannelMessagesFilterEmpty, "ChannelMessagesFilterEmpty" },
+    { TLValue::ChannelMessagesFilter, "ChannelMessagesFilter" },
+    { TLValue::ChannelMessagesFilterCollapsed, "ChannelMessagesFilterCollapsed" },
+    { TLValue::ChannelParticipant, "ChannelParticipant" },
+    { TLValue::ChannelParticipantSelf, "ChannelParticipantSelf" },
+    { TLValue::ChannelParticipantModerator, "ChannelParticipantModerator" },
+    { TLValue::ChannelParticipantEditor, "ChannelParticipantEditor" },
+    { TLValue::ChannelParticipantKicked, "ChannelParticipantKicked" },
+    { TLValue::ChannelParticipantCreator, "ChannelParticipantCreator" },
+    { TLValue::ChannelParticipantsRecent, "ChannelParticipantsRecent" },
+    { TLValue::ChannelParticipantsAdmins, "ChannelParticipantsAdmins" },
+    { TLValue::ChannelParticipantsKicked, "ChannelParticipantsKicked" },
+    { TLValue::ChannelParticipantsBots, "ChannelParticipantsBots" },
+    { TLValue::ChannelRoleEmpty, "ChannelRoleEmpty" },
+    { TLValue::ChannelRoleModerator, "ChannelRoleModerator" },
+    { TLValue::ChannelRoleEditor, "ChannelRoleEditor" },
+    { TLValue::ChannelsChannelParticipants, "ChannelsChannelParticipants" },
+    { TLValue::ChannelsChannelParticipant, "ChannelsChannelParticipant" },
+    { TLValue::HelpTermsOfService, "HelpTermsOfService" },
+    { TLValue::FoundGif, "FoundGif" },
+    { TLValue::FoundGifCached, "FoundGifCached" },
+    { TLValue::MessagesFoundGifs, "MessagesFoundGifs" },
+    { TLValue::MessagesSavedGifsNotModified, "MessagesSavedGifsNotModified" },
+    { TLValue::MessagesSavedGifs, "MessagesSavedGifs" },
+    { TLValue::InputBotInlineMessageMediaAuto, "InputBotInlineMessageMediaAuto" },
+    { TLValue::InputBotInlineMessageText, "InputBotInlineMessageText" },
+    { TLValue::InputBotInlineResult, "InputBotInlineResult" },
+    { TLValue::BotInlineMessageMediaAuto, "BotInlineMessageMediaAuto" },
+    { TLValue::BotInlineMessageText, "BotInlineMessageText" },
+    { TLValue::BotInlineMediaResultDocument, "BotInlineMediaResultDocument" },
+    { TLValue::BotInlineMediaResultPhoto, "BotInlineMediaResultPhoto" },
+    { TLValue::BotInlineResult, "BotInlineResult" },
+    { TLValue::MessagesBotResults, "MessagesBotResults" },
+    { TLValue::InvokeAfterMsg, "InvokeAfterMsg" },
+    { TLValue::InvokeAfterMsgs, "InvokeAfterMsgs" },
+    { TLValue::InitConnection, "InitConnection" },
+    { TLValue::InvokeWithLayer, "InvokeWithLayer" },
+    { TLValue::InvokeWithoutUpdates, "InvokeWithoutUpdates" },
+    { TLValue::AuthCheckPhone, "AuthCheckPhone" },
+    { TLValue::AuthSendCode, "AuthSendCode" },
+    { TLValue::AuthSendCall, "AuthSendCall" },
+    { TLValue::AuthSignUp, "AuthSignUp" },
+    { TLValue::AuthSignIn, "AuthSignIn" },
+    { TLValue::AuthLogOut, "AuthLogOut" },
+    { TLValue::AuthResetAuthorizations, "AuthResetAuthorizations" },
+    { TLValue::AuthSendInvites, "AuthSendInvites" },
+    { TLValue::AuthExportAuthorization, "AuthExportAuthorization" },
+    { TLValue::AuthImportAuthorization, "AuthImportAuthorization" },
+    { TLValue::AuthBindTempAuthKey, "AuthBindTempAuthKey" },
+    { TLValue::AuthSendSms, "AuthSendSms" },
+    { TLValue::AuthImportBotAuthorization, "AuthImportBotAuthorization" },
+    { TLValue::AuthCheckPassword, "AuthCheckPassword" },
+    { TLValue::AuthRequestPasswordRecovery, "AuthRequestPasswordRecovery" },
+    { TLValue::AuthRecoverPassword, "AuthRecoverPassword" },
+    { TLValue::AccountRegisterDevice, "AccountRegisterDevice" },
+    { TLValue::AccountUnregisterDevice, "AccountUnregisterDevice" },
+    { TLValue::AccountUpdateNotifySettings, "AccountUpdateNotifySettings" },
+    { TLValue::AccountGetNotifySettings, "AccountGetNotifySettings" },
+    { TLValue::AccountResetNotifySettings, "AccountResetNotifySettings" },
+    { TLValue::AccountUpdateProfile, "AccountUpdateProfile" },
+    { TLValue::AccountUpdateStatus, "AccountUpdateStatus" },
+    { TLValue::AccountGetWallPapers, "AccountGetWallPapers" },
+    { TLValue::AccountReportPeer, "AccountReportPeer" },
+    { TLValue::AccountCheckUsername, "AccountCheckUsername" },
+    { TLValue::AccountUpdateUsername, "AccountUpdateUsername" },
+    { TLValue::AccountGetPrivacy, "AccountGetPrivacy" },
+    { TLValue::AccountSetPrivacy, "AccountSetPrivacy" },
+    { TLValue::AccountDeleteAccount, "AccountDeleteAccount" },
+    { TLValue::AccountGetAccountTTL, "AccountGetAccountTTL" },
+    { TLValue::AccountSetAccountTTL, "AccountSetAccountTTL" },
+    { TLValue::AccountSendChangePhoneCode, "AccountSendChangePhoneCode" },
+    { TLValue::AccountChangePhone, "AccountChangePhone" },
+    { TLValue::AccountUpdateDeviceLocked, "AccountUpdateDeviceLocked" },
+    { TLValue::AccountGetAuthorizations, "AccountGetAuthorizations" },
+    { TLValue::AccountResetAuthorization, "AccountResetAuthorization" },
+    { TLValue::AccountGetPassword, "AccountGetPassword" },
+    { TLValue::AccountGetPasswordSettings, "AccountGetPasswordSettings" },
+    { TLValue::AccountUpdatePasswordSettings, "AccountUpdatePasswordSettings" },
+    { TLValue::UsersGetUsers, "UsersGetUsers" },
+    { TLValue::UsersGetFullUser, "UsersGetFullUser" },
+    { TLValue::ContactsGetStatuses, "ContactsGetStatuses" },
+    { TLValue::ContactsGetContacts, "ContactsGetContacts" },
+    { TLValue::ContactsImportContacts, "ContactsImportContacts" },
+    { TLValue::ContactsGetSuggested, "ContactsGetSuggested" },
+    { TLValue::ContactsDeleteContact, "ContactsDeleteContact" },
+    { TLValue::ContactsDeleteContacts, "ContactsDeleteContacts" },
+    { TLValue::ContactsBlock, "ContactsBlock" },
+    { TLValue::ContactsUnblock, "ContactsUnblock" },
+    { TLValue::ContactsGetBlocked, "ContactsGetBlocked" },
+    { TLValue::ContactsExportCard, "ContactsExportCard" },
+    { TLValue::ContactsImportCard, "ContactsImportCard" },
+    { TLValue::ContactsSearch, "ContactsSearch" },
+    { TLValue::ContactsResolveUsername, "ContactsResolveUsername" },
+    { TLValue::MessagesGetMessages, "MessagesGetMessages" },
+    { TLValue::MessagesGetDialogs, "MessagesGetDialogs" },
+    { TLValue::MessagesGetHistory, "MessagesGetHistory" },
+    { TLValue::MessagesSearch, "MessagesSearch" },
+    { TLValue::MessagesReadHistory, "MessagesReadHistory" },
+    { TLValue::MessagesDeleteHistory, "MessagesDeleteHistory" },
+    { TLValue::MessagesDeleteMessages, "MessagesDeleteMessages" },
+    { TLValue::MessagesReceivedMessages, "MessagesReceivedMessages" },
+    { TLValue::MessagesSetTyping, "MessagesSetTyping" },
+    { TLValue::MessagesSendMessage, "MessagesSendMessage" },
+    { TLValue::MessagesSendMedia, "MessagesSendMedia" },
+    { TLValue::MessagesForwardMessages, "MessagesForwardMessages" },
+    { TLValue::MessagesReportSpam, "MessagesReportSpam" },
+    { TLValue::MessagesGetChats, "MessagesGetChats" },
+    { TLValue::MessagesGetFullChat, "MessagesGetFullChat" },
+    { TLValue::MessagesEditChatTitle, "MessagesEditChatTitle" },
+    { TLValue::MessagesEditChatPhoto, "MessagesEditChatPhoto" },
+    { TLValue::MessagesAddChatUser, "MessagesAddChatUser" },
+    { TLValue::MessagesDeleteChatUser, "MessagesDeleteChatUser" },
+    { TLValue::MessagesCreateChat, "MessagesCreateChat" },
+    { TLValue::MessagesForwardMessage, "MessagesForwardMessage" },
+    { TLValue::MessagesSendBroadcast, "MessagesSendBroadcast" },
+    { TLValue::MessagesGetDhConfig, "MessagesGetDhConfig" },
+    { TLValue::MessagesRequestEncryption, "MessagesRequestEncryption" },
+    { TLValue::MessagesAcceptEncryption, "MessagesAcceptEncryption" },
+    { TLValue::MessagesDiscardEncryption, "MessagesDiscardEncryption" },
+    { TLValue::MessagesSetEncryptedTyping, "MessagesSetEncryptedTyping" },
+    { TLValue::MessagesReadEncryptedHistory, "MessagesReadEncryptedHistory" },
+    { TLValue::MessagesSendEncrypted, "MessagesSendEncrypted" },
+    { TLValue::MessagesSendEncryptedFile, "MessagesSendEncryptedFile" },
+    { TLValue::MessagesSendEncryptedService, "MessagesSendEncryptedService" },
+    { TLValue::MessagesReceivedQueue, "MessagesReceivedQueue" },
+    { TLValue::MessagesReadMessageContents, "MessagesReadMessageContents" },
+    { TLValue::MessagesGetStickers, "MessagesGetStickers" },
+    { TLValue::MessagesGetAllStickers, "MessagesGetAllStickers" },
+    { TLValue::MessagesGetWebPagePreview, "MessagesGetWebPagePreview" },
+    { TLValue::MessagesExportChatInvite, "MessagesExportChatInvite" },
+    { TLValue::MessagesCheckChatInvite, "MessagesCheckChatInvite" },
+    { TLValue::MessagesImportChatInvite, "MessagesImportChatInvite" },
+    { TLValue::MessagesGetStickerSet, "MessagesGetStickerSet" },
+    { TLValue::MessagesInstallStickerSet, "MessagesInstallStickerSet" },
+    { TLValue::MessagesUninstallStickerSet, "MessagesUninstallStickerSet" },
+    { TLValue::MessagesStartBot, "MessagesStartBot" },
+    { TLValue::MessagesGetMessagesViews, "MessagesGetMessagesViews" },
+    { TLValue::MessagesToggleChatAdmins, "MessagesToggleChatAdmins" },
+    { TLValue::MessagesEditChatAdmin, "MessagesEditChatAdmin" },
+    { TLValue::MessagesMigrateChat, "MessagesMigrateChat" },
+    { TLValue::MessagesSearchGlobal, "MessagesSearchGlobal" },
+    { TLValue::MessagesReorderStickerSets, "MessagesReorderStickerSets" },
+    { TLValue::MessagesGetDocumentByHash, "MessagesGetDocumentByHash" },
+    { TLValue::MessagesSearchGifs, "MessagesSearchGifs" },
+    { TLValue::MessagesGetSavedGifs, "MessagesGetSavedGifs" },
+    { TLValue::MessagesSaveGif, "MessagesSaveGif" },
+    { TLValue::MessagesGetInlineBotResults, "MessagesGetInlineBotResults" },
+    { TLValue::MessagesSetInlineBotResults, "MessagesSetInlineBotResults" },
+    { TLValue::MessagesSendInlineBotResult, "MessagesSendInlineBotResult" },
+    { TLValue::UpdatesGetState, "UpdatesGetState" },
+    { TLValue::UpdatesGetDifference, "UpdatesGetDifference" },
+    { TLValue::UpdatesGetChannelDifference, "UpdatesGetChannelDifference" },
+    { TLValue::PhotosUpdateProfilePhoto, "PhotosUpdateProfilePhoto" },
+    { TLValue::PhotosUploadProfilePhoto, "PhotosUploadProfilePhoto" },
+    { TLValue::PhotosDeletePhotos, "PhotosDeletePhotos" },
+    { TLValue::PhotosGetUserPhotos, "PhotosGetUserPhotos" },
+    { TLValue::UploadSaveFilePart, "UploadSaveFilePart" },
+    { TLValue::UploadGetFile, "UploadGetFile" },
+    { TLValue::UploadSaveBigFilePart, "UploadSaveBigFilePart" },
+    { TLValue::HelpGetConfig, "HelpGetConfig" },
+    { TLValue::HelpGetNearestDc, "HelpGetNearestDc" },
+    { TLValue::HelpGetAppUpdate, "HelpGetAppUpdate" },
+    { TLValue::HelpSaveAppLog, "HelpSaveAppLog" },
+    { TLValue::HelpGetInviteText, "HelpGetInviteText" },
+    { TLValue::HelpGetSupport, "HelpGetSupport" },
+    { TLValue::HelpGetAppChangelog, "HelpGetAppChangelog" },
+    { TLValue::HelpGetTermsOfService, "HelpGetTermsOfService" },
+    { TLValue::ChannelsGetDialogs, "ChannelsGetDialogs" },
+    { TLValue::ChannelsGetImportantHistory, "ChannelsGetImportantHistory" },
+    { TLValue::ChannelsReadHistory, "ChannelsReadHistory" },
+    { TLValue::ChannelsDeleteMessages, "ChannelsDeleteMessages" },
+    { TLValue::ChannelsDeleteUserHistory, "ChannelsDeleteUserHistory" },
+    { TLValue::ChannelsReportSpam, "ChannelsReportSpam" },
+    { TLValue::ChannelsGetMessages, "ChannelsGetMessages" },
+    { TLValue::ChannelsGetParticipants, "ChannelsGetParticipants" },
+    { TLValue::ChannelsGetParticipant, "ChannelsGetParticipant" },
+    { TLValue::ChannelsGetChannels, "ChannelsGetChannels" },
+    { TLValue::ChannelsGetFullChannel, "ChannelsGetFullChannel" },
+    { TLValue::ChannelsCreateChannel, "ChannelsCreateChannel" },
+    { TLValue::ChannelsEditAbout, "ChannelsEditAbout" },
+    { TLValue::ChannelsEditAdmin, "ChannelsEditAdmin" },
+    { TLValue::ChannelsEditTitle, "ChannelsEditTitle" },
+    { TLValue::ChannelsEditPhoto, "ChannelsEditPhoto" },
+    { TLValue::ChannelsToggleComments, "ChannelsToggleComments" },
+    { TLValue::ChannelsCheckUsername, "ChannelsCheckUsername" },
+    { TLValue::ChannelsUpdateUsername, "ChannelsUpdateUsername" },
+    { TLValue::ChannelsJoinChannel, "ChannelsJoinChannel" },
+    { TLValue::ChannelsLeaveChannel, "ChannelsLeaveChannel" },
+    { TLValue::ChannelsInviteToChannel, "ChannelsInviteToChannel" },
+    { TLValue::ChannelsKickFromChannel, "ChannelsKickFromChannel" },
+    { TLValue::ChannelsExportInvite, "ChannelsExportInvite" },
+    { TLValue::ChannelsDeleteChannel, "ChannelsDeleteChannel" },
+};
+// End of generated TLValues lookup table
+
+// The hash functions must match the ones used by the generator
+static int valueIndex(quint32 value)
+{
+    const quint32 bucket = (value * 0x9e3779b1u) >> (32 - s_valueBucketBits);
+    const quint32 slot = ((value ^ s_valueSeeds[bucket]) * 0x85ebca6bu) >> (32 - s_valueSlotBits);
+    const quint16 index = s_valueSlots[slot];
+    if ((index == 0xffff) || (s_valueEntries[index].value != value)) {
+        return -1;
+    }
+    return index;
+}
 
 bool TLValue::isValid() const
 {
-    return enumerator.valueToKey(m_value);
+    return valueIndex(m_value) >= 0;
 }
 
 QString TLValue::toString() const
 {
-    const char *value = enumerator.valueToKey(m_value);
-    if (value) {
-        return QString::fromLatin1(value);
+    const int index = valueIndex(m_value);
+    if (index >= 0) {
+        return QString::fromLatin1(s_valueEntries[index].name);
     } else {
         return QString(QLatin1String("%1")).arg(m_value, 8, 16, QLatin1Char('0'));
     }
@@ -26,7 +26,9 @@ struct TLValue {
     Q_GADGET
     Q_ENUMS(Value)
 public:
+    // Generated layer
     static constexpr quint32 CurrentLayer = 45;
+    // End of generated layer
     enum Value : quint32 {
         // Generated TLValues (proto)
         ResPQ = 0x05162463,
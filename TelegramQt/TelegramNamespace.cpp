@@ -1008,6 +1008,18 @@ QString Telegram::Utils::maskPhoneNumber(const QString &identifier)
     return identifier.mid(0, identifier.size() / 4) + QString(identifier.size() - identifier.size() / 4, QLatin1Char('x')); // + QLatin1String(" (hidden)");
 }
 
+QString Telegram::Utils::normalizedPhoneNumber(const QString &phone)
+{
+    QString result;
+    result.reserve(phone.size());
+    for (const QChar c : phone) {
+        if (c.isDigit()) {
+            result.append(c);
+        }
+    }
+    return result;
+}
+
 QStringList Telegram::Utils::maskPhoneNumber(const QStringList &list)
 {
     if (list.count() == 1) {
@@ -226,6 +226,18 @@ struct Peer
     }
 };
 
+inline uint qHash(const Peer &key, uint seed = 0)
+{
+    // Mix both the type and the id, so user 123 and chat 123 get different hashes
+    quint64 h = (quint64(key.type) << 32) | key.id;
+    h ^= h >> 33;
+    h *= Q_UINT64_C(0xff51afd7ed558ccd);
+    h ^= h >> 33;
+    h *= Q_UINT64_C(0xc4ceb3f99ce85a1a);
+    h ^= h >> 33;
+    return uint(h ^ (h >> 32)) ^ seed;
+}
+
 struct DcOption
 {
     DcOption() : port(0) { }
@@ -477,6 +489,8 @@ namespace Utils
 
 QString maskPhoneNumber(const QString &identifier);
 QStringList maskPhoneNumber(const QStringList &list);
+// Keeps only digits, so "+7 (123) 456-78-90" and "71234567890" are the same number
+QString normalizedPhoneNumber(const QString &phone);
 
 template <typename T>
 T maskPhoneNumber(T container, const QString &key)
@@ -36,11 +36,20 @@ SOURCES = CTelegramCore.cpp \
     CTelegramTransportModule.cpp \
     CRawStream.cpp \
     CTelegramStream.cpp \
+    CTelegramStreamExtraOperators.cpp \
     AbridgedLength.cpp \
     Debug.cpp \
     Utils.cpp \
+    CacheSnapshot.cpp \
+    DialogMap.cpp \
+    FileHasher.cpp \
     FileRequestDescriptor.cpp \
+    MediaCache.cpp \
+    MessageCache.cpp \
+    MessageRangeSet.cpp \
+    PartialFile.cpp \
     TelegramUtils.cpp \
+    TypingStatusMap.cpp \
     CTelegramTransport.cpp \
     CTcpTransport.cpp \
     CClientTcpTransport.cpp \
@@ -72,13 +81,23 @@ HEADERS = CTelegramCore.hpp \
     CTelegramTransportModule.hpp \
     CTelegramStream.hpp \
     CTelegramStream_p.hpp \
+    CTelegramStreamExtraOperators.hpp \
     CRawStream.hpp \
     Utils.hpp \
+    CacheSnapshot.hpp \
+    DialogMap.hpp \
+    FileHasher.hpp \
     FileRequestDescriptor.hpp \
+    MediaCache.hpp \
+    MessageCache.hpp \
+    MessageRangeSet.hpp \
+    PartialFile.hpp \
     TelegramUtils.hpp \
+    TypingStatusMap.hpp \
     CTelegramTransport.hpp \
     CTcpTransport.hpp \
     CClientTcpTransport.hpp \
+    TLLazy.hpp \
     TLTypes.hpp \
     TLNumbers.hpp \
     crypto-aes.hpp \
@@ -0,0 +1,127 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include "TypingStatusMap.hpp"
+
+#include <algorithm>
+
+namespace {
+
+struct LaterDeadline {
+    template <typename T>
+    bool operator()(const T &left, const T &right) const { return left.deadline > right.deadline; }
+};
+
+}
+
+TelegramNamespace::MessageAction TypingStatusMap::action(quint32 chatId, quint32 userId) const
+{
+    return m_entries.value(Key(chatId, userId)).action;
+}
+
+void TypingStatusMap::insert(quint32 chatId, quint32 userId, TelegramNamespace::MessageAction action, qint64 deadline)
+{
+    const Key key(chatId, userId);
+    const bool exists = m_entries.contains(key);
+    Entry &entry = m_entries[key];
+    entry.action = action;
+    if (exists && (entry.deadline == deadline)) {
+        return;
+    }
+    entry.deadline = deadline;
+
+    // The previous heap item of the key (if any) becomes stale
+    m_heap.append(HeapItem(deadline, key));
+    std::push_heap(m_heap.begin(), m_heap.end(), LaterDeadline());
+    dropStaleItems();
+
+    if (m_heap.count() > m_entries.count() * 2 + 16) {
+        rebuildHeap();
+    }
+}
+
+bool TypingStatusMap::remove(quint32 chatId, quint32 userId)
+{
+    if (!m_entries.remove(Key(chatId, userId))) {
+        return false;
+    }
+    dropStaleItems();
+    return true;
+}
+
+void TypingStatusMap::clear()
+{
+    m_entries.clear();
+    m_heap.clear();
+}
+
+qint64 TypingStatusMap::nextDeadline() const
+{
+    if (m_heap.isEmpty()) {
+        return -1;
+    }
+    return m_heap.first().deadline;
+}
+
+QVector<TypingStatusMap::Status> TypingStatusMap::takeExpired(qint64 time)
+{
+    QVector<Status> result;
+    while (!m_heap.isEmpty() && (m_heap.first().deadline <= time)) {
+        const Key key = m_heap.first().key;
+        popHeap();
+
+        Status status;
+        status.chatId = key.first;
+        status.userId = key.second;
+        status.action = m_entries.take(key).action;
+        result.append(status);
+
+        dropStaleItems();
+    }
+    return result;
+}
+
+bool TypingStatusMap::isStale(const HeapItem &item) const
+{
+    const auto it = m_entries.constFind(item.key);
+    return (it == m_entries.constEnd()) || (it.value().deadline != item.deadline);
+}
+
+void TypingStatusMap::popHeap()
+{
+    std::pop_heap(m_heap.begin(), m_heap.end(), LaterDeadline());
+    m_heap.removeLast();
+}
+
+void TypingStatusMap::dropStaleItems()
+{
+    // Keep the invariant: the top item (if any) is valid
+    while (!m_heap.isEmpty() && isStale(m_heap.first())) {
+        popHeap();
+    }
+}
+
+void TypingStatusMap::rebuildHeap()
+{
+    m_heap.clear();
+    m_heap.reserve(m_entries.count());
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        m_heap.append(HeapItem(it.value().deadline, it.key()));
+    }
+    std::make_heap(m_heap.begin(), m_heap.end(), LaterDeadline());
+}
@@ -0,0 +1,82 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#ifndef TYPINGSTATUSMAP_HPP
+#define TYPINGSTATUSMAP_HPP
+
+#include <QHash>
+#include <QPair>
+#include <QVector>
+
+#include "TelegramNamespace.hpp"
+
+// (chatId, userId) to typing action map with expiry deadlines, ordered by a binary min-heap.
+// The heap entries are invalidated lazily, so an update or removal does not need a heap search.
+class TypingStatusMap
+{
+public:
+    typedef QPair<quint32, quint32> Key; // (chatId, userId)
+
+    struct Status {
+        Status() : chatId(0), userId(0), action(TelegramNamespace::MessageActionNone) { }
+        quint32 chatId;
+        quint32 userId;
+        TelegramNamespace::MessageAction action;
+    };
+
+    int count() const { return m_entries.count(); }
+    bool isEmpty() const { return m_entries.isEmpty(); }
+    bool contains(quint32 chatId, quint32 userId) const { return m_entries.contains(Key(chatId, userId)); }
+    TelegramNamespace::MessageAction action(quint32 chatId, quint32 userId) const;
+
+    // Inserts or updates the status; the deadline is an absolute time in ms
+    void insert(quint32 chatId, quint32 userId, TelegramNamespace::MessageAction action, qint64 deadline);
+    bool remove(quint32 chatId, quint32 userId);
+    void clear();
+
+    // Returns the earliest deadline or -1 if the map is empty.
+    qint64 nextDeadline() const;
+    // Removes and returns all statuses with deadline not later than the given time.
+    QVector<Status> takeExpired(qint64 time);
+
+protected:
+    struct Entry {
+        Entry() : action(TelegramNamespace::MessageActionNone), deadline(0) { }
+        TelegramNamespace::MessageAction action;
+        qint64 deadline;
+    };
+
+    struct HeapItem {
+        HeapItem(qint64 d = 0, const Key &k = Key()) : deadline(d), key(k) { }
+        qint64 deadline;
+        Key key;
+    };
+
+    bool isStale(const HeapItem &item) const;
+    void popHeap();
+    void dropStaleItems();
+    void rebuildHeap();
+
+    QHash<Key, Entry> m_entries;
+    QVector<HeapItem> m_heap;
+
+};
+
+Q_DECLARE_TYPEINFO(TypingStatusMap::HeapItem, Q_MOVABLE_TYPE);
+
+#endif // TYPINGSTATUSMAP_HPP
@@ -350,17 +350,26 @@ QByteArray Utils::binaryNumberModExp(const QByteArray &data, const QByteArray &m
 }
 
 QByteArray Utils::aesDecrypt(const QByteArray &data, const SAesKey &key)
+{
+    QByteArray result;
+    aesDecrypt(data, key, &result);
+    return result;
+}
+
+bool Utils::aesDecrypt(const QByteArray &data, const SAesKey &key, QByteArray *output)
 {
     if (data.length() % AES_BLOCK_SIZE) {
         qCritical() << Q_FUNC_INFO << "Data is not padded (size %" << AES_BLOCK_SIZE << "!= 0)";
-        return QByteArray();
+        output->clear();
+        return false;
     }
-    QByteArray result = data;
+    // Keeps the output capacity, so the caller can decrypt packages into the same buffer
+    output->resize(data.length());
     QByteArray initVector = key.iv;
     AES_KEY dec_key;
     AES_set_decrypt_key((const uchar *) key.key.constData(), key.key.length() * 8, &dec_key);
-    AES_ige_encrypt((const uchar *) data.constData(), (uchar *) result.data(), data.length(), &dec_key, (uchar *) initVector.data(), AES_DECRYPT);
-    return result;
+    AES_ige_encrypt((const uchar *) data.constData(), (uchar *) output->data(), data.length(), &dec_key, (uchar *) initVector.data(), AES_DECRYPT);
+    return true;
 }
 
 QByteArray Utils::aesEncrypt(const QByteArray &data, const SAesKey &key)
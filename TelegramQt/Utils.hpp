@@ -66,6 +66,7 @@ Telegram::RsaKey loadRsaKey();
 QByteArray binaryNumberModExp(const QByteArray &data, const QByteArray &mod, const QByteArray &exp);
 QByteArray rsa(const QByteArray &data, const Telegram::RsaKey &key);
 QByteArray aesDecrypt(const QByteArray &data, const SAesKey &key);
+bool aesDecrypt(const QByteArray &data, const SAesKey &key, QByteArray *output);
 QByteArray aesEncrypt(const QByteArray &data, const SAesKey &key);
 QByteArray packGZip(const QByteArray &data);
 QByteArray unpackGZip(const QByteArray &data);
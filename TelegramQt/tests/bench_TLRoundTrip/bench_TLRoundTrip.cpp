@@ -0,0 +1,181 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "TLRandomValues.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+static const quint32 s_benchmarkSeed = 0x5eed;
+static const int s_benchmarkValues = 64;
+
+template <typename T>
+static TLVector<T> randomValues()
+{
+    TestRandom random(s_benchmarkSeed);
+    TLVector<T> values(s_benchmarkValues);
+    for (T &value : values) {
+        fillRandom(value, random);
+    }
+    return values;
+}
+
+template <typename T>
+static void benchmarkEncode()
+{
+    const TLVector<T> values = randomValues<T>();
+    QByteArray output;
+    QBENCHMARK {
+        output.clear();
+        CTelegramStream stream(&output, /* write */ true);
+        stream << values;
+    }
+    qDebug() << output.size() << "bytes per iteration";
+}
+
+template <typename T>
+static void benchmarkDecode()
+{
+    QByteArray input;
+    {
+        CTelegramStream stream(&input, /* write */ true);
+        stream << randomValues<T>();
+    }
+    QBENCHMARK {
+        CTelegramStream stream(input);
+        TLVector<T> values;
+        stream >> values;
+    }
+    qDebug() << input.size() << "bytes per iteration";
+}
+
+struct TypeCase
+{
+    const char *name;
+    void (*benchmarkEncode)();
+    void (*benchmarkDecode)();
+};
+
+struct TypeCaseCollector
+{
+    template <typename T>
+    void visit(const char *name)
+    {
+        cases.append({ name, &benchmarkEncode<T>, &benchmarkDecode<T> });
+    }
+
+    QVector<TypeCase> cases;
+};
+
+class bench_TLRoundTrip : public QObject
+{
+    Q_OBJECT
+public:
+    explicit bench_TLRoundTrip(QObject *parent = nullptr);
+
+private slots:
+    void encode_data();
+    void encode();
+    void decode_data();
+    void decode();
+    void decodeDialogsPage_data();
+    void decodeDialogsPage();
+
+private:
+    void addTypeCases();
+
+    QVector<TypeCase> m_typeCases;
+};
+
+bench_TLRoundTrip::bench_TLRoundTrip(QObject *parent) :
+    QObject(parent)
+{
+    TypeCaseCollector collector;
+    visitRoundTripTypes(collector);
+    m_typeCases = collector.cases;
+}
+
+void bench_TLRoundTrip::addTypeCases()
+{
+    QTest::addColumn<int>("typeIndex");
+    for (int i = 0; i < m_typeCases.count(); ++i) {
+        QTest::newRow(m_typeCases.at(i).name) << i;
+    }
+}
+
+void bench_TLRoundTrip::encode_data()
+{
+    addTypeCases();
+}
+
+void bench_TLRoundTrip::encode()
+{
+    QFETCH(int, typeIndex);
+    m_typeCases.at(typeIndex).benchmarkEncode();
+}
+
+void bench_TLRoundTrip::decode_data()
+{
+    addTypeCases();
+}
+
+void bench_TLRoundTrip::decode()
+{
+    QFETCH(int, typeIndex);
+    m_typeCases.at(typeIndex).benchmarkDecode();
+}
+
+void bench_TLRoundTrip::decodeDialogsPage_data()
+{
+    QTest::addColumn<bool>("headersOnly");
+    QTest::newRow("full") << false;
+    QTest::newRow("headers") << true;
+}
+
+void bench_TLRoundTrip::decodeDialogsPage()
+{
+    QFETCH(bool, headersOnly);
+
+    TLMessagesDialogs dialogs;
+    dialogs.tlType = TLValue::MessagesDialogs;
+    dialogs.dialogs = randomValues<TLDialog>();
+    dialogs.messages = randomValues<TLMessage>();
+    dialogs.users = randomValues<TLUser>();
+
+    QByteArray input;
+    {
+        CTelegramStream stream(&input, /* write */ true);
+        stream << dialogs;
+    }
+    QBENCHMARK {
+        CTelegramStream stream(input);
+        TLMessagesDialogs page;
+        if (headersOnly) {
+            stream.readDialogsPage(&page);
+        } else {
+            stream >> page;
+        }
+    }
+    qDebug() << input.size() << "bytes per iteration";
+}
+
+QTEST_APPLESS_MAIN(bench_TLRoundTrip)
+
+#include "bench_TLRoundTrip.moc"
@@ -0,0 +1,7 @@
+include(../tests.pri)
+
+TARGET = bench_TLRoundTrip
+INCLUDEPATH += ../tst_TLRoundTrip
+SOURCES = bench_TLRoundTrip.cpp
+SOURCES += ../tst_TLRoundTrip/TLRandomValues.cpp
+HEADERS += ../tst_TLRoundTrip/TLRandomValues.hpp
@@ -5,3 +5,14 @@ SUBDIRS += tst_CTelegramStream
 SUBDIRS += tst_TelegramRemoteFile
 SUBDIRS += tst_CTelegramDispatcher
 SUBDIRS += tst_utils
+SUBDIRS += tst_CacheSnapshot
+SUBDIRS += tst_DialogMap
+SUBDIRS += tst_FileRequestDescriptor
+SUBDIRS += tst_MediaCache
+SUBDIRS += tst_MessageCache
+SUBDIRS += tst_MessageRangeSet
+SUBDIRS += tst_PartialFile
+SUBDIRS += tst_TLTaggedUnion
+SUBDIRS += tst_TypingStatusMap
+SUBDIRS += tst_TLRoundTrip
+SUBDIRS += bench_TLRoundTrip
@@ -31,3 +31,13 @@ void CTestDispatcher::testSetDcConfiguration(const QVector<TLDcOption> newDcConf
 {
     m_dcConfiguration = newDcConfiguration;
 }
+
+void CTestDispatcher::testProcessContactList(const QVector<quint32> &contactList)
+{
+    onContactListReceived(contactList);
+}
+
+void CTestDispatcher::testProcessContactListNotModified()
+{
+    onContactListNotModified();
+}
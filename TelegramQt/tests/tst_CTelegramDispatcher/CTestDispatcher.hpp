@@ -29,6 +29,15 @@ public:
     void testProcessUpdate(const TLUpdate &update);
     void testSetDcConfiguration(const QVector<TLDcOption> newDcConfiguration);
     QVector<TLDcOption> testGetDcConfiguration() const { return m_dcConfiguration; }
+    void testSetInitializationState(InitializationStepFlags state) { m_initializationState = state; }
+
+    void testProcessContactList(const QVector<quint32> &contactList);
+    void testProcessContactListNotModified();
+    QVector<quint32> testGetContactList() const { return m_contactIdList; }
+    QString testGetContactsHash() const { return m_contactsHash; }
+    static QString testContactListHash(const QVector<quint32> &sortedContactList) { return contactListHash(sortedContactList); }
+
+    void testProcessUsers(const QVector<TLUser> &users) { onUsersReceived(users); }
 
 };
 
@@ -0,0 +1,43 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "CTestMediaModule.hpp"
+
+CTestMediaModule::CTestMediaModule(QObject *parent) :
+    CTelegramMediaModule(parent)
+{
+}
+
+void CTestMediaModule::testFinishRequest(quint32 requestId, const QByteArray &data)
+{
+    m_requestedFileDescriptors.remove(requestId);
+    deliverFilePart(requestId, data, QStringLiteral("image/jpeg"), 0, data.size());
+    finishFileRequest(requestId, Telegram::RemoteFile());
+}
+
+void CTestMediaModule::testFailRequest(quint32 requestId)
+{
+    m_requestedFileDescriptors.remove(requestId);
+    failFileRequest(requestId);
+}
+
+quint32 CTestMediaModule::addFileRequest(const FileRequestDescriptor &descriptor)
+{
+    m_requestedFileDescriptors.insert(++m_fileRequestCounter, descriptor);
+    m_sentRequests.append(m_fileRequestCounter);
+    return m_fileRequestCounter;
+}
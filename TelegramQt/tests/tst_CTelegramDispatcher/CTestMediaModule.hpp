@@ -0,0 +1,44 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef CTESTMEDIAMODULE_HPP
+#define CTESTMEDIAMODULE_HPP
+
+#include "CTelegramMediaModule.hpp"
+
+// The file requests are recorded instead of being sent to the DC connections
+class CTestMediaModule : public CTelegramMediaModule
+{
+    Q_OBJECT
+public:
+    explicit CTestMediaModule(QObject *parent = nullptr);
+
+    QVector<quint32> testSentRequests() const { return m_sentRequests; }
+    QString testRequestUniqueId(quint32 requestId) const { return m_requestedFileDescriptors.value(requestId).uniqueId; }
+    bool testInsertIntoCache(const QString &uniqueId, const QByteArray &data) { return m_mediaCache.insert(uniqueId, data); }
+
+    void testFinishRequest(quint32 requestId, const QByteArray &data);
+    void testFailRequest(quint32 requestId);
+
+protected:
+    quint32 addFileRequest(const FileRequestDescriptor &descriptor) override;
+
+    QVector<quint32> m_sentRequests;
+
+};
+
+#endif // CTESTMEDIAMODULE_HPP
@@ -18,8 +18,10 @@
 #include <QObject>
 
 #include "CTestDispatcher.hpp"
+#include "CTestMediaModule.hpp"
 
-#include <QBuffer>
+#include <QSignalSpy>
+#include <QTemporaryDir>
 #include <QTest>
 #include <QDebug>
 
@@ -31,6 +33,14 @@ public:
 
 private slots:
     void testUpdateDcOptions();
+    void testPeerHash();
+    void testContactListHash();
+    void testContactListNotModified();
+    void testPrefetchDeduplication();
+    void testPrefetchVisibleFirst();
+    void testPrefetchInteractivePause();
+    void testPrefetchJoinedByApplication();
+    void testLocalRequestsAfterClear();
 
 };
 
@@ -99,6 +109,217 @@ void tst_CTelegramDispatcher::testUpdateDcOptions()
     }
 }
 
+void tst_CTelegramDispatcher::testPeerHash()
+{
+    const Telegram::Peer user(123, Telegram::Peer::User);
+    const Telegram::Peer chat(123, Telegram::Peer::Chat);
+    const Telegram::Peer channel(123, Telegram::Peer::Channel);
+
+    QVERIFY(qHash(user) != qHash(chat));
+    QVERIFY(qHash(user) != qHash(channel));
+    QVERIFY(qHash(chat) != qHash(channel));
+    QCOMPARE(qHash(user), qHash(Telegram::Peer::fromUserId(123)));
+}
+
+void tst_CTelegramDispatcher::testContactListHash()
+{
+    QCOMPARE(CTestDispatcher::testContactListHash(QVector<quint32>()), QString());
+    // MD5 of "6789" and of "12,345,6789"
+    QCOMPARE(CTestDispatcher::testContactListHash({ 6789 }), QStringLiteral("46d045ff5190f6ea93739da6c0aa19bc"));
+    QCOMPARE(CTestDispatcher::testContactListHash({ 12, 345, 6789 }), QStringLiteral("ac38c30ec5316b1c0a94b3af94c751ce"));
+}
+
+void tst_CTelegramDispatcher::testContactListNotModified()
+{
+    CTestDispatcher dispatcher;
+    // Do not request anything on the initialization steps
+    dispatcher.testSetInitializationState(CTelegramDispatcher::StepDcConfiguration);
+
+    QSignalSpy changedSpy(&dispatcher, &CTelegramDispatcher::contactListChanged);
+    dispatcher.testProcessContactList({ 6789, 12, 345 });
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(dispatcher.testGetContactList(), QVector<quint32>({ 12, 345, 6789 }));
+    QCOMPARE(dispatcher.testGetContactsHash(), QStringLiteral("ac38c30ec5316b1c0a94b3af94c751ce"));
+
+    // The cached list and its hash are kept
+    dispatcher.testProcessContactListNotModified();
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(dispatcher.testGetContactList(), QVector<quint32>({ 12, 345, 6789 }));
+    QCOMPARE(dispatcher.testGetContactsHash(), QStringLiteral("ac38c30ec5316b1c0a94b3af94c751ce"));
+}
+
+static TLUser constructUserWithPicture(quint32 userId, quint64 pictureVolumeId)
+{
+    TLUser user;
+    user.tlType = TLValue::User;
+    user.id = userId;
+    user.flags = TLUser::Photo;
+    user.photo.tlType = TLValue::UserProfilePhoto;
+    user.photo.photoSmall.tlType = TLValue::FileLocation;
+    user.photo.photoSmall.dcId = 2;
+    user.photo.photoSmall.volumeId = pictureVolumeId;
+    user.photo.photoSmall.localId = 1;
+    return user;
+}
+
+static Telegram::RemoteFile getUserPicture(const CTelegramMediaModule &module, quint32 userId)
+{
+    Telegram::UserInfo info;
+    Telegram::RemoteFile file;
+    if (module.getUserInfo(&info, userId)) {
+        info.getPeerPicture(&file, Telegram::PeerPictureSize::Small);
+    }
+    return file;
+}
+
+void tst_CTelegramDispatcher::testPrefetchDeduplication()
+{
+    qRegisterMetaType<Telegram::Peer>();
+    CTestMediaModule module;
+    CTestDispatcher dispatcher;
+    dispatcher.plugModule(&module);
+    // The users 1 and 2 have the same picture
+    dispatcher.testProcessUsers({ constructUserWithPicture(1, 10), constructUserWithPicture(2, 10), constructUserWithPicture(3, 30) });
+
+    QSignalSpy pictureSpy(&module, &CTelegramMediaModule::peerPictureReceived);
+    QSignalSpy finishedSpy(&module, &CTelegramMediaModule::fileRequestFinished);
+
+    const QVector<Telegram::Peer> peers = { Telegram::Peer::fromUserId(1), Telegram::Peer::fromUserId(2), Telegram::Peer::fromUserId(3) };
+    module.prefetchPeerPictures(peers, Telegram::PeerPictureSize::Small);
+    QCOMPARE(module.testSentRequests().count(), 2);
+    // A repeated call does not request anything
+    module.prefetchPeerPictures(peers, Telegram::PeerPictureSize::Small);
+    QCOMPARE(module.testSentRequests().count(), 2);
+
+    const quint32 requestId = module.testSentRequests().first();
+    QCOMPARE(module.testRequestUniqueId(requestId), getUserPicture(module, 1).getUniqueId());
+    module.testFinishRequest(requestId, QByteArray("picture"));
+    QCOMPARE(pictureSpy.count(), 2);
+    QCOMPARE(pictureSpy.at(0).at(0).value<Telegram::Peer>(), Telegram::Peer::fromUserId(1));
+    QCOMPARE(pictureSpy.at(1).at(0).value<Telegram::Peer>(), Telegram::Peer::fromUserId(2));
+    QCOMPARE(pictureSpy.at(1).at(1).toByteArray(), QByteArray("picture"));
+    // The prefetch requests are internal
+    QCOMPARE(finishedSpy.count(), 0);
+}
+
+void tst_CTelegramDispatcher::testPrefetchVisibleFirst()
+{
+    CTestMediaModule module;
+    CTestDispatcher dispatcher;
+    dispatcher.plugModule(&module);
+    QVector<TLUser> users;
+    QVector<Telegram::Peer> peers;
+    for (quint32 userId = 1; userId <= 10; ++userId) {
+        users.append(constructUserWithPicture(userId, userId));
+        peers.append(Telegram::Peer::fromUserId(userId));
+    }
+    dispatcher.testProcessUsers(users);
+
+    QSignalSpy failedSpy(&module, &CTelegramMediaModule::fileRequestFailed);
+
+    module.setVisiblePeers({ Telegram::Peer::fromUserId(10) });
+    module.prefetchPeerPictures(peers, Telegram::PeerPictureSize::Small);
+
+    // The number of the prefetch requests is limited
+    const QVector<quint32> sentRequests = module.testSentRequests();
+    QCOMPARE(sentRequests.count(), 8);
+    QCOMPARE(module.testRequestUniqueId(sentRequests.at(0)), getUserPicture(module, 10).getUniqueId());
+    QCOMPARE(module.testRequestUniqueId(sentRequests.at(1)), getUserPicture(module, 1).getUniqueId());
+
+    // A failed request frees the slot
+    module.testFailRequest(sentRequests.at(0));
+    QCOMPARE(failedSpy.count(), 0);
+    QCOMPARE(module.testSentRequests().count(), 9);
+    QCOMPARE(module.testRequestUniqueId(module.testSentRequests().last()), getUserPicture(module, 8).getUniqueId());
+}
+
+void tst_CTelegramDispatcher::testPrefetchInteractivePause()
+{
+    CTestMediaModule module;
+    CTestDispatcher dispatcher;
+    dispatcher.plugModule(&module);
+    dispatcher.testProcessUsers({ constructUserWithPicture(1, 10), constructUserWithPicture(2, 20) });
+
+    QSignalSpy finishedSpy(&module, &CTelegramMediaModule::fileRequestFinished);
+
+    const Telegram::RemoteFile file = getUserPicture(module, 2);
+    const quint32 requestId = module.requestFile(&file);
+    QVERIFY(requestId);
+    QCOMPARE(module.testSentRequests().count(), 1);
+
+    // The prefetch waits for the requests of the application
+    module.prefetchPeerPictures({ Telegram::Peer::fromUserId(1) }, Telegram::PeerPictureSize::Small);
+    QCOMPARE(module.testSentRequests().count(), 1);
+
+    module.testFinishRequest(requestId, QByteArray("picture"));
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(finishedSpy.first().first().toUInt(), requestId);
+    QCOMPARE(module.testSentRequests().count(), 2);
+    QCOMPARE(module.testRequestUniqueId(module.testSentRequests().last()), getUserPicture(module, 1).getUniqueId());
+}
+
+void tst_CTelegramDispatcher::testPrefetchJoinedByApplication()
+{
+    qRegisterMetaType<Telegram::Peer>();
+    CTestMediaModule module;
+    CTestDispatcher dispatcher;
+    dispatcher.plugModule(&module);
+    dispatcher.testProcessUsers({ constructUserWithPicture(1, 10) });
+
+    QSignalSpy pictureSpy(&module, &CTelegramMediaModule::peerPictureReceived);
+    QSignalSpy partSpy(&module, &CTelegramMediaModule::filePartReceived);
+    QSignalSpy finishedSpy(&module, &CTelegramMediaModule::fileRequestFinished);
+
+    module.prefetchPeerPictures({ Telegram::Peer::fromUserId(1) }, Telegram::PeerPictureSize::Small);
+    QCOMPARE(module.testSentRequests().count(), 1);
+
+    // The picture is not downloaded twice
+    const Telegram::RemoteFile file = getUserPicture(module, 1);
+    const quint32 requestId = module.requestFile(&file);
+    QCOMPARE(requestId, module.testSentRequests().first());
+    QCOMPARE(module.testSentRequests().count(), 1);
+
+    module.testFinishRequest(requestId, QByteArray("picture"));
+    QCOMPARE(partSpy.count(), 1);
+    QCOMPARE(partSpy.first().at(0).toUInt(), requestId);
+    QCOMPARE(partSpy.first().at(1).toByteArray(), QByteArray("picture"));
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(pictureSpy.count(), 1);
+}
+
+void tst_CTelegramDispatcher::testLocalRequestsAfterClear()
+{
+    qRegisterMetaType<Telegram::Peer>();
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+
+    CTestMediaModule module;
+    CTestDispatcher dispatcher;
+    dispatcher.plugModule(&module);
+    dispatcher.testProcessUsers({ constructUserWithPicture(1, 10) });
+    module.setMediaCacheDirectory(cacheDir.path());
+    const Telegram::RemoteFile file = getUserPicture(module, 1);
+    QVERIFY(module.testInsertIntoCache(file.getUniqueId(), QByteArray("picture")));
+
+    QSignalSpy pictureSpy(&module, &CTelegramMediaModule::peerPictureReceived);
+    QSignalSpy finishedSpy(&module, &CTelegramMediaModule::fileRequestFinished);
+
+    // The cached files are delivered without the network
+    QVERIFY(module.requestFile(&file));
+    QTRY_COMPARE(finishedSpy.count(), 1);
+    module.prefetchPeerPictures({ Telegram::Peer::fromUserId(1) }, Telegram::PeerPictureSize::Small);
+    QTRY_COMPARE(pictureSpy.count(), 1);
+    QVERIFY(module.testSentRequests().isEmpty());
+
+    // The scheduled completions are dropped on clear()
+    QVERIFY(module.requestFile(&file));
+    module.prefetchPeerPictures({ Telegram::Peer::fromUserId(1) }, Telegram::PeerPictureSize::Small);
+    module.clear();
+    QTest::qWait(50);
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(pictureSpy.count(), 1);
+}
+
 QTEST_MAIN(tst_CTelegramDispatcher)
 
 #include "tst_CTelegramDispatcher.moc"
@@ -3,6 +3,7 @@ include(../tests.pri)
 TARGET = tst_telegramdispatcher
 SOURCES = tst_CTelegramDispatcher.cpp \
     CTestDispatcher.cpp \
+    CTestMediaModule.cpp \
     ../../Utils.cpp \
     ../../TelegramUtils.cpp \
     ../../CTcpTransport.cpp \
@@ -14,6 +15,7 @@ SOURCES = tst_CTelegramDispatcher.cpp \
 
 HEADERS += \
     CTestDispatcher.hpp \
+    CTestMediaModule.hpp \
     ../../Utils.hpp \
     ../../TelegramUtils.hpp \
     ../../CTelegramConnection.hpp \
@@ -18,6 +18,8 @@
 #include <QObject>
 
 #include "CTelegramStream_p.hpp"
+#include "CTelegramStreamExtraOperators.hpp"
+#include "TLLazy.hpp"
 
 #include <QBuffer>
 #include <QTest>
@@ -39,9 +41,16 @@ private slots:
     void stringsLimitSerialization();
     void shortStringSerialization();
     void longStringSerialization();
+    void utf8StringSerialization();
     void intSerialization();
     void vectorOfIntsSerialization();
     void vectorDeserializationError();
+    void vectorLengthOverflow();
+    void skipAndLazyRead();
+    void readDialogsPage();
+    void readBytesInPlace();
+    void encodedSize();
+    void sharedValue();
     void pointerVectorSerialization();
     void pointerVectorDeserialization();
     void tlNumbersSerialization();
@@ -95,6 +104,29 @@ void tst_CTelegramStream::shortStringSerialization()
     }
 }
 
+void tst_CTelegramStream::utf8StringSerialization()
+{
+    const QByteArray utf8 = QByteArrayLiteral("\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 test");
+    const QString string = QString::fromUtf8(utf8);
+    const QByteArray serialized = char(utf8.size()) + utf8 + QByteArray(2, char(0));
+
+    QByteArray buffer;
+    {
+        CTelegramStream stream(&buffer, /* write */ true);
+        stream << string;
+    }
+    QCOMPARE(buffer, serialized);
+
+    CTelegramStream stream(buffer + serialized);
+    QString result;
+    stream >> result;
+    QCOMPARE(result, string);
+    stream >> result;
+    QCOMPARE(result, string);
+    QVERIFY(!stream.error());
+    QCOMPARE(stream.bytesAvailable(), 0);
+}
+
 void tst_CTelegramStream::stringsLimitSerialization()
 {
     QList<STestData> data;
@@ -331,6 +363,243 @@ void tst_CTelegramStream::vectorDeserializationError()
     }
 }
 
+void tst_CTelegramStream::vectorLengthOverflow()
+{
+    // A vector of 0x7fffffff items with only one item data
+    const QByteArray encoded = QByteArray::fromHex("15c4b51cffffff7f01000000");
+
+    CTelegramStream stream(encoded);
+    TLVector<quint32> vector = { 1, 2, 3 };
+    stream >> vector;
+    QVERIFY(stream.error());
+    QVERIFY(vector.isEmpty());
+}
+
+void tst_CTelegramStream::skipAndLazyRead()
+{
+    TLVector<TLMessageEntity> entities;
+    entities.resize(3);
+    entities[0].tlType = TLValue::MessageEntityBold;
+    entities[0].offset = 1;
+    entities[0].length = 2;
+    entities[1].tlType = TLValue::MessageEntityTextUrl;
+    entities[1].offset = 3;
+    entities[1].length = 4;
+    entities[1].url = QStringLiteral("https://example.com");
+    entities[2].tlType = TLValue::MessageEntityPre;
+    entities[2].offset = 5;
+    entities[2].length = 6;
+    entities[2].language = QStringLiteral("cpp");
+
+    const quint32 marker = 0xdeadbeef;
+    QByteArray buffer;
+    {
+        CTelegramStream stream(&buffer, true);
+        stream << entities;
+        stream << marker;
+    }
+
+    {
+        CTelegramStream stream(buffer);
+        stream.skipVector<TLMessageEntity>();
+        quint32 value = 0;
+        stream >> value;
+        QVERIFY(!stream.error());
+        QCOMPARE(value, marker);
+    }
+
+    CTelegramStream stream(buffer);
+    TLVector<TLLazy<TLMessageEntity>> lazyEntities;
+    stream >> lazyEntities;
+    quint32 value = 0;
+    stream >> value;
+    QVERIFY(!stream.error());
+    QCOMPARE(value, marker);
+
+    QCOMPARE(lazyEntities.count(), entities.count());
+    for (int i = 0; i < entities.count(); ++i) {
+        QVERIFY(!lazyEntities.at(i).isDecoded());
+        const TLMessageEntity &entity = lazyEntities.at(i).value();
+        QVERIFY(lazyEntities.at(i).isDecoded());
+        QCOMPARE(entity.tlType, entities.at(i).tlType);
+        QCOMPARE(entity.offset, entities.at(i).offset);
+        QCOMPARE(entity.length, entities.at(i).length);
+        QCOMPARE(entity.url, entities.at(i).url);
+        QCOMPARE(entity.language, entities.at(i).language);
+    }
+}
+
+void tst_CTelegramStream::readDialogsPage()
+{
+    TLMessagesDialogs dialogs;
+    dialogs.tlType = TLValue::MessagesDialogsSlice;
+    dialogs.count = 10;
+    dialogs.dialogs.resize(1);
+    dialogs.dialogs[0].tlType = TLValue::Dialog;
+    dialogs.dialogs[0].peer.tlType = TLValue::PeerUser;
+    dialogs.dialogs[0].peer.userId = 5;
+    dialogs.dialogs[0].topMessage = 7;
+    dialogs.messages.resize(2);
+    TLMessage &message = dialogs.messages[0];
+    message.tlType = TLValue::Message;
+    message.flags = TLMessage::FromId | TLMessage::Media | TLMessage::Entities | TLMessage::Views;
+    message.id = 7;
+    message.fromId = 5;
+    message.toId.tlType = TLValue::PeerUser;
+    message.toId.userId = 1;
+    message.date = 1234;
+    message.message = QStringLiteral("Some text");
+    message.media.tlType = TLValue::MessageMediaGeo;
+    message.media.geo.tlType = TLValue::GeoPoint;
+    message.media.geo.longitude = 1.5;
+    message.entities.resize(1);
+    message.entities[0].tlType = TLValue::MessageEntityBold;
+    message.views = 3;
+    TLMessage &serviceMessage = dialogs.messages[1];
+    serviceMessage.tlType = TLValue::MessageService;
+    serviceMessage.id = 8;
+    serviceMessage.toId.tlType = TLValue::PeerChat;
+    serviceMessage.toId.chatId = 2;
+    serviceMessage.date = 1235;
+    serviceMessage.action.tlType = TLValue::MessageActionChatEditTitle;
+    serviceMessage.action.title = QStringLiteral("Title");
+    dialogs.users.resize(1);
+    dialogs.users[0].tlType = TLValue::User;
+    dialogs.users[0].id = 5;
+
+    QByteArray buffer;
+    {
+        CTelegramStream stream(&buffer, true);
+        stream << dialogs;
+    }
+
+    CTelegramStream stream(buffer);
+    TLMessagesDialogs page;
+    stream.readDialogsPage(&page);
+    QVERIFY(!stream.error());
+    QVERIFY(stream.atEnd());
+
+    QVERIFY(page.tlType == TLValue::MessagesDialogsSlice);
+    QCOMPARE(page.count, quint32(10));
+    QCOMPARE(page.dialogs.count(), 1);
+    QCOMPARE(page.dialogs.at(0).topMessage, quint32(7));
+    QCOMPARE(page.messages.count(), 2);
+
+    // The header is decoded, the body is skipped
+    const TLMessage &header = page.messages.at(0);
+    QVERIFY(header.tlType == TLValue::Message);
+    QCOMPARE(header.flags, message.flags);
+    QCOMPARE(header.id, quint32(7));
+    QCOMPARE(header.fromId, quint32(5));
+    QCOMPARE(header.toId.userId, quint32(1));
+    QCOMPARE(header.date, quint32(1234));
+    QCOMPARE(header.views, quint32(3));
+    QVERIFY(header.message.isEmpty());
+    QVERIFY(header.media.tlType != TLValue::MessageMediaGeo);
+    QVERIFY(header.entities.isEmpty());
+
+    const TLMessage &serviceHeader = page.messages.at(1);
+    QVERIFY(serviceHeader.tlType == TLValue::MessageService);
+    QCOMPARE(serviceHeader.id, quint32(8));
+    QCOMPARE(serviceHeader.toId.chatId, quint32(2));
+    QCOMPARE(serviceHeader.date, quint32(1235));
+    QVERIFY(serviceHeader.action.title.isEmpty());
+
+    QCOMPARE(page.users.count(), 1);
+    QCOMPARE(page.users.at(0).id, quint32(5));
+}
+
+void tst_CTelegramStream::readBytesInPlace()
+{
+    const QByteArray data = QByteArrayLiteral("0123456789");
+    CTelegramStream stream(data);
+    stream.skipBytes(2);
+    const QByteArray bytes = stream.readBytesInPlace(4);
+    QCOMPARE(bytes, QByteArrayLiteral("2345"));
+    QVERIFY(bytes.constData() == data.constData() + 2);
+    QCOMPARE(stream.bytesAvailable(), 4);
+    QVERIFY(!stream.error());
+
+    // Not enough data
+    QCOMPARE(stream.readBytesInPlace(5), QByteArrayLiteral("6789"));
+    QVERIFY(stream.error());
+}
+
+void tst_CTelegramStream::encodedSize()
+{
+    const QStringList strings = {
+        QString(),
+        QStringLiteral("abc"),
+        QString(253, QLatin1Char('a')),
+        QString(254, QLatin1Char('a')),
+        QString::fromUtf8("\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82"),
+        QString::fromUtf8("\xe2\x82\xac \xf0\x9f\x98\x80"),
+    };
+    for (const QString &string : strings) {
+        QByteArray buffer;
+        CTelegramStream stream(&buffer, true);
+        stream << string;
+        QCOMPARE(tlEncodedSize(string), static_cast<quint32>(buffer.size()));
+    }
+
+    TLInputPeer peer;
+    peer.tlType = TLValue::InputPeerUser;
+    peer.userId = 123;
+    peer.accessHash = 456;
+
+    TLVector<TLMessageEntity> entities;
+    entities.resize(2);
+    entities[0].tlType = TLValue::MessageEntityBold;
+    entities[1].tlType = TLValue::MessageEntityTextUrl;
+    entities[1].url = QStringLiteral("https://example.com");
+
+    QByteArray buffer;
+    {
+        CTelegramStream stream(&buffer, true);
+        stream << peer;
+        QCOMPARE(tlEncodedSize(peer), static_cast<quint32>(buffer.size()));
+        stream << entities;
+    }
+    QCOMPARE(tlEncodedSize(peer) + tlEncodedSize(entities), static_cast<quint32>(buffer.size()));
+}
+
+void tst_CTelegramStream::sharedValue()
+{
+    TLVector<TLMessageEntity> entities;
+    entities.resize(2);
+    entities[0].tlType = TLValue::MessageEntityBold;
+    entities[1].tlType = TLValue::MessageEntityTextUrl;
+    entities[1].url = QStringLiteral("https://example.com");
+
+    TLShared<TLVector<TLMessageEntity> > original(entities);
+    TLShared<TLVector<TLMessageEntity> > copy = original;
+    QVERIFY(original.isShared());
+    QCOMPARE(&copy.value(), &original.value());
+
+    QByteArray buffer;
+    {
+        CTelegramStream stream(&buffer, true);
+        stream << copy;
+    }
+    {
+        CTelegramStream stream(buffer);
+        stream >> copy; // Detaches the copy
+    }
+    QVERIFY(!original.isShared());
+    QVERIFY(&copy.value() != &original.value());
+    QCOMPARE(copy->count(), 2);
+    QCOMPARE(copy->at(1).url, original->at(1).url);
+    QCOMPARE(original.value().at(0).tlType, TLValue(TLValue::MessageEntityBold));
+
+    // The generated alias of a heavy type
+    TLMessagesMessagesShared history;
+    history.data().messages.resize(3);
+    const TLMessagesMessagesShared receivedHistory = history;
+    QVERIFY(history.isShared());
+    QCOMPARE(&receivedHistory->messages, &history->messages);
+    QCOMPARE(receivedHistory->messages.count(), 3);
+}
+
 void tst_CTelegramStream::pointerVectorSerialization()
 {
     TLVector<quint32> values = { 1, 2, 3, 4, 5 };
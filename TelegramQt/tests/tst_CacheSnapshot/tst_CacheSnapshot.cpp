@@ -0,0 +1,130 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "CacheSnapshot.hpp"
+
+#include <QBuffer>
+#include <QTest>
+#include <QDebug>
+
+class tst_CacheSnapshot : public QObject
+{
+    Q_OBJECT
+private slots:
+    void writeAndRead();
+
+};
+
+void tst_CacheSnapshot::writeAndRead()
+{
+    CacheSnapshot snapshot;
+    snapshot.authId = 0x1122334455667788ull;
+    snapshot.maxMessageId = 500;
+
+    TLUser user;
+    user.tlType = TLValue::User;
+    user.id = 123;
+    user.flags = TLUser::Self | TLUser::AccessHash | TLUser::FirstName | TLUser::Username | TLUser::Photo;
+    user.accessHash = 0xabcdef;
+    user.firstName = QStringLiteral("Name");
+    user.username = QStringLiteral("user");
+    user.photo.tlType = TLValue::UserProfilePhoto;
+    user.photo.photoSmall.tlType = TLValue::FileLocation;
+    user.photo.photoSmall.volumeId = 42;
+    snapshot.users.append(user);
+
+    TLChat chat;
+    chat.tlType = TLValue::Channel;
+    chat.id = 456;
+    chat.title = QStringLiteral("Channel");
+    snapshot.chats.append(chat);
+
+    CacheSnapshot::Dialog dialog;
+    dialog.dialog.tlType = TLValue::DialogChannel;
+    dialog.dialog.peer.tlType = TLValue::PeerChannel;
+    dialog.dialog.peer.channelId = 456;
+    dialog.dialog.topMessage = 10;
+    dialog.dialog.pts = 20;
+    dialog.date = 1000;
+    snapshot.dialogs.append(dialog);
+
+    snapshot.contactList = { 123, 789 };
+
+    CacheSnapshot::Message message;
+    message.peer = Telegram::Peer(456, Telegram::Peer::Channel);
+    message.message.tlType = TLValue::Message;
+    message.message.flags = TLMessage::FromId;
+    message.message.id = 10;
+    message.message.fromId = 123;
+    message.message.toId.tlType = TLValue::PeerChannel;
+    message.message.toId.channelId = 456;
+    message.message.date = 1000;
+    message.message.message = QStringLiteral("Text");
+    snapshot.recentMessages.append(message);
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QVERIFY(snapshot.write(&buffer));
+    buffer.close();
+
+    buffer.open(QIODevice::ReadOnly);
+    CacheSnapshot restored;
+    QVERIFY(restored.read(&buffer));
+    QCOMPARE(restored.authId, snapshot.authId);
+    QCOMPARE(restored.maxMessageId, snapshot.maxMessageId);
+    QCOMPARE(restored.users.count(), 1);
+    QCOMPARE(restored.users.first().id, user.id);
+    QVERIFY(restored.users.first().self());
+    QCOMPARE(restored.users.first().accessHash, user.accessHash);
+    QCOMPARE(restored.users.first().firstName, user.firstName);
+    QCOMPARE(restored.users.first().photo.photoSmall.volumeId, quint64(42));
+    QCOMPARE(restored.chats.count(), 1);
+    QCOMPARE(restored.chats.first().title, chat.title);
+    QCOMPARE(restored.dialogs.count(), 1);
+    QCOMPARE(restored.dialogs.first().dialog.peer.channelId, quint32(456));
+    QCOMPARE(restored.dialogs.first().dialog.pts, quint32(20));
+    QCOMPARE(restored.dialogs.first().date, quint32(1000));
+    QCOMPARE(restored.contactList, snapshot.contactList);
+    QCOMPARE(restored.recentMessages.count(), 1);
+    QCOMPARE(restored.recentMessages.first().peer, message.peer);
+    QCOMPARE(restored.recentMessages.first().message.id, quint32(10));
+    QCOMPARE(restored.recentMessages.first().message.fromId, quint32(123));
+    QCOMPARE(restored.recentMessages.first().message.toId.channelId, quint32(456));
+    QCOMPARE(restored.recentMessages.first().message.message, message.message.message);
+    buffer.close();
+
+    // Truncated data should be rejected
+    QBuffer truncated;
+    truncated.setData(buffer.data().left(buffer.data().size() / 2));
+    truncated.open(QIODevice::ReadOnly);
+    QVERIFY(!CacheSnapshot().read(&truncated));
+
+    // The snapshot of another API layer should be rejected
+    QByteArray otherLayer = buffer.data();
+    const quint32 layer = TLValue::CurrentLayer + 1;
+    otherLayer.replace(8, sizeof(layer), reinterpret_cast<const char*>(&layer), sizeof(layer));
+    QBuffer otherLayerBuffer(&otherLayer);
+    otherLayerBuffer.open(QIODevice::ReadOnly);
+    QVERIFY(!CacheSnapshot().read(&otherLayerBuffer));
+}
+
+QTEST_APPLESS_MAIN(tst_CacheSnapshot)
+
+#include "tst_CacheSnapshot.moc"
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_CacheSnapshot
+SOURCES = tst_CacheSnapshot.cpp
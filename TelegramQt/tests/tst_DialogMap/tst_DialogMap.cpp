@@ -0,0 +1,82 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "DialogMap.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+class tst_DialogMap : public QObject
+{
+    Q_OBJECT
+private slots:
+    void insertAndRemove();
+
+};
+
+void tst_DialogMap::insertAndRemove()
+{
+    DialogMap dialogs;
+    const Telegram::Peer user(123, Telegram::Peer::User);
+    const Telegram::Peer chat(123, Telegram::Peer::Chat);
+
+    // Insert enough dialogs to trigger a few rehashes
+    for (quint32 i = 1; i <= 100; ++i) {
+        TLDialog dialog;
+        dialog.topMessage = i;
+        QVERIFY(dialogs.insert(Telegram::Peer(i, Telegram::Peer::Channel), dialog, /* date */ i));
+    }
+    TLDialog userDialog;
+    userDialog.topMessage = 1000;
+    QVERIFY(dialogs.insert(user, userDialog, 50));
+    QVERIFY(dialogs.insert(chat, TLDialog(), 200));
+    QCOMPARE(dialogs.count(), 102);
+
+    QCOMPARE(dialogs.find(user)->topMessage, quint32(1000));
+    QVERIFY(!dialogs.find(Telegram::Peer(1000, Telegram::Peer::User)));
+
+    // The most recent first, the stable order for the same date
+    QCOMPARE(dialogs.peerAt(0), chat);
+    QCOMPARE(dialogs.peerAt(1), Telegram::Peer(100, Telegram::Peer::Channel));
+    QCOMPARE(dialogs.peerAt(51), Telegram::Peer(50, Telegram::Peer::Channel));
+    QCOMPARE(dialogs.peerAt(52), user);
+
+    dialogs.setDate(user, 300);
+    QCOMPARE(dialogs.peers().first(), user);
+
+    QVERIFY(dialogs.remove(chat));
+    QVERIFY(!dialogs.remove(chat));
+    for (quint32 i = 1; i <= 100; i += 2) {
+        QVERIFY(dialogs.remove(Telegram::Peer(i, Telegram::Peer::Channel)));
+    }
+    QCOMPARE(dialogs.count(), 51);
+    for (quint32 i = 2; i <= 100; i += 2) {
+        const TLDialog *dialog = dialogs.find(Telegram::Peer(i, Telegram::Peer::Channel));
+        QVERIFY(dialog);
+        QCOMPARE(dialog->topMessage, i);
+    }
+    QCOMPARE(dialogs.find(user)->topMessage, quint32(1000));
+    QCOMPARE(dialogs.peerAt(1), Telegram::Peer(100, Telegram::Peer::Channel));
+    QCOMPARE(dialogs.peerAt(50), Telegram::Peer(2, Telegram::Peer::Channel));
+}
+
+QTEST_APPLESS_MAIN(tst_DialogMap)
+
+#include "tst_DialogMap.moc"
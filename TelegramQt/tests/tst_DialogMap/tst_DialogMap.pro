@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_DialogMap
+SOURCES = tst_DialogMap.cpp
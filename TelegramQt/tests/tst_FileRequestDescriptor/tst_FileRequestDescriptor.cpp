@@ -0,0 +1,148 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "FileRequestDescriptor.hpp"
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QTest>
+#include <QDebug>
+
+class tst_FileRequestDescriptor : public QObject
+{
+    Q_OBJECT
+private slots:
+    void downloadChunks();
+    void uploadParts();
+
+};
+
+void tst_FileRequestDescriptor::downloadChunks()
+{
+    FileRequestDescriptor descriptor;
+    descriptor.setType(FileRequestDescriptor::Download);
+    descriptor.setChunkSize(1024);
+    descriptor.setSize(1024 * 3 + 100);
+
+    QVector<quint32> offsets;
+    while (descriptor.canRequestChunk()) {
+        offsets.append(descriptor.takeNextChunkOffset(0));
+    }
+    QCOMPARE(offsets.count(), descriptor.window());
+    QCOMPARE(offsets.first(), quint32(0));
+    QCOMPARE(offsets.at(1), quint32(1024));
+
+    QByteArray data;
+    quint32 offset = 0;
+
+    // An out of order chunk is kept until the previous one is received
+    QVERIFY(descriptor.addChunk(1024, QByteArray(1024, 'b'), 10));
+    QVERIFY(!descriptor.takeReadyChunk(&data, &offset));
+    QVERIFY(descriptor.addChunk(0, QByteArray(1024, 'a'), 20));
+    QVERIFY(!descriptor.addChunk(0, QByteArray(1024, 'a'), 20));
+
+    QVERIFY(descriptor.takeReadyChunk(&data, &offset));
+    QCOMPARE(offset, quint32(0));
+    QCOMPARE(data.at(0), 'a');
+    QVERIFY(descriptor.takeReadyChunk(&data, &offset));
+    QCOMPARE(offset, quint32(1024));
+    QCOMPARE(data.at(0), 'b');
+    QVERIFY(!descriptor.takeReadyChunk(&data, &offset));
+    QCOMPARE(descriptor.offset(), quint32(2048));
+
+    // The lost requests are requested again
+    QVERIFY(descriptor.canRequestChunk());
+    descriptor.resetChunkRequests();
+    QCOMPARE(descriptor.chunksInFlight(), 0);
+    offsets.clear();
+    while (descriptor.canRequestChunk()) {
+        offsets.append(descriptor.takeNextChunkOffset(30));
+    }
+    QCOMPARE(offsets, QVector<quint32>({ 2048, 3072 }));
+
+    // A failed chunk is requested again, but only a few times
+    QVERIFY(descriptor.setChunkFailed(2048));
+    QCOMPARE(descriptor.chunksInFlight(), 1);
+    QVERIFY(descriptor.canRequestChunk());
+    QCOMPARE(descriptor.takeNextChunkOffset(40), quint32(2048));
+    QVERIFY(descriptor.setChunkFailed(2048));
+    QCOMPARE(descriptor.takeNextChunkOffset(50), quint32(2048));
+    QVERIFY(!descriptor.setChunkFailed(2048));
+
+    // A reply to a request sent before resetChunkRequests() is ignored
+    descriptor.resetChunkRequests();
+    QVERIFY(descriptor.setChunkFailed(3072));
+}
+
+void tst_FileRequestDescriptor::uploadParts()
+{
+    const QByteArray content(FileRequestDescriptor::defaultDownloadPartSize() * 5 + 10, 'x');
+    QBuffer source;
+    source.setData(content);
+    source.open(QIODevice::ReadOnly);
+
+    FileRequestDescriptor descriptor = FileRequestDescriptor::uploadRequest(&source, QLatin1String("file"), 1);
+    QVERIFY(descriptor.isValid());
+    QCOMPARE(descriptor.parts(), quint32(6));
+
+    QVector<quint32> parts;
+    quint32 part = 0;
+    QByteArray data;
+    while (descriptor.canUploadPart()) {
+        QVERIFY(descriptor.takeNextPart(&part, &data));
+        QCOMPARE(quint32(data.size()), descriptor.chunkSize());
+        parts.append(part);
+    }
+    QCOMPARE(parts.count(), descriptor.partsInFlight());
+    QVERIFY(parts.count() < 6);
+
+    // A failed part is sent again
+    QVERIFY(descriptor.setPartFailed(1));
+    QVERIFY(descriptor.canUploadPart());
+    QVERIFY(descriptor.takeNextPart(&part, &data));
+    QCOMPARE(part, quint32(1));
+
+    for (quint32 p : parts) {
+        descriptor.setPartUploaded(p);
+    }
+    while (descriptor.canUploadPart()) {
+        QVERIFY(descriptor.takeNextPart(&part, &data));
+        descriptor.setPartUploaded(part);
+    }
+    QCOMPARE(data.size(), 10);
+    QVERIFY(descriptor.finished());
+    QCOMPARE(descriptor.offset(), quint32(content.size()));
+    QCOMPARE(descriptor.md5Sum(), QCryptographicHash::hash(content, QCryptographicHash::Md5));
+    QCOMPARE(descriptor.inputFile().md5Checksum, QString::fromLatin1(descriptor.md5Sum().toHex()));
+
+    // The parts of an in-memory file are views on the content
+    FileRequestDescriptor memoryDescriptor = FileRequestDescriptor::uploadRequest(content, QLatin1String("file"), 1);
+    while (memoryDescriptor.canUploadPart()) {
+        QVERIFY(memoryDescriptor.takeNextPart(&part, &data));
+        QCOMPARE(data.constData(), content.constData() + part * memoryDescriptor.chunkSize());
+        memoryDescriptor.setPartUploaded(part);
+    }
+    QVERIFY(memoryDescriptor.finished());
+    QCOMPARE(memoryDescriptor.md5Sum(), QCryptographicHash::hash(content, QCryptographicHash::Md5));
+}
+
+QTEST_APPLESS_MAIN(tst_FileRequestDescriptor)
+
+#include "tst_FileRequestDescriptor.moc"
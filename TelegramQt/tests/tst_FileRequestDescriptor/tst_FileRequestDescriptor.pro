@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_FileRequestDescriptor
+SOURCES = tst_FileRequestDescriptor.cpp
@@ -0,0 +1,107 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "MediaCache.hpp"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QDebug>
+
+#ifdef Q_OS_WIN
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+class tst_MediaCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void insertAndEvict();
+    void persistentUsageOrder();
+
+};
+
+void tst_MediaCache::insertAndEvict()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    {
+        MediaCache cache;
+        QVERIFY(cache.setDirectory(dir.path()));
+        cache.setMaxSize(250);
+        QVERIFY(cache.insert(QLatin1String("0a"), QByteArray(100, 'a')));
+        QVERIFY(cache.insert(QLatin1String("0b"), QByteArray(100, 'b')));
+        QVERIFY(!cache.insert(QLatin1String("../x"), QByteArray(1, 'x')));
+
+        // Use "0a", so "0b" becomes the least recently used one
+        QCOMPARE(cache.data(QLatin1String("0a")), QByteArray(100, 'a'));
+        QVERIFY(cache.insert(QLatin1String("0c"), QByteArray(100, 'c')));
+        QCOMPARE(cache.count(), 2);
+        QVERIFY(!cache.contains(QLatin1String("0b")));
+        QVERIFY(!QFile::exists(cache.filePath(QLatin1String("0b"))));
+        QCOMPARE(cache.totalSize(), quint64(200));
+    }
+
+    // The files are found on the next start
+    MediaCache cache;
+    QVERIFY(cache.setDirectory(dir.path()));
+    QCOMPARE(cache.count(), 2);
+    QCOMPARE(cache.data(QLatin1String("0c")), QByteArray(100, 'c'));
+}
+
+static bool setModificationTime(const QString &filePath, time_t time)
+{
+    struct utimbuf times;
+    times.actime = time;
+    times.modtime = time;
+    return ::utime(QFile::encodeName(filePath).constData(), &times) == 0;
+}
+
+void tst_MediaCache::persistentUsageOrder()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    {
+        MediaCache cache;
+        QVERIFY(cache.setDirectory(dir.path()));
+        QVERIFY(cache.insert(QLatin1String("0a"), QByteArray(100, 'a')));
+        QVERIFY(cache.insert(QLatin1String("0b"), QByteArray(100, 'b')));
+        // "0a" is the oldest file on the disk until it is used
+        QVERIFY(setModificationTime(cache.filePath(QLatin1String("0a")), 1000000000));
+        QVERIFY(setModificationTime(cache.filePath(QLatin1String("0b")), 1000000100));
+        QCOMPARE(cache.data(QLatin1String("0a")), QByteArray(100, 'a'));
+    }
+
+    // The usage is known on the next start, so "0b" is the least recently used one
+    MediaCache cache;
+    QVERIFY(cache.setDirectory(dir.path()));
+    cache.setMaxSize(250);
+    QVERIFY(cache.insert(QLatin1String("0c"), QByteArray(100, 'c')));
+    QVERIFY(cache.contains(QLatin1String("0a")));
+    QVERIFY(!cache.contains(QLatin1String("0b")));
+}
+
+QTEST_APPLESS_MAIN(tst_MediaCache)
+
+#include "tst_MediaCache.moc"
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_MediaCache
+SOURCES = tst_MediaCache.cpp
@@ -0,0 +1,131 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "MessageCache.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+class tst_MessageCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void insertAndEvict();
+    void markEvicted();
+    void evictedKeysLimit();
+
+};
+
+static TLMessage makeMessage(quint32 id, int textSize)
+{
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.id = id;
+    message.message = QString(textSize, QLatin1Char('x'));
+    message.media.tlType = TLValue::MessageMediaPhoto;
+    return message;
+}
+
+void tst_MessageCache::insertAndEvict()
+{
+    const Telegram::Peer peer = Telegram::Peer::fromUserId(1);
+    const TLMessage message = makeMessage(1, 100);
+    const quint32 cost = MessageCache::estimateCost(message);
+
+    MessageCache cache;
+    cache.setMaxCost(cost * 3);
+    for (quint32 id = 1; id <= 3; ++id) {
+        cache.insert(peer, makeMessage(id, 100));
+    }
+    QCOMPARE(cache.count(), 3);
+    QCOMPARE(cache.totalCost(), cost * 3);
+
+    // Use the first one, so the second one becomes the least recently used
+    QVERIFY(cache.object(peer, 1));
+    QCOMPARE(cache.object(peer, 1)->id, quint32(1));
+    cache.insert(peer, makeMessage(4, 100));
+    QCOMPARE(cache.count(), 3);
+    QVERIFY(!cache.contains(peer, 2));
+    QVERIFY(cache.contains(peer, 1));
+    QCOMPARE(cache.keys().first().id, quint32(4));
+    QCOMPARE(cache.keys().last().id, quint32(3));
+
+    // The evicted message is reported once
+    QVERIFY(cache.isEvicted(peer, 2));
+    QVERIFY(cache.takeEvicted(peer, 2));
+    QVERIFY(!cache.takeEvicted(peer, 2));
+    QVERIFY(!cache.isEvicted(peer, 3));
+
+    // A message is kept even if it does not fit into the budget
+    cache.insert(peer, makeMessage(5, int(cost * 3)));
+    QCOMPARE(cache.count(), 1);
+    QVERIFY(cache.contains(peer, 5));
+
+    QVERIFY(cache.remove(peer, 5));
+    QVERIFY(!cache.remove(peer, 5));
+    QCOMPARE(cache.totalCost(), quint32(0));
+}
+
+void tst_MessageCache::markEvicted()
+{
+    const Telegram::Peer peer = Telegram::Peer::fromUserId(1);
+    MessageCache cache;
+    cache.insert(peer, makeMessage(1, 10));
+
+    // Only the messages which are not in the cache are marked
+    cache.markEvicted(MessageCache::Key(peer, 1));
+    cache.markEvicted(MessageCache::Key(peer, 2));
+    QVERIFY(!cache.isEvicted(peer, 1));
+    QVERIFY(cache.isEvicted(peer, 2));
+
+    // The inserted message is not evicted anymore
+    cache.insert(peer, makeMessage(2, 10));
+    QVERIFY(!cache.isEvicted(peer, 2));
+    QCOMPARE(cache.evictedCount(), 0);
+}
+
+void tst_MessageCache::evictedKeysLimit()
+{
+    const Telegram::Peer peer = Telegram::Peer::fromUserId(1);
+    const quint32 extraKeys = 10;
+    const quint32 keys = MessageCache::maxEvictedKeys() + extraKeys;
+
+    MessageCache cache;
+    for (quint32 id = 1; id <= keys; ++id) {
+        cache.markEvicted(MessageCache::Key(peer, id));
+    }
+    // Mark the first one once again, so it is not the oldest anymore
+    cache.markEvicted(MessageCache::Key(peer, extraKeys + 1));
+    cache.markEvicted(MessageCache::Key(peer, keys + 1));
+
+    QCOMPARE(cache.evictedCount(), MessageCache::maxEvictedKeys());
+    QVERIFY(!cache.isEvicted(peer, 1));
+    QVERIFY(!cache.isEvicted(peer, extraKeys));
+    QVERIFY(cache.isEvicted(peer, extraKeys + 1));
+    QVERIFY(!cache.isEvicted(peer, extraKeys + 2));
+    QVERIFY(cache.isEvicted(peer, keys + 1));
+
+    cache.clear();
+    QCOMPARE(cache.evictedCount(), 0);
+}
+
+QTEST_APPLESS_MAIN(tst_MessageCache)
+
+#include "tst_MessageCache.moc"
@@ -0,0 +1,73 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "MessageRangeSet.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+class tst_MessageRangeSet : public QObject
+{
+    Q_OBJECT
+private slots:
+    void insert();
+
+};
+
+void tst_MessageRangeSet::insert()
+{
+    MessageRangeSet ranges;
+    QVERIFY(!ranges.contains(1));
+
+    ranges.insert(10, 20);
+    ranges.insert(40, 50);
+    ranges.insert(60, 70);
+    QCOMPARE(ranges.count(), 3);
+    QVERIFY(ranges.contains(10));
+    QVERIFY(ranges.contains(20));
+    QVERIFY(!ranges.contains(21));
+    QVERIFY(!ranges.contains(9));
+    QCOMPARE(ranges.rangeOf(45).first, quint32(40));
+    QCOMPARE(ranges.rangeOf(30).last, quint32(0));
+
+    // Adjacent ranges are merged
+    ranges.insert(21, 25);
+    QCOMPARE(ranges.count(), 3);
+    QCOMPARE(ranges.at(0).last, quint32(25));
+
+    // Overlapping several ranges
+    ranges.insert(45, 65);
+    QCOMPARE(ranges.count(), 2);
+    QCOMPARE(ranges.at(1).first, quint32(40));
+    QCOMPARE(ranges.at(1).last, quint32(70));
+
+    ranges.insert(1, 5);
+    QCOMPARE(ranges.count(), 3);
+    QCOMPARE(ranges.at(0).first, quint32(1));
+
+    ranges.insert(0, 100);
+    QCOMPARE(ranges.count(), 1);
+    QCOMPARE(ranges.at(0).first, quint32(0));
+    QCOMPARE(ranges.at(0).last, quint32(100));
+}
+
+QTEST_APPLESS_MAIN(tst_MessageRangeSet)
+
+#include "tst_MessageRangeSet.moc"
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_MessageRangeSet
+SOURCES = tst_MessageRangeSet.cpp
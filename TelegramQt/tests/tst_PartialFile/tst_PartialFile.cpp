@@ -0,0 +1,148 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "PartialFile.hpp"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QDebug>
+
+class tst_PartialFile : public QObject
+{
+    Q_OBJECT
+private slots:
+    void writeAndResume();
+    void downloadTwice();
+    void syncIndex();
+
+};
+
+void tst_PartialFile::writeAndResume()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString filePath = dir.path() + QLatin1String("/file");
+
+    {
+        PartialFile file(filePath);
+        QVERIFY(file.open(300));
+        QVERIFY(file.write(200, QByteArray(100, 'c')));
+        QVERIFY(file.write(0, QByteArray(100, 'a')));
+        QCOMPARE(file.completedPrefix(), quint32(100));
+        QVERIFY(!file.write(250, QByteArray(100, 'x'))); // Out of the file
+        QVERIFY(!file.finish());
+    }
+
+    // Resume
+    PartialFile file(filePath);
+    QVERIFY(file.open(300));
+    QCOMPARE(file.ranges().count(), 2);
+    QCOMPARE(file.completedPrefix(), quint32(100));
+    QVERIFY(file.write(100, QByteArray(100, 'b')));
+    QVERIFY(file.isComplete());
+    QVERIFY(file.finish());
+
+    QFile result(filePath);
+    QVERIFY(result.open(QIODevice::ReadOnly));
+    QByteArray expected(100, 'a');
+    expected.append(QByteArray(100, 'b'));
+    expected.append(QByteArray(100, 'c'));
+    QCOMPARE(result.readAll(), expected);
+    QVERIFY(!QFile::exists(file.dataFilePath()));
+    QVERIFY(!QFile::exists(file.indexFilePath()));
+
+    // The index of another size is not used
+    PartialFile otherFile(filePath + QLatin1String("2"));
+    QVERIFY(otherFile.open(300));
+    QVERIFY(otherFile.write(0, QByteArray(10, 'a')));
+    otherFile.close();
+    QVERIFY(otherFile.open(400));
+    QCOMPARE(otherFile.completedPrefix(), quint32(0));
+}
+
+void tst_PartialFile::downloadTwice()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString filePath = dir.path() + QLatin1String("/file");
+    const QByteArray content = QByteArray(100, 'a') + QByteArray(100, 'b');
+
+    {
+        PartialFile file(filePath);
+        QVERIFY(file.open(content.size()));
+        QVERIFY(!file.isFinished());
+        QVERIFY(file.write(0, content));
+        QVERIFY(file.finish());
+    }
+    const QDateTime modified = QFileInfo(filePath).lastModified();
+
+    // The second download of the same file is completed from the downloaded one
+    PartialFile file(filePath);
+    QVERIFY(file.open(content.size()));
+    QVERIFY(file.isFinished());
+    QVERIFY(file.isComplete());
+    QCOMPARE(file.completedPrefix(), quint32(content.size()));
+    QVERIFY(!QFile::exists(file.dataFilePath()));
+    QCOMPARE(file.read(0, 100), content.left(100));
+    QCOMPARE(file.read(100, 150), content.mid(100));
+    QVERIFY(!file.write(0, QByteArray(10, 'x')));
+    QVERIFY(file.finish());
+
+    QFile result(filePath);
+    QVERIFY(result.open(QIODevice::ReadOnly));
+    QCOMPARE(result.readAll(), content);
+    QCOMPARE(QFileInfo(filePath).lastModified(), modified);
+
+    // A file of another size is downloaded again
+    PartialFile otherFile(filePath);
+    QVERIFY(otherFile.open(content.size() + 1));
+    QVERIFY(!otherFile.isFinished());
+    QCOMPARE(otherFile.completedPrefix(), quint32(0));
+    otherFile.remove();
+}
+
+void tst_PartialFile::syncIndex()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString filePath = dir.path() + QLatin1String("/file");
+
+    PartialFile file(filePath);
+    QVERIFY(file.open(100));
+    QVERIFY(file.write(0, QByteArray(10, 'a')));
+    // The index is not written for each chunk
+    QVERIFY(!QFile::exists(file.indexFilePath()));
+    QVERIFY(file.sync());
+    QVERIFY(QFile::exists(file.indexFilePath()));
+
+    QVERIFY(file.write(10, QByteArray(10, 'b')));
+    file.close();
+
+    PartialFile resumed(filePath);
+    QVERIFY(resumed.open(100));
+    QCOMPARE(resumed.completedPrefix(), quint32(20));
+}
+
+QTEST_APPLESS_MAIN(tst_PartialFile)
+
+#include "tst_PartialFile.moc"
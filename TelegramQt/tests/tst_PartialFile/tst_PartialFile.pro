@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_PartialFile
+SOURCES = tst_PartialFile.cpp
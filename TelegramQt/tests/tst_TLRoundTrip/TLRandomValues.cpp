@@ -0,0 +1,3712 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "TLRandomValues.hpp"
+
+void fillRandom(bool &value, TestRandom &random)
+{
+    value = random.next() & 1;
+}
+
+void fillRandom(quint32 &value, TestRandom &random)
+{
+    value = random.next();
+}
+
+void fillRandom(quint64 &value, TestRandom &random)
+{
+    value = (quint64(random.next()) << 32) | random.next();
+}
+
+void fillRandom(double &value, TestRandom &random)
+{
+    value = random.next() / 16.0;
+}
+
+static int randomLength(TestRandom &random)
+{
+    // Sometimes exceed 253 bytes to cover the long abridged length
+    return random.bounded(8) ? random.bounded(24) : 250 + random.bounded(100);
+}
+
+void fillRandom(QString &value, TestRandom &random)
+{
+    value.resize(randomLength(random));
+    for (QChar &c : value) {
+        // Mix one, two and three bytes UTF-8 sequences
+        switch (random.bounded(4)) {
+        case 0:
+            c = QChar(0x0400 + random.bounded(0x100));
+            break;
+        case 1:
+            c = QChar(0x4e00 + random.bounded(0x1000));
+            break;
+        default:
+            c = QChar(0x20 + random.bounded(0x5f));
+            break;
+        }
+    }
+}
+
+void fillRandom(QByteArray &value, TestRandom &random)
+{
+    value.resize(randomLength(random));
+    for (char &c : value) {
+        c = static_cast<char>(random.next());
+    }
+}
+
+// Generated random value implementation
+void fillRandom(TLAccountDaysTTL &accountDaysTTLValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AccountDaysTTL,
+    };
+    accountDaysTTLValue.tlType = random.pick(types);
+
+    switch (accountDaysTTLValue.tlType) {
+    case TLValue::AccountDaysTTL:
+        fillRandom(accountDaysTTLValue.days, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAccountPassword &accountPasswordValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AccountNoPassword,
+        TLValue::AccountPassword,
+    };
+    accountPasswordValue.tlType = random.pick(types);
+
+    switch (accountPasswordValue.tlType) {
+    case TLValue::AccountNoPassword:
+        fillRandom(accountPasswordValue.newSalt, random);
+        fillRandom(accountPasswordValue.emailUnconfirmedPattern, random);
+        break;
+    case TLValue::AccountPassword:
+        fillRandom(accountPasswordValue.currentSalt, random);
+        fillRandom(accountPasswordValue.newSalt, random);
+        fillRandom(accountPasswordValue.hint, random);
+        fillRandom(accountPasswordValue.hasRecovery, random);
+        fillRandom(accountPasswordValue.emailUnconfirmedPattern, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAccountPasswordInputSettings &accountPasswordInputSettingsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AccountPasswordInputSettings,
+    };
+    accountPasswordInputSettingsValue.tlType = random.pick(types);
+
+    switch (accountPasswordInputSettingsValue.tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        fillRandom(accountPasswordInputSettingsValue.flags, random);
+        fillRandom(accountPasswordInputSettingsValue.newSalt, random);
+        fillRandom(accountPasswordInputSettingsValue.newPasswordHash, random);
+        fillRandom(accountPasswordInputSettingsValue.hint, random);
+        fillRandom(accountPasswordInputSettingsValue.email, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAccountPasswordSettings &accountPasswordSettingsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AccountPasswordSettings,
+    };
+    accountPasswordSettingsValue.tlType = random.pick(types);
+
+    switch (accountPasswordSettingsValue.tlType) {
+    case TLValue::AccountPasswordSettings:
+        fillRandom(accountPasswordSettingsValue.email, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AccountSentChangePhoneCode,
+    };
+    accountSentChangePhoneCodeValue.tlType = random.pick(types);
+
+    switch (accountSentChangePhoneCodeValue.tlType) {
+    case TLValue::AccountSentChangePhoneCode:
+        fillRandom(accountSentChangePhoneCodeValue.phoneCodeHash, random);
+        fillRandom(accountSentChangePhoneCodeValue.sendCallTimeout, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAudio &audioValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AudioEmpty,
+        TLValue::Audio,
+    };
+    audioValue.tlType = random.pick(types);
+
+    switch (audioValue.tlType) {
+    case TLValue::AudioEmpty:
+        fillRandom(audioValue.id, random);
+        break;
+    case TLValue::Audio:
+        fillRandom(audioValue.id, random);
+        fillRandom(audioValue.accessHash, random);
+        fillRandom(audioValue.date, random);
+        fillRandom(audioValue.duration, random);
+        fillRandom(audioValue.mimeType, random);
+        fillRandom(audioValue.size, random);
+        fillRandom(audioValue.dcId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAuthCheckedPhone &authCheckedPhoneValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AuthCheckedPhone,
+    };
+    authCheckedPhoneValue.tlType = random.pick(types);
+
+    switch (authCheckedPhoneValue.tlType) {
+    case TLValue::AuthCheckedPhone:
+        fillRandom(authCheckedPhoneValue.phoneRegistered, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAuthExportedAuthorization &authExportedAuthorizationValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AuthExportedAuthorization,
+    };
+    authExportedAuthorizationValue.tlType = random.pick(types);
+
+    switch (authExportedAuthorizationValue.tlType) {
+    case TLValue::AuthExportedAuthorization:
+        fillRandom(authExportedAuthorizationValue.id, random);
+        fillRandom(authExportedAuthorizationValue.bytes, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAuthPasswordRecovery &authPasswordRecoveryValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AuthPasswordRecovery,
+    };
+    authPasswordRecoveryValue.tlType = random.pick(types);
+
+    switch (authPasswordRecoveryValue.tlType) {
+    case TLValue::AuthPasswordRecovery:
+        fillRandom(authPasswordRecoveryValue.emailPattern, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAuthSentCode &authSentCodeValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AuthSentCode,
+        TLValue::AuthSentAppCode,
+    };
+    authSentCodeValue.tlType = random.pick(types);
+
+    switch (authSentCodeValue.tlType) {
+    case TLValue::AuthSentCode:
+    case TLValue::AuthSentAppCode:
+        fillRandom(authSentCodeValue.phoneRegistered, random);
+        fillRandom(authSentCodeValue.phoneCodeHash, random);
+        fillRandom(authSentCodeValue.sendCallTimeout, random);
+        fillRandom(authSentCodeValue.isPassword, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAuthorization &authorizationValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::Authorization,
+    };
+    authorizationValue.tlType = random.pick(types);
+
+    switch (authorizationValue.tlType) {
+    case TLValue::Authorization:
+        fillRandom(authorizationValue.hash, random);
+        fillRandom(authorizationValue.flags, random);
+        fillRandom(authorizationValue.deviceModel, random);
+        fillRandom(authorizationValue.platform, random);
+        fillRandom(authorizationValue.systemVersion, random);
+        fillRandom(authorizationValue.apiId, random);
+        fillRandom(authorizationValue.appName, random);
+        fillRandom(authorizationValue.appVersion, random);
+        fillRandom(authorizationValue.dateCreated, random);
+        fillRandom(authorizationValue.dateActive, random);
+        fillRandom(authorizationValue.ip, random);
+        fillRandom(authorizationValue.country, random);
+        fillRandom(authorizationValue.region, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLBotCommand &botCommandValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::BotCommand,
+    };
+    botCommandValue.tlType = random.pick(types);
+
+    switch (botCommandValue.tlType) {
+    case TLValue::BotCommand:
+        fillRandom(botCommandValue.command, random);
+        fillRandom(botCommandValue.description, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLBotInfo &botInfoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::BotInfoEmpty,
+        TLValue::BotInfo,
+    };
+    botInfoValue.tlType = random.pick(types);
+
+    switch (botInfoValue.tlType) {
+    case TLValue::BotInfoEmpty:
+        break;
+    case TLValue::BotInfo:
+        fillRandom(botInfoValue.userId, random);
+        fillRandom(botInfoValue.version, random);
+        fillRandom(botInfoValue.shareText, random);
+        fillRandom(botInfoValue.description, random);
+        fillRandom(botInfoValue.commands, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChannelParticipant &channelParticipantValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChannelParticipant,
+        TLValue::ChannelParticipantSelf,
+        TLValue::ChannelParticipantModerator,
+        TLValue::ChannelParticipantEditor,
+        TLValue::ChannelParticipantKicked,
+        TLValue::ChannelParticipantCreator,
+    };
+    channelParticipantValue.tlType = random.pick(types);
+
+    switch (channelParticipantValue.tlType) {
+    case TLValue::ChannelParticipant:
+        fillRandom(channelParticipantValue.userId, random);
+        fillRandom(channelParticipantValue.date, random);
+        break;
+    case TLValue::ChannelParticipantSelf:
+    case TLValue::ChannelParticipantModerator:
+    case TLValue::ChannelParticipantEditor:
+        fillRandom(channelParticipantValue.userId, random);
+        fillRandom(channelParticipantValue.inviterId, random);
+        fillRandom(channelParticipantValue.date, random);
+        break;
+    case TLValue::ChannelParticipantKicked:
+        fillRandom(channelParticipantValue.userId, random);
+        fillRandom(channelParticipantValue.kickedBy, random);
+        fillRandom(channelParticipantValue.date, random);
+        break;
+    case TLValue::ChannelParticipantCreator:
+        fillRandom(channelParticipantValue.userId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChannelParticipantRole &channelParticipantRoleValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChannelRoleEmpty,
+        TLValue::ChannelRoleModerator,
+        TLValue::ChannelRoleEditor,
+    };
+    channelParticipantRoleValue.tlType = random.pick(types);
+
+    switch (channelParticipantRoleValue.tlType) {
+    case TLValue::ChannelRoleEmpty:
+    case TLValue::ChannelRoleModerator:
+    case TLValue::ChannelRoleEditor:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChannelParticipantsFilter &channelParticipantsFilterValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChannelParticipantsRecent,
+        TLValue::ChannelParticipantsAdmins,
+        TLValue::ChannelParticipantsKicked,
+        TLValue::ChannelParticipantsBots,
+    };
+    channelParticipantsFilterValue.tlType = random.pick(types);
+
+    switch (channelParticipantsFilterValue.tlType) {
+    case TLValue::ChannelParticipantsRecent:
+    case TLValue::ChannelParticipantsAdmins:
+    case TLValue::ChannelParticipantsKicked:
+    case TLValue::ChannelParticipantsBots:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChatParticipant &chatParticipantValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChatParticipant,
+        TLValue::ChatParticipantCreator,
+        TLValue::ChatParticipantAdmin,
+    };
+    chatParticipantValue.tlType = random.pick(types);
+
+    switch (chatParticipantValue.tlType) {
+    case TLValue::ChatParticipant:
+    case TLValue::ChatParticipantAdmin:
+        fillRandom(chatParticipantValue.userId, random);
+        fillRandom(chatParticipantValue.inviterId, random);
+        fillRandom(chatParticipantValue.date, random);
+        break;
+    case TLValue::ChatParticipantCreator:
+        fillRandom(chatParticipantValue.userId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChatParticipants &chatParticipantsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChatParticipantsForbidden,
+        TLValue::ChatParticipants,
+    };
+    chatParticipantsValue.tlType = random.pick(types);
+
+    switch (chatParticipantsValue.tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        fillRandom(chatParticipantsValue.flags, random);
+        fillRandom(chatParticipantsValue.chatId, random);
+        fillRandom(chatParticipantsValue.selfParticipant, random);
+        break;
+    case TLValue::ChatParticipants:
+        fillRandom(chatParticipantsValue.chatId, random);
+        fillRandom(chatParticipantsValue.participants, random);
+        fillRandom(chatParticipantsValue.version, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContact &contactValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::Contact,
+    };
+    contactValue.tlType = random.pick(types);
+
+    switch (contactValue.tlType) {
+    case TLValue::Contact:
+        fillRandom(contactValue.userId, random);
+        fillRandom(contactValue.mutual, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactBlocked &contactBlockedValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactBlocked,
+    };
+    contactBlockedValue.tlType = random.pick(types);
+
+    switch (contactBlockedValue.tlType) {
+    case TLValue::ContactBlocked:
+        fillRandom(contactBlockedValue.userId, random);
+        fillRandom(contactBlockedValue.date, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactLink &contactLinkValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactLinkUnknown,
+        TLValue::ContactLinkNone,
+        TLValue::ContactLinkHasPhone,
+        TLValue::ContactLinkContact,
+    };
+    contactLinkValue.tlType = random.pick(types);
+
+    switch (contactLinkValue.tlType) {
+    case TLValue::ContactLinkUnknown:
+    case TLValue::ContactLinkNone:
+    case TLValue::ContactLinkHasPhone:
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactSuggested &contactSuggestedValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactSuggested,
+    };
+    contactSuggestedValue.tlType = random.pick(types);
+
+    switch (contactSuggestedValue.tlType) {
+    case TLValue::ContactSuggested:
+        fillRandom(contactSuggestedValue.userId, random);
+        fillRandom(contactSuggestedValue.mutualContacts, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLDisabledFeature &disabledFeatureValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::DisabledFeature,
+    };
+    disabledFeatureValue.tlType = random.pick(types);
+
+    switch (disabledFeatureValue.tlType) {
+    case TLValue::DisabledFeature:
+        fillRandom(disabledFeatureValue.feature, random);
+        fillRandom(disabledFeatureValue.description, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLEncryptedChat &encryptedChatValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::EncryptedChatEmpty,
+        TLValue::EncryptedChatWaiting,
+        TLValue::EncryptedChatRequested,
+        TLValue::EncryptedChat,
+        TLValue::EncryptedChatDiscarded,
+    };
+    encryptedChatValue.tlType = random.pick(types);
+
+    switch (encryptedChatValue.tlType) {
+    case TLValue::EncryptedChatEmpty:
+    case TLValue::EncryptedChatDiscarded:
+        fillRandom(encryptedChatValue.id, random);
+        break;
+    case TLValue::EncryptedChatWaiting:
+        fillRandom(encryptedChatValue.id, random);
+        fillRandom(encryptedChatValue.accessHash, random);
+        fillRandom(encryptedChatValue.date, random);
+        fillRandom(encryptedChatValue.adminId, random);
+        fillRandom(encryptedChatValue.participantId, random);
+        break;
+    case TLValue::EncryptedChatRequested:
+        fillRandom(encryptedChatValue.id, random);
+        fillRandom(encryptedChatValue.accessHash, random);
+        fillRandom(encryptedChatValue.date, random);
+        fillRandom(encryptedChatValue.adminId, random);
+        fillRandom(encryptedChatValue.participantId, random);
+        fillRandom(encryptedChatValue.gA, random);
+        break;
+    case TLValue::EncryptedChat:
+        fillRandom(encryptedChatValue.id, random);
+        fillRandom(encryptedChatValue.accessHash, random);
+        fillRandom(encryptedChatValue.date, random);
+        fillRandom(encryptedChatValue.adminId, random);
+        fillRandom(encryptedChatValue.participantId, random);
+        fillRandom(encryptedChatValue.gAOrB, random);
+        fillRandom(encryptedChatValue.keyFingerprint, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLEncryptedFile &encryptedFileValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::EncryptedFileEmpty,
+        TLValue::EncryptedFile,
+    };
+    encryptedFileValue.tlType = random.pick(types);
+
+    switch (encryptedFileValue.tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        fillRandom(encryptedFileValue.id, random);
+        fillRandom(encryptedFileValue.accessHash, random);
+        fillRandom(encryptedFileValue.size, random);
+        fillRandom(encryptedFileValue.dcId, random);
+        fillRandom(encryptedFileValue.keyFingerprint, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLEncryptedMessage &encryptedMessageValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::EncryptedMessage,
+        TLValue::EncryptedMessageService,
+    };
+    encryptedMessageValue.tlType = random.pick(types);
+
+    switch (encryptedMessageValue.tlType) {
+    case TLValue::EncryptedMessage:
+        fillRandom(encryptedMessageValue.randomId, random);
+        fillRandom(encryptedMessageValue.chatId, random);
+        fillRandom(encryptedMessageValue.date, random);
+        fillRandom(encryptedMessageValue.bytes, random);
+        fillRandom(encryptedMessageValue.file, random);
+        break;
+    case TLValue::EncryptedMessageService:
+        fillRandom(encryptedMessageValue.randomId, random);
+        fillRandom(encryptedMessageValue.chatId, random);
+        fillRandom(encryptedMessageValue.date, random);
+        fillRandom(encryptedMessageValue.bytes, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLError &errorValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::Error,
+    };
+    errorValue.tlType = random.pick(types);
+
+    switch (errorValue.tlType) {
+    case TLValue::Error:
+        fillRandom(errorValue.code, random);
+        fillRandom(errorValue.text, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLExportedChatInvite &exportedChatInviteValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChatInviteEmpty,
+        TLValue::ChatInviteExported,
+    };
+    exportedChatInviteValue.tlType = random.pick(types);
+
+    switch (exportedChatInviteValue.tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        fillRandom(exportedChatInviteValue.link, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLFileLocation &fileLocationValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::FileLocationUnavailable,
+        TLValue::FileLocation,
+    };
+    fileLocationValue.tlType = random.pick(types);
+
+    switch (fileLocationValue.tlType) {
+    case TLValue::FileLocationUnavailable:
+        fillRandom(fileLocationValue.volumeId, random);
+        fillRandom(fileLocationValue.localId, random);
+        fillRandom(fileLocationValue.secret, random);
+        break;
+    case TLValue::FileLocation:
+        fillRandom(fileLocationValue.dcId, random);
+        fillRandom(fileLocationValue.volumeId, random);
+        fillRandom(fileLocationValue.localId, random);
+        fillRandom(fileLocationValue.secret, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLGeoPoint &geoPointValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::GeoPointEmpty,
+        TLValue::GeoPoint,
+    };
+    geoPointValue.tlType = random.pick(types);
+
+    switch (geoPointValue.tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        fillRandom(geoPointValue.longitude, random);
+        fillRandom(geoPointValue.latitude, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLHelpAppChangelog &helpAppChangelogValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::HelpAppChangelogEmpty,
+        TLValue::HelpAppChangelog,
+    };
+    helpAppChangelogValue.tlType = random.pick(types);
+
+    switch (helpAppChangelogValue.tlType) {
+    case TLValue::HelpAppChangelogEmpty:
+        break;
+    case TLValue::HelpAppChangelog:
+        fillRandom(helpAppChangelogValue.text, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLHelpAppUpdate &helpAppUpdateValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::HelpAppUpdate,
+        TLValue::HelpNoAppUpdate,
+    };
+    helpAppUpdateValue.tlType = random.pick(types);
+
+    switch (helpAppUpdateValue.tlType) {
+    case TLValue::HelpAppUpdate:
+        fillRandom(helpAppUpdateValue.id, random);
+        fillRandom(helpAppUpdateValue.critical, random);
+        fillRandom(helpAppUpdateValue.url, random);
+        fillRandom(helpAppUpdateValue.text, random);
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLHelpInviteText &helpInviteTextValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::HelpInviteText,
+    };
+    helpInviteTextValue.tlType = random.pick(types);
+
+    switch (helpInviteTextValue.tlType) {
+    case TLValue::HelpInviteText:
+        fillRandom(helpInviteTextValue.message, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLHelpTermsOfService &helpTermsOfServiceValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::HelpTermsOfService,
+    };
+    helpTermsOfServiceValue.tlType = random.pick(types);
+
+    switch (helpTermsOfServiceValue.tlType) {
+    case TLValue::HelpTermsOfService:
+        fillRandom(helpTermsOfServiceValue.text, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLImportedContact &importedContactValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ImportedContact,
+    };
+    importedContactValue.tlType = random.pick(types);
+
+    switch (importedContactValue.tlType) {
+    case TLValue::ImportedContact:
+        fillRandom(importedContactValue.userId, random);
+        fillRandom(importedContactValue.clientId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputAppEvent &inputAppEventValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputAppEvent,
+    };
+    inputAppEventValue.tlType = random.pick(types);
+
+    switch (inputAppEventValue.tlType) {
+    case TLValue::InputAppEvent:
+        fillRandom(inputAppEventValue.time, random);
+        fillRandom(inputAppEventValue.type, random);
+        fillRandom(inputAppEventValue.peer, random);
+        fillRandom(inputAppEventValue.data, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputAudio &inputAudioValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputAudioEmpty,
+        TLValue::InputAudio,
+    };
+    inputAudioValue.tlType = random.pick(types);
+
+    switch (inputAudioValue.tlType) {
+    case TLValue::InputAudioEmpty:
+        break;
+    case TLValue::InputAudio:
+        fillRandom(inputAudioValue.id, random);
+        fillRandom(inputAudioValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputChannel &inputChannelValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputChannelEmpty,
+        TLValue::InputChannel,
+    };
+    inputChannelValue.tlType = random.pick(types);
+
+    switch (inputChannelValue.tlType) {
+    case TLValue::InputChannelEmpty:
+        break;
+    case TLValue::InputChannel:
+        fillRandom(inputChannelValue.channelId, random);
+        fillRandom(inputChannelValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputContact &inputContactValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPhoneContact,
+    };
+    inputContactValue.tlType = random.pick(types);
+
+    switch (inputContactValue.tlType) {
+    case TLValue::InputPhoneContact:
+        fillRandom(inputContactValue.clientId, random);
+        fillRandom(inputContactValue.phone, random);
+        fillRandom(inputContactValue.firstName, random);
+        fillRandom(inputContactValue.lastName, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputDocument &inputDocumentValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputDocumentEmpty,
+        TLValue::InputDocument,
+    };
+    inputDocumentValue.tlType = random.pick(types);
+
+    switch (inputDocumentValue.tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        fillRandom(inputDocumentValue.id, random);
+        fillRandom(inputDocumentValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputEncryptedChat &inputEncryptedChatValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputEncryptedChat,
+    };
+    inputEncryptedChatValue.tlType = random.pick(types);
+
+    switch (inputEncryptedChatValue.tlType) {
+    case TLValue::InputEncryptedChat:
+        fillRandom(inputEncryptedChatValue.chatId, random);
+        fillRandom(inputEncryptedChatValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputEncryptedFile &inputEncryptedFileValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputEncryptedFileEmpty,
+        TLValue::InputEncryptedFileUploaded,
+        TLValue::InputEncryptedFile,
+        TLValue::InputEncryptedFileBigUploaded,
+    };
+    inputEncryptedFileValue.tlType = random.pick(types);
+
+    switch (inputEncryptedFileValue.tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        fillRandom(inputEncryptedFileValue.id, random);
+        fillRandom(inputEncryptedFileValue.parts, random);
+        fillRandom(inputEncryptedFileValue.md5Checksum, random);
+        fillRandom(inputEncryptedFileValue.keyFingerprint, random);
+        break;
+    case TLValue::InputEncryptedFile:
+        fillRandom(inputEncryptedFileValue.id, random);
+        fillRandom(inputEncryptedFileValue.accessHash, random);
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        fillRandom(inputEncryptedFileValue.id, random);
+        fillRandom(inputEncryptedFileValue.parts, random);
+        fillRandom(inputEncryptedFileValue.keyFingerprint, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputFile &inputFileValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputFile,
+        TLValue::InputFileBig,
+    };
+    inputFileValue.tlType = random.pick(types);
+
+    switch (inputFileValue.tlType) {
+    case TLValue::InputFile:
+        fillRandom(inputFileValue.id, random);
+        fillRandom(inputFileValue.parts, random);
+        fillRandom(inputFileValue.name, random);
+        fillRandom(inputFileValue.md5Checksum, random);
+        break;
+    case TLValue::InputFileBig:
+        fillRandom(inputFileValue.id, random);
+        fillRandom(inputFileValue.parts, random);
+        fillRandom(inputFileValue.name, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputFileLocation &inputFileLocationValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputFileLocation,
+        TLValue::InputVideoFileLocation,
+        TLValue::InputEncryptedFileLocation,
+        TLValue::InputAudioFileLocation,
+        TLValue::InputDocumentFileLocation,
+    };
+    inputFileLocationValue.tlType = random.pick(types);
+
+    switch (inputFileLocationValue.tlType) {
+    case TLValue::InputFileLocation:
+        fillRandom(inputFileLocationValue.volumeId, random);
+        fillRandom(inputFileLocationValue.localId, random);
+        fillRandom(inputFileLocationValue.secret, random);
+        break;
+    case TLValue::InputVideoFileLocation:
+    case TLValue::InputEncryptedFileLocation:
+    case TLValue::InputAudioFileLocation:
+    case TLValue::InputDocumentFileLocation:
+        fillRandom(inputFileLocationValue.id, random);
+        fillRandom(inputFileLocationValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputGeoPoint &inputGeoPointValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputGeoPointEmpty,
+        TLValue::InputGeoPoint,
+    };
+    inputGeoPointValue.tlType = random.pick(types);
+
+    switch (inputGeoPointValue.tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        fillRandom(inputGeoPointValue.latitude, random);
+        fillRandom(inputGeoPointValue.longitude, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputPeer &inputPeerValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPeerEmpty,
+        TLValue::InputPeerSelf,
+        TLValue::InputPeerChat,
+        TLValue::InputPeerUser,
+        TLValue::InputPeerChannel,
+    };
+    inputPeerValue.tlType = random.pick(types);
+
+    switch (inputPeerValue.tlType) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerChat:
+        fillRandom(inputPeerValue.chatId, random);
+        break;
+    case TLValue::InputPeerUser:
+        fillRandom(inputPeerValue.userId, random);
+        fillRandom(inputPeerValue.accessHash, random);
+        break;
+    case TLValue::InputPeerChannel:
+        fillRandom(inputPeerValue.channelId, random);
+        fillRandom(inputPeerValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputPeerNotifyEvents &inputPeerNotifyEventsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPeerNotifyEventsEmpty,
+        TLValue::InputPeerNotifyEventsAll,
+    };
+    inputPeerNotifyEventsValue.tlType = random.pick(types);
+
+    switch (inputPeerNotifyEventsValue.tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputPeerNotifySettings &inputPeerNotifySettingsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPeerNotifySettings,
+    };
+    inputPeerNotifySettingsValue.tlType = random.pick(types);
+
+    switch (inputPeerNotifySettingsValue.tlType) {
+    case TLValue::InputPeerNotifySettings:
+        fillRandom(inputPeerNotifySettingsValue.muteUntil, random);
+        fillRandom(inputPeerNotifySettingsValue.sound, random);
+        fillRandom(inputPeerNotifySettingsValue.showPreviews, random);
+        fillRandom(inputPeerNotifySettingsValue.eventsMask, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputPhoto &inputPhotoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPhotoEmpty,
+        TLValue::InputPhoto,
+    };
+    inputPhotoValue.tlType = random.pick(types);
+
+    switch (inputPhotoValue.tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        fillRandom(inputPhotoValue.id, random);
+        fillRandom(inputPhotoValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputPhotoCrop &inputPhotoCropValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPhotoCropAuto,
+        TLValue::InputPhotoCrop,
+    };
+    inputPhotoCropValue.tlType = random.pick(types);
+
+    switch (inputPhotoCropValue.tlType) {
+    case TLValue::InputPhotoCropAuto:
+        break;
+    case TLValue::InputPhotoCrop:
+        fillRandom(inputPhotoCropValue.cropLeft, random);
+        fillRandom(inputPhotoCropValue.cropTop, random);
+        fillRandom(inputPhotoCropValue.cropWidth, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputPrivacyKey &inputPrivacyKeyValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPrivacyKeyStatusTimestamp,
+    };
+    inputPrivacyKeyValue.tlType = random.pick(types);
+
+    switch (inputPrivacyKeyValue.tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputStickerSet &inputStickerSetValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputStickerSetEmpty,
+        TLValue::InputStickerSetID,
+        TLValue::InputStickerSetShortName,
+    };
+    inputStickerSetValue.tlType = random.pick(types);
+
+    switch (inputStickerSetValue.tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        fillRandom(inputStickerSetValue.id, random);
+        fillRandom(inputStickerSetValue.accessHash, random);
+        break;
+    case TLValue::InputStickerSetShortName:
+        fillRandom(inputStickerSetValue.shortName, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputUser &inputUserValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputUserEmpty,
+        TLValue::InputUserSelf,
+        TLValue::InputUser,
+    };
+    inputUserValue.tlType = random.pick(types);
+
+    switch (inputUserValue.tlType) {
+    case TLValue::InputUserEmpty:
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUser:
+        fillRandom(inputUserValue.userId, random);
+        fillRandom(inputUserValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputVideo &inputVideoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputVideoEmpty,
+        TLValue::InputVideo,
+    };
+    inputVideoValue.tlType = random.pick(types);
+
+    switch (inputVideoValue.tlType) {
+    case TLValue::InputVideoEmpty:
+        break;
+    case TLValue::InputVideo:
+        fillRandom(inputVideoValue.id, random);
+        fillRandom(inputVideoValue.accessHash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLKeyboardButton &keyboardButtonValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::KeyboardButton,
+    };
+    keyboardButtonValue.tlType = random.pick(types);
+
+    switch (keyboardButtonValue.tlType) {
+    case TLValue::KeyboardButton:
+        fillRandom(keyboardButtonValue.text, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLKeyboardButtonRow &keyboardButtonRowValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::KeyboardButtonRow,
+    };
+    keyboardButtonRowValue.tlType = random.pick(types);
+
+    switch (keyboardButtonRowValue.tlType) {
+    case TLValue::KeyboardButtonRow:
+        fillRandom(keyboardButtonRowValue.buttons, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessageEntity &messageEntityValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessageEntityUnknown,
+        TLValue::MessageEntityMention,
+        TLValue::MessageEntityHashtag,
+        TLValue::MessageEntityBotCommand,
+        TLValue::MessageEntityUrl,
+        TLValue::MessageEntityEmail,
+        TLValue::MessageEntityBold,
+        TLValue::MessageEntityItalic,
+        TLValue::MessageEntityCode,
+        TLValue::MessageEntityPre,
+        TLValue::MessageEntityTextUrl,
+    };
+    messageEntityValue.tlType = random.pick(types);
+
+    switch (messageEntityValue.tlType) {
+    case TLValue::MessageEntityUnknown:
+    case TLValue::MessageEntityMention:
+    case TLValue::MessageEntityHashtag:
+    case TLValue::MessageEntityBotCommand:
+    case TLValue::MessageEntityUrl:
+    case TLValue::MessageEntityEmail:
+    case TLValue::MessageEntityBold:
+    case TLValue::MessageEntityItalic:
+    case TLValue::MessageEntityCode:
+        fillRandom(messageEntityValue.offset, random);
+        fillRandom(messageEntityValue.length, random);
+        break;
+    case TLValue::MessageEntityPre:
+        fillRandom(messageEntityValue.offset, random);
+        fillRandom(messageEntityValue.length, random);
+        fillRandom(messageEntityValue.language, random);
+        break;
+    case TLValue::MessageEntityTextUrl:
+        fillRandom(messageEntityValue.offset, random);
+        fillRandom(messageEntityValue.length, random);
+        fillRandom(messageEntityValue.url, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessageGroup &messageGroupValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessageGroup,
+    };
+    messageGroupValue.tlType = random.pick(types);
+
+    switch (messageGroupValue.tlType) {
+    case TLValue::MessageGroup:
+        fillRandom(messageGroupValue.minId, random);
+        fillRandom(messageGroupValue.maxId, random);
+        fillRandom(messageGroupValue.count, random);
+        fillRandom(messageGroupValue.date, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessageRange &messageRangeValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessageRange,
+    };
+    messageRangeValue.tlType = random.pick(types);
+
+    switch (messageRangeValue.tlType) {
+    case TLValue::MessageRange:
+        fillRandom(messageRangeValue.minId, random);
+        fillRandom(messageRangeValue.maxId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesAffectedHistory &messagesAffectedHistoryValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesAffectedHistory,
+    };
+    messagesAffectedHistoryValue.tlType = random.pick(types);
+
+    switch (messagesAffectedHistoryValue.tlType) {
+    case TLValue::MessagesAffectedHistory:
+        fillRandom(messagesAffectedHistoryValue.pts, random);
+        fillRandom(messagesAffectedHistoryValue.ptsCount, random);
+        fillRandom(messagesAffectedHistoryValue.offset, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesAffectedMessages &messagesAffectedMessagesValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesAffectedMessages,
+    };
+    messagesAffectedMessagesValue.tlType = random.pick(types);
+
+    switch (messagesAffectedMessagesValue.tlType) {
+    case TLValue::MessagesAffectedMessages:
+        fillRandom(messagesAffectedMessagesValue.pts, random);
+        fillRandom(messagesAffectedMessagesValue.ptsCount, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesDhConfig &messagesDhConfigValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesDhConfigNotModified,
+        TLValue::MessagesDhConfig,
+    };
+    messagesDhConfigValue.tlType = random.pick(types);
+
+    switch (messagesDhConfigValue.tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        fillRandom(messagesDhConfigValue.random, random);
+        break;
+    case TLValue::MessagesDhConfig:
+        fillRandom(messagesDhConfigValue.g, random);
+        fillRandom(messagesDhConfigValue.p, random);
+        fillRandom(messagesDhConfigValue.version, random);
+        fillRandom(messagesDhConfigValue.random, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesFilter &messagesFilterValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputMessagesFilterEmpty,
+        TLValue::InputMessagesFilterPhotos,
+        TLValue::InputMessagesFilterVideo,
+        TLValue::InputMessagesFilterPhotoVideo,
+        TLValue::InputMessagesFilterPhotoVideoDocuments,
+        TLValue::InputMessagesFilterDocument,
+        TLValue::InputMessagesFilterAudio,
+        TLValue::InputMessagesFilterAudioDocuments,
+        TLValue::InputMessagesFilterUrl,
+        TLValue::InputMessagesFilterGif,
+    };
+    messagesFilterValue.tlType = random.pick(types);
+
+    switch (messagesFilterValue.tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+    case TLValue::InputMessagesFilterPhotos:
+    case TLValue::InputMessagesFilterVideo:
+    case TLValue::InputMessagesFilterPhotoVideo:
+    case TLValue::InputMessagesFilterPhotoVideoDocuments:
+    case TLValue::InputMessagesFilterDocument:
+    case TLValue::InputMessagesFilterAudio:
+    case TLValue::InputMessagesFilterAudioDocuments:
+    case TLValue::InputMessagesFilterUrl:
+    case TLValue::InputMessagesFilterGif:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesSentEncryptedMessage,
+        TLValue::MessagesSentEncryptedFile,
+    };
+    messagesSentEncryptedMessageValue.tlType = random.pick(types);
+
+    switch (messagesSentEncryptedMessageValue.tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        fillRandom(messagesSentEncryptedMessageValue.date, random);
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        fillRandom(messagesSentEncryptedMessageValue.date, random);
+        fillRandom(messagesSentEncryptedMessageValue.file, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLNearestDc &nearestDcValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::NearestDc,
+    };
+    nearestDcValue.tlType = random.pick(types);
+
+    switch (nearestDcValue.tlType) {
+    case TLValue::NearestDc:
+        fillRandom(nearestDcValue.country, random);
+        fillRandom(nearestDcValue.thisDc, random);
+        fillRandom(nearestDcValue.nearestDc, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPeer &peerValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PeerUser,
+        TLValue::PeerChat,
+        TLValue::PeerChannel,
+    };
+    peerValue.tlType = random.pick(types);
+
+    switch (peerValue.tlType) {
+    case TLValue::PeerUser:
+        fillRandom(peerValue.userId, random);
+        break;
+    case TLValue::PeerChat:
+        fillRandom(peerValue.chatId, random);
+        break;
+    case TLValue::PeerChannel:
+        fillRandom(peerValue.channelId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPeerNotifyEvents &peerNotifyEventsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PeerNotifyEventsEmpty,
+        TLValue::PeerNotifyEventsAll,
+    };
+    peerNotifyEventsValue.tlType = random.pick(types);
+
+    switch (peerNotifyEventsValue.tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPeerNotifySettings &peerNotifySettingsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PeerNotifySettingsEmpty,
+        TLValue::PeerNotifySettings,
+    };
+    peerNotifySettingsValue.tlType = random.pick(types);
+
+    switch (peerNotifySettingsValue.tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        fillRandom(peerNotifySettingsValue.muteUntil, random);
+        fillRandom(peerNotifySettingsValue.sound, random);
+        fillRandom(peerNotifySettingsValue.showPreviews, random);
+        fillRandom(peerNotifySettingsValue.eventsMask, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPhotoSize &photoSizeValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PhotoSizeEmpty,
+        TLValue::PhotoSize,
+        TLValue::PhotoCachedSize,
+    };
+    photoSizeValue.tlType = random.pick(types);
+
+    switch (photoSizeValue.tlType) {
+    case TLValue::PhotoSizeEmpty:
+        fillRandom(photoSizeValue.type, random);
+        break;
+    case TLValue::PhotoSize:
+        fillRandom(photoSizeValue.type, random);
+        fillRandom(photoSizeValue.location, random);
+        fillRandom(photoSizeValue.w, random);
+        fillRandom(photoSizeValue.h, random);
+        fillRandom(photoSizeValue.size, random);
+        break;
+    case TLValue::PhotoCachedSize:
+        fillRandom(photoSizeValue.type, random);
+        fillRandom(photoSizeValue.location, random);
+        fillRandom(photoSizeValue.w, random);
+        fillRandom(photoSizeValue.h, random);
+        fillRandom(photoSizeValue.bytes, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPrivacyKey &privacyKeyValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PrivacyKeyStatusTimestamp,
+    };
+    privacyKeyValue.tlType = random.pick(types);
+
+    switch (privacyKeyValue.tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPrivacyRule &privacyRuleValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PrivacyValueAllowContacts,
+        TLValue::PrivacyValueAllowAll,
+        TLValue::PrivacyValueAllowUsers,
+        TLValue::PrivacyValueDisallowContacts,
+        TLValue::PrivacyValueDisallowAll,
+        TLValue::PrivacyValueDisallowUsers,
+    };
+    privacyRuleValue.tlType = random.pick(types);
+
+    switch (privacyRuleValue.tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+    case TLValue::PrivacyValueAllowAll:
+    case TLValue::PrivacyValueDisallowContacts:
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+    case TLValue::PrivacyValueDisallowUsers:
+        fillRandom(privacyRuleValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLReceivedNotifyMessage &receivedNotifyMessageValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ReceivedNotifyMessage,
+    };
+    receivedNotifyMessageValue.tlType = random.pick(types);
+
+    switch (receivedNotifyMessageValue.tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        fillRandom(receivedNotifyMessageValue.id, random);
+        fillRandom(receivedNotifyMessageValue.flags, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLReportReason &reportReasonValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputReportReasonSpam,
+        TLValue::InputReportReasonViolence,
+        TLValue::InputReportReasonPornography,
+        TLValue::InputReportReasonOther,
+    };
+    reportReasonValue.tlType = random.pick(types);
+
+    switch (reportReasonValue.tlType) {
+    case TLValue::InputReportReasonSpam:
+    case TLValue::InputReportReasonViolence:
+    case TLValue::InputReportReasonPornography:
+        break;
+    case TLValue::InputReportReasonOther:
+        fillRandom(reportReasonValue.text, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLSendMessageAction &sendMessageActionValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::SendMessageTypingAction,
+        TLValue::SendMessageCancelAction,
+        TLValue::SendMessageRecordVideoAction,
+        TLValue::SendMessageUploadVideoAction,
+        TLValue::SendMessageRecordAudioAction,
+        TLValue::SendMessageUploadAudioAction,
+        TLValue::SendMessageUploadPhotoAction,
+        TLValue::SendMessageUploadDocumentAction,
+        TLValue::SendMessageGeoLocationAction,
+        TLValue::SendMessageChooseContactAction,
+    };
+    sendMessageActionValue.tlType = random.pick(types);
+
+    switch (sendMessageActionValue.tlType) {
+    case TLValue::SendMessageTypingAction:
+    case TLValue::SendMessageCancelAction:
+    case TLValue::SendMessageRecordVideoAction:
+    case TLValue::SendMessageRecordAudioAction:
+    case TLValue::SendMessageGeoLocationAction:
+    case TLValue::SendMessageChooseContactAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+    case TLValue::SendMessageUploadAudioAction:
+    case TLValue::SendMessageUploadPhotoAction:
+    case TLValue::SendMessageUploadDocumentAction:
+        fillRandom(sendMessageActionValue.progress, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLStickerPack &stickerPackValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::StickerPack,
+    };
+    stickerPackValue.tlType = random.pick(types);
+
+    switch (stickerPackValue.tlType) {
+    case TLValue::StickerPack:
+        fillRandom(stickerPackValue.emoticon, random);
+        fillRandom(stickerPackValue.documents, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLStorageFileType &storageFileTypeValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::StorageFileUnknown,
+        TLValue::StorageFileJpeg,
+        TLValue::StorageFileGif,
+        TLValue::StorageFilePng,
+        TLValue::StorageFilePdf,
+        TLValue::StorageFileMp3,
+        TLValue::StorageFileMov,
+        TLValue::StorageFilePartial,
+        TLValue::StorageFileMp4,
+        TLValue::StorageFileWebp,
+    };
+    storageFileTypeValue.tlType = random.pick(types);
+
+    switch (storageFileTypeValue.tlType) {
+    case TLValue::StorageFileUnknown:
+    case TLValue::StorageFileJpeg:
+    case TLValue::StorageFileGif:
+    case TLValue::StorageFilePng:
+    case TLValue::StorageFilePdf:
+    case TLValue::StorageFileMp3:
+    case TLValue::StorageFileMov:
+    case TLValue::StorageFilePartial:
+    case TLValue::StorageFileMp4:
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUpdatesState &updatesStateValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UpdatesState,
+    };
+    updatesStateValue.tlType = random.pick(types);
+
+    switch (updatesStateValue.tlType) {
+    case TLValue::UpdatesState:
+        fillRandom(updatesStateValue.pts, random);
+        fillRandom(updatesStateValue.qts, random);
+        fillRandom(updatesStateValue.date, random);
+        fillRandom(updatesStateValue.seq, random);
+        fillRandom(updatesStateValue.unreadCount, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUploadFile &uploadFileValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UploadFile,
+    };
+    uploadFileValue.tlType = random.pick(types);
+
+    switch (uploadFileValue.tlType) {
+    case TLValue::UploadFile:
+        fillRandom(uploadFileValue.type, random);
+        fillRandom(uploadFileValue.mtime, random);
+        fillRandom(uploadFileValue.bytes, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUserProfilePhoto &userProfilePhotoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UserProfilePhotoEmpty,
+        TLValue::UserProfilePhoto,
+    };
+    userProfilePhotoValue.tlType = random.pick(types);
+
+    switch (userProfilePhotoValue.tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        fillRandom(userProfilePhotoValue.photoId, random);
+        fillRandom(userProfilePhotoValue.photoSmall, random);
+        fillRandom(userProfilePhotoValue.photoBig, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUserStatus &userStatusValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UserStatusEmpty,
+        TLValue::UserStatusOnline,
+        TLValue::UserStatusOffline,
+        TLValue::UserStatusRecently,
+        TLValue::UserStatusLastWeek,
+        TLValue::UserStatusLastMonth,
+    };
+    userStatusValue.tlType = random.pick(types);
+
+    switch (userStatusValue.tlType) {
+    case TLValue::UserStatusEmpty:
+    case TLValue::UserStatusRecently:
+    case TLValue::UserStatusLastWeek:
+    case TLValue::UserStatusLastMonth:
+        break;
+    case TLValue::UserStatusOnline:
+        fillRandom(userStatusValue.expires, random);
+        break;
+    case TLValue::UserStatusOffline:
+        fillRandom(userStatusValue.wasOnline, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLVideo &videoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::VideoEmpty,
+        TLValue::Video,
+    };
+    videoValue.tlType = random.pick(types);
+
+    switch (videoValue.tlType) {
+    case TLValue::VideoEmpty:
+        fillRandom(videoValue.id, random);
+        break;
+    case TLValue::Video:
+        fillRandom(videoValue.id, random);
+        fillRandom(videoValue.accessHash, random);
+        fillRandom(videoValue.date, random);
+        fillRandom(videoValue.duration, random);
+        fillRandom(videoValue.mimeType, random);
+        fillRandom(videoValue.size, random);
+        fillRandom(videoValue.thumb, random);
+        fillRandom(videoValue.dcId, random);
+        fillRandom(videoValue.w, random);
+        fillRandom(videoValue.h, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLWallPaper &wallPaperValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::WallPaper,
+        TLValue::WallPaperSolid,
+    };
+    wallPaperValue.tlType = random.pick(types);
+
+    switch (wallPaperValue.tlType) {
+    case TLValue::WallPaper:
+        fillRandom(wallPaperValue.id, random);
+        fillRandom(wallPaperValue.title, random);
+        fillRandom(wallPaperValue.sizes, random);
+        fillRandom(wallPaperValue.color, random);
+        break;
+    case TLValue::WallPaperSolid:
+        fillRandom(wallPaperValue.id, random);
+        fillRandom(wallPaperValue.title, random);
+        fillRandom(wallPaperValue.bgColor, random);
+        fillRandom(wallPaperValue.color, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAccountAuthorizations &accountAuthorizationsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AccountAuthorizations,
+    };
+    accountAuthorizationsValue.tlType = random.pick(types);
+
+    switch (accountAuthorizationsValue.tlType) {
+    case TLValue::AccountAuthorizations:
+        fillRandom(accountAuthorizationsValue.authorizations, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLBotInlineMessage &botInlineMessageValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::BotInlineMessageMediaAuto,
+        TLValue::BotInlineMessageText,
+    };
+    botInlineMessageValue.tlType = random.pick(types);
+
+    switch (botInlineMessageValue.tlType) {
+    case TLValue::BotInlineMessageMediaAuto:
+        fillRandom(botInlineMessageValue.caption, random);
+        break;
+    case TLValue::BotInlineMessageText:
+        fillRandom(botInlineMessageValue.flags, random);
+        fillRandom(botInlineMessageValue.message, random);
+        fillRandom(botInlineMessageValue.entities, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChannelMessagesFilter &channelMessagesFilterValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChannelMessagesFilterEmpty,
+        TLValue::ChannelMessagesFilter,
+        TLValue::ChannelMessagesFilterCollapsed,
+    };
+    channelMessagesFilterValue.tlType = random.pick(types);
+
+    switch (channelMessagesFilterValue.tlType) {
+    case TLValue::ChannelMessagesFilterEmpty:
+    case TLValue::ChannelMessagesFilterCollapsed:
+        break;
+    case TLValue::ChannelMessagesFilter:
+        fillRandom(channelMessagesFilterValue.flags, random);
+        fillRandom(channelMessagesFilterValue.ranges, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChatPhoto &chatPhotoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChatPhotoEmpty,
+        TLValue::ChatPhoto,
+    };
+    chatPhotoValue.tlType = random.pick(types);
+
+    switch (chatPhotoValue.tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        fillRandom(chatPhotoValue.photoSmall, random);
+        fillRandom(chatPhotoValue.photoBig, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactStatus &contactStatusValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactStatus,
+    };
+    contactStatusValue.tlType = random.pick(types);
+
+    switch (contactStatusValue.tlType) {
+    case TLValue::ContactStatus:
+        fillRandom(contactStatusValue.userId, random);
+        fillRandom(contactStatusValue.status, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLDcOption &dcOptionValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::DcOption,
+    };
+    dcOptionValue.tlType = random.pick(types);
+
+    switch (dcOptionValue.tlType) {
+    case TLValue::DcOption:
+        fillRandom(dcOptionValue.flags, random);
+        fillRandom(dcOptionValue.id, random);
+        fillRandom(dcOptionValue.ipAddress, random);
+        fillRandom(dcOptionValue.port, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLDialog &dialogValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::Dialog,
+        TLValue::DialogChannel,
+    };
+    dialogValue.tlType = random.pick(types);
+
+    switch (dialogValue.tlType) {
+    case TLValue::Dialog:
+        fillRandom(dialogValue.peer, random);
+        fillRandom(dialogValue.topMessage, random);
+        fillRandom(dialogValue.readInboxMaxId, random);
+        fillRandom(dialogValue.unreadCount, random);
+        fillRandom(dialogValue.notifySettings, random);
+        break;
+    case TLValue::DialogChannel:
+        fillRandom(dialogValue.peer, random);
+        fillRandom(dialogValue.topMessage, random);
+        fillRandom(dialogValue.topImportantMessage, random);
+        fillRandom(dialogValue.readInboxMaxId, random);
+        fillRandom(dialogValue.unreadCount, random);
+        fillRandom(dialogValue.unreadImportantCount, random);
+        fillRandom(dialogValue.notifySettings, random);
+        fillRandom(dialogValue.pts, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLDocumentAttribute &documentAttributeValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::DocumentAttributeImageSize,
+        TLValue::DocumentAttributeAnimated,
+        TLValue::DocumentAttributeSticker,
+        TLValue::DocumentAttributeVideo,
+        TLValue::DocumentAttributeAudio,
+        TLValue::DocumentAttributeFilename,
+    };
+    documentAttributeValue.tlType = random.pick(types);
+
+    switch (documentAttributeValue.tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        fillRandom(documentAttributeValue.w, random);
+        fillRandom(documentAttributeValue.h, random);
+        break;
+    case TLValue::DocumentAttributeAnimated:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        fillRandom(documentAttributeValue.alt, random);
+        fillRandom(documentAttributeValue.stickerset, random);
+        break;
+    case TLValue::DocumentAttributeVideo:
+        fillRandom(documentAttributeValue.duration, random);
+        fillRandom(documentAttributeValue.w, random);
+        fillRandom(documentAttributeValue.h, random);
+        break;
+    case TLValue::DocumentAttributeAudio:
+        fillRandom(documentAttributeValue.duration, random);
+        fillRandom(documentAttributeValue.title, random);
+        fillRandom(documentAttributeValue.performer, random);
+        break;
+    case TLValue::DocumentAttributeFilename:
+        fillRandom(documentAttributeValue.fileName, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputBotInlineMessage &inputBotInlineMessageValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputBotInlineMessageMediaAuto,
+        TLValue::InputBotInlineMessageText,
+    };
+    inputBotInlineMessageValue.tlType = random.pick(types);
+
+    switch (inputBotInlineMessageValue.tlType) {
+    case TLValue::InputBotInlineMessageMediaAuto:
+        fillRandom(inputBotInlineMessageValue.caption, random);
+        break;
+    case TLValue::InputBotInlineMessageText:
+        fillRandom(inputBotInlineMessageValue.flags, random);
+        fillRandom(inputBotInlineMessageValue.message, random);
+        fillRandom(inputBotInlineMessageValue.entities, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputBotInlineResult &inputBotInlineResultValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputBotInlineResult,
+    };
+    inputBotInlineResultValue.tlType = random.pick(types);
+
+    switch (inputBotInlineResultValue.tlType) {
+    case TLValue::InputBotInlineResult:
+        fillRandom(inputBotInlineResultValue.flags, random);
+        fillRandom(inputBotInlineResultValue.id, random);
+        fillRandom(inputBotInlineResultValue.type, random);
+        fillRandom(inputBotInlineResultValue.title, random);
+        fillRandom(inputBotInlineResultValue.description, random);
+        fillRandom(inputBotInlineResultValue.url, random);
+        fillRandom(inputBotInlineResultValue.thumbUrl, random);
+        fillRandom(inputBotInlineResultValue.contentUrl, random);
+        fillRandom(inputBotInlineResultValue.contentType, random);
+        fillRandom(inputBotInlineResultValue.w, random);
+        fillRandom(inputBotInlineResultValue.h, random);
+        fillRandom(inputBotInlineResultValue.duration, random);
+        fillRandom(inputBotInlineResultValue.sendMessage, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputChatPhoto &inputChatPhotoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputChatPhotoEmpty,
+        TLValue::InputChatUploadedPhoto,
+        TLValue::InputChatPhoto,
+    };
+    inputChatPhotoValue.tlType = random.pick(types);
+
+    switch (inputChatPhotoValue.tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        fillRandom(inputChatPhotoValue.file, random);
+        fillRandom(inputChatPhotoValue.crop, random);
+        break;
+    case TLValue::InputChatPhoto:
+        fillRandom(inputChatPhotoValue.id, random);
+        fillRandom(inputChatPhotoValue.crop, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputMedia &inputMediaValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputMediaEmpty,
+        TLValue::InputMediaUploadedPhoto,
+        TLValue::InputMediaPhoto,
+        TLValue::InputMediaGeoPoint,
+        TLValue::InputMediaContact,
+        TLValue::InputMediaUploadedVideo,
+        TLValue::InputMediaUploadedThumbVideo,
+        TLValue::InputMediaVideo,
+        TLValue::InputMediaUploadedAudio,
+        TLValue::InputMediaAudio,
+        TLValue::InputMediaUploadedDocument,
+        TLValue::InputMediaUploadedThumbDocument,
+        TLValue::InputMediaDocument,
+        TLValue::InputMediaVenue,
+        TLValue::InputMediaGifExternal,
+    };
+    inputMediaValue.tlType = random.pick(types);
+
+    switch (inputMediaValue.tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        fillRandom(inputMediaValue.file, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaPhoto:
+        fillRandom(inputMediaValue.inputPhotoId, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaGeoPoint:
+        fillRandom(inputMediaValue.geoPoint, random);
+        break;
+    case TLValue::InputMediaContact:
+        fillRandom(inputMediaValue.phoneNumber, random);
+        fillRandom(inputMediaValue.firstName, random);
+        fillRandom(inputMediaValue.lastName, random);
+        break;
+    case TLValue::InputMediaUploadedVideo:
+        fillRandom(inputMediaValue.file, random);
+        fillRandom(inputMediaValue.duration, random);
+        fillRandom(inputMediaValue.w, random);
+        fillRandom(inputMediaValue.h, random);
+        fillRandom(inputMediaValue.mimeType, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaUploadedThumbVideo:
+        fillRandom(inputMediaValue.file, random);
+        fillRandom(inputMediaValue.thumb, random);
+        fillRandom(inputMediaValue.duration, random);
+        fillRandom(inputMediaValue.w, random);
+        fillRandom(inputMediaValue.h, random);
+        fillRandom(inputMediaValue.mimeType, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaVideo:
+        fillRandom(inputMediaValue.inputVideoId, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaUploadedAudio:
+        fillRandom(inputMediaValue.file, random);
+        fillRandom(inputMediaValue.duration, random);
+        fillRandom(inputMediaValue.mimeType, random);
+        break;
+    case TLValue::InputMediaAudio:
+        fillRandom(inputMediaValue.inputAudioId, random);
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        fillRandom(inputMediaValue.file, random);
+        fillRandom(inputMediaValue.mimeType, random);
+        fillRandom(inputMediaValue.attributes, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaUploadedThumbDocument:
+        fillRandom(inputMediaValue.file, random);
+        fillRandom(inputMediaValue.thumb, random);
+        fillRandom(inputMediaValue.mimeType, random);
+        fillRandom(inputMediaValue.attributes, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaDocument:
+        fillRandom(inputMediaValue.inputDocumentId, random);
+        fillRandom(inputMediaValue.caption, random);
+        break;
+    case TLValue::InputMediaVenue:
+        fillRandom(inputMediaValue.geoPoint, random);
+        fillRandom(inputMediaValue.title, random);
+        fillRandom(inputMediaValue.address, random);
+        fillRandom(inputMediaValue.provider, random);
+        fillRandom(inputMediaValue.venueId, random);
+        break;
+    case TLValue::InputMediaGifExternal:
+        fillRandom(inputMediaValue.url, random);
+        fillRandom(inputMediaValue.q, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputNotifyPeer &inputNotifyPeerValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputNotifyPeer,
+        TLValue::InputNotifyUsers,
+        TLValue::InputNotifyChats,
+        TLValue::InputNotifyAll,
+    };
+    inputNotifyPeerValue.tlType = random.pick(types);
+
+    switch (inputNotifyPeerValue.tlType) {
+    case TLValue::InputNotifyPeer:
+        fillRandom(inputNotifyPeerValue.peer, random);
+        break;
+    case TLValue::InputNotifyUsers:
+    case TLValue::InputNotifyChats:
+    case TLValue::InputNotifyAll:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLInputPrivacyRule &inputPrivacyRuleValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::InputPrivacyValueAllowContacts,
+        TLValue::InputPrivacyValueAllowAll,
+        TLValue::InputPrivacyValueAllowUsers,
+        TLValue::InputPrivacyValueDisallowContacts,
+        TLValue::InputPrivacyValueDisallowAll,
+        TLValue::InputPrivacyValueDisallowUsers,
+    };
+    inputPrivacyRuleValue.tlType = random.pick(types);
+
+    switch (inputPrivacyRuleValue.tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+    case TLValue::InputPrivacyValueAllowAll:
+    case TLValue::InputPrivacyValueDisallowContacts:
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+    case TLValue::InputPrivacyValueDisallowUsers:
+        fillRandom(inputPrivacyRuleValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLNotifyPeer &notifyPeerValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::NotifyPeer,
+        TLValue::NotifyUsers,
+        TLValue::NotifyChats,
+        TLValue::NotifyAll,
+    };
+    notifyPeerValue.tlType = random.pick(types);
+
+    switch (notifyPeerValue.tlType) {
+    case TLValue::NotifyPeer:
+        fillRandom(notifyPeerValue.peer, random);
+        break;
+    case TLValue::NotifyUsers:
+    case TLValue::NotifyChats:
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPhoto &photoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PhotoEmpty,
+        TLValue::Photo,
+    };
+    photoValue.tlType = random.pick(types);
+
+    switch (photoValue.tlType) {
+    case TLValue::PhotoEmpty:
+        fillRandom(photoValue.id, random);
+        break;
+    case TLValue::Photo:
+        fillRandom(photoValue.id, random);
+        fillRandom(photoValue.accessHash, random);
+        fillRandom(photoValue.date, random);
+        fillRandom(photoValue.sizes, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLReplyMarkup &replyMarkupValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ReplyKeyboardHide,
+        TLValue::ReplyKeyboardForceReply,
+        TLValue::ReplyKeyboardMarkup,
+    };
+    replyMarkupValue.tlType = random.pick(types);
+
+    switch (replyMarkupValue.tlType) {
+    case TLValue::ReplyKeyboardHide:
+    case TLValue::ReplyKeyboardForceReply:
+        fillRandom(replyMarkupValue.flags, random);
+        break;
+    case TLValue::ReplyKeyboardMarkup:
+        fillRandom(replyMarkupValue.flags, random);
+        fillRandom(replyMarkupValue.rows, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLStickerSet &stickerSetValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::StickerSet,
+    };
+    stickerSetValue.tlType = random.pick(types);
+
+    switch (stickerSetValue.tlType) {
+    case TLValue::StickerSet:
+        fillRandom(stickerSetValue.flags, random);
+        fillRandom(stickerSetValue.id, random);
+        fillRandom(stickerSetValue.accessHash, random);
+        fillRandom(stickerSetValue.title, random);
+        fillRandom(stickerSetValue.shortName, random);
+        fillRandom(stickerSetValue.count, random);
+        fillRandom(stickerSetValue.hash, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUser &userValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UserEmpty,
+        TLValue::User,
+    };
+    userValue.tlType = random.pick(types);
+
+    switch (userValue.tlType) {
+    case TLValue::UserEmpty:
+        fillRandom(userValue.id, random);
+        break;
+    case TLValue::User:
+        fillRandom(userValue.flags, random);
+        fillRandom(userValue.id, random);
+        fillRandom(userValue.accessHash, random);
+        fillRandom(userValue.firstName, random);
+        fillRandom(userValue.lastName, random);
+        fillRandom(userValue.username, random);
+        fillRandom(userValue.phone, random);
+        fillRandom(userValue.photo, random);
+        fillRandom(userValue.status, random);
+        fillRandom(userValue.botInfoVersion, random);
+        fillRandom(userValue.restrictionReason, random);
+        fillRandom(userValue.botInlinePlaceholder, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAccountPrivacyRules &accountPrivacyRulesValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AccountPrivacyRules,
+    };
+    accountPrivacyRulesValue.tlType = random.pick(types);
+
+    switch (accountPrivacyRulesValue.tlType) {
+    case TLValue::AccountPrivacyRules:
+        fillRandom(accountPrivacyRulesValue.rules, random);
+        fillRandom(accountPrivacyRulesValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLAuthAuthorization &authAuthorizationValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::AuthAuthorization,
+    };
+    authAuthorizationValue.tlType = random.pick(types);
+
+    switch (authAuthorizationValue.tlType) {
+    case TLValue::AuthAuthorization:
+        fillRandom(authAuthorizationValue.user, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChannelsChannelParticipant &channelsChannelParticipantValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChannelsChannelParticipant,
+    };
+    channelsChannelParticipantValue.tlType = random.pick(types);
+
+    switch (channelsChannelParticipantValue.tlType) {
+    case TLValue::ChannelsChannelParticipant:
+        fillRandom(channelsChannelParticipantValue.participant, random);
+        fillRandom(channelsChannelParticipantValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChannelsChannelParticipants &channelsChannelParticipantsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChannelsChannelParticipants,
+    };
+    channelsChannelParticipantsValue.tlType = random.pick(types);
+
+    switch (channelsChannelParticipantsValue.tlType) {
+    case TLValue::ChannelsChannelParticipants:
+        fillRandom(channelsChannelParticipantsValue.count, random);
+        fillRandom(channelsChannelParticipantsValue.participants, random);
+        fillRandom(channelsChannelParticipantsValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChat &chatValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChatEmpty,
+        TLValue::Chat,
+        TLValue::ChatForbidden,
+        TLValue::Channel,
+        TLValue::ChannelForbidden,
+    };
+    chatValue.tlType = random.pick(types);
+
+    switch (chatValue.tlType) {
+    case TLValue::ChatEmpty:
+        fillRandom(chatValue.id, random);
+        break;
+    case TLValue::Chat:
+        fillRandom(chatValue.flags, random);
+        fillRandom(chatValue.id, random);
+        fillRandom(chatValue.title, random);
+        fillRandom(chatValue.photo, random);
+        fillRandom(chatValue.participantsCount, random);
+        fillRandom(chatValue.date, random);
+        fillRandom(chatValue.version, random);
+        fillRandom(chatValue.migratedTo, random);
+        break;
+    case TLValue::ChatForbidden:
+        fillRandom(chatValue.id, random);
+        fillRandom(chatValue.title, random);
+        break;
+    case TLValue::Channel:
+        fillRandom(chatValue.flags, random);
+        fillRandom(chatValue.id, random);
+        fillRandom(chatValue.accessHash, random);
+        fillRandom(chatValue.title, random);
+        fillRandom(chatValue.username, random);
+        fillRandom(chatValue.photo, random);
+        fillRandom(chatValue.date, random);
+        fillRandom(chatValue.version, random);
+        fillRandom(chatValue.restrictionReason, random);
+        break;
+    case TLValue::ChannelForbidden:
+        fillRandom(chatValue.id, random);
+        fillRandom(chatValue.accessHash, random);
+        fillRandom(chatValue.title, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChatFull &chatFullValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChatFull,
+        TLValue::ChannelFull,
+    };
+    chatFullValue.tlType = random.pick(types);
+
+    switch (chatFullValue.tlType) {
+    case TLValue::ChatFull:
+        fillRandom(chatFullValue.id, random);
+        fillRandom(chatFullValue.participants, random);
+        fillRandom(chatFullValue.chatPhoto, random);
+        fillRandom(chatFullValue.notifySettings, random);
+        fillRandom(chatFullValue.exportedInvite, random);
+        fillRandom(chatFullValue.botInfo, random);
+        break;
+    case TLValue::ChannelFull:
+        fillRandom(chatFullValue.flags, random);
+        fillRandom(chatFullValue.id, random);
+        fillRandom(chatFullValue.about, random);
+        fillRandom(chatFullValue.participantsCount, random);
+        fillRandom(chatFullValue.adminsCount, random);
+        fillRandom(chatFullValue.kickedCount, random);
+        fillRandom(chatFullValue.readInboxMaxId, random);
+        fillRandom(chatFullValue.unreadCount, random);
+        fillRandom(chatFullValue.unreadImportantCount, random);
+        fillRandom(chatFullValue.chatPhoto, random);
+        fillRandom(chatFullValue.notifySettings, random);
+        fillRandom(chatFullValue.exportedInvite, random);
+        fillRandom(chatFullValue.botInfo, random);
+        fillRandom(chatFullValue.migratedFromChatId, random);
+        fillRandom(chatFullValue.migratedFromMaxId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLChatInvite &chatInviteValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ChatInviteAlready,
+        TLValue::ChatInvite,
+    };
+    chatInviteValue.tlType = random.pick(types);
+
+    switch (chatInviteValue.tlType) {
+    case TLValue::ChatInviteAlready:
+        fillRandom(chatInviteValue.chat, random);
+        break;
+    case TLValue::ChatInvite:
+        fillRandom(chatInviteValue.flags, random);
+        fillRandom(chatInviteValue.title, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLConfig &configValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::Config,
+    };
+    configValue.tlType = random.pick(types);
+
+    switch (configValue.tlType) {
+    case TLValue::Config:
+        fillRandom(configValue.date, random);
+        fillRandom(configValue.expires, random);
+        fillRandom(configValue.testMode, random);
+        fillRandom(configValue.thisDc, random);
+        fillRandom(configValue.dcOptions, random);
+        fillRandom(configValue.chatSizeMax, random);
+        fillRandom(configValue.megagroupSizeMax, random);
+        fillRandom(configValue.forwardedCountMax, random);
+        fillRandom(configValue.onlineUpdatePeriodMs, random);
+        fillRandom(configValue.offlineBlurTimeoutMs, random);
+        fillRandom(configValue.offlineIdleTimeoutMs, random);
+        fillRandom(configValue.onlineCloudTimeoutMs, random);
+        fillRandom(configValue.notifyCloudDelayMs, random);
+        fillRandom(configValue.notifyDefaultDelayMs, random);
+        fillRandom(configValue.chatBigSize, random);
+        fillRandom(configValue.pushChatPeriodMs, random);
+        fillRandom(configValue.pushChatLimit, random);
+        fillRandom(configValue.savedGifsLimit, random);
+        fillRandom(configValue.disabledFeatures, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactsBlocked &contactsBlockedValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactsBlocked,
+        TLValue::ContactsBlockedSlice,
+    };
+    contactsBlockedValue.tlType = random.pick(types);
+
+    switch (contactsBlockedValue.tlType) {
+    case TLValue::ContactsBlocked:
+        fillRandom(contactsBlockedValue.blocked, random);
+        fillRandom(contactsBlockedValue.users, random);
+        break;
+    case TLValue::ContactsBlockedSlice:
+        fillRandom(contactsBlockedValue.count, random);
+        fillRandom(contactsBlockedValue.blocked, random);
+        fillRandom(contactsBlockedValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactsContacts &contactsContactsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactsContactsNotModified,
+        TLValue::ContactsContacts,
+    };
+    contactsContactsValue.tlType = random.pick(types);
+
+    switch (contactsContactsValue.tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        fillRandom(contactsContactsValue.contacts, random);
+        fillRandom(contactsContactsValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactsFound &contactsFoundValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactsFound,
+    };
+    contactsFoundValue.tlType = random.pick(types);
+
+    switch (contactsFoundValue.tlType) {
+    case TLValue::ContactsFound:
+        fillRandom(contactsFoundValue.results, random);
+        fillRandom(contactsFoundValue.chats, random);
+        fillRandom(contactsFoundValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactsImportedContacts &contactsImportedContactsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactsImportedContacts,
+    };
+    contactsImportedContactsValue.tlType = random.pick(types);
+
+    switch (contactsImportedContactsValue.tlType) {
+    case TLValue::ContactsImportedContacts:
+        fillRandom(contactsImportedContactsValue.imported, random);
+        fillRandom(contactsImportedContactsValue.retryContacts, random);
+        fillRandom(contactsImportedContactsValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactsLink &contactsLinkValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactsLink,
+    };
+    contactsLinkValue.tlType = random.pick(types);
+
+    switch (contactsLinkValue.tlType) {
+    case TLValue::ContactsLink:
+        fillRandom(contactsLinkValue.myLink, random);
+        fillRandom(contactsLinkValue.foreignLink, random);
+        fillRandom(contactsLinkValue.user, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactsResolvedPeer &contactsResolvedPeerValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactsResolvedPeer,
+    };
+    contactsResolvedPeerValue.tlType = random.pick(types);
+
+    switch (contactsResolvedPeerValue.tlType) {
+    case TLValue::ContactsResolvedPeer:
+        fillRandom(contactsResolvedPeerValue.peer, random);
+        fillRandom(contactsResolvedPeerValue.chats, random);
+        fillRandom(contactsResolvedPeerValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLContactsSuggested &contactsSuggestedValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::ContactsSuggested,
+    };
+    contactsSuggestedValue.tlType = random.pick(types);
+
+    switch (contactsSuggestedValue.tlType) {
+    case TLValue::ContactsSuggested:
+        fillRandom(contactsSuggestedValue.results, random);
+        fillRandom(contactsSuggestedValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLDocument &documentValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::DocumentEmpty,
+        TLValue::Document,
+    };
+    documentValue.tlType = random.pick(types);
+
+    switch (documentValue.tlType) {
+    case TLValue::DocumentEmpty:
+        fillRandom(documentValue.id, random);
+        break;
+    case TLValue::Document:
+        fillRandom(documentValue.id, random);
+        fillRandom(documentValue.accessHash, random);
+        fillRandom(documentValue.date, random);
+        fillRandom(documentValue.mimeType, random);
+        fillRandom(documentValue.size, random);
+        fillRandom(documentValue.thumb, random);
+        fillRandom(documentValue.dcId, random);
+        fillRandom(documentValue.attributes, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLFoundGif &foundGifValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::FoundGif,
+        TLValue::FoundGifCached,
+    };
+    foundGifValue.tlType = random.pick(types);
+
+    switch (foundGifValue.tlType) {
+    case TLValue::FoundGif:
+        fillRandom(foundGifValue.url, random);
+        fillRandom(foundGifValue.thumbUrl, random);
+        fillRandom(foundGifValue.contentUrl, random);
+        fillRandom(foundGifValue.contentType, random);
+        fillRandom(foundGifValue.w, random);
+        fillRandom(foundGifValue.h, random);
+        break;
+    case TLValue::FoundGifCached:
+        fillRandom(foundGifValue.url, random);
+        fillRandom(foundGifValue.photo, random);
+        fillRandom(foundGifValue.document, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLHelpSupport &helpSupportValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::HelpSupport,
+    };
+    helpSupportValue.tlType = random.pick(types);
+
+    switch (helpSupportValue.tlType) {
+    case TLValue::HelpSupport:
+        fillRandom(helpSupportValue.phoneNumber, random);
+        fillRandom(helpSupportValue.user, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessageAction &messageActionValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessageActionEmpty,
+        TLValue::MessageActionChatCreate,
+        TLValue::MessageActionChatEditTitle,
+        TLValue::MessageActionChatEditPhoto,
+        TLValue::MessageActionChatDeletePhoto,
+        TLValue::MessageActionChatAddUser,
+        TLValue::MessageActionChatDeleteUser,
+        TLValue::MessageActionChatJoinedByLink,
+        TLValue::MessageActionChannelCreate,
+        TLValue::MessageActionChatMigrateTo,
+        TLValue::MessageActionChannelMigrateFrom,
+    };
+    messageActionValue.tlType = random.pick(types);
+
+    switch (messageActionValue.tlType) {
+    case TLValue::MessageActionEmpty:
+    case TLValue::MessageActionChatDeletePhoto:
+        break;
+    case TLValue::MessageActionChatCreate:
+        fillRandom(messageActionValue.title, random);
+        fillRandom(messageActionValue.users, random);
+        break;
+    case TLValue::MessageActionChatEditTitle:
+    case TLValue::MessageActionChannelCreate:
+        fillRandom(messageActionValue.title, random);
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        fillRandom(messageActionValue.photo, random);
+        break;
+    case TLValue::MessageActionChatAddUser:
+        fillRandom(messageActionValue.users, random);
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+        fillRandom(messageActionValue.userId, random);
+        break;
+    case TLValue::MessageActionChatJoinedByLink:
+        fillRandom(messageActionValue.inviterId, random);
+        break;
+    case TLValue::MessageActionChatMigrateTo:
+        fillRandom(messageActionValue.channelId, random);
+        break;
+    case TLValue::MessageActionChannelMigrateFrom:
+        fillRandom(messageActionValue.title, random);
+        fillRandom(messageActionValue.chatId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesAllStickers &messagesAllStickersValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesAllStickersNotModified,
+        TLValue::MessagesAllStickers,
+    };
+    messagesAllStickersValue.tlType = random.pick(types);
+
+    switch (messagesAllStickersValue.tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        fillRandom(messagesAllStickersValue.hash, random);
+        fillRandom(messagesAllStickersValue.sets, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesChatFull &messagesChatFullValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesChatFull,
+    };
+    messagesChatFullValue.tlType = random.pick(types);
+
+    switch (messagesChatFullValue.tlType) {
+    case TLValue::MessagesChatFull:
+        fillRandom(messagesChatFullValue.fullChat, random);
+        fillRandom(messagesChatFullValue.chats, random);
+        fillRandom(messagesChatFullValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesChats &messagesChatsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesChats,
+    };
+    messagesChatsValue.tlType = random.pick(types);
+
+    switch (messagesChatsValue.tlType) {
+    case TLValue::MessagesChats:
+        fillRandom(messagesChatsValue.chats, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesFoundGifs &messagesFoundGifsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesFoundGifs,
+    };
+    messagesFoundGifsValue.tlType = random.pick(types);
+
+    switch (messagesFoundGifsValue.tlType) {
+    case TLValue::MessagesFoundGifs:
+        fillRandom(messagesFoundGifsValue.nextOffset, random);
+        fillRandom(messagesFoundGifsValue.results, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesSavedGifs &messagesSavedGifsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesSavedGifsNotModified,
+        TLValue::MessagesSavedGifs,
+    };
+    messagesSavedGifsValue.tlType = random.pick(types);
+
+    switch (messagesSavedGifsValue.tlType) {
+    case TLValue::MessagesSavedGifsNotModified:
+        break;
+    case TLValue::MessagesSavedGifs:
+        fillRandom(messagesSavedGifsValue.hash, random);
+        fillRandom(messagesSavedGifsValue.gifs, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesStickerSet &messagesStickerSetValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesStickerSet,
+    };
+    messagesStickerSetValue.tlType = random.pick(types);
+
+    switch (messagesStickerSetValue.tlType) {
+    case TLValue::MessagesStickerSet:
+        fillRandom(messagesStickerSetValue.set, random);
+        fillRandom(messagesStickerSetValue.packs, random);
+        fillRandom(messagesStickerSetValue.documents, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesStickers &messagesStickersValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesStickersNotModified,
+        TLValue::MessagesStickers,
+    };
+    messagesStickersValue.tlType = random.pick(types);
+
+    switch (messagesStickersValue.tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        fillRandom(messagesStickersValue.hash, random);
+        fillRandom(messagesStickersValue.stickers, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPhotosPhoto &photosPhotoValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PhotosPhoto,
+    };
+    photosPhotoValue.tlType = random.pick(types);
+
+    switch (photosPhotoValue.tlType) {
+    case TLValue::PhotosPhoto:
+        fillRandom(photosPhotoValue.photo, random);
+        fillRandom(photosPhotoValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLPhotosPhotos &photosPhotosValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::PhotosPhotos,
+        TLValue::PhotosPhotosSlice,
+    };
+    photosPhotosValue.tlType = random.pick(types);
+
+    switch (photosPhotosValue.tlType) {
+    case TLValue::PhotosPhotos:
+        fillRandom(photosPhotosValue.photos, random);
+        fillRandom(photosPhotosValue.users, random);
+        break;
+    case TLValue::PhotosPhotosSlice:
+        fillRandom(photosPhotosValue.count, random);
+        fillRandom(photosPhotosValue.photos, random);
+        fillRandom(photosPhotosValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUserFull &userFullValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UserFull,
+    };
+    userFullValue.tlType = random.pick(types);
+
+    switch (userFullValue.tlType) {
+    case TLValue::UserFull:
+        fillRandom(userFullValue.user, random);
+        fillRandom(userFullValue.link, random);
+        fillRandom(userFullValue.profilePhoto, random);
+        fillRandom(userFullValue.notifySettings, random);
+        fillRandom(userFullValue.blocked, random);
+        fillRandom(userFullValue.botInfo, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLWebPage &webPageValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::WebPageEmpty,
+        TLValue::WebPagePending,
+        TLValue::WebPage,
+    };
+    webPageValue.tlType = random.pick(types);
+
+    switch (webPageValue.tlType) {
+    case TLValue::WebPageEmpty:
+        fillRandom(webPageValue.id, random);
+        break;
+    case TLValue::WebPagePending:
+        fillRandom(webPageValue.id, random);
+        fillRandom(webPageValue.date, random);
+        break;
+    case TLValue::WebPage:
+        fillRandom(webPageValue.flags, random);
+        fillRandom(webPageValue.id, random);
+        fillRandom(webPageValue.url, random);
+        fillRandom(webPageValue.displayUrl, random);
+        fillRandom(webPageValue.type, random);
+        fillRandom(webPageValue.siteName, random);
+        fillRandom(webPageValue.title, random);
+        fillRandom(webPageValue.description, random);
+        fillRandom(webPageValue.photo, random);
+        fillRandom(webPageValue.embedUrl, random);
+        fillRandom(webPageValue.embedType, random);
+        fillRandom(webPageValue.embedWidth, random);
+        fillRandom(webPageValue.embedHeight, random);
+        fillRandom(webPageValue.duration, random);
+        fillRandom(webPageValue.author, random);
+        fillRandom(webPageValue.document, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLBotInlineResult &botInlineResultValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::BotInlineMediaResultDocument,
+        TLValue::BotInlineMediaResultPhoto,
+        TLValue::BotInlineResult,
+    };
+    botInlineResultValue.tlType = random.pick(types);
+
+    switch (botInlineResultValue.tlType) {
+    case TLValue::BotInlineMediaResultDocument:
+        fillRandom(botInlineResultValue.id, random);
+        fillRandom(botInlineResultValue.type, random);
+        fillRandom(botInlineResultValue.document, random);
+        fillRandom(botInlineResultValue.sendMessage, random);
+        break;
+    case TLValue::BotInlineMediaResultPhoto:
+        fillRandom(botInlineResultValue.id, random);
+        fillRandom(botInlineResultValue.type, random);
+        fillRandom(botInlineResultValue.photo, random);
+        fillRandom(botInlineResultValue.sendMessage, random);
+        break;
+    case TLValue::BotInlineResult:
+        fillRandom(botInlineResultValue.flags, random);
+        fillRandom(botInlineResultValue.id, random);
+        fillRandom(botInlineResultValue.type, random);
+        fillRandom(botInlineResultValue.title, random);
+        fillRandom(botInlineResultValue.description, random);
+        fillRandom(botInlineResultValue.url, random);
+        fillRandom(botInlineResultValue.thumbUrl, random);
+        fillRandom(botInlineResultValue.contentUrl, random);
+        fillRandom(botInlineResultValue.contentType, random);
+        fillRandom(botInlineResultValue.w, random);
+        fillRandom(botInlineResultValue.h, random);
+        fillRandom(botInlineResultValue.duration, random);
+        fillRandom(botInlineResultValue.sendMessage, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessageMedia &messageMediaValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessageMediaEmpty,
+        TLValue::MessageMediaPhoto,
+        TLValue::MessageMediaVideo,
+        TLValue::MessageMediaGeo,
+        TLValue::MessageMediaContact,
+        TLValue::MessageMediaUnsupported,
+        TLValue::MessageMediaDocument,
+        TLValue::MessageMediaAudio,
+        TLValue::MessageMediaWebPage,
+        TLValue::MessageMediaVenue,
+    };
+    messageMediaValue.tlType = random.pick(types);
+
+    switch (messageMediaValue.tlType) {
+    case TLValue::MessageMediaEmpty:
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaPhoto:
+        fillRandom(messageMediaValue.photo, random);
+        fillRandom(messageMediaValue.caption, random);
+        break;
+    case TLValue::MessageMediaVideo:
+        fillRandom(messageMediaValue.video, random);
+        fillRandom(messageMediaValue.caption, random);
+        break;
+    case TLValue::MessageMediaGeo:
+        fillRandom(messageMediaValue.geo, random);
+        break;
+    case TLValue::MessageMediaContact:
+        fillRandom(messageMediaValue.phoneNumber, random);
+        fillRandom(messageMediaValue.firstName, random);
+        fillRandom(messageMediaValue.lastName, random);
+        fillRandom(messageMediaValue.userId, random);
+        break;
+    case TLValue::MessageMediaDocument:
+        fillRandom(messageMediaValue.document, random);
+        fillRandom(messageMediaValue.caption, random);
+        break;
+    case TLValue::MessageMediaAudio:
+        fillRandom(messageMediaValue.audio, random);
+        break;
+    case TLValue::MessageMediaWebPage:
+        fillRandom(messageMediaValue.webpage, random);
+        break;
+    case TLValue::MessageMediaVenue:
+        fillRandom(messageMediaValue.geo, random);
+        fillRandom(messageMediaValue.title, random);
+        fillRandom(messageMediaValue.address, random);
+        fillRandom(messageMediaValue.provider, random);
+        fillRandom(messageMediaValue.venueId, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesBotResults &messagesBotResultsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesBotResults,
+    };
+    messagesBotResultsValue.tlType = random.pick(types);
+
+    switch (messagesBotResultsValue.tlType) {
+    case TLValue::MessagesBotResults:
+        fillRandom(messagesBotResultsValue.flags, random);
+        fillRandom(messagesBotResultsValue.queryId, random);
+        fillRandom(messagesBotResultsValue.nextOffset, random);
+        fillRandom(messagesBotResultsValue.results, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessage &messageValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessageEmpty,
+        TLValue::Message,
+        TLValue::MessageService,
+    };
+    messageValue.tlType = random.pick(types);
+
+    switch (messageValue.tlType) {
+    case TLValue::MessageEmpty:
+        fillRandom(messageValue.id, random);
+        break;
+    case TLValue::Message:
+        fillRandom(messageValue.flags, random);
+        fillRandom(messageValue.id, random);
+        fillRandom(messageValue.fromId, random);
+        fillRandom(messageValue.toId, random);
+        fillRandom(messageValue.fwdFromId, random);
+        fillRandom(messageValue.fwdDate, random);
+        fillRandom(messageValue.viaBotId, random);
+        fillRandom(messageValue.replyToMsgId, random);
+        fillRandom(messageValue.date, random);
+        fillRandom(messageValue.message, random);
+        fillRandom(messageValue.media, random);
+        fillRandom(messageValue.replyMarkup, random);
+        fillRandom(messageValue.entities, random);
+        fillRandom(messageValue.views, random);
+        break;
+    case TLValue::MessageService:
+        fillRandom(messageValue.flags, random);
+        fillRandom(messageValue.id, random);
+        fillRandom(messageValue.fromId, random);
+        fillRandom(messageValue.toId, random);
+        fillRandom(messageValue.date, random);
+        fillRandom(messageValue.action, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesDialogs &messagesDialogsValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesDialogs,
+        TLValue::MessagesDialogsSlice,
+    };
+    messagesDialogsValue.tlType = random.pick(types);
+
+    switch (messagesDialogsValue.tlType) {
+    case TLValue::MessagesDialogs:
+        fillRandom(messagesDialogsValue.dialogs, random);
+        fillRandom(messagesDialogsValue.messages, random);
+        fillRandom(messagesDialogsValue.chats, random);
+        fillRandom(messagesDialogsValue.users, random);
+        break;
+    case TLValue::MessagesDialogsSlice:
+        fillRandom(messagesDialogsValue.count, random);
+        fillRandom(messagesDialogsValue.dialogs, random);
+        fillRandom(messagesDialogsValue.messages, random);
+        fillRandom(messagesDialogsValue.chats, random);
+        fillRandom(messagesDialogsValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLMessagesMessages &messagesMessagesValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::MessagesMessages,
+        TLValue::MessagesMessagesSlice,
+        TLValue::MessagesChannelMessages,
+    };
+    messagesMessagesValue.tlType = random.pick(types);
+
+    switch (messagesMessagesValue.tlType) {
+    case TLValue::MessagesMessages:
+        fillRandom(messagesMessagesValue.messages, random);
+        fillRandom(messagesMessagesValue.chats, random);
+        fillRandom(messagesMessagesValue.users, random);
+        break;
+    case TLValue::MessagesMessagesSlice:
+        fillRandom(messagesMessagesValue.count, random);
+        fillRandom(messagesMessagesValue.messages, random);
+        fillRandom(messagesMessagesValue.chats, random);
+        fillRandom(messagesMessagesValue.users, random);
+        break;
+    case TLValue::MessagesChannelMessages:
+        fillRandom(messagesMessagesValue.flags, random);
+        fillRandom(messagesMessagesValue.pts, random);
+        fillRandom(messagesMessagesValue.count, random);
+        fillRandom(messagesMessagesValue.messages, random);
+        fillRandom(messagesMessagesValue.collapsed, random);
+        fillRandom(messagesMessagesValue.chats, random);
+        fillRandom(messagesMessagesValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUpdate &updateValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UpdateNewMessage,
+        TLValue::UpdateMessageID,
+        TLValue::UpdateDeleteMessages,
+        TLValue::UpdateUserTyping,
+        TLValue::UpdateChatUserTyping,
+        TLValue::UpdateChatParticipants,
+        TLValue::UpdateUserStatus,
+        TLValue::UpdateUserName,
+        TLValue::UpdateUserPhoto,
+        TLValue::UpdateContactRegistered,
+        TLValue::UpdateContactLink,
+        TLValue::UpdateNewAuthorization,
+        TLValue::UpdateNewEncryptedMessage,
+        TLValue::UpdateEncryptedChatTyping,
+        TLValue::UpdateEncryption,
+        TLValue::UpdateEncryptedMessagesRead,
+        TLValue::UpdateChatParticipantAdd,
+        TLValue::UpdateChatParticipantDelete,
+        TLValue::UpdateDcOptions,
+        TLValue::UpdateUserBlocked,
+        TLValue::UpdateNotifySettings,
+        TLValue::UpdateServiceNotification,
+        TLValue::UpdatePrivacy,
+        TLValue::UpdateUserPhone,
+        TLValue::UpdateReadHistoryInbox,
+        TLValue::UpdateReadHistoryOutbox,
+        TLValue::UpdateWebPage,
+        TLValue::UpdateReadMessagesContents,
+        TLValue::UpdateChannelTooLong,
+        TLValue::UpdateChannel,
+        TLValue::UpdateChannelGroup,
+        TLValue::UpdateNewChannelMessage,
+        TLValue::UpdateReadChannelInbox,
+        TLValue::UpdateDeleteChannelMessages,
+        TLValue::UpdateChannelMessageViews,
+        TLValue::UpdateChatAdmins,
+        TLValue::UpdateChatParticipantAdmin,
+        TLValue::UpdateNewStickerSet,
+        TLValue::UpdateStickerSetsOrder,
+        TLValue::UpdateStickerSets,
+        TLValue::UpdateSavedGifs,
+        TLValue::UpdateBotInlineQuery,
+    };
+    updateValue.tlType = random.pick(types);
+
+    switch (updateValue.tlType) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+        fillRandom(updateValue.message, random);
+        fillRandom(updateValue.pts, random);
+        fillRandom(updateValue.ptsCount, random);
+        break;
+    case TLValue::UpdateMessageID:
+        fillRandom(updateValue.id, random);
+        fillRandom(updateValue.randomId, random);
+        break;
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+        fillRandom(updateValue.messages, random);
+        fillRandom(updateValue.pts, random);
+        fillRandom(updateValue.ptsCount, random);
+        break;
+    case TLValue::UpdateUserTyping:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.action, random);
+        break;
+    case TLValue::UpdateChatUserTyping:
+        fillRandom(updateValue.chatId, random);
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.action, random);
+        break;
+    case TLValue::UpdateChatParticipants:
+        fillRandom(updateValue.participants, random);
+        break;
+    case TLValue::UpdateUserStatus:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.status, random);
+        break;
+    case TLValue::UpdateUserName:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.firstName, random);
+        fillRandom(updateValue.lastName, random);
+        fillRandom(updateValue.username, random);
+        break;
+    case TLValue::UpdateUserPhoto:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.date, random);
+        fillRandom(updateValue.photo, random);
+        fillRandom(updateValue.previous, random);
+        break;
+    case TLValue::UpdateContactRegistered:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.date, random);
+        break;
+    case TLValue::UpdateContactLink:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.myLink, random);
+        fillRandom(updateValue.foreignLink, random);
+        break;
+    case TLValue::UpdateNewAuthorization:
+        fillRandom(updateValue.authKeyId, random);
+        fillRandom(updateValue.date, random);
+        fillRandom(updateValue.device, random);
+        fillRandom(updateValue.location, random);
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        fillRandom(updateValue.encryptedMessage, random);
+        fillRandom(updateValue.qts, random);
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+        fillRandom(updateValue.chatId, random);
+        break;
+    case TLValue::UpdateEncryption:
+        fillRandom(updateValue.chat, random);
+        fillRandom(updateValue.date, random);
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+        fillRandom(updateValue.chatId, random);
+        fillRandom(updateValue.maxDate, random);
+        fillRandom(updateValue.date, random);
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        fillRandom(updateValue.chatId, random);
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.inviterId, random);
+        fillRandom(updateValue.date, random);
+        fillRandom(updateValue.version, random);
+        break;
+    case TLValue::UpdateChatParticipantDelete:
+        fillRandom(updateValue.chatId, random);
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.version, random);
+        break;
+    case TLValue::UpdateDcOptions:
+        fillRandom(updateValue.dcOptions, random);
+        break;
+    case TLValue::UpdateUserBlocked:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.blocked, random);
+        break;
+    case TLValue::UpdateNotifySettings:
+        fillRandom(updateValue.notifyPeer, random);
+        fillRandom(updateValue.notifySettings, random);
+        break;
+    case TLValue::UpdateServiceNotification:
+        fillRandom(updateValue.type, random);
+        fillRandom(updateValue.stringMessage, random);
+        fillRandom(updateValue.media, random);
+        fillRandom(updateValue.popup, random);
+        break;
+    case TLValue::UpdatePrivacy:
+        fillRandom(updateValue.key, random);
+        fillRandom(updateValue.rules, random);
+        break;
+    case TLValue::UpdateUserPhone:
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.phone, random);
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+        fillRandom(updateValue.peer, random);
+        fillRandom(updateValue.maxId, random);
+        fillRandom(updateValue.pts, random);
+        fillRandom(updateValue.ptsCount, random);
+        break;
+    case TLValue::UpdateWebPage:
+        fillRandom(updateValue.webpage, random);
+        fillRandom(updateValue.pts, random);
+        fillRandom(updateValue.ptsCount, random);
+        break;
+    case TLValue::UpdateChannelTooLong:
+    case TLValue::UpdateChannel:
+        fillRandom(updateValue.channelId, random);
+        break;
+    case TLValue::UpdateChannelGroup:
+        fillRandom(updateValue.channelId, random);
+        fillRandom(updateValue.group, random);
+        break;
+    case TLValue::UpdateReadChannelInbox:
+        fillRandom(updateValue.channelId, random);
+        fillRandom(updateValue.maxId, random);
+        break;
+    case TLValue::UpdateDeleteChannelMessages:
+        fillRandom(updateValue.channelId, random);
+        fillRandom(updateValue.messages, random);
+        fillRandom(updateValue.pts, random);
+        fillRandom(updateValue.ptsCount, random);
+        break;
+    case TLValue::UpdateChannelMessageViews:
+        fillRandom(updateValue.channelId, random);
+        fillRandom(updateValue.id, random);
+        fillRandom(updateValue.views, random);
+        break;
+    case TLValue::UpdateChatAdmins:
+        fillRandom(updateValue.chatId, random);
+        fillRandom(updateValue.enabled, random);
+        fillRandom(updateValue.version, random);
+        break;
+    case TLValue::UpdateChatParticipantAdmin:
+        fillRandom(updateValue.chatId, random);
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.isAdmin, random);
+        fillRandom(updateValue.version, random);
+        break;
+    case TLValue::UpdateNewStickerSet:
+        fillRandom(updateValue.stickerset, random);
+        break;
+    case TLValue::UpdateStickerSetsOrder:
+        fillRandom(updateValue.order, random);
+        break;
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+        break;
+    case TLValue::UpdateBotInlineQuery:
+        fillRandom(updateValue.queryId, random);
+        fillRandom(updateValue.userId, random);
+        fillRandom(updateValue.query, random);
+        fillRandom(updateValue.offset, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUpdates &updatesValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UpdatesTooLong,
+        TLValue::UpdateShortMessage,
+        TLValue::UpdateShortChatMessage,
+        TLValue::UpdateShort,
+        TLValue::UpdatesCombined,
+        TLValue::Updates,
+        TLValue::UpdateShortSentMessage,
+    };
+    updatesValue.tlType = random.pick(types);
+
+    switch (updatesValue.tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        fillRandom(updatesValue.flags, random);
+        fillRandom(updatesValue.id, random);
+        fillRandom(updatesValue.userId, random);
+        fillRandom(updatesValue.message, random);
+        fillRandom(updatesValue.pts, random);
+        fillRandom(updatesValue.ptsCount, random);
+        fillRandom(updatesValue.date, random);
+        fillRandom(updatesValue.fwdFromId, random);
+        fillRandom(updatesValue.fwdDate, random);
+        fillRandom(updatesValue.viaBotId, random);
+        fillRandom(updatesValue.replyToMsgId, random);
+        fillRandom(updatesValue.entities, random);
+        break;
+    case TLValue::UpdateShortChatMessage:
+        fillRandom(updatesValue.flags, random);
+        fillRandom(updatesValue.id, random);
+        fillRandom(updatesValue.fromId, random);
+        fillRandom(updatesValue.chatId, random);
+        fillRandom(updatesValue.message, random);
+        fillRandom(updatesValue.pts, random);
+        fillRandom(updatesValue.ptsCount, random);
+        fillRandom(updatesValue.date, random);
+        fillRandom(updatesValue.fwdFromId, random);
+        fillRandom(updatesValue.fwdDate, random);
+        fillRandom(updatesValue.viaBotId, random);
+        fillRandom(updatesValue.replyToMsgId, random);
+        fillRandom(updatesValue.entities, random);
+        break;
+    case TLValue::UpdateShort:
+        fillRandom(updatesValue.update, random);
+        fillRandom(updatesValue.date, random);
+        break;
+    case TLValue::UpdatesCombined:
+        fillRandom(updatesValue.updates, random);
+        fillRandom(updatesValue.users, random);
+        fillRandom(updatesValue.chats, random);
+        fillRandom(updatesValue.date, random);
+        fillRandom(updatesValue.seqStart, random);
+        fillRandom(updatesValue.seq, random);
+        break;
+    case TLValue::Updates:
+        fillRandom(updatesValue.updates, random);
+        fillRandom(updatesValue.users, random);
+        fillRandom(updatesValue.chats, random);
+        fillRandom(updatesValue.date, random);
+        fillRandom(updatesValue.seq, random);
+        break;
+    case TLValue::UpdateShortSentMessage:
+        fillRandom(updatesValue.flags, random);
+        fillRandom(updatesValue.id, random);
+        fillRandom(updatesValue.pts, random);
+        fillRandom(updatesValue.ptsCount, random);
+        fillRandom(updatesValue.date, random);
+        fillRandom(updatesValue.media, random);
+        fillRandom(updatesValue.entities, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUpdatesChannelDifference &updatesChannelDifferenceValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UpdatesChannelDifferenceEmpty,
+        TLValue::UpdatesChannelDifferenceTooLong,
+        TLValue::UpdatesChannelDifference,
+    };
+    updatesChannelDifferenceValue.tlType = random.pick(types);
+
+    switch (updatesChannelDifferenceValue.tlType) {
+    case TLValue::UpdatesChannelDifferenceEmpty:
+        fillRandom(updatesChannelDifferenceValue.flags, random);
+        fillRandom(updatesChannelDifferenceValue.pts, random);
+        fillRandom(updatesChannelDifferenceValue.timeout, random);
+        break;
+    case TLValue::UpdatesChannelDifferenceTooLong:
+        fillRandom(updatesChannelDifferenceValue.flags, random);
+        fillRandom(updatesChannelDifferenceValue.pts, random);
+        fillRandom(updatesChannelDifferenceValue.timeout, random);
+        fillRandom(updatesChannelDifferenceValue.topMessage, random);
+        fillRandom(updatesChannelDifferenceValue.topImportantMessage, random);
+        fillRandom(updatesChannelDifferenceValue.readInboxMaxId, random);
+        fillRandom(updatesChannelDifferenceValue.unreadCount, random);
+        fillRandom(updatesChannelDifferenceValue.unreadImportantCount, random);
+        fillRandom(updatesChannelDifferenceValue.messages, random);
+        fillRandom(updatesChannelDifferenceValue.chats, random);
+        fillRandom(updatesChannelDifferenceValue.users, random);
+        break;
+    case TLValue::UpdatesChannelDifference:
+        fillRandom(updatesChannelDifferenceValue.flags, random);
+        fillRandom(updatesChannelDifferenceValue.pts, random);
+        fillRandom(updatesChannelDifferenceValue.timeout, random);
+        fillRandom(updatesChannelDifferenceValue.newMessages, random);
+        fillRandom(updatesChannelDifferenceValue.otherUpdates, random);
+        fillRandom(updatesChannelDifferenceValue.chats, random);
+        fillRandom(updatesChannelDifferenceValue.users, random);
+        break;
+    default:
+        break;
+    }
+}
+
+void fillRandom(TLUpdatesDifference &updatesDifferenceValue, TestRandom &random)
+{
+    static const TLValue types[] = {
+        TLValue::UpdatesDifferenceEmpty,
+        TLValue::UpdatesDifference,
+        TLValue::UpdatesDifferenceSlice,
+    };
+    updatesDifferenceValue.tlType = random.pick(types);
+
+    switch (updatesDifferenceValue.tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        fillRandom(updatesDifferenceValue.date, random);
+        fillRandom(updatesDifferenceValue.seq, random);
+        break;
+    case TLValue::UpdatesDifference:
+        fillRandom(updatesDifferenceValue.newMessages, random);
+        fillRandom(updatesDifferenceValue.newEncryptedMessages, random);
+        fillRandom(updatesDifferenceValue.otherUpdates, random);
+        fillRandom(updatesDifferenceValue.chats, random);
+        fillRandom(updatesDifferenceValue.users, random);
+        fillRandom(updatesDifferenceValue.state, random);
+        break;
+    case TLValue::UpdatesDifferenceSlice:
+        fillRandom(updatesDifferenceValue.newMessages, random);
+        fillRandom(updatesDifferenceValue.newEncryptedMessages, random);
+        fillRandom(updatesDifferenceValue.otherUpdates, random);
+        fillRandom(updatesDifferenceValue.chats, random);
+        fillRandom(updatesDifferenceValue.users, random);
+        fillRandom(updatesDifferenceValue.intermediateState, random);
+        break;
+    default:
+        break;
+    }
+}
+
+// End of generated random value implementation
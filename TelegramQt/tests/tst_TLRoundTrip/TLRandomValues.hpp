@@ -0,0 +1,376 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TLRANDOMVALUES_HPP
+#define TLRANDOMVALUES_HPP
+
+#include "CTelegramStream_p.hpp"
+#include "CTelegramStreamExtraOperators.hpp"
+
+// Deterministic xorshift generator, so a failed case can be reproduced by its seed
+class TestRandom
+{
+public:
+    explicit TestRandom(quint32 seed) :
+        m_state(seed ? seed : 1),
+        m_depth(0)
+    {
+    }
+
+    quint32 next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return m_state;
+    }
+
+    quint32 bounded(quint32 bound) { return next() % bound; }
+
+    template <typename T, int N>
+    const T &pick(const T (&values)[N]) { return values[bounded(N)]; }
+
+    // Keep the nested vectors short to not blow up the big types (e.g. the difference)
+    int vectorSize() { return m_depth < s_maxDepth ? static_cast<int>(bounded(4)) : 0; }
+    void enterVector() { ++m_depth; }
+    void leaveVector() { --m_depth; }
+
+private:
+    static const int s_maxDepth = 2;
+    quint32 m_state;
+    int m_depth;
+};
+void fillRandom(bool &value, TestRandom &random);
+void fillRandom(quint32 &value, TestRandom &random);
+void fillRandom(quint64 &value, TestRandom &random);
+void fillRandom(double &value, TestRandom &random);
+void fillRandom(QString &value, TestRandom &random);
+void fillRandom(QByteArray &value, TestRandom &random);
+
+template <int Size>
+void fillRandom(TLNumber<Size> &value, TestRandom &random)
+{
+    for (int i = 0; i < Size / 8 / 8; ++i) {
+        fillRandom(value.parts[i], random);
+    }
+}
+
+template <typename T>
+void fillRandom(TLVector<T> &vector, TestRandom &random)
+{
+    vector.resize(random.vectorSize());
+    random.enterVector();
+    for (T &item : vector) {
+        fillRandom(item, random);
+    }
+    random.leaveVector();
+}
+
+// Generated random value declarations
+void fillRandom(TLAccountDaysTTL &accountDaysTTLValue, TestRandom &random);
+void fillRandom(TLAccountPassword &accountPasswordValue, TestRandom &random);
+void fillRandom(TLAccountPasswordInputSettings &accountPasswordInputSettingsValue, TestRandom &random);
+void fillRandom(TLAccountPasswordSettings &accountPasswordSettingsValue, TestRandom &random);
+void fillRandom(TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue, TestRandom &random);
+void fillRandom(TLAudio &audioValue, TestRandom &random);
+void fillRandom(TLAuthCheckedPhone &authCheckedPhoneValue, TestRandom &random);
+void fillRandom(TLAuthExportedAuthorization &authExportedAuthorizationValue, TestRandom &random);
+void fillRandom(TLAuthPasswordRecovery &authPasswordRecoveryValue, TestRandom &random);
+void fillRandom(TLAuthSentCode &authSentCodeValue, TestRandom &random);
+void fillRandom(TLAuthorization &authorizationValue, TestRandom &random);
+void fillRandom(TLBotCommand &botCommandValue, TestRandom &random);
+void fillRandom(TLBotInfo &botInfoValue, TestRandom &random);
+void fillRandom(TLChannelParticipant &channelParticipantValue, TestRandom &random);
+void fillRandom(TLChannelParticipantRole &channelParticipantRoleValue, TestRandom &random);
+void fillRandom(TLChannelParticipantsFilter &channelParticipantsFilterValue, TestRandom &random);
+void fillRandom(TLChatParticipant &chatParticipantValue, TestRandom &random);
+void fillRandom(TLChatParticipants &chatParticipantsValue, TestRandom &random);
+void fillRandom(TLContact &contactValue, TestRandom &random);
+void fillRandom(TLContactBlocked &contactBlockedValue, TestRandom &random);
+void fillRandom(TLContactLink &contactLinkValue, TestRandom &random);
+void fillRandom(TLContactSuggested &contactSuggestedValue, TestRandom &random);
+void fillRandom(TLDisabledFeature &disabledFeatureValue, TestRandom &random);
+void fillRandom(TLEncryptedChat &encryptedChatValue, TestRandom &random);
+void fillRandom(TLEncryptedFile &encryptedFileValue, TestRandom &random);
+void fillRandom(TLEncryptedMessage &encryptedMessageValue, TestRandom &random);
+void fillRandom(TLError &errorValue, TestRandom &random);
+void fillRandom(TLExportedChatInvite &exportedChatInviteValue, TestRandom &random);
+void fillRandom(TLFileLocation &fileLocationValue, TestRandom &random);
+void fillRandom(TLGeoPoint &geoPointValue, TestRandom &random);
+void fillRandom(TLHelpAppChangelog &helpAppChangelogValue, TestRandom &random);
+void fillRandom(TLHelpAppUpdate &helpAppUpdateValue, TestRandom &random);
+void fillRandom(TLHelpInviteText &helpInviteTextValue, TestRandom &random);
+void fillRandom(TLHelpTermsOfService &helpTermsOfServiceValue, TestRandom &random);
+void fillRandom(TLImportedContact &importedContactValue, TestRandom &random);
+void fillRandom(TLInputAppEvent &inputAppEventValue, TestRandom &random);
+void fillRandom(TLInputAudio &inputAudioValue, TestRandom &random);
+void fillRandom(TLInputChannel &inputChannelValue, TestRandom &random);
+void fillRandom(TLInputContact &inputContactValue, TestRandom &random);
+void fillRandom(TLInputDocument &inputDocumentValue, TestRandom &random);
+void fillRandom(TLInputEncryptedChat &inputEncryptedChatValue, TestRandom &random);
+void fillRandom(TLInputEncryptedFile &inputEncryptedFileValue, TestRandom &random);
+void fillRandom(TLInputFile &inputFileValue, TestRandom &random);
+void fillRandom(TLInputFileLocation &inputFileLocationValue, TestRandom &random);
+void fillRandom(TLInputGeoPoint &inputGeoPointValue, TestRandom &random);
+void fillRandom(TLInputPeer &inputPeerValue, TestRandom &random);
+void fillRandom(TLInputPeerNotifyEvents &inputPeerNotifyEventsValue, TestRandom &random);
+void fillRandom(TLInputPeerNotifySettings &inputPeerNotifySettingsValue, TestRandom &random);
+void fillRandom(TLInputPhoto &inputPhotoValue, TestRandom &random);
+void fillRandom(TLInputPhotoCrop &inputPhotoCropValue, TestRandom &random);
+void fillRandom(TLInputPrivacyKey &inputPrivacyKeyValue, TestRandom &random);
+void fillRandom(TLInputStickerSet &inputStickerSetValue, TestRandom &random);
+void fillRandom(TLInputUser &inputUserValue, TestRandom &random);
+void fillRandom(TLInputVideo &inputVideoValue, TestRandom &random);
+void fillRandom(TLKeyboardButton &keyboardButtonValue, TestRandom &random);
+void fillRandom(TLKeyboardButtonRow &keyboardButtonRowValue, TestRandom &random);
+void fillRandom(TLMessageEntity &messageEntityValue, TestRandom &random);
+void fillRandom(TLMessageGroup &messageGroupValue, TestRandom &random);
+void fillRandom(TLMessageRange &messageRangeValue, TestRandom &random);
+void fillRandom(TLMessagesAffectedHistory &messagesAffectedHistoryValue, TestRandom &random);
+void fillRandom(TLMessagesAffectedMessages &messagesAffectedMessagesValue, TestRandom &random);
+void fillRandom(TLMessagesDhConfig &messagesDhConfigValue, TestRandom &random);
+void fillRandom(TLMessagesFilter &messagesFilterValue, TestRandom &random);
+void fillRandom(TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue, TestRandom &random);
+void fillRandom(TLNearestDc &nearestDcValue, TestRandom &random);
+void fillRandom(TLPeer &peerValue, TestRandom &random);
+void fillRandom(TLPeerNotifyEvents &peerNotifyEventsValue, TestRandom &random);
+void fillRandom(TLPeerNotifySettings &peerNotifySettingsValue, TestRandom &random);
+void fillRandom(TLPhotoSize &photoSizeValue, TestRandom &random);
+void fillRandom(TLPrivacyKey &privacyKeyValue, TestRandom &random);
+void fillRandom(TLPrivacyRule &privacyRuleValue, TestRandom &random);
+void fillRandom(TLReceivedNotifyMessage &receivedNotifyMessageValue, TestRandom &random);
+void fillRandom(TLReportReason &reportReasonValue, TestRandom &random);
+void fillRandom(TLSendMessageAction &sendMessageActionValue, TestRandom &random);
+void fillRandom(TLStickerPack &stickerPackValue, TestRandom &random);
+void fillRandom(TLStorageFileType &storageFileTypeValue, TestRandom &random);
+void fillRandom(TLUpdatesState &updatesStateValue, TestRandom &random);
+void fillRandom(TLUploadFile &uploadFileValue, TestRandom &random);
+void fillRandom(TLUserProfilePhoto &userProfilePhotoValue, TestRandom &random);
+void fillRandom(TLUserStatus &userStatusValue, TestRandom &random);
+void fillRandom(TLVideo &videoValue, TestRandom &random);
+void fillRandom(TLWallPaper &wallPaperValue, TestRandom &random);
+void fillRandom(TLAccountAuthorizations &accountAuthorizationsValue, TestRandom &random);
+void fillRandom(TLBotInlineMessage &botInlineMessageValue, TestRandom &random);
+void fillRandom(TLChannelMessagesFilter &channelMessagesFilterValue, TestRandom &random);
+void fillRandom(TLChatPhoto &chatPhotoValue, TestRandom &random);
+void fillRandom(TLContactStatus &contactStatusValue, TestRandom &random);
+void fillRandom(TLDcOption &dcOptionValue, TestRandom &random);
+void fillRandom(TLDialog &dialogValue, TestRandom &random);
+void fillRandom(TLDocumentAttribute &documentAttributeValue, TestRandom &random);
+void fillRandom(TLInputBotInlineMessage &inputBotInlineMessageValue, TestRandom &random);
+void fillRandom(TLInputBotInlineResult &inputBotInlineResultValue, TestRandom &random);
+void fillRandom(TLInputChatPhoto &inputChatPhotoValue, TestRandom &random);
+void fillRandom(TLInputMedia &inputMediaValue, TestRandom &random);
+void fillRandom(TLInputNotifyPeer &inputNotifyPeerValue, TestRandom &random);
+void fillRandom(TLInputPrivacyRule &inputPrivacyRuleValue, TestRandom &random);
+void fillRandom(TLNotifyPeer &notifyPeerValue, TestRandom &random);
+void fillRandom(TLPhoto &photoValue, TestRandom &random);
+void fillRandom(TLReplyMarkup &replyMarkupValue, TestRandom &random);
+void fillRandom(TLStickerSet &stickerSetValue, TestRandom &random);
+void fillRandom(TLUser &userValue, TestRandom &random);
+void fillRandom(TLAccountPrivacyRules &accountPrivacyRulesValue, TestRandom &random);
+void fillRandom(TLAuthAuthorization &authAuthorizationValue, TestRandom &random);
+void fillRandom(TLChannelsChannelParticipant &channelsChannelParticipantValue, TestRandom &random);
+void fillRandom(TLChannelsChannelParticipants &channelsChannelParticipantsValue, TestRandom &random);
+void fillRandom(TLChat &chatValue, TestRandom &random);
+void fillRandom(TLChatFull &chatFullValue, TestRandom &random);
+void fillRandom(TLChatInvite &chatInviteValue, TestRandom &random);
+void fillRandom(TLConfig &configValue, TestRandom &random);
+void fillRandom(TLContactsBlocked &contactsBlockedValue, TestRandom &random);
+void fillRandom(TLContactsContacts &contactsContactsValue, TestRandom &random);
+void fillRandom(TLContactsFound &contactsFoundValue, TestRandom &random);
+void fillRandom(TLContactsImportedContacts &contactsImportedContactsValue, TestRandom &random);
+void fillRandom(TLContactsLink &contactsLinkValue, TestRandom &random);
+void fillRandom(TLContactsResolvedPeer &contactsResolvedPeerValue, TestRandom &random);
+void fillRandom(TLContactsSuggested &contactsSuggestedValue, TestRandom &random);
+void fillRandom(TLDocument &documentValue, TestRandom &random);
+void fillRandom(TLFoundGif &foundGifValue, TestRandom &random);
+void fillRandom(TLHelpSupport &helpSupportValue, TestRandom &random);
+void fillRandom(TLMessageAction &messageActionValue, TestRandom &random);
+void fillRandom(TLMessagesAllStickers &messagesAllStickersValue, TestRandom &random);
+void fillRandom(TLMessagesChatFull &messagesChatFullValue, TestRandom &random);
+void fillRandom(TLMessagesChats &messagesChatsValue, TestRandom &random);
+void fillRandom(TLMessagesFoundGifs &messagesFoundGifsValue, TestRandom &random);
+void fillRandom(TLMessagesSavedGifs &messagesSavedGifsValue, TestRandom &random);
+void fillRandom(TLMessagesStickerSet &messagesStickerSetValue, TestRandom &random);
+void fillRandom(TLMessagesStickers &messagesStickersValue, TestRandom &random);
+void fillRandom(TLPhotosPhoto &photosPhotoValue, TestRandom &random);
+void fillRandom(TLPhotosPhotos &photosPhotosValue, TestRandom &random);
+void fillRandom(TLUserFull &userFullValue, TestRandom &random);
+void fillRandom(TLWebPage &webPageValue, TestRandom &random);
+void fillRandom(TLBotInlineResult &botInlineResultValue, TestRandom &random);
+void fillRandom(TLMessageMedia &messageMediaValue, TestRandom &random);
+void fillRandom(TLMessagesBotResults &messagesBotResultsValue, TestRandom &random);
+void fillRandom(TLMessage &messageValue, TestRandom &random);
+void fillRandom(TLMessagesDialogs &messagesDialogsValue, TestRandom &random);
+void fillRandom(TLMessagesMessages &messagesMessagesValue, TestRandom &random);
+void fillRandom(TLUpdate &updateValue, TestRandom &random);
+void fillRandom(TLUpdates &updatesValue, TestRandom &random);
+void fillRandom(TLUpdatesChannelDifference &updatesChannelDifferenceValue, TestRandom &random);
+void fillRandom(TLUpdatesDifference &updatesDifferenceValue, TestRandom &random);
+// End of generated random value declarations
+
+// Calls visitor.visit<T>(name) for each type which can be written and read back
+template <typename Visitor>
+void visitRoundTripTypes(Visitor &visitor)
+{
+    // Generated round trip cases
+    visitor.template visit<TLAccountDaysTTL>("TLAccountDaysTTL");
+    visitor.template visit<TLAccountPassword>("TLAccountPassword");
+    visitor.template visit<TLAccountPasswordInputSettings>("TLAccountPasswordInputSettings");
+    visitor.template visit<TLAccountPasswordSettings>("TLAccountPasswordSettings");
+    visitor.template visit<TLAccountSentChangePhoneCode>("TLAccountSentChangePhoneCode");
+    visitor.template visit<TLAudio>("TLAudio");
+    visitor.template visit<TLAuthCheckedPhone>("TLAuthCheckedPhone");
+    visitor.template visit<TLAuthExportedAuthorization>("TLAuthExportedAuthorization");
+    visitor.template visit<TLAuthPasswordRecovery>("TLAuthPasswordRecovery");
+    visitor.template visit<TLAuthSentCode>("TLAuthSentCode");
+    visitor.template visit<TLAuthorization>("TLAuthorization");
+    visitor.template visit<TLBotCommand>("TLBotCommand");
+    visitor.template visit<TLBotInfo>("TLBotInfo");
+    visitor.template visit<TLChannelParticipant>("TLChannelParticipant");
+    visitor.template visit<TLChannelParticipantRole>("TLChannelParticipantRole");
+    visitor.template visit<TLChannelParticipantsFilter>("TLChannelParticipantsFilter");
+    visitor.template visit<TLChatParticipant>("TLChatParticipant");
+    visitor.template visit<TLChatParticipants>("TLChatParticipants");
+    visitor.template visit<TLContact>("TLContact");
+    visitor.template visit<TLContactBlocked>("TLContactBlocked");
+    visitor.template visit<TLContactLink>("TLContactLink");
+    visitor.template visit<TLContactSuggested>("TLContactSuggested");
+    visitor.template visit<TLDisabledFeature>("TLDisabledFeature");
+    visitor.template visit<TLEncryptedChat>("TLEncryptedChat");
+    visitor.template visit<TLEncryptedFile>("TLEncryptedFile");
+    visitor.template visit<TLEncryptedMessage>("TLEncryptedMessage");
+    visitor.template visit<TLError>("TLError");
+    visitor.template visit<TLExportedChatInvite>("TLExportedChatInvite");
+    visitor.template visit<TLFileLocation>("TLFileLocation");
+    visitor.template visit<TLGeoPoint>("TLGeoPoint");
+    visitor.template visit<TLHelpAppChangelog>("TLHelpAppChangelog");
+    visitor.template visit<TLHelpAppUpdate>("TLHelpAppUpdate");
+    visitor.template visit<TLHelpInviteText>("TLHelpInviteText");
+    visitor.template visit<TLHelpTermsOfService>("TLHelpTermsOfService");
+    visitor.template visit<TLImportedContact>("TLImportedContact");
+    visitor.template visit<TLInputAppEvent>("TLInputAppEvent");
+    visitor.template visit<TLInputAudio>("TLInputAudio");
+    visitor.template visit<TLInputChannel>("TLInputChannel");
+    visitor.template visit<TLInputContact>("TLInputContact");
+    visitor.template visit<TLInputDocument>("TLInputDocument");
+    visitor.template visit<TLInputEncryptedChat>("TLInputEncryptedChat");
+    visitor.template visit<TLInputEncryptedFile>("TLInputEncryptedFile");
+    visitor.template visit<TLInputFile>("TLInputFile");
+    visitor.template visit<TLInputFileLocation>("TLInputFileLocation");
+    visitor.template visit<TLInputGeoPoint>("TLInputGeoPoint");
+    visitor.template visit<TLInputPeer>("TLInputPeer");
+    visitor.template visit<TLInputPeerNotifyEvents>("TLInputPeerNotifyEvents");
+    visitor.template visit<TLInputPeerNotifySettings>("TLInputPeerNotifySettings");
+    visitor.template visit<TLInputPhoto>("TLInputPhoto");
+    visitor.template visit<TLInputPhotoCrop>("TLInputPhotoCrop");
+    visitor.template visit<TLInputPrivacyKey>("TLInputPrivacyKey");
+    visitor.template visit<TLInputStickerSet>("TLInputStickerSet");
+    visitor.template visit<TLInputUser>("TLInputUser");
+    visitor.template visit<TLInputVideo>("TLInputVideo");
+    visitor.template visit<TLKeyboardButton>("TLKeyboardButton");
+    visitor.template visit<TLKeyboardButtonRow>("TLKeyboardButtonRow");
+    visitor.template visit<TLMessageEntity>("TLMessageEntity");
+    visitor.template visit<TLMessageGroup>("TLMessageGroup");
+    visitor.template visit<TLMessageRange>("TLMessageRange");
+    visitor.template visit<TLMessagesAffectedHistory>("TLMessagesAffectedHistory");
+    visitor.template visit<TLMessagesAffectedMessages>("TLMessagesAffectedMessages");
+    visitor.template visit<TLMessagesDhConfig>("TLMessagesDhConfig");
+    visitor.template visit<TLMessagesFilter>("TLMessagesFilter");
+    visitor.template visit<TLMessagesSentEncryptedMessage>("TLMessagesSentEncryptedMessage");
+    visitor.template visit<TLNearestDc>("TLNearestDc");
+    visitor.template visit<TLPeer>("TLPeer");
+    visitor.template visit<TLPeerNotifyEvents>("TLPeerNotifyEvents");
+    visitor.template visit<TLPeerNotifySettings>("TLPeerNotifySettings");
+    visitor.template visit<TLPhotoSize>("TLPhotoSize");
+    visitor.template visit<TLPrivacyKey>("TLPrivacyKey");
+    visitor.template visit<TLPrivacyRule>("TLPrivacyRule");
+    visitor.template visit<TLReceivedNotifyMessage>("TLReceivedNotifyMessage");
+    visitor.template visit<TLReportReason>("TLReportReason");
+    visitor.template visit<TLSendMessageAction>("TLSendMessageAction");
+    visitor.template visit<TLStickerPack>("TLStickerPack");
+    visitor.template visit<TLStorageFileType>("TLStorageFileType");
+    visitor.template visit<TLUpdatesState>("TLUpdatesState");
+    visitor.template visit<TLUploadFile>("TLUploadFile");
+    visitor.template visit<TLUserProfilePhoto>("TLUserProfilePhoto");
+    visitor.template visit<TLUserStatus>("TLUserStatus");
+    visitor.template visit<TLVideo>("TLVideo");
+    visitor.template visit<TLWallPaper>("TLWallPaper");
+    visitor.template visit<TLAccountAuthorizations>("TLAccountAuthorizations");
+    visitor.template visit<TLBotInlineMessage>("TLBotInlineMessage");
+    visitor.template visit<TLChannelMessagesFilter>("TLChannelMessagesFilter");
+    visitor.template visit<TLChatPhoto>("TLChatPhoto");
+    visitor.template visit<TLContactStatus>("TLContactStatus");
+    visitor.template visit<TLDcOption>("TLDcOption");
+    visitor.template visit<TLDialog>("TLDialog");
+    visitor.template visit<TLDocumentAttribute>("TLDocumentAttribute");
+    visitor.template visit<TLInputBotInlineMessage>("TLInputBotInlineMessage");
+    visitor.template visit<TLInputBotInlineResult>("TLInputBotInlineResult");
+    visitor.template visit<TLInputChatPhoto>("TLInputChatPhoto");
+    visitor.template visit<TLInputMedia>("TLInputMedia");
+    visitor.template visit<TLInputNotifyPeer>("TLInputNotifyPeer");
+    visitor.template visit<TLInputPrivacyRule>("TLInputPrivacyRule");
+    visitor.template visit<TLNotifyPeer>("TLNotifyPeer");
+    visitor.template visit<TLPhoto>("TLPhoto");
+    visitor.template visit<TLReplyMarkup>("TLReplyMarkup");
+    visitor.template visit<TLStickerSet>("TLStickerSet");
+    visitor.template visit<TLUser>("TLUser");
+    visitor.template visit<TLAccountPrivacyRules>("TLAccountPrivacyRules");
+    visitor.template visit<TLAuthAuthorization>("TLAuthAuthorization");
+    visitor.template visit<TLChannelsChannelParticipant>("TLChannelsChannelParticipant");
+    visitor.template visit<TLChannelsChannelParticipants>("TLChannelsChannelParticipants");
+    visitor.template visit<TLChat>("TLChat");
+    visitor.template visit<TLChatFull>("TLChatFull");
+    visitor.template visit<TLChatInvite>("TLChatInvite");
+    visitor.template visit<TLConfig>("TLConfig");
+    visitor.template visit<TLContactsBlocked>("TLContactsBlocked");
+    visitor.template visit<TLContactsContacts>("TLContactsContacts");
+    visitor.template visit<TLContactsFound>("TLContactsFound");
+    visitor.template visit<TLContactsImportedContacts>("TLContactsImportedContacts");
+    visitor.template visit<TLContactsLink>("TLContactsLink");
+    visitor.template visit<TLContactsResolvedPeer>("TLContactsResolvedPeer");
+    visitor.template visit<TLContactsSuggested>("TLContactsSuggested");
+    visitor.template visit<TLDocument>("TLDocument");
+    visitor.template visit<TLFoundGif>("TLFoundGif");
+    visitor.template visit<TLHelpSupport>("TLHelpSupport");
+    visitor.template visit<TLMessageAction>("TLMessageAction");
+    visitor.template visit<TLMessagesAllStickers>("TLMessagesAllStickers");
+    visitor.template visit<TLMessagesChatFull>("TLMessagesChatFull");
+    visitor.template visit<TLMessagesChats>("TLMessagesChats");
+    visitor.template visit<TLMessagesFoundGifs>("TLMessagesFoundGifs");
+    visitor.template visit<TLMessagesSavedGifs>("TLMessagesSavedGifs");
+    visitor.template visit<TLMessagesStickerSet>("TLMessagesStickerSet");
+    visitor.template visit<TLMessagesStickers>("TLMessagesStickers");
+    visitor.template visit<TLPhotosPhoto>("TLPhotosPhoto");
+    visitor.template visit<TLPhotosPhotos>("TLPhotosPhotos");
+    visitor.template visit<TLUserFull>("TLUserFull");
+    visitor.template visit<TLWebPage>("TLWebPage");
+    visitor.template visit<TLBotInlineResult>("TLBotInlineResult");
+    visitor.template visit<TLMessageMedia>("TLMessageMedia");
+    visitor.template visit<TLMessagesBotResults>("TLMessagesBotResults");
+    visitor.template visit<TLMessage>("TLMessage");
+    visitor.template visit<TLMessagesDialogs>("TLMessagesDialogs");
+    visitor.template visit<TLMessagesMessages>("TLMessagesMessages");
+    visitor.template visit<TLUpdate>("TLUpdate");
+    visitor.template visit<TLUpdates>("TLUpdates");
+    visitor.template visit<TLUpdatesChannelDifference>("TLUpdatesChannelDifference");
+    visitor.template visit<TLUpdatesDifference>("TLUpdatesDifference");
+    // End of generated round trip cases
+}
+
+#endif // TLRANDOMVALUES_HPP
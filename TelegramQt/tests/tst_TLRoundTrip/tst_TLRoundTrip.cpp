@@ -0,0 +1,119 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "TLRandomValues.hpp"
+
+#include <QTest>
+
+static const quint32 s_roundTripSeeds = 32;
+
+template <typename T>
+static bool roundTrip(quint32 seed, QByteArray *encoded, QByteArray *reencoded, quint32 *expectedSize)
+{
+    TestRandom random(seed);
+    T value;
+    fillRandom(value, random);
+    *expectedSize = tlEncodedSize(value);
+    {
+        CTelegramStream stream(encoded, /* write */ true);
+        stream << value;
+    }
+
+    T decoded;
+    {
+        CTelegramStream stream(*encoded);
+        stream >> decoded;
+        if (stream.error() || stream.bytesAvailable()) {
+            return false;
+        }
+    }
+
+    CTelegramStream stream(reencoded, /* write */ true);
+    stream << decoded;
+    return true;
+}
+
+struct TypeCase
+{
+    const char *name;
+    bool (*roundTrip)(quint32 seed, QByteArray *encoded, QByteArray *reencoded, quint32 *expectedSize);
+};
+
+struct TypeCaseCollector
+{
+    template <typename T>
+    void visit(const char *name)
+    {
+        cases.append({ name, &roundTrip<T> });
+    }
+
+    QVector<TypeCase> cases;
+};
+
+class tst_TLRoundTrip : public QObject
+{
+    Q_OBJECT
+public:
+    explicit tst_TLRoundTrip(QObject *parent = nullptr);
+
+private slots:
+    void roundTrip_data();
+    void roundTrip();
+
+private:
+    QVector<TypeCase> m_typeCases;
+};
+
+tst_TLRoundTrip::tst_TLRoundTrip(QObject *parent) :
+    QObject(parent)
+{
+    TypeCaseCollector collector;
+    visitRoundTripTypes(collector);
+    m_typeCases = collector.cases;
+}
+
+void tst_TLRoundTrip::roundTrip_data()
+{
+    QTest::addColumn<int>("typeIndex");
+    for (int i = 0; i < m_typeCases.count(); ++i) {
+        QTest::newRow(m_typeCases.at(i).name) << i;
+    }
+}
+
+void tst_TLRoundTrip::roundTrip()
+{
+    QFETCH(int, typeIndex);
+    const TypeCase &typeCase = m_typeCases.at(typeIndex);
+
+    for (quint32 seed = 1; seed <= s_roundTripSeeds; ++seed) {
+        QByteArray encoded;
+        QByteArray reencoded;
+        quint32 expectedSize = 0;
+        const QByteArray message = QByteArrayLiteral("Seed ") + QByteArray::number(seed);
+        QVERIFY2(typeCase.roundTrip(seed, &encoded, &reencoded, &expectedSize), message.constData());
+        QVERIFY2(encoded == reencoded, message.constData());
+        // The size is computed without encoding (e.g. to reserve the output buffer)
+        QVERIFY2(quint32(encoded.size()) == expectedSize, message.constData());
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_TLRoundTrip)
+
+#include "tst_TLRoundTrip.moc"
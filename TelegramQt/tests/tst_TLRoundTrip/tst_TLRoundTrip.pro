@@ -0,0 +1,6 @@
+include(../tests.pri)
+
+TARGET = tst_TLRoundTrip
+SOURCES = tst_TLRoundTrip.cpp
+SOURCES += TLRandomValues.cpp
+HEADERS += TLRandomValues.hpp
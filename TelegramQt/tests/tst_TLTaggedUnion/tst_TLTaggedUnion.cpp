@@ -0,0 +1,755 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "CTelegramStream_p.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+#include <new>
+
+// The generator builds these types in the tagged union layout (see Generator::setTaggedUnionTypes()).
+// The shipped types use the flat layout, so the union is built next to them and checked against them.
+namespace TaggedUnion {
+
+// Generated tagged union types
+struct TLInputMedia {
+    struct InputMediaUploadedPhoto {
+        TLInputFile file;
+        QString caption;
+    };
+
+    struct InputMediaPhoto {
+        TLInputPhoto inputPhotoId;
+        QString caption;
+    };
+
+    struct InputMediaGeoPoint {
+        TLInputGeoPoint geoPoint;
+    };
+
+    struct InputMediaContact {
+        QString phoneNumber;
+        QString firstName;
+        QString lastName;
+    };
+
+    struct InputMediaUploadedVideo {
+        InputMediaUploadedVideo() :
+            duration(0),
+            w(0),
+            h(0) { }
+        TLInputFile file;
+        quint32 duration;
+        quint32 w;
+        quint32 h;
+        QString mimeType;
+        QString caption;
+    };
+
+    struct InputMediaUploadedThumbVideo {
+        InputMediaUploadedThumbVideo() :
+            duration(0),
+            w(0),
+            h(0) { }
+        TLInputFile file;
+        TLInputFile thumb;
+        quint32 duration;
+        quint32 w;
+        quint32 h;
+        QString mimeType;
+        QString caption;
+    };
+
+    struct InputMediaVideo {
+        TLInputVideo inputVideoId;
+        QString caption;
+    };
+
+    struct InputMediaUploadedAudio {
+        InputMediaUploadedAudio() :
+            duration(0) { }
+        TLInputFile file;
+        quint32 duration;
+        QString mimeType;
+    };
+
+    struct InputMediaAudio {
+        TLInputAudio inputAudioId;
+    };
+
+    struct InputMediaUploadedDocument {
+        TLInputFile file;
+        QString mimeType;
+        TLVector<TLDocumentAttribute> attributes;
+        QString caption;
+    };
+
+    struct InputMediaUploadedThumbDocument {
+        TLInputFile file;
+        TLInputFile thumb;
+        QString mimeType;
+        TLVector<TLDocumentAttribute> attributes;
+        QString caption;
+    };
+
+    struct InputMediaDocument {
+        TLInputDocument inputDocumentId;
+        QString caption;
+    };
+
+    struct InputMediaVenue {
+        TLInputGeoPoint geoPoint;
+        QString title;
+        QString address;
+        QString provider;
+        QString venueId;
+    };
+
+    struct InputMediaGifExternal {
+        QString url;
+        QString q;
+    };
+
+    TLInputMedia() :
+        tlType(TLValue::InputMediaEmpty) { construct(nullptr); }
+    TLInputMedia(const TLInputMedia &another) :
+        tlType(another.tlType) { construct(&another); }
+    ~TLInputMedia() { destroy(); }
+
+    TLInputMedia &operator=(const TLInputMedia &another) {
+        if (this != &another) {
+            destroy();
+            tlType = another.tlType;
+            construct(&another);
+        }
+        return *this;
+    }
+
+    bool isValid() const {
+        switch (tlType) {
+        case TLValue::InputMediaEmpty:
+        case TLValue::InputMediaUploadedPhoto:
+        case TLValue::InputMediaPhoto:
+        case TLValue::InputMediaGeoPoint:
+        case TLValue::InputMediaContact:
+        case TLValue::InputMediaUploadedVideo:
+        case TLValue::InputMediaUploadedThumbVideo:
+        case TLValue::InputMediaVideo:
+        case TLValue::InputMediaUploadedAudio:
+        case TLValue::InputMediaAudio:
+        case TLValue::InputMediaUploadedDocument:
+        case TLValue::InputMediaUploadedThumbDocument:
+        case TLValue::InputMediaDocument:
+        case TLValue::InputMediaVenue:
+        case TLValue::InputMediaGifExternal:
+            return true;
+        default:
+            return false;
+        };
+    }
+    void setTlType(TLValue newType) {
+        destroy();
+        tlType = newType;
+        construct(nullptr);
+    }
+
+    InputMediaUploadedPhoto &inputMediaUploadedPhoto() { Q_ASSERT(tlType == TLValue::InputMediaUploadedPhoto); return m_inputMediaUploadedPhoto; }
+    const InputMediaUploadedPhoto &inputMediaUploadedPhoto() const { Q_ASSERT(tlType == TLValue::InputMediaUploadedPhoto); return m_inputMediaUploadedPhoto; }
+    InputMediaPhoto &inputMediaPhoto() { Q_ASSERT(tlType == TLValue::InputMediaPhoto); return m_inputMediaPhoto; }
+    const InputMediaPhoto &inputMediaPhoto() const { Q_ASSERT(tlType == TLValue::InputMediaPhoto); return m_inputMediaPhoto; }
+    InputMediaGeoPoint &inputMediaGeoPoint() { Q_ASSERT(tlType == TLValue::InputMediaGeoPoint); return m_inputMediaGeoPoint; }
+    const InputMediaGeoPoint &inputMediaGeoPoint() const { Q_ASSERT(tlType == TLValue::InputMediaGeoPoint); return m_inputMediaGeoPoint; }
+    InputMediaContact &inputMediaContact() { Q_ASSERT(tlType == TLValue::InputMediaContact); return m_inputMediaContact; }
+    const InputMediaContact &inputMediaContact() const { Q_ASSERT(tlType == TLValue::InputMediaContact); return m_inputMediaContact; }
+    InputMediaUploadedVideo &inputMediaUploadedVideo() { Q_ASSERT(tlType == TLValue::InputMediaUploadedVideo); return m_inputMediaUploadedVideo; }
+    const InputMediaUploadedVideo &inputMediaUploadedVideo() const { Q_ASSERT(tlType == TLValue::InputMediaUploadedVideo); return m_inputMediaUploadedVideo; }
+    InputMediaUploadedThumbVideo &inputMediaUploadedThumbVideo() { Q_ASSERT(tlType == TLValue::InputMediaUploadedThumbVideo); return m_inputMediaUploadedThumbVideo; }
+    const InputMediaUploadedThumbVideo &inputMediaUploadedThumbVideo() const { Q_ASSERT(tlType == TLValue::InputMediaUploadedThumbVideo); return m_inputMediaUploadedThumbVideo; }
+    InputMediaVideo &inputMediaVideo() { Q_ASSERT(tlType == TLValue::InputMediaVideo); return m_inputMediaVideo; }
+    const InputMediaVideo &inputMediaVideo() const { Q_ASSERT(tlType == TLValue::InputMediaVideo); return m_inputMediaVideo; }
+    InputMediaUploadedAudio &inputMediaUploadedAudio() { Q_ASSERT(tlType == TLValue::InputMediaUploadedAudio); return m_inputMediaUploadedAudio; }
+    const InputMediaUploadedAudio &inputMediaUploadedAudio() const { Q_ASSERT(tlType == TLValue::InputMediaUploadedAudio); return m_inputMediaUploadedAudio; }
+    InputMediaAudio &inputMediaAudio() { Q_ASSERT(tlType == TLValue::InputMediaAudio); return m_inputMediaAudio; }
+    const InputMediaAudio &inputMediaAudio() const { Q_ASSERT(tlType == TLValue::InputMediaAudio); return m_inputMediaAudio; }
+    InputMediaUploadedDocument &inputMediaUploadedDocument() { Q_ASSERT(tlType == TLValue::InputMediaUploadedDocument); return m_inputMediaUploadedDocument; }
+    const InputMediaUploadedDocument &inputMediaUploadedDocument() const { Q_ASSERT(tlType == TLValue::InputMediaUploadedDocument); return m_inputMediaUploadedDocument; }
+    InputMediaUploadedThumbDocument &inputMediaUploadedThumbDocument() { Q_ASSERT(tlType == TLValue::InputMediaUploadedThumbDocument); return m_inputMediaUploadedThumbDocument; }
+    const InputMediaUploadedThumbDocument &inputMediaUploadedThumbDocument() const { Q_ASSERT(tlType == TLValue::InputMediaUploadedThumbDocument); return m_inputMediaUploadedThumbDocument; }
+    InputMediaDocument &inputMediaDocument() { Q_ASSERT(tlType == TLValue::InputMediaDocument); return m_inputMediaDocument; }
+    const InputMediaDocument &inputMediaDocument() const { Q_ASSERT(tlType == TLValue::InputMediaDocument); return m_inputMediaDocument; }
+    InputMediaVenue &inputMediaVenue() { Q_ASSERT(tlType == TLValue::InputMediaVenue); return m_inputMediaVenue; }
+    const InputMediaVenue &inputMediaVenue() const { Q_ASSERT(tlType == TLValue::InputMediaVenue); return m_inputMediaVenue; }
+    InputMediaGifExternal &inputMediaGifExternal() { Q_ASSERT(tlType == TLValue::InputMediaGifExternal); return m_inputMediaGifExternal; }
+    const InputMediaGifExternal &inputMediaGifExternal() const { Q_ASSERT(tlType == TLValue::InputMediaGifExternal); return m_inputMediaGifExternal; }
+
+    TLValue tlType; // Read-only, use setTlType() to switch the active payload
+
+protected:
+    void construct(const TLInputMedia *another) {
+        switch (tlType) {
+        case TLValue::InputMediaUploadedPhoto:
+            if (another) {
+                new (&m_inputMediaUploadedPhoto) InputMediaUploadedPhoto(another->m_inputMediaUploadedPhoto);
+            } else {
+                new (&m_inputMediaUploadedPhoto) InputMediaUploadedPhoto();
+            }
+            break;
+        case TLValue::InputMediaPhoto:
+            if (another) {
+                new (&m_inputMediaPhoto) InputMediaPhoto(another->m_inputMediaPhoto);
+            } else {
+                new (&m_inputMediaPhoto) InputMediaPhoto();
+            }
+            break;
+        case TLValue::InputMediaGeoPoint:
+            if (another) {
+                new (&m_inputMediaGeoPoint) InputMediaGeoPoint(another->m_inputMediaGeoPoint);
+            } else {
+                new (&m_inputMediaGeoPoint) InputMediaGeoPoint();
+            }
+            break;
+        case TLValue::InputMediaContact:
+            if (another) {
+                new (&m_inputMediaContact) InputMediaContact(another->m_inputMediaContact);
+            } else {
+                new (&m_inputMediaContact) InputMediaContact();
+            }
+            break;
+        case TLValue::InputMediaUploadedVideo:
+            if (another) {
+                new (&m_inputMediaUploadedVideo) InputMediaUploadedVideo(another->m_inputMediaUploadedVideo);
+            } else {
+                new (&m_inputMediaUploadedVideo) InputMediaUploadedVideo();
+            }
+            break;
+        case TLValue::InputMediaUploadedThumbVideo:
+            if (another) {
+                new (&m_inputMediaUploadedThumbVideo) InputMediaUploadedThumbVideo(another->m_inputMediaUploadedThumbVideo);
+            } else {
+                new (&m_inputMediaUploadedThumbVideo) InputMediaUploadedThumbVideo();
+            }
+            break;
+        case TLValue::InputMediaVideo:
+            if (another) {
+                new (&m_inputMediaVideo) InputMediaVideo(another->m_inputMediaVideo);
+            } else {
+                new (&m_inputMediaVideo) InputMediaVideo();
+            }
+            break;
+        case TLValue::InputMediaUploadedAudio:
+            if (another) {
+                new (&m_inputMediaUploadedAudio) InputMediaUploadedAudio(another->m_inputMediaUploadedAudio);
+            } else {
+                new (&m_inputMediaUploadedAudio) InputMediaUploadedAudio();
+            }
+            break;
+        case TLValue::InputMediaAudio:
+            if (another) {
+                new (&m_inputMediaAudio) InputMediaAudio(another->m_inputMediaAudio);
+            } else {
+                new (&m_inputMediaAudio) InputMediaAudio();
+            }
+            break;
+        case TLValue::InputMediaUploadedDocument:
+            if (another) {
+                new (&m_inputMediaUploadedDocument) InputMediaUploadedDocument(another->m_inputMediaUploadedDocument);
+            } else {
+                new (&m_inputMediaUploadedDocument) InputMediaUploadedDocument();
+            }
+            break;
+        case TLValue::InputMediaUploadedThumbDocument:
+            if (another) {
+                new (&m_inputMediaUploadedThumbDocument) InputMediaUploadedThumbDocument(another->m_inputMediaUploadedThumbDocument);
+            } else {
+                new (&m_inputMediaUploadedThumbDocument) InputMediaUploadedThumbDocument();
+            }
+            break;
+        case TLValue::InputMediaDocument:
+            if (another) {
+                new (&m_inputMediaDocument) InputMediaDocument(another->m_inputMediaDocument);
+            } else {
+                new (&m_inputMediaDocument) InputMediaDocument();
+            }
+            break;
+        case TLValue::InputMediaVenue:
+            if (another) {
+                new (&m_inputMediaVenue) InputMediaVenue(another->m_inputMediaVenue);
+            } else {
+                new (&m_inputMediaVenue) InputMediaVenue();
+            }
+            break;
+        case TLValue::InputMediaGifExternal:
+            if (another) {
+                new (&m_inputMediaGifExternal) InputMediaGifExternal(another->m_inputMediaGifExternal);
+            } else {
+                new (&m_inputMediaGifExternal) InputMediaGifExternal();
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    void destroy() {
+        switch (tlType) {
+        case TLValue::InputMediaUploadedPhoto:
+            m_inputMediaUploadedPhoto.~InputMediaUploadedPhoto();
+            break;
+        case TLValue::InputMediaPhoto:
+            m_inputMediaPhoto.~InputMediaPhoto();
+            break;
+        case TLValue::InputMediaGeoPoint:
+            m_inputMediaGeoPoint.~InputMediaGeoPoint();
+            break;
+        case TLValue::InputMediaContact:
+            m_inputMediaContact.~InputMediaContact();
+            break;
+        case TLValue::InputMediaUploadedVideo:
+            m_inputMediaUploadedVideo.~InputMediaUploadedVideo();
+            break;
+        case TLValue::InputMediaUploadedThumbVideo:
+            m_inputMediaUploadedThumbVideo.~InputMediaUploadedThumbVideo();
+            break;
+        case TLValue::InputMediaVideo:
+            m_inputMediaVideo.~InputMediaVideo();
+            break;
+        case TLValue::InputMediaUploadedAudio:
+            m_inputMediaUploadedAudio.~InputMediaUploadedAudio();
+            break;
+        case TLValue::InputMediaAudio:
+            m_inputMediaAudio.~InputMediaAudio();
+            break;
+        case TLValue::InputMediaUploadedDocument:
+            m_inputMediaUploadedDocument.~InputMediaUploadedDocument();
+            break;
+        case TLValue::InputMediaUploadedThumbDocument:
+            m_inputMediaUploadedThumbDocument.~InputMediaUploadedThumbDocument();
+            break;
+        case TLValue::InputMediaDocument:
+            m_inputMediaDocument.~InputMediaDocument();
+            break;
+        case TLValue::InputMediaVenue:
+            m_inputMediaVenue.~InputMediaVenue();
+            break;
+        case TLValue::InputMediaGifExternal:
+            m_inputMediaGifExternal.~InputMediaGifExternal();
+            break;
+        default:
+            break;
+        }
+    }
+
+    union {
+        InputMediaUploadedPhoto m_inputMediaUploadedPhoto;
+        InputMediaPhoto m_inputMediaPhoto;
+        InputMediaGeoPoint m_inputMediaGeoPoint;
+        InputMediaContact m_inputMediaContact;
+        InputMediaUploadedVideo m_inputMediaUploadedVideo;
+        InputMediaUploadedThumbVideo m_inputMediaUploadedThumbVideo;
+        InputMediaVideo m_inputMediaVideo;
+        InputMediaUploadedAudio m_inputMediaUploadedAudio;
+        InputMediaAudio m_inputMediaAudio;
+        InputMediaUploadedDocument m_inputMediaUploadedDocument;
+        InputMediaUploadedThumbDocument m_inputMediaUploadedThumbDocument;
+        InputMediaDocument m_inputMediaDocument;
+        InputMediaVenue m_inputMediaVenue;
+        InputMediaGifExternal m_inputMediaGifExternal;
+    };
+};
+
+// End of generated tagged union types
+
+// Generated tagged union operators
+CTelegramStream &operator>>(CTelegramStream &stream, TLInputMedia &inputMediaValue)
+{
+    TLValue type;
+    stream >> type;
+    inputMediaValue.setTlType(type);
+
+    switch (type) {
+    case TLValue::InputMediaUploadedPhoto: {
+        TLInputMedia::InputMediaUploadedPhoto &result = inputMediaValue.inputMediaUploadedPhoto();
+        stream >> result.file;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaPhoto: {
+        TLInputMedia::InputMediaPhoto &result = inputMediaValue.inputMediaPhoto();
+        stream >> result.inputPhotoId;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaGeoPoint: {
+        TLInputMedia::InputMediaGeoPoint &result = inputMediaValue.inputMediaGeoPoint();
+        stream >> result.geoPoint;
+        break;
+    }
+    case TLValue::InputMediaContact: {
+        TLInputMedia::InputMediaContact &result = inputMediaValue.inputMediaContact();
+        stream >> result.phoneNumber;
+        stream >> result.firstName;
+        stream >> result.lastName;
+        break;
+    }
+    case TLValue::InputMediaUploadedVideo: {
+        TLInputMedia::InputMediaUploadedVideo &result = inputMediaValue.inputMediaUploadedVideo();
+        stream >> result.file;
+        stream >> result.duration;
+        stream >> result.w;
+        stream >> result.h;
+        stream >> result.mimeType;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaUploadedThumbVideo: {
+        TLInputMedia::InputMediaUploadedThumbVideo &result = inputMediaValue.inputMediaUploadedThumbVideo();
+        stream >> result.file;
+        stream >> result.thumb;
+        stream >> result.duration;
+        stream >> result.w;
+        stream >> result.h;
+        stream >> result.mimeType;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaVideo: {
+        TLInputMedia::InputMediaVideo &result = inputMediaValue.inputMediaVideo();
+        stream >> result.inputVideoId;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaUploadedAudio: {
+        TLInputMedia::InputMediaUploadedAudio &result = inputMediaValue.inputMediaUploadedAudio();
+        stream >> result.file;
+        stream >> result.duration;
+        stream >> result.mimeType;
+        break;
+    }
+    case TLValue::InputMediaAudio: {
+        TLInputMedia::InputMediaAudio &result = inputMediaValue.inputMediaAudio();
+        stream >> result.inputAudioId;
+        break;
+    }
+    case TLValue::InputMediaUploadedDocument: {
+        TLInputMedia::InputMediaUploadedDocument &result = inputMediaValue.inputMediaUploadedDocument();
+        stream >> result.file;
+        stream >> result.mimeType;
+        stream >> result.attributes;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaUploadedThumbDocument: {
+        TLInputMedia::InputMediaUploadedThumbDocument &result = inputMediaValue.inputMediaUploadedThumbDocument();
+        stream >> result.file;
+        stream >> result.thumb;
+        stream >> result.mimeType;
+        stream >> result.attributes;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaDocument: {
+        TLInputMedia::InputMediaDocument &result = inputMediaValue.inputMediaDocument();
+        stream >> result.inputDocumentId;
+        stream >> result.caption;
+        break;
+    }
+    case TLValue::InputMediaVenue: {
+        TLInputMedia::InputMediaVenue &result = inputMediaValue.inputMediaVenue();
+        stream >> result.geoPoint;
+        stream >> result.title;
+        stream >> result.address;
+        stream >> result.provider;
+        stream >> result.venueId;
+        break;
+    }
+    case TLValue::InputMediaGifExternal: {
+        TLInputMedia::InputMediaGifExternal &result = inputMediaValue.inputMediaGifExternal();
+        stream >> result.url;
+        stream >> result.q;
+        break;
+    }
+    default:
+        break;
+    }
+
+    return stream;
+}
+
+CTelegramStream &operator<<(CTelegramStream &stream, const TLInputMedia &inputMediaValue)
+{
+    stream << inputMediaValue.tlType;
+    switch (inputMediaValue.tlType) {
+    case TLValue::InputMediaUploadedPhoto: {
+        const TLInputMedia::InputMediaUploadedPhoto &payload = inputMediaValue.inputMediaUploadedPhoto();
+        stream << payload.file;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaPhoto: {
+        const TLInputMedia::InputMediaPhoto &payload = inputMediaValue.inputMediaPhoto();
+        stream << payload.inputPhotoId;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaGeoPoint: {
+        const TLInputMedia::InputMediaGeoPoint &payload = inputMediaValue.inputMediaGeoPoint();
+        stream << payload.geoPoint;
+        break;
+    }
+    case TLValue::InputMediaContact: {
+        const TLInputMedia::InputMediaContact &payload = inputMediaValue.inputMediaContact();
+        stream << payload.phoneNumber;
+        stream << payload.firstName;
+        stream << payload.lastName;
+        break;
+    }
+    case TLValue::InputMediaUploadedVideo: {
+        const TLInputMedia::InputMediaUploadedVideo &payload = inputMediaValue.inputMediaUploadedVideo();
+        stream << payload.file;
+        stream << payload.duration;
+        stream << payload.w;
+        stream << payload.h;
+        stream << payload.mimeType;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaUploadedThumbVideo: {
+        const TLInputMedia::InputMediaUploadedThumbVideo &payload = inputMediaValue.inputMediaUploadedThumbVideo();
+        stream << payload.file;
+        stream << payload.thumb;
+        stream << payload.duration;
+        stream << payload.w;
+        stream << payload.h;
+        stream << payload.mimeType;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaVideo: {
+        const TLInputMedia::InputMediaVideo &payload = inputMediaValue.inputMediaVideo();
+        stream << payload.inputVideoId;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaUploadedAudio: {
+        const TLInputMedia::InputMediaUploadedAudio &payload = inputMediaValue.inputMediaUploadedAudio();
+        stream << payload.file;
+        stream << payload.duration;
+        stream << payload.mimeType;
+        break;
+    }
+    case TLValue::InputMediaAudio: {
+        const TLInputMedia::InputMediaAudio &payload = inputMediaValue.inputMediaAudio();
+        stream << payload.inputAudioId;
+        break;
+    }
+    case TLValue::InputMediaUploadedDocument: {
+        const TLInputMedia::InputMediaUploadedDocument &payload = inputMediaValue.inputMediaUploadedDocument();
+        stream << payload.file;
+        stream << payload.mimeType;
+        stream << payload.attributes;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaUploadedThumbDocument: {
+        const TLInputMedia::InputMediaUploadedThumbDocument &payload = inputMediaValue.inputMediaUploadedThumbDocument();
+        stream << payload.file;
+        stream << payload.thumb;
+        stream << payload.mimeType;
+        stream << payload.attributes;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaDocument: {
+        const TLInputMedia::InputMediaDocument &payload = inputMediaValue.inputMediaDocument();
+        stream << payload.inputDocumentId;
+        stream << payload.caption;
+        break;
+    }
+    case TLValue::InputMediaVenue: {
+        const TLInputMedia::InputMediaVenue &payload = inputMediaValue.inputMediaVenue();
+        stream << payload.geoPoint;
+        stream << payload.title;
+        stream << payload.address;
+        stream << payload.provider;
+        stream << payload.venueId;
+        break;
+    }
+    case TLValue::InputMediaGifExternal: {
+        const TLInputMedia::InputMediaGifExternal &payload = inputMediaValue.inputMediaGifExternal();
+        stream << payload.url;
+        stream << payload.q;
+        break;
+    }
+    default:
+        break;
+    }
+
+    return stream;
+}
+
+// End of generated tagged union operators
+
+} // TaggedUnion namespace
+
+class tst_TLTaggedUnion : public QObject
+{
+    Q_OBJECT
+private slots:
+    void payloadLifetime();
+    void roundTrip_data();
+    void roundTrip();
+
+};
+
+template <typename T>
+static QByteArray encode(const T &value)
+{
+    QByteArray result;
+    CTelegramStream stream(&result, /* write */ true);
+    stream << value;
+    return result;
+}
+
+template <typename T>
+static bool decode(const QByteArray &data, T *value)
+{
+    CTelegramStream stream(data);
+    stream >> *value;
+    return !stream.error() && !stream.bytesAvailable();
+}
+
+void tst_TLTaggedUnion::payloadLifetime()
+{
+    TaggedUnion::TLInputMedia media;
+    QCOMPARE(media.tlType, TLValue(TLValue::InputMediaEmpty));
+    QVERIFY(media.isValid());
+
+    media.setTlType(TLValue::InputMediaContact);
+    media.inputMediaContact().phoneNumber = QLatin1String("+71234567890");
+    media.inputMediaContact().firstName = QLatin1String("First");
+
+    // The payload is copied with the type
+    TaggedUnion::TLInputMedia copy = media;
+    QCOMPARE(copy.tlType, TLValue(TLValue::InputMediaContact));
+    QCOMPARE(copy.inputMediaContact().phoneNumber, QLatin1String("+71234567890"));
+
+    TaggedUnion::TLInputMedia assigned;
+    assigned.setTlType(TLValue::InputMediaGifExternal);
+    assigned.inputMediaGifExternal().url = QLatin1String("url");
+    assigned = media;
+    QCOMPARE(assigned.inputMediaContact().firstName, QLatin1String("First"));
+
+    // Switching the type resets the payload
+    media.setTlType(TLValue::InputMediaUploadedVideo);
+    QCOMPARE(media.inputMediaUploadedVideo().duration, quint32(0));
+    QVERIFY(media.inputMediaUploadedVideo().mimeType.isEmpty());
+    QCOMPARE(copy.inputMediaContact().lastName, QString());
+}
+
+void tst_TLTaggedUnion::roundTrip_data()
+{
+    QTest::addColumn<QByteArray>("encoded");
+
+    TLInputFile file;
+    file.id = 0x1122334455667788ull;
+    file.parts = 3;
+    file.name = QLatin1String("file.jpg");
+    file.md5Checksum = QLatin1String("0123456789abcdef");
+
+    TLInputFile thumb;
+    thumb.tlType = TLValue::InputFileBig;
+    thumb.id = 42;
+    thumb.parts = 1;
+    thumb.name = QLatin1String("thumb.jpg");
+
+    TLDocumentAttribute fileName;
+    fileName.tlType = TLValue::DocumentAttributeFilename;
+    fileName.fileName = QLatin1String("document.pdf");
+    TLDocumentAttribute imageSize;
+    imageSize.tlType = TLValue::DocumentAttributeImageSize;
+    imageSize.w = 640;
+    imageSize.h = 480;
+
+    TLInputMedia media;
+    QTest::newRow("empty") << encode(media);
+
+    media.tlType = TLValue::InputMediaUploadedPhoto;
+    media.file = file;
+    media.caption = QLatin1String("caption");
+    QTest::newRow("uploaded photo") << encode(media);
+
+    media = TLInputMedia();
+    media.tlType = TLValue::InputMediaContact;
+    media.phoneNumber = QLatin1String("+71234567890");
+    media.firstName = QLatin1String("First");
+    media.lastName = QLatin1String("Last");
+    QTest::newRow("contact") << encode(media);
+
+    media = TLInputMedia();
+    media.tlType = TLValue::InputMediaUploadedThumbVideo;
+    media.file = file;
+    media.thumb = thumb;
+    media.duration = 61;
+    media.w = 1280;
+    media.h = 720;
+    media.mimeType = QLatin1String("video/mp4");
+    QTest::newRow("uploaded thumb video") << encode(media);
+
+    media = TLInputMedia();
+    media.tlType = TLValue::InputMediaUploadedDocument;
+    media.file = file;
+    media.mimeType = QLatin1String("application/pdf");
+    media.attributes = { fileName, imageSize };
+    QTest::newRow("uploaded document") << encode(media);
+
+    media = TLInputMedia();
+    media.tlType = TLValue::InputMediaVenue;
+    media.geoPoint.tlType = TLValue::InputGeoPoint;
+    media.geoPoint.latitude = 55.75;
+    media.geoPoint.longitude = 37.62;
+    media.title = QLatin1String("title");
+    media.address = QLatin1String("address");
+    media.venueId = QLatin1String("venue");
+    QTest::newRow("venue") << encode(media);
+}
+
+void tst_TLTaggedUnion::roundTrip()
+{
+    QFETCH(QByteArray, encoded);
+
+    // The union reads and writes exactly the same bytes as the flat type
+    TaggedUnion::TLInputMedia unionValue;
+    QVERIFY(decode(encoded, &unionValue));
+    QVERIFY(unionValue.isValid());
+    QCOMPARE(encode(unionValue), encoded);
+
+    TLInputMedia flatValue;
+    QVERIFY(decode(encode(unionValue), &flatValue));
+    QCOMPARE(flatValue.tlType, unionValue.tlType);
+    QCOMPARE(encode(flatValue), encoded);
+
+    // A copy keeps the payload
+    const TaggedUnion::TLInputMedia copy = unionValue;
+    QCOMPARE(encode(copy), encoded);
+}
+
+QTEST_APPLESS_MAIN(tst_TLTaggedUnion)
+
+#include "tst_TLTaggedUnion.moc"
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_TLTaggedUnion
+SOURCES = tst_TLTaggedUnion.cpp
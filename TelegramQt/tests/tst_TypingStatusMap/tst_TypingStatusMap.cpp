@@ -0,0 +1,69 @@
+/*
+   Copyright (C) 2017 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include <QObject>
+
+#include "TypingStatusMap.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+class tst_TypingStatusMap : public QObject
+{
+    Q_OBJECT
+private slots:
+    void expiration();
+
+};
+
+void tst_TypingStatusMap::expiration()
+{
+    TypingStatusMap statuses;
+    QCOMPARE(statuses.nextDeadline(), qint64(-1));
+
+    statuses.insert(0, 1, TelegramNamespace::MessageActionTyping, 300);
+    statuses.insert(5, 1, TelegramNamespace::MessageActionTyping, 100);
+    statuses.insert(5, 2, TelegramNamespace::MessageActionUploadPhoto, 200);
+    QCOMPARE(statuses.count(), 3);
+    QCOMPARE(statuses.nextDeadline(), qint64(100));
+    QCOMPARE(statuses.action(5, 2), TelegramNamespace::MessageActionUploadPhoto);
+    QCOMPARE(statuses.action(0, 2), TelegramNamespace::MessageActionNone);
+
+    // Prolongation makes the previous deadline stale
+    statuses.insert(5, 1, TelegramNamespace::MessageActionTyping, 400);
+    QCOMPARE(statuses.nextDeadline(), qint64(200));
+
+    QVERIFY(statuses.remove(5, 2));
+    QVERIFY(!statuses.remove(5, 2));
+    QCOMPARE(statuses.nextDeadline(), qint64(300));
+
+    QVERIFY(statuses.takeExpired(299).isEmpty());
+
+    // Both remaining statuses expire at once
+    const QVector<TypingStatusMap::Status> expired = statuses.takeExpired(400);
+    QCOMPARE(expired.count(), 2);
+    QCOMPARE(expired.at(0).userId, quint32(1));
+    QCOMPARE(expired.at(0).chatId, quint32(0));
+    QCOMPARE(expired.at(1).chatId, quint32(5));
+    QVERIFY(statuses.isEmpty());
+    QCOMPARE(statuses.nextDeadline(), qint64(-1));
+}
+
+QTEST_APPLESS_MAIN(tst_TypingStatusMap)
+
+#include "tst_TypingStatusMap.moc"
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_TypingStatusMap
+SOURCES = tst_TypingStatusMap.cpp
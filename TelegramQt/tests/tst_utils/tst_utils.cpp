@@ -20,7 +20,9 @@
 #include "Utils.hpp"
 #include "TelegramNamespace.hpp"
 #include "RandomGenerator.hpp"
+#include "TLValues.hpp"
 
+#include <QMetaEnum>
 #include <QTest>
 #include <QDebug>
 
@@ -45,6 +47,7 @@ private slots:
     void testGzipUnpack();
     void testGzipOnDifferentDataSizes_data();
     void testGzipOnDifferentDataSizes();
+    void testTLValueNames();
 };
 
 void tst_utils::initTestCase()
@@ -68,6 +71,16 @@ void tst_utils::testAesEncryption()
     QVERIFY(!encodedData.isEmpty());
     const QByteArray decodedData = Utils::aesDecrypt(encodedData, aesKey);
     QCOMPARE(sourceData, decodedData);
+
+    // Decryption into an existing buffer reuses its allocation
+    QByteArray buffer;
+    buffer.reserve(64);
+    const char *bufferData = buffer.constData();
+    QVERIFY(Utils::aesDecrypt(encodedData, aesKey, &buffer));
+    QCOMPARE(buffer, sourceData);
+    QVERIFY(buffer.constData() == bufferData);
+    QVERIFY(!Utils::aesDecrypt(sourceData.left(15), aesKey, &buffer));
+    QVERIFY(buffer.isEmpty());
 }
 
 void tst_utils::testRsaLoad()
@@ -289,6 +302,21 @@ void tst_utils::testGzipOnDifferentDataSizes()
     QCOMPARE(unpacked.size(), dataSizeInt);
 }
 
+void tst_utils::testTLValueNames()
+{
+    const QMetaEnum enumerator = TLValue::staticMetaObject.enumerator(TLValue::staticMetaObject.indexOfEnumerator("Value"));
+    QVERIFY(enumerator.keyCount() > 0);
+    for (int i = 0; i < enumerator.keyCount(); ++i) {
+        const TLValue value(static_cast<quint32>(enumerator.value(i)));
+        QVERIFY(value.isValid());
+        QCOMPARE(value.toString(), QString::fromLatin1(enumerator.key(i)));
+    }
+
+    const TLValue unknownValue(0x12345678);
+    QVERIFY(!unknownValue.isValid());
+    QCOMPARE(unknownValue.toString(), QStringLiteral("12345678"));
+}
+
 QTEST_APPLESS_MAIN(tst_utils)
 
 #include "tst_utils.moc"
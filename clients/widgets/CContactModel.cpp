@@ -184,9 +184,31 @@ void CContactModel::addContactId(quint32 id)
     m_contacts.append(SContact());
     m_backend->getUserInfo(&m_contacts.last(), id);
     m_contacts.last().m_picture = getPeerPictureNowOrLater(peer);
+    addToIndex(m_contacts.count() - 1);
     qDebug() << Q_FUNC_INFO << peer.id << m_contacts.last().m_picture.token;
 }
 
+void CContactModel::addToIndex(int index)
+{
+    const SContact &contact = m_contacts.at(index);
+    m_idToIndex.insert(contact.id(), index);
+    const QString phone = Telegram::Utils::normalizedPhoneNumber(contact.phone());
+    if (!phone.isEmpty()) {
+        m_phoneToIndex.insert(phone, index);
+    }
+}
+
+void CContactModel::rebuildIndex()
+{
+    m_idToIndex.clear();
+    m_phoneToIndex.clear();
+    m_idToIndex.reserve(m_contacts.count());
+    m_phoneToIndex.reserve(m_contacts.count());
+    for (int i = 0; i < m_contacts.count(); ++i) {
+        addToIndex(i);
+    }
+}
+
 void CContactModel::addContact(quint32 id)
 {
     if (hasContact(id)) {
@@ -209,6 +231,7 @@ bool CContactModel::removeContact(quint32 id)
 
     beginRemoveRows(QModelIndex(), contactIndex, contactIndex);
     m_contacts.removeAt(contactIndex);
+    rebuildIndex();
     endRemoveRows();
 
     return true;
@@ -218,6 +241,11 @@ void CContactModel::setContactList(const QVector<quint32> &newContactList)
 {
     beginResetModel();
     m_contacts.clear();
+    m_idToIndex.clear();
+    m_phoneToIndex.clear();
+    m_contacts.reserve(newContactList.count());
+    m_idToIndex.reserve(newContactList.count());
+    m_phoneToIndex.reserve(newContactList.count());
     for (quint32 userId : newContactList) {
         addContactId(userId);
     }
@@ -242,6 +270,8 @@ void CContactModel::clear()
 {
     beginResetModel();
     m_contacts.clear();
+    m_idToIndex.clear();
+    m_phoneToIndex.clear();
     endResetModel();
 }
 
@@ -252,7 +282,17 @@ void CContactModel::onContactProfileChanged(quint32 id)
         return;
     }
 
+    const QString previousPhone = Telegram::Utils::normalizedPhoneNumber(m_contacts.at(index).phone());
     m_backend->getUserInfo(&m_contacts[index], id);
+    const QString phone = Telegram::Utils::normalizedPhoneNumber(m_contacts.at(index).phone());
+    if (phone != previousPhone) {
+        if (m_phoneToIndex.value(previousPhone, -1) == index) {
+            m_phoneToIndex.remove(previousPhone);
+        }
+        if (!phone.isEmpty()) {
+            m_phoneToIndex.insert(phone, index);
+        }
+    }
     QModelIndex modelIndexFirst = createIndex(index, UserName);
     QModelIndex modelIndexLast = createIndex(index, FullName);
     emit dataChanged(modelIndexFirst, modelIndexLast);
@@ -286,29 +326,17 @@ void CContactModel::updatePeerPicture(const PeerPicture &picture)
 
 int CContactModel::indexOfContact(quint32 id) const
 {
-    for (int i = 0; i < m_contacts.count(); ++i) {
-        if (m_contacts.at(i).id() == id) {
-            return i;
-        }
-    }
-
-    return -1;
+    return m_idToIndex.value(id, -1);
 }
 
 int CContactModel::indexOfContact(const QString &phone) const
 {
-    for (int i = 0; i < m_contacts.count(); ++i) {
-        if (m_contacts.at(i).phone() == phone) {
-            return i;
-        }
-    }
-
-    return -1;
+    return m_phoneToIndex.value(Telegram::Utils::normalizedPhoneNumber(phone), -1);
 }
 
 bool CContactModel::hasContact(quint32 contactId) const
 {
-    return contacts().contains(contactId);
+    return m_idToIndex.contains(contactId);
 }
 
 const SContact *CContactModel::contactAt(int index) const
@@ -20,6 +20,7 @@
 
 #include <QList>
 #include <QStringList>
+#include <QHash>
 #include <QSet>
 
 #include "CPeerModel.hpp"
@@ -97,9 +98,13 @@ protected:
 
 private:
     void addContactId(quint32 id);
+    void addToIndex(int index);
+    void rebuildIndex();
     QString contactStatusStr(const SContact &contact) const;
 
     QList<SContact> m_contacts;
+    QHash<quint32, int> m_idToIndex;
+    QHash<QString, int> m_phoneToIndex; // Normalized phone to index
 };
 
 inline int CContactModel::columnCount(const QModelIndex &parent) const
@@ -146,12 +146,7 @@ QVariant CDialogModel::data(int dialogIndex, CDialogModel::Role role) const
 
 int CDialogModel::indexOfPeer(const Telegram::Peer peer) const
 {
-    for (int i = 0; i < m_dialogs.count(); ++i) {
-        if (m_dialogs.at(i)->peer() == peer) {
-            return i;
-        }
-    }
-    return -1;
+    return m_peerToIndex.value(peer, -1);
 }
 
 void CDialogModel::setDialogs(const QVector<Telegram::Peer> &dialogs)
@@ -160,9 +155,13 @@ void CDialogModel::setDialogs(const QVector<Telegram::Peer> &dialogs)
     beginResetModel();
     qDeleteAll(m_dialogs);
     m_dialogs.clear();
+    m_peerToIndex.clear();
+    m_dialogs.reserve(dialogs.count());
+    m_peerToIndex.reserve(dialogs.count());
     for (const Telegram::Peer &peer : dialogs) {
         Telegram::DialogInfo *info = new Telegram::DialogInfo();
         m_backend->getDialogInfo(info, peer);
+        m_peerToIndex.insert(peer, m_dialogs.count());
         m_dialogs.append(info);
     }
     endResetModel();
@@ -185,6 +184,7 @@ void CDialogModel::syncDialogs(const QVector<Telegram::Peer> &added, const QVect
     for (const Telegram::Peer &peer : reallyAddedDialogs) {
         Telegram::DialogInfo *info = new Telegram::DialogInfo();
         m_backend->getDialogInfo(info, peer);
+        m_peerToIndex.insert(peer, m_dialogs.count());
         m_dialogs.append(info);
     }
     endInsertRows();
@@ -5,6 +5,8 @@
 
 #include "TelegramNamespace.hpp"
 
+#include <QHash>
+
 class CDialogModel : public CPeerModel
 {
     Q_OBJECT
@@ -63,6 +65,7 @@ protected:
 private:
     QVector<CPeerModel*> m_sourceModels;
     QVector<Telegram::DialogInfo*> m_dialogs;
+    QHash<Telegram::Peer, int> m_peerToIndex;
 
 };
 
@@ -256,16 +256,15 @@ int CMessageModel::messageIndex(quint64 messageId) const
     return -1;
 }
 
-void CMessageModel::addMessage(const SMessage &message)
+// Returns true if the message media data should be requested
+bool CMessageModel::prepareMessage(SMessage *message, Telegram::RemoteFile *fileInfo) const
 {
     Telegram::MessageMediaInfo mediaInfo;
-    Telegram::RemoteFile fileInfo;
-    SMessage processedMessage = message;
     bool needFileData = false;
-    if (message.type != TelegramNamespace::MessageTypeText) {
-        m_backend->getMessageMediaInfo(&mediaInfo, message.id, message.peer());
-        mediaInfo.getRemoteFileInfo(&fileInfo);
-        switch (message.type) {
+    if (message->type != TelegramNamespace::MessageTypeText) {
+        m_backend->getMessageMediaInfo(&mediaInfo, message->id, message->peer());
+        mediaInfo.getRemoteFileInfo(fileInfo);
+        switch (message->type) {
         case TelegramNamespace::MessageTypePhoto:
         case TelegramNamespace::MessageTypeVideo:
             needFileData = true;
@@ -277,7 +276,7 @@ void CMessageModel::addMessage(const SMessage &message)
         }
             break;
         case TelegramNamespace::MessageTypeGeo:
-            processedMessage.text = QString("%1%2, %3%4").arg(mediaInfo.latitude()).arg(QChar(0x00b0)).arg(mediaInfo.longitude()).arg(QChar(0x00b0));
+            message->text = QString("%1%2, %3%4").arg(mediaInfo.latitude()).arg(QChar(0x00b0)).arg(mediaInfo.longitude()).arg(QChar(0x00b0));
             break;
         default:
             break;
@@ -285,14 +284,33 @@ void CMessageModel::addMessage(const SMessage &message)
     }
 
     if (needFileData) {
-        const QByteArray data = m_fileManager->getData(fileInfo.getUniqueId());
+        const QByteArray data = m_fileManager->getData(fileInfo->getUniqueId());
         const QPixmap picture = QPixmap::fromImage(QImage::fromData(data));
         if (!picture.isNull()) {
-            processedMessage.mediaData = picture;
+            message->mediaData = picture;
             needFileData = false;
         }
     }
 
+    if (!message->timestamp) {
+        message->timestamp = QDateTime::currentMSecsSinceEpoch() / 1000;
+    }
+    return needFileData;
+}
+
+void CMessageModel::requestMessageFile(const SMessage &message, const Telegram::RemoteFile &fileInfo)
+{
+    const quint64 id = message.id ? message.id : message.id64;
+    const QString uniqueId = m_fileManager->requestFile(fileInfo);
+    m_fileRequests.insert(uniqueId, id);
+}
+
+void CMessageModel::addMessage(const SMessage &message)
+{
+    Telegram::RemoteFile fileInfo;
+    SMessage processedMessage = message;
+    const bool needFileData = prepareMessage(&processedMessage, &fileInfo);
+
     for (int i = 0; i < m_messages.count(); ++i) {
         if ((m_messages.at(i).id64 && (m_messages.at(i).id64 == message.id64))
                 || (!m_messages.at(i).id64 && (m_messages.at(i).id == message.id))) {
@@ -303,15 +321,57 @@ void CMessageModel::addMessage(const SMessage &message)
     }
     beginInsertRows(QModelIndex(), m_messages.count(), m_messages.count());
     m_messages.append(processedMessage);
-    if (!m_messages.last().timestamp) {
-        m_messages.last().timestamp = QDateTime::currentMSecsSinceEpoch() / 1000;
-    }
     endInsertRows();
 
     if (needFileData) {
-        const quint64 id = message.id ? message.id : message.id64;
-        const QString uniqueId = m_fileManager->requestFile(fileInfo);
-        m_fileRequests.insert(uniqueId, id);
+        requestMessageFile(processedMessage, fileInfo);
+    }
+}
+
+void CMessageModel::addMessages(const QVector<Telegram::Message> &messages)
+{
+    // Index the known (incoming, i.e. without random id) messages once for the whole chunk
+    QHash<quint32, int> knownMessages;
+    knownMessages.reserve(m_messages.count());
+    for (int i = 0; i < m_messages.count(); ++i) {
+        if (!m_messages.at(i).id64) {
+            knownMessages.insert(m_messages.at(i).id, i);
+        }
+    }
+
+    QList<SMessage> newMessages;
+    newMessages.reserve(messages.count());
+    QVector<QPair<int, Telegram::RemoteFile> > fileRequests; // Index in m_messages after the insertion
+
+    for (const Telegram::Message &message : messages) {
+        SMessage processedMessage(message);
+        Telegram::RemoteFile fileInfo;
+        const bool needFileData = prepareMessage(&processedMessage, &fileInfo);
+
+        const int existIndex = knownMessages.value(message.id, -1);
+        if (existIndex >= 0) {
+            m_messages.replace(existIndex, processedMessage);
+            emit dataChanged(index(existIndex, 0), index(existIndex, ColumnsCount - 1));
+            if (needFileData) {
+                fileRequests.append(qMakePair(existIndex, fileInfo));
+            }
+            continue;
+        }
+        knownMessages.insert(message.id, m_messages.count() + newMessages.count());
+        if (needFileData) {
+            fileRequests.append(qMakePair(m_messages.count() + newMessages.count(), fileInfo));
+        }
+        newMessages.append(processedMessage);
+    }
+
+    if (!newMessages.isEmpty()) {
+        beginInsertRows(QModelIndex(), m_messages.count(), m_messages.count() + newMessages.count() - 1);
+        m_messages.append(newMessages);
+        endInsertRows();
+    }
+
+    for (const auto &request : fileRequests) {
+        requestMessageFile(m_messages.at(request.first), request.second);
     }
 }
 
@@ -87,6 +87,7 @@ public:
 
 public slots:
     void addMessage(const SMessage &message);
+    void addMessages(const QVector<Telegram::Message> &messages);
     void onFileRequestComplete(const QString &uniqueId);
     int setMessageMediaData(quint64 messageId, const QVariant &data);
     void setMessageRead(Telegram::Peer peer, quint32 messageId, bool out);
@@ -96,6 +97,9 @@ public slots:
     void clear();
 
 private:
+    bool prepareMessage(SMessage *message, Telegram::RemoteFile *fileInfo) const;
+    void requestMessageFile(const SMessage &message, const Telegram::RemoteFile &fileInfo);
+
     CTelegramCore *m_backend;
     CFileManager *m_fileManager;
     CContactModel *m_contactsModel;
@@ -112,6 +112,7 @@ MainWindow::MainWindow(QWidget *parent) :
 
     m_core->setAppInformation(appInfo);
     m_core->setAutoReconnection(true);
+    m_core->setMessagesBatchingEnabled(true);
 
     connect(m_core, SIGNAL(connectionStateChanged(TelegramNamespace::ConnectionState)),
             SLOT(onConnectionStateChanged(TelegramNamespace::ConnectionState)));
@@ -131,6 +132,8 @@ MainWindow::MainWindow(QWidget *parent) :
             m_dialogModel, SLOT(syncDialogs(QVector<Telegram::Peer>,QVector<Telegram::Peer>)));
     connect(m_core, SIGNAL(messageReceived(Telegram::Message)),
             SLOT(onMessageReceived(Telegram::Message)));
+    connect(m_core, SIGNAL(messagesReceived(QVector<Telegram::Message>)),
+            SLOT(onMessagesReceived(QVector<Telegram::Message>)));
     connect(m_core, SIGNAL(contactChatMessageActionChanged(quint32,quint32,TelegramNamespace::MessageAction)),
             SLOT(onContactChatMessageActionChanged(quint32,quint32,TelegramNamespace::MessageAction)));
     connect(m_core, SIGNAL(contactMessageActionChanged(quint32,TelegramNamespace::MessageAction)),
@@ -312,6 +315,42 @@ void MainWindow::onMessageReceived(const Telegram::Message &message)
     }
 }
 
+void MainWindow::onMessagesReceived(const QVector<Telegram::Message> &messages)
+{
+    QVector<Telegram::Message> chatMessages;
+    QVector<Telegram::Message> contactMessages;
+    for (const Telegram::Message &message : messages) {
+        if (message.peer().type != Telegram::Peer::User) {
+            if (message.peer().id == m_activeChatId) {
+                chatMessages.append(message);
+            }
+        } else {
+            contactMessages.append(message);
+        }
+    }
+
+    if (!chatMessages.isEmpty()) {
+        m_chatMessagingModel->addMessages(chatMessages);
+    }
+    if (contactMessages.isEmpty()) {
+        return;
+    }
+    m_messagingModel->addMessages(contactMessages);
+
+    QHash<quint32, quint32> lastIncomingMessages; // Contact id to the last message id
+    for (const Telegram::Message &message : contactMessages) {
+        if (!(message.flags & TelegramNamespace::MessageFlagOut) && (m_contactLastMessageList.value(message.peer().id) < message.id)) {
+            m_contactLastMessageList.insert(message.peer().id, message.id);
+            lastIncomingMessages.insert(message.peer().id, message.id);
+        }
+    }
+    if (ui->settingsReadMessages->isChecked() && (ui->tabWidget->currentWidget() == ui->tabMessaging)) {
+        for (auto it = lastIncomingMessages.constBegin(); it != lastIncomingMessages.constEnd(); ++it) {
+            m_core->setMessageRead(it.key(), it.value());
+        }
+    }
+}
+
 void MainWindow::onContactChatMessageActionChanged(quint32 chatId, quint32 userId, TelegramNamespace::MessageAction action)
 {
     if (m_activeChatId != chatId) {
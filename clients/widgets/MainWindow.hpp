@@ -71,6 +71,7 @@ protected slots:
     void onAuthSignErrorReceived(TelegramNamespace::AuthSignError errorCode, const QString &errorMessage);
     void updateContactList();
     void onMessageReceived(const Telegram::Message &message);
+    void onMessagesReceived(const QVector<Telegram::Message> &messages);
     void onContactChatMessageActionChanged(quint32 chatId, quint32 userId, TelegramNamespace::MessageAction action);
     void onContactMessageActionChanged(quint32 userId, TelegramNamespace::MessageAction action);
     void onContactStatusChanged(quint32 contact);
@@ -24,6 +24,8 @@
 #include <QJsonObject>
 #include <QRegularExpression>
 
+#include <algorithm>
+
 #include <zlib.h>
 
 static const QString tlPrefix = QLatin1String("TL");
@@ -55,6 +57,11 @@ static const QStringList typesBlackList = QStringList()
         << tlTrueType
            ;
 
+// The types which are built in the tagged union layout for tst_TLTaggedUnion
+static const QStringList taggedUnionTestTypes = QStringList()
+        << QLatin1String("TLInputMedia")
+           ;
+
 QString ensureGoodName(const QString &name, const QVariantHash &context)
 {
     static const QStringList badNames = QStringList()
@@ -413,6 +420,133 @@ QString Generator::generateTLValuesDefinition(const TLMethod &method)
     return QString("        %1 = 0x%2,\n").arg(method.nameFirstCapital()).arg(method.id, 8, 0x10, QLatin1Char('0'));
 }
 
+// The hash functions must match the ones used for the lookup in TLValues.cpp
+static quint32 valueBucket(quint32 value, int bits)
+{
+    return (value * 0x9e3779b1u) >> (32 - bits);
+}
+
+static quint32 valueSlot(quint32 value, quint32 seed, int bits)
+{
+    return ((value ^ seed) * 0x85ebca6bu) >> (32 - bits);
+}
+
+static QString joinTableValues(const QVector<quint16> &values)
+{
+    static const int valuesPerLine = 16;
+    QString code;
+    for (int i = 0; i < values.count(); i += valuesPerLine) {
+        QStringList line;
+        for (int j = i; j < qMin(i + valuesPerLine, values.count()); ++j) {
+            line.append(values.at(j) == 0xffff ? QStringLiteral("0xffff") : QString::number(values.at(j)));
+        }
+        code.append(spacing + line.join(QLatin1String(", ")) + QLatin1String(",\n"));
+    }
+    return code;
+}
+
+QString Generator::generateTLValuesLookupTable(const QString &valuesCode)
+{
+    static const QRegularExpression valueExpr(QStringLiteral("^\\s*(\\w+) = 0x([0-9a-f]{8}),$"), QRegularExpression::MultilineOption);
+    static const quint16 invalidIndex = 0xffff;
+
+    QStringList names;
+    QVector<quint32> values;
+    QRegularExpressionMatchIterator it = valueExpr.globalMatch(valuesCode);
+    while (it.hasNext()) {
+        const QRegularExpressionMatch match = it.next();
+        names.append(match.captured(1));
+        values.append(match.captured(2).toUInt(nullptr, 16));
+    }
+    if (values.isEmpty() || (values.count() >= invalidIndex)) {
+        qWarning() << "Unexpected number of TLValues:" << values.count();
+        return QString();
+    }
+
+    // Hash and displace: the value selects a bucket and the bucket seed moves its values to the free slots.
+    int slotBits = 1;
+    while ((1 << slotBits) < values.count()) {
+        ++slotBits;
+    }
+    const int bucketBits = qMax(slotBits - 2, 1);
+
+    QVector<QVector<int>> buckets(1 << bucketBits);
+    for (int i = 0; i < values.count(); ++i) {
+        buckets[valueBucket(values.at(i), bucketBits)].append(i);
+    }
+    QVector<int> bucketOrder(buckets.count());
+    for (int i = 0; i < bucketOrder.count(); ++i) {
+        bucketOrder[i] = i;
+    }
+    // Place the biggest buckets first, while there are enough free slots
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](int left, int right) {
+        return buckets.at(left).count() > buckets.at(right).count();
+    });
+
+    QVector<quint16> seeds(buckets.count(), 0);
+    QVector<quint16> slotTable(1 << slotBits, invalidIndex);
+    foreach (int bucket, bucketOrder) {
+        const QVector<int> &items = buckets.at(bucket);
+        QVector<quint32> itemSlots;
+        bool found = items.isEmpty();
+        for (quint32 seed = 0; (seed < invalidIndex) && !found; ++seed) {
+            itemSlots.clear();
+            found = true;
+            foreach (int item, items) {
+                const quint32 slot = valueSlot(values.at(item), seed, slotBits);
+                if ((slotTable.at(slot) != invalidIndex) || itemSlots.contains(slot)) {
+                    found = false;
+                    break;
+                }
+                itemSlots.append(slot);
+            }
+            if (found) {
+                seeds[bucket] = seed;
+            }
+        }
+        if (!found) {
+            qWarning() << "Unable to build the TLValues lookup table";
+            return QString();
+        }
+        for (int i = 0; i < items.count(); ++i) {
+            slotTable[itemSlots.at(i)] = items.at(i);
+        }
+    }
+
+    QString code;
+    code.append(QString("static constexpr int s_valueBucketBits = %1;\n").arg(bucketBits));
+    code.append(QString("static constexpr int s_valueSlotBits = %1;\n\n").arg(slotBits));
+    code.append(QLatin1String("static constexpr quint16 s_valueSeeds[] = {\n"));
+    code.append(joinTableValues(seeds));
+    code.append(QLatin1String("};\n\n"));
+    code.append(QLatin1String("static constexpr quint16 s_valueSlots[] = {\n"));
+    code.append(joinTableValues(slotTable));
+    code.append(QLatin1String("};\n\n"));
+    code.append(QLatin1String("static constexpr TLValueEntry s_valueEntries[] = {\n"));
+    foreach (const QString &name, names) {
+        code.append(QString("%1{ %2::%3, \"%3\" },\n").arg(spacing, tlValueName, name));
+    }
+    code.append(QLatin1String("};\n"));
+    return code;
+}
+
+bool Generator::isHeavyType(const TLType &type)
+{
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (member.isVector()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+QString Generator::generateTLTypeSharedAlias(const TLType &type)
+{
+    return QString("using %1Shared = TLShared<%1>;\n\n").arg(type.name);
+}
+
 QString Generator::generateTLTypeDefinition(const TLType &type, bool addSpecSources)
 {
     QString code;
@@ -596,40 +730,206 @@ QStringList Generator::generateTLTypeMembers(const TLType &type)
     return membersCode;
 }
 
+static QString payloadAccessorName(const TLSubType &subType)
+{
+    QString name = subType.name;
+    name[0] = name.at(0).toLower();
+    return name;
+}
+
+static bool hasPayload(const TLSubType &subType)
+{
+    foreach (const TLParam &member, subType.members) {
+        if (!member.dependOnFlag() || (member.type() != tlTrueType)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Generator::hasTaggedUnionLayout(const TLType &type)
+{
+    // The union pays off only if there are at least two constructors with data
+    int payloads = 0;
+    foreach (const TLSubType &subType, type.subTypes) {
+        if (hasPayload(subType)) {
+            ++payloads;
+        }
+    }
+    return payloads > 1;
+}
+
+QString Generator::generateTLTypeTaggedUnionDefinition(const TLType &type)
+{
+    QString code;
+    code.append(QString("struct %1 {\n").arg(type.name));
+
+    const QString memberFlags = joinLinesWithPrepend(generateTLTypeMemberFlags(type), doubleSpacing);
+    if (!memberFlags.isEmpty()) {
+        code.append(spacing + "enum Flags {\n");
+        code.append(memberFlags);
+        code.append(spacing + "};\n\n");
+    }
+
+    QList<TLSubType> payloadTypes;
+    QString isValidTypeCode;
+    foreach (const TLSubType &subType, type.subTypes) {
+        isValidTypeCode.append(QStringLiteral("        case %1::%2:\n").arg(tlValueName, subType.name));
+        if (!hasPayload(subType)) {
+            continue;
+        }
+        payloadTypes.append(subType);
+
+        QStringList initializers;
+        QStringList getters;
+        QStringList members;
+        foreach (const TLParam &member, subType.members) {
+            if (member.dependOnFlag() && (member.type() == tlTrueType)) {
+                getters.append(QStringLiteral("bool %1() const { return %2 & %3; }").arg(member.getAlias(), member.flagMember, member.flagName()));
+                continue; // No extra data behind the flag
+            }
+            if (podTypes.contains(member.type())) {
+                initializers.append(QStringLiteral("%1(%2)").arg(member.getAlias(), initTypesValues.at(podTypes.indexOf(member.type()))));
+            }
+            if (member.accessByPointer()) {
+                if (member.isVector()) {
+                    members.append(QStringLiteral("%1<%2*> %3;").arg(tlVectorType, member.bareType(), member.getAlias()));
+                } else {
+                    members.append(QStringLiteral("%1 *%2;").arg(member.type(), member.getAlias()));
+                }
+            } else {
+                members.append(QStringLiteral("%1 %2;").arg(member.type(), member.getAlias()));
+            }
+        }
+
+        code.append(spacing + QString("struct %1 {\n").arg(subType.name));
+        if (!initializers.isEmpty()) {
+            code.append(doubleSpacing + QString("%1() :\n").arg(subType.name));
+            code.append(doubleSpacing + spacing + initializers.join(QStringLiteral(",\n") + doubleSpacing + spacing) + QLatin1String(" { }\n"));
+        }
+        code.append(joinLinesWithPrepend(getters, doubleSpacing));
+        code.append(joinLinesWithPrepend(members, doubleSpacing));
+        code.append(spacing + QLatin1String("};\n\n"));
+    }
+
+    code.append(spacing + QString("%1() :\n").arg(type.name));
+    code.append(doubleSpacing + QString("%1(%2::%3) { construct(nullptr); }\n").arg(tlTypeMember, tlValueName, type.subTypes.first().name));
+    code.append(spacing + QString("%1(const %1 &another) :\n").arg(type.name));
+    code.append(doubleSpacing + QString("%1(another.%1) { construct(&another); }\n").arg(tlTypeMember));
+    code.append(spacing + QString("~%1() { destroy(); }\n\n").arg(type.name));
+    code.append(spacing + QString("%1 &operator=(const %1 &another) {\n").arg(type.name));
+    code.append(doubleSpacing + QLatin1String("if (this != &another) {\n"));
+    code.append(doubleSpacing + spacing + QLatin1String("destroy();\n"));
+    code.append(doubleSpacing + spacing + QString("%1 = another.%1;\n").arg(tlTypeMember));
+    code.append(doubleSpacing + spacing + QLatin1String("construct(&another);\n"));
+    code.append(doubleSpacing + QLatin1String("}\n"));
+    code.append(doubleSpacing + QLatin1String("return *this;\n"));
+    code.append(spacing + QLatin1String("}\n\n"));
+
+    code.append(spacing + QStringLiteral("bool isValid() const {\n"
+                                         "        switch (tlType) {\n"));
+    code.append(isValidTypeCode);
+    code.append(QStringLiteral("            return true;\n"
+                               "        default:\n"
+                               "            return false;\n"
+                               "        };\n"
+                               "    }\n"));
+
+    code.append(spacing + QString("void setTlType(%1 newType) {\n").arg(tlValueName));
+    code.append(doubleSpacing + QLatin1String("destroy();\n"));
+    code.append(doubleSpacing + QString("%1 = newType;\n").arg(tlTypeMember));
+    code.append(doubleSpacing + QLatin1String("construct(nullptr);\n"));
+    code.append(spacing + QLatin1String("}\n\n"));
+
+    foreach (const TLSubType &subType, payloadTypes) {
+        const QString accessor = payloadAccessorName(subType);
+        const QString check = QString("Q_ASSERT(%1 == %2::%3); ").arg(tlTypeMember, tlValueName, subType.name);
+        code.append(spacing + QString("%1 &%2() { %3return m_%2; }\n").arg(subType.name, accessor, check));
+        code.append(spacing + QString("const %1 &%2() const { %3return m_%2; }\n").arg(subType.name, accessor, check));
+    }
+    code.append(QLatin1Char('\n'));
+    code.append(spacing + QString("%1 %2; // Read-only, use setTlType() to switch the active payload\n\n").arg(tlValueName, tlTypeMember));
+
+    code.append(QLatin1String("protected:\n"));
+    code.append(spacing + QString("void construct(const %1 *another) {\n").arg(type.name));
+    code.append(doubleSpacing + QString("switch (%1) {\n").arg(tlTypeMember));
+    foreach (const TLSubType &subType, payloadTypes) {
+        const QString accessor = payloadAccessorName(subType);
+        code.append(doubleSpacing + QString("case %1::%2:\n").arg(tlValueName, subType.name));
+        code.append(doubleSpacing + spacing + QLatin1String("if (another) {\n"));
+        code.append(doubleSpacing + doubleSpacing + QString("new (&m_%1) %2(another->m_%1);\n").arg(accessor, subType.name));
+        code.append(doubleSpacing + spacing + QLatin1String("} else {\n"));
+        code.append(doubleSpacing + doubleSpacing + QString("new (&m_%1) %2();\n").arg(accessor, subType.name));
+        code.append(doubleSpacing + spacing + QLatin1String("}\n"));
+        code.append(doubleSpacing + spacing + QLatin1String("break;\n"));
+    }
+    code.append(doubleSpacing + QLatin1String("default:\n"));
+    code.append(doubleSpacing + spacing + QLatin1String("break;\n"));
+    code.append(doubleSpacing + QLatin1String("}\n"));
+    code.append(spacing + QLatin1String("}\n"));
+
+    code.append(spacing + QLatin1String("void destroy() {\n"));
+    code.append(doubleSpacing + QString("switch (%1) {\n").arg(tlTypeMember));
+    foreach (const TLSubType &subType, payloadTypes) {
+        code.append(doubleSpacing + QString("case %1::%2:\n").arg(tlValueName, subType.name));
+        code.append(doubleSpacing + spacing + QString("m_%1.~%2();\n").arg(payloadAccessorName(subType), subType.name));
+        code.append(doubleSpacing + spacing + QLatin1String("break;\n"));
+    }
+    code.append(doubleSpacing + QLatin1String("default:\n"));
+    code.append(doubleSpacing + spacing + QLatin1String("break;\n"));
+    code.append(doubleSpacing + QLatin1String("}\n"));
+    code.append(spacing + QLatin1String("}\n\n"));
+
+    code.append(spacing + QLatin1String("union {\n"));
+    foreach (const TLSubType &subType, payloadTypes) {
+        code.append(doubleSpacing + QString("%1 m_%2;\n").arg(subType.name, payloadAccessorName(subType)));
+    }
+    code.append(spacing + QLatin1String("};\n"));
+    code.append(QLatin1String("};\n\n"));
+
+    return code;
+}
+
 QString Generator::streamReadImplementationHead(const QString &argName, const QString &typeName)
 {
     QString code;
     code.append(QString("%1 &%1::operator>>(%2 &%3)\n{\n").arg(streamClassName, typeName, argName));
-    code.append(QString("%1%2 result;\n\n").arg(spacing, typeName));
-    code.append(QString("%1*this >> result.tlType;\n\n%1switch (result.tlType) {\n").arg(spacing));
+    // Decode in place (the reset is cheap: the default value has no allocated members)
+    code.append(QString("%1%2 = %3();\n\n").arg(spacing, argName, typeName));
+    code.append(QString("%1*this >> %2.tlType;\n\n%1switch (%2.tlType) {\n").arg(spacing, argName));
     return code;
 }
 
 QString Generator::streamReadImplementationEnd(const QString &argName)
 {
+    Q_UNUSED(argName)
     QString code;
     code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
-    code.append(QString("%1%2 = result;\n\n%1return *this;\n}\n\n").arg(spacing, argName));
+    code.append(QString("%1return *this;\n}\n\n").arg(spacing));
     return code;
 }
 
 QString Generator::streamReadPerTypeImplementation(const QString &argName, const TLSubType &subType)
 {
-    Q_UNUSED(argName)
+    return streamReadPerTypeImplementationBase(argName, subType, QStringLiteral("*this"));
+}
+
+QString Generator::streamReadPerTypeImplementationBase(const QString &argName, const TLSubType &subType, const QString &streamGetter)
+{
     QString code;
     foreach (const TLParam &member, subType.members) {
         if (member.dependOnFlag()) {
             if (member.type() == tlTrueType) {
                 continue;
             }
-            code.append(doubleSpacing + QString("if (result.%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit));
-            code.append(doubleSpacing + spacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
+            code.append(doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(argName, member.flagMember).arg(member.flagBit));
+            code.append(doubleSpacing + spacing + streamGetter + QString(" >> %1.%2;\n").arg(argName, member.getAlias()));
             code.append(doubleSpacing + QLatin1Literal("}\n"));
         } else {
             if (member.accessByPointer() && !member.isVector()) {
-                code.append(doubleSpacing + QString("*this >> *result.%1;\n").arg(member.getAlias()));
+                code.append(doubleSpacing + streamGetter + QString(" >> *%1.%2;\n").arg(argName, member.getAlias()));
             } else {
-                code.append(doubleSpacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
+                code.append(doubleSpacing + streamGetter + QString(" >> %1.%2;\n").arg(argName, member.getAlias()));
             }
         }
     }
@@ -761,6 +1061,217 @@ QString Generator::generateStreamReadOperatorDefinition(const TLType &type)
     return generateStreamOperatorDefinition(type, streamReadImplementationHead, streamReadPerTypeImplementation, streamReadImplementationEnd);
 }
 
+QString Generator::generateStreamSkipDeclaration(const TLType &type)
+{
+    return QString("template <> void %1::skip<%2>();\n").arg(streamClassName, type.name);
+}
+
+static QStringList flagHolders(const TLType &type)
+{
+    QStringList holders;
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (member.dependOnFlag() && !holders.contains(member.flagMember)) {
+                holders.append(member.flagMember);
+            }
+        }
+    }
+    return holders;
+}
+
+QString Generator::streamSkipPerTypeImplementation(const QStringList &holders, const TLSubType &subType)
+{
+    QString code;
+    foreach (const TLParam &member, subType.members) {
+        QString skipCode;
+        if (holders.contains(member.getAlias())) {
+            // The flags are needed to skip the optional members
+            skipCode = QString("*this >> %1;\n").arg(member.getAlias());
+        } else if (member.isVector()) {
+            skipCode = QString("skipVector<%1>();\n").arg(member.bareType());
+        } else {
+            skipCode = QString("skip<%1>();\n").arg(member.bareType());
+        }
+        if (member.dependOnFlag()) {
+            if (member.type() == tlTrueType) {
+                continue;
+            }
+            code.append(doubleSpacing + QString("if (%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit));
+            code.append(doubleSpacing + spacing + skipCode);
+            code.append(doubleSpacing + QLatin1Literal("}\n"));
+        } else {
+            code.append(doubleSpacing + skipCode);
+        }
+    }
+    code.append(QString("%1break;\n").arg(doubleSpacing));
+    return code;
+}
+
+QString Generator::generateStreamSkipDefinition(const TLType &type)
+{
+    const QStringList holders = flagHolders(type);
+    const auto head = [&type, &holders](const QString &argName, const QString &typeName) {
+        Q_UNUSED(argName)
+        QString code;
+        code.append(QString("template <>\nvoid %1::skip<%2>()\n{\n").arg(streamClassName, typeName));
+        code.append(spacing + QString("%1 type;\n").arg(tlValueName));
+        code.append(spacing + QLatin1String("*this >> type;\n"));
+        foreach (const QString &holder, holders) {
+            QString holderType;
+            foreach (const TLSubType &subType, type.subTypes) {
+                foreach (const TLParam &member, subType.members) {
+                    if (member.getAlias() == holder) {
+                        holderType = member.type();
+                    }
+                }
+            }
+            code.append(spacing + QString("%1 %2 = 0;\n").arg(holderType, holder));
+        }
+        code.append(QString("\n%1switch (type) {\n").arg(spacing));
+        return code;
+    };
+    const auto perType = [&holders](const QString &argName, const TLSubType &subType) {
+        Q_UNUSED(argName)
+        return streamSkipPerTypeImplementation(holders, subType);
+    };
+    const auto end = [](const QString &argName) {
+        Q_UNUSED(argName)
+        // There is no way to know the size of an unknown constructor
+        return QString("%1default:\n%1%1setError(true);\n%1%1break;\n%1}\n}\n\n").arg(spacing);
+    };
+    return generateStreamOperatorDefinition(type, head, perType, end);
+}
+
+QString Generator::generateEncodedSizeDeclaration(const TLType &type)
+{
+    QString argName = removePrefix(type.name);
+    argName[0] = argName.at(0).toLower();
+    argName += QLatin1String("Value");
+    return QString("quint32 tlEncodedSize(const %1 &%2);\n").arg(type.name, argName);
+}
+
+QString Generator::encodedSizeImplementationHead(const QString &argName, const QString &typeName)
+{
+    QString code;
+    code.append(QString("quint32 tlEncodedSize(const %1 &%2)\n{\n").arg(typeName, argName));
+    code.append(QString("%1quint32 size = 4; // tlType\n\n%1switch (%2.tlType) {\n").arg(spacing, argName));
+    return code;
+}
+
+QString Generator::encodedSizeImplementationEnd(const QString &argName)
+{
+    Q_UNUSED(argName)
+
+    QString code;
+    code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(spacing + QLatin1String("return size;\n}\n\n"));
+    return code;
+}
+
+QString Generator::encodedSizePerTypeImplementation(const QString &argName, const TLSubType &subType)
+{
+    QString code;
+    foreach (const TLParam &member, subType.members) {
+        if (member.dependOnFlag()) {
+            if (member.type() == tlTrueType) {
+                continue;
+            }
+            code.append(doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(argName).arg(member.flagMember).arg(member.flagBit));
+            code.append(doubleSpacing + spacing + QString("size += tlEncodedSize(%1.%2);\n").arg(argName, member.getAlias()));
+            code.append(doubleSpacing + QLatin1Literal("}\n"));
+        } else {
+            if (member.accessByPointer() && !member.isVector()) {
+                code.append(doubleSpacing + QString("size += tlEncodedSize(*%1.%2);\n").arg(argName, member.getAlias()));
+            } else {
+                code.append(doubleSpacing + QString("size += tlEncodedSize(%1.%2);\n").arg(argName, member.getAlias()));
+            }
+        }
+    }
+    code.append(QString("%1break;\n").arg(doubleSpacing));
+    return code;
+}
+
+QString Generator::generateEncodedSizeDefinition(const TLType &type)
+{
+    return generateStreamOperatorDefinition(type, encodedSizeImplementationHead, encodedSizePerTypeImplementation, encodedSizeImplementationEnd);
+}
+
+QString Generator::generateEncodedSizeTaggedUnionDefinition(const TLType &type)
+{
+    QString argName = removePrefix(type.name);
+    argName[0] = argName.at(0).toLower();
+    argName += QLatin1String("Value");
+
+    QString code = encodedSizeImplementationHead(argName, type.name);
+    foreach (const TLSubType &subType, type.subTypes) {
+        if (!hasPayload(subType)) {
+            continue;
+        }
+        code.append(spacing + QString("case %1::%2: {\n").arg(tlValueName, subType.name));
+        code.append(doubleSpacing + QString("const %1::%2 &payload = %3.%4();\n").arg(type.name, subType.name, argName, payloadAccessorName(subType)));
+        code.append(encodedSizePerTypeImplementation(QStringLiteral("payload"), subType));
+        code.append(spacing + QLatin1String("}\n"));
+    }
+    code.append(encodedSizeImplementationEnd(argName));
+    return code;
+}
+
+QString Generator::generateRandomValueDeclaration(const TLType &type)
+{
+    QString argName = removePrefix(type.name);
+    argName[0] = argName.at(0).toLower();
+    argName += QLatin1String("Value");
+    return QString("void fillRandom(%1 &%2, TestRandom &random);\n").arg(type.name, argName);
+}
+
+QString Generator::randomValuePerTypeImplementation(const QString &argName, const TLSubType &subType)
+{
+    QString code;
+    foreach (const TLParam &member, subType.members) {
+        // TLTrue values have no storage and the pointers are left null
+        if ((member.type() == tlTrueType) || member.accessByPointer()) {
+            continue;
+        }
+        code.append(doubleSpacing + QString("fillRandom(%1.%2, random);\n").arg(argName, member.getAlias()));
+    }
+    code.append(QString("%1break;\n").arg(doubleSpacing));
+    return code;
+}
+
+QString Generator::generateRandomValueDefinition(const TLType &type)
+{
+    const auto head = [&type](const QString &argName, const QString &typeName) {
+        QString code;
+        code.append(QString("void fillRandom(%1 &%2, TestRandom &random)\n{\n").arg(typeName, argName));
+        code.append(spacing + QString("static const %1 types[] = {\n").arg(tlValueName));
+        foreach (const TLSubType &subType, type.subTypes) {
+            code.append(doubleSpacing + QString("%1::%2,\n").arg(tlValueName, subType.name));
+        }
+        code.append(spacing + QLatin1String("};\n"));
+        code.append(spacing + QString("%1.tlType = random.pick(types);\n\n").arg(argName));
+        code.append(spacing + QString("switch (%1.tlType) {\n").arg(argName));
+        return code;
+    };
+    const auto end = [](const QString &argName) {
+        Q_UNUSED(argName)
+        return QString("%1default:\n%1%1break;\n%1}\n}\n\n").arg(spacing);
+    };
+    return generateStreamOperatorDefinition(type, head, randomValuePerTypeImplementation, end);
+}
+
+QString Generator::generateRoundTripCase(const TLType &type)
+{
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (member.accessByPointer()) {
+                // Can not be written without the nested values
+                return QString();
+            }
+        }
+    }
+    return spacing + QString("visitor.template visit<%1>(\"%1\");\n").arg(type.name);
+}
+
 QString Generator::generateStreamReadVectorTemplate(const QString &type)
 {
     return QString(QLatin1String("template %1 &%1::operator>>(TLVector<%2> &v);")).arg(streamClassName, type);
@@ -833,18 +1344,23 @@ QString Generator::debugOperatorImplementationEnd(const QString &argName)
 QString Generator::debugOperatorPerTypeImplementation(const QString &argName, const TLSubType &subType)
 {
     Q_UNUSED(argName)
+    return debugOperatorPayloadImplementation(QStringLiteral("type"), subType);
+}
+
+QString Generator::debugOperatorPayloadImplementation(const QString &objectName, const TLSubType &subType)
+{
     QString code;
     foreach (const TLParam &member, subType.members) {
-        QString typeDebugStatement = QStringLiteral("type.%1");
+        QString typeDebugStatement = objectName + QStringLiteral(".%1");
         if (member.type().contains(QLatin1String("QByteArray"))) {
-            typeDebugStatement = QStringLiteral("type.%1.toHex()");
+            typeDebugStatement = objectName + QStringLiteral(".%1.toHex()");
         }
         typeDebugStatement = typeDebugStatement.arg(member.getAlias());
         if (member.dependOnFlag()) {
             if (member.type() == tlTrueType) {
                 continue;
             }
-            code += doubleSpacing + QString("if (type.%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit);
+            code += doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(objectName, member.flagMember).arg(member.flagBit);
             code += doubleSpacing + spacing + QString("d << spacer.innerSpaces() << \"%1: \" << %2 <<\"\\n\";\n").arg(member.getAlias(), typeDebugStatement);
             code += doubleSpacing + QLatin1Literal("}\n");
         } else {
@@ -878,6 +1394,74 @@ QString Generator::generateDebugWriteOperatorDefinition(const TLType &type)
 //    }
 }
 
+QString Generator::generateStreamReadOperatorTaggedUnionDefinition(const TLType &type, bool freeOperator)
+{
+    QString argName = removePrefix(type.name);
+    argName[0] = argName.at(0).toLower();
+    argName += QLatin1String("Value");
+
+    const QString streamGetter = freeOperator ? QStringLiteral("stream") : QStringLiteral("*this");
+    QString code;
+    if (freeOperator) {
+        code.append(QString("%1 &operator>>(%1 &stream, %2 &%3)\n{\n").arg(streamClassName, type.name, argName));
+    } else {
+        code.append(QString("%1 &%1::operator>>(%2 &%3)\n{\n").arg(streamClassName, type.name, argName));
+    }
+    code.append(spacing + QString("%1 type;\n").arg(tlValueName));
+    code.append(spacing + streamGetter + QLatin1String(" >> type;\n"));
+    code.append(spacing + QString("%1.setTlType(type);\n\n").arg(argName));
+    code.append(spacing + QLatin1String("switch (type) {\n"));
+    foreach (const TLSubType &subType, type.subTypes) {
+        if (!hasPayload(subType)) {
+            continue;
+        }
+        code.append(spacing + QString("case %1::%2: {\n").arg(tlValueName, subType.name));
+        code.append(doubleSpacing + QString("%1::%2 &result = %3.%4();\n").arg(type.name, subType.name, argName, payloadAccessorName(subType)));
+        code.append(streamReadPerTypeImplementationBase(QStringLiteral("result"), subType, streamGetter));
+        code.append(spacing + QLatin1String("}\n"));
+    }
+    code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(spacing + QString("return %1;\n}\n\n").arg(freeOperator ? QStringLiteral("stream") : QStringLiteral("*this")));
+    return code;
+}
+
+QString Generator::generateStreamWriteOperatorTaggedUnionDefinition(const TLType &type, bool freeOperator)
+{
+    QString argName = removePrefix(type.name);
+    argName[0] = argName.at(0).toLower();
+    argName += QLatin1String("Value");
+
+    QString code = freeOperator ? streamWriteFreeImplementationHead(argName, type.name) : streamWriteImplementationHead(argName, type.name);
+    const QString streamGetter = freeOperator ? QStringLiteral("stream") : QStringLiteral("*this");
+    foreach (const TLSubType &subType, type.subTypes) {
+        if (!hasPayload(subType)) {
+            continue;
+        }
+        code.append(spacing + QString("case %1::%2: {\n").arg(tlValueName, subType.name));
+        code.append(doubleSpacing + QString("const %1::%2 &payload = %3.%4();\n").arg(type.name, subType.name, argName, payloadAccessorName(subType)));
+        code.append(streamWritePerTypeImplementationBase(QStringLiteral("payload"), subType, streamGetter));
+        code.append(spacing + QLatin1String("}\n"));
+    }
+    code.append(freeOperator ? streamWriteFreeImplementationEnd(argName) : streamWriteImplementationEnd(argName));
+    return code;
+}
+
+QString Generator::generateDebugWriteOperatorTaggedUnionDefinition(const TLType &type)
+{
+    QString code = debugOperatorImplementationHead(QString(), type.name);
+    foreach (const TLSubType &subType, type.subTypes) {
+        if (!hasPayload(subType)) {
+            continue;
+        }
+        code.append(spacing + QString("case %1::%2: {\n").arg(tlValueName, subType.name));
+        code.append(doubleSpacing + QString("const %1::%2 &payload = type.%3();\n").arg(type.name, subType.name, payloadAccessorName(subType)));
+        code.append(debugOperatorPayloadImplementation(QStringLiteral("payload"), subType));
+        code.append(spacing + QLatin1String("}\n"));
+    }
+    code.append(debugOperatorImplementationEnd(QString()));
+    return code;
+}
+
 QString Generator::generateConnectionMethodDeclaration(const TLMethod &method)
 {
     return spacing + QString("quint64 %1(%2);\n").arg(method.name).arg(formatMethodParams(method));
@@ -887,7 +1471,20 @@ QString Generator::generateConnectionMethodDefinition(const TLMethod &method, QS
 {
     QString result;
     result += QString("quint64 %1::%2(%3)\n{\n").arg(methodsClassName).arg(method.name).arg(formatMethodParams(method));
+    result += spacing + QString("quint32 size = 4; // %1::%2\n").arg(tlValueName, formatName(method.name, FirstLetterCase::Upper));
+    foreach (const TLParam &param, method.params) {
+        if (param.dependOnFlag()) {
+            if (param.type() != tlTrueType) {
+                result += spacing + QString("if (%1 & 1 << %2) {\n").arg(param.flagMember).arg(param.flagBit);
+                result += spacing + spacing + QString("size += tlEncodedSize(%1);\n").arg(param.getAlias());
+                result += spacing + QLatin1String("}\n");
+            }
+        } else {
+            result += spacing + QString("size += tlEncodedSize(%1);\n").arg(param.getAlias());
+        }
+    }
     result += spacing + QLatin1String("QByteArray output;\n");
+    result += spacing + QLatin1String("output.reserve(size);\n");
     result += spacing + streamClassName + QLatin1String(" outputStream(&output, /* write */ true);\n");
 
     result += spacing + QString("outputStream << %1::%2;\n").arg(tlValueName, formatName(method.name, FirstLetterCase::Upper));
@@ -1225,7 +1822,10 @@ void Generator::getUsedAndVectorTypes(QStringList &usedTypes, QStringList &vecto
 }
 
 Generator::Generator() :
-    m_addSpecSources(false)
+    m_addSpecSources(false),
+    m_taggedUnionTypes(false),
+    m_sharedTypes(false),
+    m_layer(0)
 {
 }
 
@@ -1250,6 +1850,8 @@ enum EntryType {
 
 bool Generator::loadFromText(const QByteArray &data)
 {
+    m_layer = layerFromText(data);
+
     QTextStream input(data);
     EntryType entryType = EntryTypedef;
     m_groups.append(QStringList());
@@ -1343,6 +1945,13 @@ void Generator::generate()
     codeOfTLTypes.clear();
     codeStreamReadDeclarations.clear();
     codeStreamReadDefinitions.clear();
+    codeStreamSkipDeclarations.clear();
+    codeStreamSkipDefinitions.clear();
+    codeEncodedSizeDeclarations.clear();
+    codeEncodedSizeDefinitions.clear();
+    codeRandomValueDeclarations.clear();
+    codeRandomValueDefinitions.clear();
+    codeRoundTripCases.clear();
     codeStreamReadTemplateInstancing.clear();
     codeStreamWriteDeclarations.clear();
     codeStreamWriteDefinitions.clear();
@@ -1516,25 +2125,85 @@ void Generator::generate()
             continue;
         }
 
-        codeOfTLTypes.append(generateTLTypeDefinition(type, m_addSpecSources));
+        const bool taggedUnion = m_taggedUnionTypes && hasTaggedUnionLayout(type);
+
+        if (taggedUnion) {
+            codeOfTLTypes.append(generateTLTypeTaggedUnionDefinition(type));
+        } else {
+            codeOfTLTypes.append(generateTLTypeDefinition(type, m_addSpecSources));
+        }
+        if (m_sharedTypes && isHeavyType(type)) {
+            codeOfTLTypes.append(generateTLTypeSharedAlias(type));
+        }
 
         codeStreamReadDeclarations.append(generateStreamReadOperatorDeclaration(type));
-        codeStreamReadDefinitions.append(generateStreamReadOperatorDefinition(type));
+        if (taggedUnion) {
+            codeStreamReadDefinitions.append(generateStreamReadOperatorTaggedUnionDefinition(type, /* freeOperator */ false));
+        } else {
+            codeStreamReadDefinitions.append(generateStreamReadOperatorDefinition(type));
+        }
+        codeStreamSkipDeclarations.append(generateStreamSkipDeclaration(type));
+        codeStreamSkipDefinitions.append(generateStreamSkipDefinition(type));
+        codeEncodedSizeDeclarations.append(generateEncodedSizeDeclaration(type));
+        if (!taggedUnion) {
+            codeRandomValueDeclarations.append(generateRandomValueDeclaration(type));
+            codeRandomValueDefinitions.append(generateRandomValueDefinition(type));
+            codeRoundTripCases.append(generateRoundTripCase(type));
+        }
+        if (taggedUnion) {
+            codeEncodedSizeDefinitions.append(generateEncodedSizeTaggedUnionDefinition(type));
+        } else {
+            codeEncodedSizeDefinitions.append(generateEncodedSizeDefinition(type));
+        }
 
         if (typesUsedForWrite.contains(type.name)) {
             codeStreamWriteDeclarations.append(generateStreamWriteOperatorDeclaration(type));
-            codeStreamWriteDefinitions.append(generateStreamWriteOperatorDefinition(type));
+            if (taggedUnion) {
+                codeStreamWriteDefinitions.append(generateStreamWriteOperatorTaggedUnionDefinition(type, /* freeOperator */ false));
+            } else {
+                codeStreamWriteDefinitions.append(generateStreamWriteOperatorDefinition(type));
+            }
         } else {
             codeStreamExtraWriteDeclarations.append(generateStreamWriteFreeOperatorDeclaration(&type));
-            codeStreamExtraWriteDefinitions .append(generateStreamWriteFreeOperatorDefinition(type));
+            if (taggedUnion) {
+                codeStreamExtraWriteDefinitions.append(generateStreamWriteOperatorTaggedUnionDefinition(type, /* freeOperator */ true));
+            } else {
+                codeStreamExtraWriteDefinitions.append(generateStreamWriteFreeOperatorDefinition(type));
+            }
         }
 
         codeDebugWriteDeclarations.append(generateDebugWriteOperatorDeclaration(type));
-        codeDebugWriteDefinitions .append(generateDebugWriteOperatorDefinition(type));
+        if (taggedUnion) {
+            codeDebugWriteDefinitions.append(generateDebugWriteOperatorTaggedUnionDefinition(type));
+        } else {
+            codeDebugWriteDefinitions.append(generateDebugWriteOperatorDefinition(type));
+        }
+
+        // Build and check the union layout regardless of the option; it is compared with the flat one
+        if (taggedUnionTestTypes.contains(type.name) && hasTaggedUnionLayout(type)) {
+            codeTaggedUnionTestTypes.append(generateTLTypeTaggedUnionDefinition(type));
+            codeTaggedUnionTestOperators.append(generateStreamReadOperatorTaggedUnionDefinition(type, /* freeOperator */ true));
+            codeTaggedUnionTestOperators.append(generateStreamWriteOperatorTaggedUnionDefinition(type, /* freeOperator */ true));
+        }
     }
 
 }
 
+int Generator::layerFromText(const QByteArray &data)
+{
+    static const QByteArray layerMarker = QByteArrayLiteral("// LAYER ");
+    const int layerIndex = data.indexOf(layerMarker);
+    if (layerIndex < 0) {
+        return 0;
+    }
+    const int start = layerIndex + layerMarker.length();
+    const int end = data.indexOf('\n', start);
+    const QByteArray layerString = data.mid(start, end < 0 ? -1 : end - start).trimmed();
+    bool ok;
+    const int layer = layerString.toInt(&ok);
+    return ok ? layer : 0;
+}
+
 QByteArray Generator::getPredicateForCrc32(const QByteArray &sourceLine)
 {
     static const QRegularExpression expr("([a-zA-Z\\.0-9_]+)(#[0-9a-f]+)?([^=]*)=\\s*([a-zA-Z\\.<>0-9_]+);");
@@ -1649,6 +2318,16 @@ void Generator::setAddSpecSources(bool addSources)
     m_addSpecSources = addSources;
 }
 
+void Generator::setTaggedUnionTypes(bool enable)
+{
+    m_taggedUnionTypes = enable;
+}
+
+void Generator::setSharedTypes(bool enable)
+{
+    m_sharedTypes = enable;
+}
+
 QString Generator::removeWord(QString input, QString word)
 {
     if (input.isEmpty()) {
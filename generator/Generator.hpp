@@ -146,25 +146,38 @@ public:
     static QByteArray getPredicateForCrc32(const QByteArray &sourceLine);
     static quint32 getCrc32(const QByteArray &bytes);
     static LineParseResult parseLine(const QString &line);
+    static int layerFromText(const QByteArray &data);
 
+    int layer() const { return m_layer; }
     QMap<QString, TLType> types() const { return m_types; }
     QList<TLType> solvedTypes() const { return m_solvedTypes; }
     QMap<QString, TLMethod> functions() const { return m_functions; }
     QVector<QStringList> groups() const { return m_groups; }
 
     void setAddSpecSources(bool addSources);
+    // Emit the types with several data constructors as a tagged union (one payload struct per constructor)
+    void setTaggedUnionTypes(bool enable);
+    // Add TLShared aliases (e.g. TLMessagesMessagesShared) for the types with vector members
+    void setSharedTypes(bool enable);
 
     static QString removeWord(QString input, QString word);
     static QString generateTLValuesDefinition(const TLType &type);
     static QString generateTLValuesDefinition(const TLMethod &method);
+    // Perfect hash from the TLValues (given as the enum code) to the names
+    static QString generateTLValuesLookupTable(const QString &valuesCode);
     static QString generateTLTypeDefinition(const TLType &type, bool addSpecSources = false);
     static QStringList generateTLTypeMemberFlags(const TLType &type);
     static QStringList generateTLTypeMemberGetters(const TLType &type);
     static QStringList generateTLTypeMembers(const TLType &type);
+    static bool hasTaggedUnionLayout(const TLType &type);
+    static QString generateTLTypeTaggedUnionDefinition(const TLType &type);
+    static bool isHeavyType(const TLType &type);
+    static QString generateTLTypeSharedAlias(const TLType &type);
 
     static QString streamReadImplementationHead(const QString &argName, const QString &typeName);
     static QString streamReadImplementationEnd(const QString &argName);
     static QString streamReadPerTypeImplementation(const QString &argName, const TLSubType &subType);
+    static QString streamReadPerTypeImplementationBase(const QString &argName, const TLSubType &subType, const QString &streamGetter);
 
     static QString streamWriteImplementationHead(const QString &argName, const QString &typeName);
     static QString streamWriteFreeImplementationHead(const QString &argName, const QString &typeName);
@@ -183,18 +196,38 @@ public:
     static QString generateStreamReadFreeOperatorDeclaration(const NameWithEntityType *type);
     static QString generateStreamReadOperatorDefinition(const TLType &type);
     static QString generateStreamReadVectorTemplate(const QString &type);
+    static QString generateStreamSkipDeclaration(const TLType &type);
+    static QString streamSkipPerTypeImplementation(const QStringList &holders, const TLSubType &subType);
+    static QString generateStreamSkipDefinition(const TLType &type);
+
+    static QString generateEncodedSizeDeclaration(const TLType &type);
+    static QString encodedSizeImplementationHead(const QString &argName, const QString &typeName);
+    static QString encodedSizeImplementationEnd(const QString &argName);
+    static QString encodedSizePerTypeImplementation(const QString &argName, const TLSubType &subType);
+    static QString generateEncodedSizeDefinition(const TLType &type);
+    static QString generateEncodedSizeTaggedUnionDefinition(const TLType &type);
+
+    // Random values and round trip cases for tst_TLRoundTrip and bench_TLRoundTrip
+    static QString generateRandomValueDeclaration(const TLType &type);
+    static QString randomValuePerTypeImplementation(const QString &argName, const TLSubType &subType);
+    static QString generateRandomValueDefinition(const TLType &type);
+    static QString generateRoundTripCase(const TLType &type);
     static QString generateStreamWriteOperatorDeclaration(const TLType &type);
     static QString generateStreamWriteFreeOperatorDeclaration(const NameWithEntityType *type);
     static QString generateStreamWriteOperatorDefinition(const TLType &type);
     static QString generateStreamWriteFreeOperatorDefinition(const TLType &type);
     static QString generateStreamWriteVectorTemplate(const QString &type);
     static QString generateStreamWriteFreeVectorTemplate(const QString &type);
+    static QString generateStreamReadOperatorTaggedUnionDefinition(const TLType &type, bool freeOperator);
+    static QString generateStreamWriteOperatorTaggedUnionDefinition(const TLType &type, bool freeOperator);
 
     static QString generateDebugWriteOperatorDeclaration(const TLType &type);
     static QString debugOperatorImplementationHead(const QString &argName, const QString &typeName);
     static QString debugOperatorImplementationEnd(const QString &argName);
     static QString debugOperatorPerTypeImplementation(const QString &argName, const TLSubType &subType);
+    static QString debugOperatorPayloadImplementation(const QString &objectName, const TLSubType &subType);
     static QString generateDebugWriteOperatorDefinition(const TLType &type);
+    static QString generateDebugWriteOperatorTaggedUnionDefinition(const TLType &type);
 
     static QString generateConnectionMethodDeclaration(const TLMethod &method);
     static QString generateConnectionMethodDefinition(const TLMethod &method, QStringList &usedTypes);
@@ -215,6 +248,16 @@ public:
     QString codeStreamReadDeclarations;
     QString codeStreamReadDefinitions;
     QString codeStreamReadTemplateInstancing;
+    QString codeStreamSkipDeclarations;
+    QString codeStreamSkipDefinitions;
+    QString codeEncodedSizeDeclarations;
+    QString codeEncodedSizeDefinitions;
+    QString codeRandomValueDeclarations;
+    QString codeRandomValueDefinitions;
+    QString codeRoundTripCases;
+    // The tagged union layout (and free operators) of a few types for tst_TLTaggedUnion
+    QString codeTaggedUnionTestTypes;
+    QString codeTaggedUnionTestOperators;
     QString codeStreamWriteDeclarations;
     QString codeStreamWriteDefinitions;
     QString codeStreamWriteTemplateInstancing;
@@ -240,6 +283,9 @@ private:
     QMap<QString, TLMethod> m_functions;
     QVector<QStringList> m_groups;
     bool m_addSpecSources;
+    bool m_taggedUnionTypes;
+    bool m_sharedTypes;
+    int m_layer;
 };
 
 #endif // GENERATORNG_HPP
@@ -46,8 +46,9 @@ enum SchemaFormat {
 static bool s_dryRun = false;
 static bool s_dump = true;
 static bool s_addSpecSources = false;
+static bool s_taggedUnionTypes = false;
+static bool s_sharedTypes = false;
 
-static const QByteArray c_textLayerMarker = QByteArrayLiteral("// LAYER ");
 
 static QString s_inputDir;
 static QString s_outputDir;
@@ -307,17 +308,9 @@ StatusCode fetchText(const QString &url, QString *output)
         return ServerError;
     }
 
-    int layerIndex = data.indexOf(c_textLayerMarker);
-    if (layerIndex < 0) {
-        qWarning() << "No layer marker";
-        return SchemaReadError;
-    }
-    bool ok;
-    QByteArray mid = data.mid(layerIndex + c_textLayerMarker.length());
-    mid = mid.trimmed();
-    int layer = mid.toInt(&ok);
-    if (!ok) {
-        qWarning() << "No layer version in data" << mid;
+    const int layer = Generator::layerFromText(data);
+    if (!layer) {
+        qWarning() << "No layer marker or version in data";
         return SchemaReadError;
     }
 
@@ -377,6 +370,8 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
 
     Generator generator;
     generator.setAddSpecSources(s_addSpecSources);
+    generator.setTaggedUnionTypes(s_taggedUnionTypes);
+    generator.setSharedTypes(s_sharedTypes);
 
     bool success = true;
 
@@ -416,11 +411,24 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
                                                                           QStringLiteral("Telegram API RPC process implementation")));
     generator.generate();
 
+    if (generator.layer()) {
+        replacingHelper(QLatin1String("TLValues.hpp"), 4, QLatin1String("layer"),
+                        QStringLiteral("    static constexpr quint32 CurrentLayer = %1;\n").arg(generator.layer()));
+    } else {
+        qWarning() << "The schema has no layer marker, TLValue::CurrentLayer is not updated";
+    }
     replacingHelper(QLatin1String("TLValues.hpp"), 8, QLatin1String("TLValues"), generator.codeOfTLValues);
+    const QString protoValues = getGeneratedContent(QStringLiteral("TLValues.hpp"), 8, QLatin1String("TLValues (proto)"));
+    replacingHelper(QLatin1String("TLValues.cpp"), 0, QLatin1String("TLValues lookup table"),
+                    Generator::generateTLValuesLookupTable(protoValues + generator.codeOfTLValues));
     replacingHelper(QLatin1String("TLTypes.hpp"), 0, QLatin1String("TLTypes"), generator.codeOfTLTypes);
     replacingHelper(QLatin1String("CTelegramStream.hpp"), 4, QLatin1String("read operators"), generator.codeStreamReadDeclarations);
     replacingHelper(QLatin1String("CTelegramStream.cpp"), 0, QLatin1String("read operators implementation"), generator.codeStreamReadDefinitions);
     replacingHelper(QLatin1String("CTelegramStream.cpp"), 0, QLatin1String("vector read templates instancing"), generator.codeStreamReadTemplateInstancing);
+    replacingHelper(QLatin1String("CTelegramStream.hpp"), 0, QLatin1String("skip declarations"), generator.codeStreamSkipDeclarations);
+    replacingHelper(QLatin1String("CTelegramStream.cpp"), 0, QLatin1String("skip implementation"), generator.codeStreamSkipDefinitions);
+    replacingHelper(QLatin1String("CTelegramStream.hpp"), 0, QLatin1String("encoded size declarations"), generator.codeEncodedSizeDeclarations);
+    replacingHelper(QLatin1String("CTelegramStream.cpp"), 0, QLatin1String("encoded size implementation"), generator.codeEncodedSizeDefinitions);
     replacingHelper(QLatin1String("CTelegramStream.hpp"), 4, QLatin1String("write operators"), generator.codeStreamWriteDeclarations);
     replacingHelper(QLatin1String("CTelegramStream.cpp"), 0, QLatin1String("write operators implementation"), generator.codeStreamWriteDefinitions);
     replacingHelper(QLatin1String("CTelegramStream.cpp"), 0, QLatin1String("vector write templates instancing"), generator.codeStreamWriteTemplateInstancing);
@@ -428,6 +436,13 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
     replacingHelper(QLatin1String("CTelegramStreamExtraOperators.hpp"), 0, QLatin1String("write operators"), generator.codeStreamExtraWriteDeclarations);
     replacingHelper(QLatin1String("CTelegramStreamExtraOperators.cpp"), 0, QLatin1String("write operators implementation"), generator.codeStreamExtraWriteDefinitions);
 
+    replacingHelper(QLatin1String("tests/tst_TLRoundTrip/TLRandomValues.hpp"), 0, QLatin1String("random value declarations"), generator.codeRandomValueDeclarations);
+    replacingHelper(QLatin1String("tests/tst_TLRoundTrip/TLRandomValues.cpp"), 0, QLatin1String("random value implementation"), generator.codeRandomValueDefinitions);
+    replacingHelper(QLatin1String("tests/tst_TLRoundTrip/TLRandomValues.hpp"), 4, QLatin1String("round trip cases"), generator.codeRoundTripCases);
+
+    replacingHelper(QLatin1String("tests/tst_TLTaggedUnion/tst_TLTaggedUnion.cpp"), 0, QLatin1String("tagged union types"), generator.codeTaggedUnionTestTypes);
+    replacingHelper(QLatin1String("tests/tst_TLTaggedUnion/tst_TLTaggedUnion.cpp"), 0, QLatin1String("tagged union operators"), generator.codeTaggedUnionTestOperators);
+
     replacingHelper(QLatin1String("CTelegramConnection.hpp"), 4, QLatin1String("Telegram API methods declaration"), generator.codeConnectionDeclarations);
     replacingHelper(QLatin1String("CTelegramConnection.cpp"), 0, QLatin1String("Telegram API methods implementation"), generator.codeConnectionDefinitions);
 
@@ -476,6 +491,12 @@ int main(int argc, char *argv[])
     QCommandLineOption addSpecSourcesOption(QStringLiteral("add-spec-sources"));
     parser.addOption(addSpecSourcesOption);
 
+    QCommandLineOption taggedUnionsOption(QStringLiteral("tagged-unions"));
+    parser.addOption(taggedUnionsOption);
+
+    QCommandLineOption sharedTypesOption(QStringLiteral("shared-types"));
+    parser.addOption(sharedTypesOption);
+
     QCommandLineOption fetchTextOption(QStringLiteral("fetch-text"));
     fetchTextOption.setValueName(QStringLiteral("url"));
     parser.addOption(fetchTextOption);
@@ -503,6 +524,8 @@ int main(int argc, char *argv[])
     s_dryRun = parser.isSet(dryRunOption);
     s_dump = parser.isSet(dumpOption);
     s_addSpecSources = parser.isSet(addSpecSourcesOption);
+    s_taggedUnionTypes = parser.isSet(taggedUnionsOption);
+    s_sharedTypes = parser.isSet(sharedTypesOption);
     s_inputDir = parser.value(inputDirOption);
     if (s_inputDir.isEmpty()) {
         s_inputDir = QStringLiteral("./");
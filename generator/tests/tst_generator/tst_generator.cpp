@@ -86,6 +86,9 @@ private slots:
     void checkTypeWithMemberConflicts();
     void recursiveTypeMembers();
     void doubleRecursiveTypeMembers();
+    void taggedUnionType();
+    void layerFromText();
+    void sharedTypes();
 };
 
 tst_Generator::tst_Generator(QObject *parent) :
@@ -235,6 +238,82 @@ void tst_Generator::doubleRecursiveTypeMembers()
     }
 }
 
+void tst_Generator::taggedUnionType()
+{
+    const QStringList sources = c_sourcesInputMediaDeps + c_sourcesInputMedia;
+    const QString generatedTypeName = Generator::parseLine(c_sourcesInputMedia.first()).typeName;
+    const QByteArray textData = generateTextSpec(sources);
+    Generator generator;
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+    const TLType solvedType = getSolvedType(generator, generatedTypeName);
+    QVERIFY(!solvedType.name.isEmpty());
+    QVERIFY(Generator::hasTaggedUnionLayout(solvedType));
+    QVERIFY(!Generator::hasTaggedUnionLayout(getSolvedType(generator, QStringLiteral("InputPhoto"))));
+
+    const QString definition = Generator::generateTLTypeTaggedUnionDefinition(solvedType);
+    static const QStringList checkList = {
+        QStringLiteral("    struct InputMediaUploadedPhoto {\n"
+                       "        TLInputFile file;\n"
+                       "        QString caption;\n"
+                       "    };\n"),
+        QStringLiteral("    struct InputMediaUploadedAudio {\n"
+                       "        InputMediaUploadedAudio() :\n"
+                       "            duration(0) { }\n"),
+        QStringLiteral("TLInputVideo inputVideoId;"),
+        QStringLiteral("InputMediaVideo &inputMediaVideo() { Q_ASSERT(tlType == TLValue::InputMediaVideo); return m_inputMediaVideo; }"),
+        QStringLiteral("void setTlType(TLValue newType) {"),
+        QStringLiteral("        InputMediaDocument m_inputMediaDocument;\n"),
+    };
+    for (const QString &mustHaveCode : checkList) {
+        if (!definition.contains(mustHaveCode)) {
+            QString message = QStringLiteral("The code \"%1\" is missing in the generated union of the type %2.").arg(mustHaveCode, generatedTypeName);
+            QFAIL(message.toUtf8().constData());
+        }
+    }
+    // The empty constructor has no payload
+    QVERIFY(!definition.contains(QStringLiteral("struct InputMediaEmpty")));
+
+    const QString readOperator = Generator::generateStreamReadOperatorTaggedUnionDefinition(solvedType, /* freeOperator */ false);
+    QVERIFY(readOperator.contains(QStringLiteral("    inputMediaValue.setTlType(type);\n")));
+    QVERIFY(readOperator.contains(QStringLiteral("        TLInputMedia::InputMediaContact &result = inputMediaValue.inputMediaContact();\n"
+                                                 "        *this >> result.phoneNumber;\n")));
+
+    // The free operators are used by tst_TLTaggedUnion to build the union next to the flat type
+    const QString freeReadOperator = Generator::generateStreamReadOperatorTaggedUnionDefinition(solvedType, /* freeOperator */ true);
+    QVERIFY(freeReadOperator.startsWith(QStringLiteral("CTelegramStream &operator>>(CTelegramStream &stream, TLInputMedia &inputMediaValue)\n")));
+    QVERIFY(freeReadOperator.contains(QStringLiteral("        stream >> result.phoneNumber;\n")));
+    QVERIFY(freeReadOperator.endsWith(QStringLiteral("    return stream;\n}\n\n")));
+}
+
+void tst_Generator::layerFromText()
+{
+    const QByteArray textData = generateTextSpec(c_sourcesInputMediaDeps);
+    QCOMPARE(Generator::layerFromText(textData), 0);
+    QCOMPARE(Generator::layerFromText(textData + "// LAYER 45\n"), 45);
+    QCOMPARE(Generator::layerFromText(textData + "// LAYER 72"), 72);
+    QCOMPARE(Generator::layerFromText(textData + "// LAYER abc\n"), 0);
+
+    Generator generator;
+    QVERIFY(generator.loadFromText(textData + "\n// LAYER 53\n"));
+    QCOMPARE(generator.layer(), 53);
+}
+
+void tst_Generator::sharedTypes()
+{
+    const QStringList sources = c_sourcesInputMediaDeps + c_sourcesInputMedia;
+    const QByteArray textData = generateTextSpec(sources);
+    Generator generator;
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+
+    const TLType inputMedia = getSolvedType(generator, Generator::parseLine(c_sourcesInputMedia.first()).typeName);
+    QVERIFY(!inputMedia.name.isEmpty());
+    QVERIFY(Generator::isHeavyType(inputMedia));
+    QVERIFY(!Generator::isHeavyType(getSolvedType(generator, QStringLiteral("InputPhoto"))));
+    QCOMPARE(Generator::generateTLTypeSharedAlias(inputMedia), QStringLiteral("using TLInputMediaShared = TLShared<TLInputMedia>;\n\n"));
+}
+
 QTEST_APPLESS_MAIN(tst_Generator)
 
 #include "tst_generator.moc"